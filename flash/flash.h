@@ -25,6 +25,12 @@
 
 #define FLASH_PAGE_SIZE 256
 
+/* Pages in a sector, the unit flash_erase_sector() erases. */
+#define FLASH_SECTOR_PAGES 256
+
+/* First page of the TLE file sent by the host, see pccomms mode1. */
+#define FLASH_BASE_TLE_FILE 10
+
 #define FLASH_WIP_TEST_TIME 2
 
 #define FLASH_WREN      0x06
@@ -39,6 +39,8 @@ bool flash_sector_erase_in_progress(void) {
 }
 
 /** flash_erase_sector
+ *
+ * @param int sector The sector number, FLASH_SECTOR_PAGES pages each.
  */
 int flash_erase_sector(int sector) {
 
@@ -74,6 +76,8 @@ int flash_erase_sector(int sector) {
 
     SSP0_FLUSH_RX_FIFO;
     
+    /* The command takes the page address of any page in the sector. */
+    sector *= FLASH_SECTOR_PAGES;
     FLASH_CS_ASSERT;
     FLASH_LONG_COMMAND(FLASH_SE, sector);
     FLASH_CS_DEASSERT;
@@ -103,8 +103,14 @@
 #define SET_P2_04      (LPC_GPIO2->FIOSET = (1UL << 4))
 #define CLR_P2_04      (LPC_GPIO2->FIOCLR = (1UL << 4))
 #define VAL_P2_04      (LPC_GPIO2->FIOPIN & (1UL << 4))
+#ifdef SOWB_HOST
+/* See SOWB_HOST in host/Makefile. */
+#define P22_ASSERT
+#define P22_DEASSERT
+#else
 #define P22_ASSERT     SET_P2_04
 #define P22_DEASSERT   CLR_P2_04
+#endif
 #define P22_VALUE      VAL_P2_04
 #define P22_TOGGLE     P22_VALUE ? P22_DEASSERT : P22_ASSERT
 
@@ -0,0 +1,118 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for nexstar_align_select(). Through a night at the
+   St Andrews site, every half hour, it brings the star engine up to 
+   date and asks for two and three alignment stars with the mount 
+   parked at azimuth 0, elevation 0. It prints the stars, their least
+   separation in azimuth, the slew in the order proposed against the
+   worst order of the same stars, and the time a selection takes. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "nexstar.h"
+#include "star.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+#define BENCH_STEP          1800.       /* Seconds. */
+#define BENCH_SPAN          (12. * 3600.)
+#define BENCH_REPEAT        200
+
+/** bench_route
+ *
+ * @return double Seconds to slew from the park through stars in an order.
+ */
+static double bench_route(NEXSTAR_ALIGN_STAR *a, const int *order, int n) {
+    double t = 0., el = 0., az = 0.;
+    int i;
+    
+    for (i = 0; i < n; i++) {
+        t += bench_slew(el, az, a[order[i]].elevation, a[order[i]].azimuth);
+        el = a[order[i]].elevation; az = a[order[i]].azimuth;
+    }
+    return t;
+}
+
+int main(void) {
+    static const int orders[6][3] = { {0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0} };
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    NEXSTAR_ALIGN_STAR a[NEXSTAR_ALIGN_MAX];
+    basicStarData s;
+    double jd0, jd, d, t0, elapsed = 0., slew, worst, gap, g;
+    char h[16];
+    int i, j, k, n, want, calls = 0;
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 5; t.hour = 18; t.is_valid = 1;
+    host_set_time(&t);
+    jd0 = gps_julian_date(&t);
+    satapi_stars_start(SAT_STARS_MIN_EL, SAT_STARS_MAX_MAG);
+    
+    printf("%-5s %s\n", "UT", "stars (HR mag az el), least az gap, slew proposed/worst order, s");
+    for (d = 0.; d <= BENCH_SPAN; d += BENCH_STEP) {
+        bench_time(jd0 + d / 86400., &t);
+        host_set_time(&t);
+        jd = gps_julian_date(&t);
+        do satapi_stars_process(); while (satapi_stars_jd() != jd);
+        
+        for (want = 2; want <= 3; want++) {
+            t0 = host_seconds();
+            for (i = 0; i < BENCH_REPEAT; i++) n = nexstar_align_select(0., 0., want, a);
+            elapsed += host_seconds() - t0;
+            calls += BENCH_REPEAT;
+            
+            sprintf(h, "%02d:%02d", t.hour, t.minute);
+            printf("%-5s", want == 2 ? h : "");
+            gap = 360.;
+            for (i = 0; i < n; i++) {
+                get_bright_star(a[i].star, &s);
+                printf(" HR%-4d %.1f %3.0f %2.0f,", s.hr, s.mag, a[i].azimuth, a[i].elevation);
+                for (j = i + 1; j < n; j++) {
+                    g = fabs(a[i].azimuth - a[j].azimuth);
+                    if (g > 180.) g = 360. - g;
+                    if (g < gap) gap = g;
+                }
+            }
+            
+            slew = 0.;
+            for (i = 0; i < n; i++) slew += a[i].slew;
+            worst = 0.;
+            for (k = 0; k < 6; k++) {
+                for (i = 0; i < n && orders[k][i] < n; i++) ;
+                if (i < n) continue;
+                g = bench_route(a, orders[k], n);
+                if (g > worst) worst = g;
+            }
+            printf(" %3.0f, %3.0f/%3.0f\n", gap, slew, worst);
+        }
+    }
+    printf("selection %.1f us\n", elapsed * 1E6 / calls);
+    return 0;
+}
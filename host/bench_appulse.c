@@ -0,0 +1,202 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for satapi_appulse(). For three days of passes of 
+   the ISS it finds the appulses with bright stars and checks them 
+   against a scan of the whole catalog along the propagated track, 
+   every second and then every hundredth of a second around each 
+   closest approach. It prints the appulses, any the scan finds that 
+   satapi_appulse() does not (or the other way round, or twice), the
+   worst differences in time and separation and the time taken per 
+   pass. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "star.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+static const char *bench_elements[3] = {
+    "ISS (ZARYA)",
+    "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147",
+    "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777"
+};
+
+#define BENCH_SPAN          (3. * 86400.)
+#define BENCH_MIN_EL        10.
+#define BENCH_MAX_SEP       30.     /* Arc minutes. */
+#define BENCH_MAX_MAG       5.0
+#define BENCH_STARS         10000
+#define BENCH_FOUND         64
+#define BENCH_REPEAT        20
+
+static SAT_POS_DATA q;
+static vector_t bench_star[BENCH_STARS];
+static double bench_best[BENCH_STARS], bench_when[BENCH_STARS];
+
+/** bench_direction
+ *
+ * The unit vector from the observer to the satellite at t.
+ */
+static void bench_direction(double t, vector_t *u) {
+    obs_frame_t frame;
+    
+    satapi_observer_frame(&q.location, q.jd_utc + t / 86400., &frame);
+    satapi_observe(&q, &frame, 0);
+    Vec_Sub(&q.pos, &frame.pos, u);
+    Normalize(u);
+}
+
+/** bench_catalog
+ *
+ * Every star of the catalog bright enough as a unit vector of date,
+ * precessed with the rigorous formulae of Meeus, Astronomical 
+ * Algorithms ch. 21, rather than a rotation matrix.
+ *
+ * @return int The number of catalog entries.
+ */
+static int bench_catalog(double jd) {
+    basicStarData bright, *s;
+    double t, zeta, z, theta, a, b, c, ra, dec;
+    int i;
+    
+    t = (jd - 2451545.0) / 36525.;
+    zeta  = (2306.2181 + (0.30188 + 0.017998 * t) * t) * t / 3600. * de2ra;
+    z     = (2306.2181 + (1.09468 + 0.018203 * t) * t) * t / 3600. * de2ra;
+    theta = (2004.3109 - (0.42665 + 0.041833 * t) * t) * t / 3600. * de2ra;
+    
+    for (i = 0; (s = get_bright_star(i, &bright)) != NULL && i < BENCH_STARS; i++) {
+        bench_star[i].x = bench_star[i].y = bench_star[i].z = 0.;
+        if (s->mag > BENCH_MAX_MAG) continue;
+        ra = s->ra * de2ra; dec = s->dec * de2ra;
+        a = cos(dec) * sin(ra + zeta);
+        b = cos(theta) * cos(dec) * cos(ra + zeta) - sin(theta) * sin(dec);
+        c = sin(theta) * cos(dec) * cos(ra + zeta) + cos(theta) * sin(dec);
+        ra = atan2(a, b) + z;
+        dec = asin(c);
+        bench_star[i].x = cos(dec) * cos(ra);
+        bench_star[i].y = cos(dec) * sin(ra);
+        bench_star[i].z = sin(dec);
+    }
+    return i;
+}
+
+/** bench_scan
+ *
+ * The closest approach of the pass to every star, found by a scan.
+ */
+static void bench_scan(SAT_PASS *pass, int stars) {
+    vector_t u;
+    double t, d, lo, hi;
+    int i;
+    
+    for (i = 0; i < stars; i++) bench_best[i] = -2.;
+    for (t = pass->aos; t <= pass->los; t += 1.) {
+        bench_direction(t, &u);
+        for (i = 0; i < stars; i++) {
+            d = Dot(&u, &bench_star[i]);
+            if (d > bench_best[i]) { bench_best[i] = d; bench_when[i] = t; }
+        }
+    }
+    for (i = 0; i < stars; i++) {
+        /* A second of the track can be a degree of sky. */
+        if (bench_best[i] < cos((BENCH_MAX_SEP / 60. + 1.) * de2ra)) continue;
+        lo = bench_when[i] - 1. > pass->aos ? bench_when[i] - 1. : pass->aos;
+        hi = bench_when[i] + 1. < pass->los ? bench_when[i] + 1. : pass->los;
+        for (t = lo; t <= hi; t += 0.01) {
+            bench_direction(t, &u);
+            d = Dot(&u, &bench_star[i]);
+            if (d > bench_best[i]) { bench_best[i] = d; bench_when[i] = t; }
+        }
+    }
+}
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    SAT_PASS pass;
+    SAT_APPULSE found[BENCH_FOUND];
+    basicStarData bright, *s;
+    double from, t0, elapsed = 0., sep, worst_t = 0., worst_sep = 0.;
+    char h[32];
+    int i, j, k, n, stars, passes = 0, total = 0, missed = 0, extra = 0;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 6; t.hour = 12; t.is_valid = 1;
+    host_set_time(&t);
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    
+    memset(&q, 0, sizeof(q));
+    for (i = 0; i < 3; i++) strcpy(q.elements[i], bench_elements[i]);
+    observer_now(&q);
+    q.jd_utc = gps_julian_date(&q.time);
+    stars = bench_catalog(q.jd_utc);
+    
+    printf("%-11s %6s %7s %6s %6s\n", "time", "HR", "mag", "sep'", "PA");
+    for (from = 0.; satapi_next_pass(&q, from, BENCH_SPAN - from, BENCH_MIN_EL, &pass) == 0; from = pass.los + 1.) {
+        passes++;
+        t0 = host_seconds();
+        for (i = 0; i < BENCH_REPEAT; i++) {
+            n = satapi_appulse(&q, &pass, BENCH_MAX_SEP, BENCH_MAX_MAG, found, BENCH_FOUND);
+        }
+        elapsed += (host_seconds() - t0) / BENCH_REPEAT;
+        total += n;
+        
+        for (i = 0; i < n; i++) {
+            s = get_bright_star(found[i].star, &bright);
+            printf("%-11s %6d %7.2f %6.2f %6.1f\n", bench_hms(found[i].t, h), s->hr, s->mag, 
+                found[i].separation, found[i].position_angle);
+        }
+        
+        bench_scan(&pass, stars);
+        for (i = 0; i < stars; i++) {
+            sep = bench_best[i] >= 1. ? 0. : Degrees(acos(bench_best[i])) * 60.;
+            for (j = 0; j < n && found[j].star != i; j++) ;
+            if (sep > BENCH_MAX_SEP) {
+                if (j < n) { extra++; printf("  extra HR%d\n", get_bright_star(i, &bright)->hr); }
+                continue;
+            }
+            if (j == n) {
+                missed++;
+                printf("  missed HR%d at %s, %.2f'\n", get_bright_star(i, &bright)->hr, bench_hms(bench_when[i], h), sep);
+                continue;
+            }
+            for (k = j + 1; k < n; k++) {
+                if (found[k].star == i) { extra++; printf("  HR%d twice\n", get_bright_star(i, &bright)->hr); }
+            }
+            if (fabs(found[j].t - bench_when[i]) > worst_t) worst_t = fabs(found[j].t - bench_when[i]);
+            if (fabs(found[j].separation - sep) > worst_sep) worst_sep = fabs(found[j].separation - sep);
+        }
+    }
+    
+    printf("\n%d passes, %d appulses within %.0f' of stars to mag %.1f, %d missed, %d extra\n",
+        passes, total, BENCH_MAX_SEP, BENCH_MAX_MAG, missed, extra);
+    printf("worst against the scan: %.2f s, %.1f arcsec\n", worst_t, worst_sep * 60.);
+    printf("satapi_appulse(): %.3f ms per pass\n", elapsed / passes * 1e3);
+    
+    return missed || extra ? 1 : 0;
+}
@@ -0,0 +1,153 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the batch propagator in sgp4_batch.c. It makes a
+   catalog the size of the public one, 25000 objects of which one in 
+   ten is deep space, propagates it through a day at one minute steps
+   and compares the batch with sgp4_propagate() one satellite at a 
+   time, for speed in satellite steps a second and for the largest 
+   difference in position and velocity. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+#include "bench_util.h"
+#include "sgp4_batch.h"
+
+#define BENCH_SATELLITES    25000
+#define BENCH_EPOCH         10278.50000000
+#define BENCH_STEPS         1440        /* A day at one minute steps. */
+#define BENCH_SCALAR_STEPS  60          /* Enough of it to time the scalar path. */
+#define BENCH_CHECK_STEP    61          /* Minutes between accuracy checks. */
+
+static SAT_HANDLE   *bench_sat;
+static sgp4_batch_t bench_batch;
+
+/** bench_object
+ *
+ * Write and load the TLE of catalog object n. Every tenth is in a 
+ * geosynchronous or Molniya orbit, the rest are in low orbits from
+ * 200 km, where SGP4 simplifies, up and one in seven is eccentric.
+ */
+static void bench_object(int n) {
+    char e[3][80], name[16];
+    double revs, ecc, bstar, n_rad, a, incl, raan, argp, m;
+    
+    if (n % 10 == 9) {
+        revs = n % 20 == 9 ? 1.00270000 : 2.00600000;
+        ecc = n % 20 == 9 ? 0.0002 : 0.72;
+        bstar = 0.;
+    }
+    else {
+        /* The eccentric ones keep their perigee above 200 km. */
+        revs = 11. + 5.4 * bench_random();
+        n_rad = revs * twopi / secday;
+        a = pow(398600.4418 / (n_rad * n_rad), 1. / 3.);
+        ecc = (n % 7 == 0 ? 1. : 0.1) * (1. - (xkmper + 200.) / a) * bench_random();
+        if (ecc < 0.) ecc = 0.;
+        bstar = 1e-5 + 5e-4 * bench_random();
+    }
+    
+    m    = 360. * bench_random();
+    argp = 360. * bench_random();
+    raan = 360. * bench_random();
+    incl = 110. * bench_random();
+    sprintf(name, "OBJECT %d", n);
+    bench_tle(e, name, n, BENCH_EPOCH, bstar, incl, raan, ecc, argp, m, revs);
+    
+    if (satapi_load(&bench_sat[n], e) != 0) {
+        printf("object %d: bad TLE\n%s\n%s\n", n, e[1], e[2]);
+        exit(1);
+    }
+}
+
+int main(void) {
+    SAT_HANDLE *h;
+    vector_t pos, vel;
+    double t0, jd, jd0, phase, d, scalar, batch, worst_pos[2] = { 0., 0. }, worst_vel[2] = { 0., 0. };
+    int i, j, step, deep = 0, simple = 0, checked = 0;
+    
+    bench_sat = (SAT_HANDLE *)malloc(BENCH_SATELLITES * sizeof(SAT_HANDLE));
+    sgp4_batch_init(&bench_batch);
+    for (i = 0; i < BENCH_SATELLITES; i++) {
+        bench_object(i);
+        h = &bench_sat[i];
+        if (sgp4_batch_add(&bench_batch, &h->ctx, h->jd_epoch) != i) {
+            printf("out of memory\n");
+            return 1;
+        }
+        if (h->ctx.flags & DEEP_SPACE_EPHEM_FLAG) deep++;
+        else if (h->ctx.flags & SIMPLE_FLAG) simple++;
+    }
+    printf("%d objects, %d deep space, %d simplified near earth\n", BENCH_SATELLITES, deep, simple);
+    
+    jd0 = Julian_Date_of_Epoch(BENCH_EPOCH) + 0.25;
+    
+    /* One at a time, as the device does. */
+    t0 = host_seconds();
+    for (step = 0; step < BENCH_SCALAR_STEPS; step++) {
+        jd = jd0 + step / xmnpda;
+        for (i = 0; i < BENCH_SATELLITES; i++) {
+            h = &bench_sat[i];
+            sgp4_propagate(&h->ctx, (jd - h->jd_epoch) * xmnpda, &pos, &vel, &phase);
+            Convert_Sat_State(&pos, &vel);
+        }
+    }
+    scalar = (double)BENCH_SATELLITES * BENCH_SCALAR_STEPS / (host_seconds() - t0);
+    
+    /* The whole day in batches. */
+    t0 = host_seconds();
+    for (step = 0; step < BENCH_STEPS; step++) {
+        sgp4_batch_propagate(&bench_batch, jd0 + step / xmnpda);
+    }
+    batch = host_seconds() - t0;
+    
+    printf("scalar %.2fM satellite steps/s, batch %.2fM/s (%d lanes), x%.1f\n", 
+        scalar / 1e6, (double)BENCH_SATELLITES * BENCH_STEPS / batch / 1e6, SGP4_BATCH_LANES,
+        (double)BENCH_SATELLITES * BENCH_STEPS / batch / scalar);
+    printf("a day at one minute steps: %.1f s scalar, %.1f s batch\n", 
+        (double)BENCH_SATELLITES * BENCH_STEPS / scalar, batch);
+    
+    /* The batch against sgp4_propagate() through the day. */
+    for (step = 0; step < BENCH_STEPS; step += BENCH_CHECK_STEP) {
+        jd = jd0 + step / xmnpda;
+        sgp4_batch_propagate(&bench_batch, jd);
+        for (i = 0; i < BENCH_SATELLITES; i++) {
+            h = &bench_sat[i];
+            sgp4_propagate(&h->ctx, (jd - h->jd_epoch) * xmnpda, &pos, &vel, &phase);
+            Convert_Sat_State(&pos, &vel);
+            j = bench_batch.deep[i] != NULL;
+            d = sqrt(Sqr(pos.x - bench_batch.x[i]) + Sqr(pos.y - bench_batch.y[i]) + Sqr(pos.z - bench_batch.z[i]));
+            if (d > worst_pos[j]) worst_pos[j] = d;
+            d = sqrt(Sqr(vel.x - bench_batch.vx[i]) + Sqr(vel.y - bench_batch.vy[i]) + Sqr(vel.z - bench_batch.vz[i]));
+            if (d > worst_vel[j]) worst_vel[j] = d;
+            checked++;
+        }
+    }
+    printf("%d positions checked, worst difference near earth %.3f mm and %.4f mm/s,\n"
+        "deep space %.3f mm and %.4f mm/s\n", checked, worst_pos[0] * 1e6, worst_vel[0] * 1e6, 
+        worst_pos[1] * 1e6, worst_vel[1] * 1e6);
+    
+    sgp4_batch_free(&bench_batch);
+    free(bench_sat);
+    return 0;
+}
@@ -0,0 +1,114 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Host benchmark for the SDP4 resonance integrator. Deep(dpsec) 
+   integrates the resonance terms out from epoch in 720 minute steps
+   and keeps the last steps as checkpoints, so a sample that moves 
+   back in time resumes from a checkpoint rather than from epoch. 
+   This times sgp4_propagate() walking forwards, walking backwards
+   and jumping between two weeks for a near-earth orbit and for the 
+   two resonant deep-space cases, which should all cost about the 
+   same per sample. */
+
+#include "sowb.h"
+#include "sgp4sdp4.h"
+#include "host_hal.h"
+
+/* The ISS from test/predict_th.c, a made up 24 hour geosynchronous 
+   orbit and the Molniya orbit from bench_ephem.c. */
+static char bench_elements[][3][80] = {
+    { "ISS (ZARYA)",
+      "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147",
+      "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777" },
+    { "TEST GEO",
+      "1 26824U 01024A   10278.50000000  .00000050  00000-0  00000+0 0  9996",
+      "2 26824   0.0300 270.0000 0002000 100.0000 200.0000  1.00270000 34503" },
+    { "TEST MOLNIYA",
+      "1 23420U 94081A   10278.50000000  .00000100  00000-0  10000-3 0  9991",
+      "2 23420  62.8000 250.0000 7200000 280.0000  15.0000  2.00600000123454" }
+};
+
+#define BENCH_SATELLITES    (int)(sizeof(bench_elements) / sizeof(bench_elements[0]))
+#define BENCH_START         (30. * xmnpda)      /* minutes after epoch */
+#define BENCH_SAMPLES       3600                /* one second apart */
+#define BENCH_REPEAT        50
+
+static sgp4_ctx_t ctx;
+static double bench_sink = 0.;
+
+/** bench_sample
+ *
+ * Propagate to tsince minutes and keep the result live.
+ */
+static void bench_sample(double tsince) {
+    vector_t pos, vel;
+    double phase;
+    
+    sgp4_propagate(&ctx, tsince, &pos, &vel, &phase);
+    bench_sink += pos.x;
+}
+
+int main(void) {
+    tle_t tle;
+    double t0, fwd, back, jump;
+    int i, j, k;
+    
+    printf("%-14s %4s %10s %10s %10s\n", "satellite", "type", "fwd us", "back us", "jump us");
+    
+    for (i = 0; i < BENCH_SATELLITES; i++) {
+        if (Get_Next_Tle_Set(bench_elements[i], &tle) != 1) {
+            printf("%-14s bad TLE\n", bench_elements[i][0]);
+            continue;
+        }
+        select_ephemeris(&tle);
+        sgp4_init(&ctx, &tle);
+        
+        /* A second at a time forwards over an hour. */
+        t0 = host_seconds();
+        for (k = 0; k < BENCH_REPEAT; k++) {
+            for (j = 0; j < BENCH_SAMPLES; j++) bench_sample(BENCH_START + j / 60.);
+        }
+        fwd = (host_seconds() - t0) / ((double)BENCH_REPEAT * BENCH_SAMPLES);
+        
+        /* The same samples backwards, as a search back to AOS does. */
+        t0 = host_seconds();
+        for (k = 0; k < BENCH_REPEAT; k++) {
+            for (j = BENCH_SAMPLES - 1; j >= 0; j--) bench_sample(BENCH_START + j / 60.);
+        }
+        back = (host_seconds() - t0) / ((double)BENCH_REPEAT * BENCH_SAMPLES);
+        
+        /* Alternating between now and a week earlier. */
+        t0 = host_seconds();
+        for (k = 0; k < BENCH_REPEAT; k++) {
+            for (j = 0; j < BENCH_SAMPLES; j++) {
+                bench_sample(BENCH_START + j / 60. - ((j & 1) ? 7. * xmnpda : 0.));
+            }
+        }
+        jump = (host_seconds() - t0) / ((double)BENCH_REPEAT * BENCH_SAMPLES);
+        
+        printf("%-14s %4s %10.3f %10.3f %10.3f\n", bench_elements[i][0], 
+            Is_Deep_Space(&tle) ? "SDP4" : "SGP4", 
+            fwd * 1e6, back * 1e6, jump * 1e6);
+    }
+    
+    return bench_sink == 12345. ? 1 : 0;
+}
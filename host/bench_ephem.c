@@ -0,0 +1,131 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Host benchmark for satapi_ephem_fit() and satapi_ephem_eval().
+   For the next pass of each test satellite it fits an ephemeris, 
+   checks it every second of the pass against satallite_calculate()
+   and compares the cost per sample of the two. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+
+/* The ISS elements from test/predict_th.c, and made up Molniya and 
+   GPS orbits to exercise SDP4. */
+static const char *bench_elements[][3] = {
+    { "ISS (ZARYA)",
+      "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147",
+      "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777" },
+    { "TEST MOLNIYA",
+      "1 23420U 94081A   10278.50000000  .00000100  00000-0  10000-3 0  9991",
+      "2 23420  62.8000 250.0000 7200000 280.0000  15.0000  2.00600000123454" },
+    { "TEST GPS",
+      "1 24876U 97035A   10278.50000000  .00000000  00000-0  00000+0 0  9993",
+      "2 24876  55.0000 100.0000 0100000  50.0000 300.0000  2.00560000 99998" }
+};
+
+#define BENCH_SATELLITES    (int)(sizeof(bench_elements) / sizeof(bench_elements[0]))
+#define BENCH_REPEAT        200
+
+static SAT_POS_DATA q;
+static SAT_EPHEM    e;
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    SAT_PASS pass;
+    double v[SAT_EPHEM_VALUES], err[SAT_EPHEM_VALUES], s, x, t0, full, fast, sink = 0.;
+    int i, j, k, n;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 6; t.hour = 18; t.is_valid = 1;
+    host_set_time(&t);
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    
+    printf("%-14s %6s %4s %5s | %9s %9s %9s %9s | %9s %9s %9s %9s | %8s %8s\n", 
+        "satellite", "pass s", "segs", "props", 
+        "rep az", "rep el", "rep km", "rep km/s", 
+        "max az", "max el", "max km", "max km/s", "full us", "cheb us");
+    
+    for (i = 0; i < BENCH_SATELLITES; i++) {
+        memset(&q, 0, sizeof(q));
+        for (j = 0; j < 3; j++) strcpy(q.elements[j], bench_elements[i][j]);
+        observer_now(&q);
+        
+        if (satapi_next_pass(&q, 0., 86400., 5., &pass) != 0) {
+            printf("%-14s no pass\n", bench_elements[i][0]);
+            continue;
+        }
+        satapi_ephem_fit(&q, pass.aos, pass.los, &e);
+        
+        /* Check every second of the pass against the propagator. */
+        for (j = 0; j < SAT_EPHEM_VALUES; j++) err[j] = 0.;
+        for (s = e.start; s <= e.end; s += 1.) {
+            q.tsince = s;
+            satallite_calculate(&q);
+            satapi_ephem_eval(&e, s, v);
+            x = fabs(v[SAT_EPHEM_AZ] - q.azimuth);
+            if (x > 180.) x = 360. - x;
+            x *= cos(q.elevation * de2ra);
+            if (x > err[SAT_EPHEM_AZ]) err[SAT_EPHEM_AZ] = x;
+            x = fabs(v[SAT_EPHEM_EL] - q.elevation); if (x > err[SAT_EPHEM_EL]) err[SAT_EPHEM_EL] = x;
+            x = fabs(v[SAT_EPHEM_RG] - q.range); if (x > err[SAT_EPHEM_RG]) err[SAT_EPHEM_RG] = x;
+            x = fabs(v[SAT_EPHEM_RATE] - q.rangeRate); if (x > err[SAT_EPHEM_RATE]) err[SAT_EPHEM_RATE] = x;
+        }
+        
+        /* Cost per sample, the same samples both ways. */
+        n = (int)(e.end - e.start);
+        t0 = host_seconds();
+        for (k = 0; k < BENCH_REPEAT; k++) {
+            for (j = 0; j < n; j++) {
+                q.tsince = e.start + j;
+                satallite_calculate(&q);
+                sink += q.elevation;
+            }
+        }
+        full = (host_seconds() - t0) / ((double)BENCH_REPEAT * n);
+        t0 = host_seconds();
+        for (k = 0; k < BENCH_REPEAT; k++) {
+            for (j = 0; j < n; j++) {
+                satapi_ephem_eval(&e, e.start + j, v);
+                sink += v[SAT_EPHEM_EL];
+            }
+        }
+        fast = (host_seconds() - t0) / ((double)BENCH_REPEAT * n);
+        
+        printf("%-14s %6.0f %4d %5d | %9.5f %9.5f %9.5f %9.6f | %9.5f %9.5f %9.5f %9.6f | %8.3f %8.3f\n",
+            bench_elements[i][0], e.end - e.start, e.segments, e.evaluations,
+            e.max_error[SAT_EPHEM_AZ], e.max_error[SAT_EPHEM_EL], e.max_error[SAT_EPHEM_RG], e.max_error[SAT_EPHEM_RATE],
+            err[SAT_EPHEM_AZ], err[SAT_EPHEM_EL], err[SAT_EPHEM_RG], err[SAT_EPHEM_RATE],
+            full * 1e6, fast * 1e6);
+    }
+    
+    printf("rep = error estimated by satapi_ephem_fit(), max = worst error against\n"
+           "satallite_calculate() every second, az scaled by cos(el), degrees.\n");
+    
+    return sink == 12345. ? 1 : 0;
+}
@@ -0,0 +1,242 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the GEO belt survey in satapi_geo.c. A made up
+   TLE file of station-kept and drifting belt objects, with a few that
+   are not in the belt and have no name line, is put in the host's 
+   flash. The survey is started, runs a round, and its positions are 
+   checked against a satapi_calculate() of a freshly loaded TLE. 
+   After a second round five minutes on, the positions carried on 
+   with the drift are checked the same way, half way to the next 
+   round and at it. It also times a day of rounds, each object read
+   back from flash and loaded again as the survey does. */
+
+#include "sowb.h"
+#include "flash.h"
+#include "satapi.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+#define BENCH_EPOCH         10278.5
+#define BENCH_STATIONS      24      /* Station-kept, every 5 degrees from 75W. */
+#define BENCH_DRIFTING      8
+#define BENCH_INTERVAL      300.    /* Seconds, as GEO_INTERVAL. */
+#define BENCH_ROUNDS        288     /* A day of rounds. */
+
+/* Objects that are not in the belt: name, inclination, mean motion,
+   eccentricity. */
+typedef struct _bench_other {
+    const char  *name;
+    double      incl, revs, ecc;
+} BENCH_OTHER;
+
+static BENCH_OTHER bench_others[] = {
+    { "TEST LEO",     51.6, 15.5,   0.001 },
+    { "TEST GPS",     55.0,  2.0056, 0.01 },
+    { "TEST MOLNIYA", 63.4,  2.006, 0.72 },
+    { "TEST TUNDRA",  63.4,  1.0027, 0.27 },
+    { "TEST GTO",      7.0,  2.25,  0.73 }
+};
+
+#define BENCH_OTHERS        (int)(sizeof(bench_others) / sizeof(bench_others[0]))
+#define BENCH_MAX           (BENCH_STATIONS + BENCH_DRIFTING + BENCH_OTHERS)
+
+static char     bench_elements[BENCH_MAX][3][80];
+static int      bench_count;
+static char     bench_file[BENCH_MAX * 3 * 80];
+static uint32_t bench_offset[BENCH_MAX];
+static int      bench_found_count;
+static GPS_TIME bench_start;
+
+/** bench_add
+ *
+ * Write the TLE of a circular or elliptical orbit whose mean anomaly
+ * puts it over a longitude at epoch, were it geostationary.
+ */
+static void bench_add(const char *name, double incl, double raan, double revs, double ecc, double longitude) {
+    double gmst, m;
+    
+    gmst = Degrees(ThetaG_JD(Julian_Date_of_Epoch(BENCH_EPOCH)));
+    m = fmod(longitude - raan + gmst + 720., 360.);
+    bench_tle(bench_elements[bench_count], name, 91000 + bench_count, BENCH_EPOCH, 0., 
+        incl, raan, ecc, 0., m, revs);
+    bench_count++;
+}
+
+/** bench_found
+ *
+ * Note where each TLE is in the file, as satapi_tle_scan() gives it.
+ */
+static int bench_found(char elements[3][80], uint32_t offset) {
+    bench_offset[bench_found_count++] = offset;
+    return 0;
+}
+
+/** bench_truth
+ *
+ * The az/el of a catalog object by satapi_calculate() of a freshly 
+ * loaded TLE, so its lunar-solar terms are worked out at that time.
+ * The time is in seconds from the start of the run.
+ */
+static void bench_truth(int sat, double seconds, double *azimuth, double *elevation) {
+    static SAT_POS_DATA q;
+    int i;
+    
+    memset(&q, 0, sizeof(q));
+    for (i = 0; i < 3; i++) strcpy(q.elements[i], bench_elements[sat][i]);
+    observer_now(&q);
+    q.time = bench_start;
+    q.tsince = seconds;
+    satapi_calculate(&q, SAT_OUT_AZEL);
+    *azimuth = q.azimuth;
+    *elevation = q.elevation;
+}
+
+/** bench_run
+ *
+ * Let the survey finish a round, if one is due.
+ */
+static void bench_run(void) {
+    int i;
+    
+    for (i = 0; i < 1000; i++) satapi_geo_process();
+}
+
+/** bench_check
+ *
+ * @return double The worst error, arc seconds, of the listed objects
+ * at seconds from the start, of one kind (1 drifting, 0 not).
+ */
+static double bench_check(double seconds, double jd, int drifting) {
+    SAT_GEO *g;
+    double az, el, taz, tel, err, worst = 0.;
+    int i;
+    
+    for (i = 0; (g = satapi_geo_get(i)) != NULL; i++) {
+        if ((g->catnr - 91000 >= BENCH_STATIONS) != drifting) continue;
+        satapi_geo_position(g, jd, &az, &el);
+        bench_truth(g->catnr - 91000, seconds, &taz, &tel);
+        err = bench_separation(az, el, taz, tel);
+        if (err > worst) worst = err;
+    }
+    return worst;
+}
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    obs_frame_t frame;
+    vector_t pos, vel, obs_set;
+    SAT_HANDLE s;
+    SAT_GEO *g;
+    char elements[3][80];
+    char name[25];
+    double jd0, jd, t0, each, phase, sum = 0.;
+    int i, j, len, loaded, held, sorted = 1;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 6; t.hour = 18; t.is_valid = 1;
+    host_set_time(&t);
+    bench_start = t;
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    jd0 = gps_julian_date(&t);
+    
+    for (i = 0; i < BENCH_STATIONS; i++) {
+        sprintf(name, "TEST GEO %d", i);
+        bench_add(name, 0.02 + 0.002 * i, 80. + 3. * i, 1.00273791, 0.0002, -75. + 5. * i);
+    }
+    for (i = 0; i < BENCH_DRIFTING; i++) {
+        sprintf(name, "TEST DRIFT %d", i);
+        bench_add(name, 2. + 1.5 * i, 40. * i, 0.992 + 0.0025 * i, 0.001, -62.5 + 15. * i);
+    }
+    for (i = 0; i < BENCH_OTHERS; i++) {
+        bench_add(bench_others[i].name, bench_others[i].incl, 30. * i, bench_others[i].revs, bench_others[i].ecc, 0.);
+    }
+    
+    /* The TLE file, those not in the belt without a name line. */
+    for (i = 0, len = 0; i < bench_count; i++) {
+        if (i < BENCH_STATIONS + BENCH_DRIFTING) len += sprintf(bench_file + len, "%s\r\n", bench_elements[i][0]);
+        len += sprintf(bench_file + len, "%s\r\n%s\r\n", bench_elements[i][1], bench_elements[i][2]);
+    }
+    host_flash_write(FLASH_BASE_TLE_FILE, bench_file, len);
+    satapi_tle_scan(bench_found);
+    for (i = 0; i < bench_found_count; i++) {
+        if (satapi_tle_read(bench_offset[i], elements) != 0 || strcmp(elements[1], bench_elements[i][1]) != 0) {
+            printf("TLE %d not read back from the file\n", i);
+        }
+    }
+    
+    loaded = satapi_sky_load();
+    held = satapi_geo_start();
+    bench_run();
+    printf("%d TLEs in the file, %d found, %d loaded in the sky engine, %d left out\n", 
+        bench_count, bench_found_count, loaded, satapi_sky_dropped());
+    if (loaded + satapi_sky_dropped() != bench_found_count) printf("TLEs lost by the sky engine\n");
+    printf("%d held by the survey (%d in the belt), %d above the horizon\n\n", 
+        held, BENCH_STATIONS + BENCH_DRIFTING, satapi_geo_count());
+    
+    printf("%4s %-14s %8s %7s %9s %9s %7s\n", "rank", "satellite", "az", "el", "az \"/min", "el \"/min", "err \"");
+    
+    /* The second round, which gives the drift. */
+    t.minute = 5;
+    host_set_time(&t);
+    bench_run();
+    jd = gps_julian_date(&t);
+    for (i = 0; (g = satapi_geo_get(i)) != NULL; i++) {
+        double taz, tel;
+        bench_truth(g->catnr - 91000, BENCH_INTERVAL, &taz, &tel);
+        printf("%4d %-14s %8.3f %7.3f %9.2f %9.2f %7.2f\n", i, bench_elements[g->catnr - 91000][0], g->azimuth, g->elevation,
+            g->azimuth_rate * 3600., g->elevation_rate * 3600., bench_separation(g->azimuth, g->elevation, taz, tel));
+        if (i > 0 && satapi_geo_get(i - 1)->azimuth > g->azimuth) sorted = 0;
+        if (g->elevation < 5.) sorted = 0;
+    }
+    printf("\nlist %s\n", sorted ? "in azimuth order, all above 5 deg" : "OUT OF ORDER");
+    
+    printf("carried on with drift, worst error: station-kept %.1f\" at +150 s, %.1f\" at +300 s; "
+        "drifting %.1f\" at +150 s, %.1f\" at +300 s\n",
+        bench_check(BENCH_INTERVAL + 150., jd + 150. / 86400., 0), bench_check(2. * BENCH_INTERVAL, jd + BENCH_INTERVAL / 86400., 0),
+        bench_check(BENCH_INTERVAL + 150., jd + 150. / 86400., 1), bench_check(2. * BENCH_INTERVAL, jd + BENCH_INTERVAL / 86400., 1));
+    
+    /* A day of rounds, each object in the round's frame. */
+    t0 = host_seconds();
+    for (j = 0; j < BENCH_ROUNDS; j++) {
+        jd = jd0 + j * BENCH_INTERVAL / 86400.;
+        satapi_observer_frame(&l, jd, &frame);
+        for (i = 0; i < held; i++) {
+            satapi_tle_read(bench_offset[i], elements);
+            satapi_load(&s, elements);
+            sgp4_propagate(&s.ctx, (jd - s.jd_epoch) * xmnpda, &pos, &vel, &phase);
+            Convert_Sat_State(&pos, &vel);
+            Calculate_Obs_Frame(&frame, &pos, &vel, &obs_set);
+            sum += obs_set.x;
+        }
+    }
+    each = (host_seconds() - t0) / (BENCH_ROUNDS * held);
+    printf("per object %.3f us, per round of %d %.1f us\n", each * 1e6, held, each * held * 1e6);
+    
+    return sum == 12345. ? 1 : 0;
+}
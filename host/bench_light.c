@@ -0,0 +1,193 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Host benchmark for satapi_pass_light(). It checks the interpolated
+   solar position of Solar_Position_Cached() against 
+   Calculate_Solar_Position() and compares their cost. For three days
+   of passes of each test satellite it prints how each pass is lit,
+   checks the eclipse times against a one second scan and compares 
+   the propagations used for the lighting with those used to find 
+   the pass. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+/* The ISS from test/predict_th.c and the GPS orbit from bench_ephem.c. */
+static const char *bench_elements[][3] = {
+    { "ISS (ZARYA)",
+      "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147",
+      "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777" },
+    { "TEST GPS",
+      "1 24876U 97035A   10278.50000000  .00000000  00000-0  00000+0 0  9993",
+      "2 24876  55.0000 100.0000 0100000  50.0000 300.0000  2.00560000 99998" }
+};
+
+/* A low orbit with a drag term so large that SGP4 gives NaN about 
+   24 days after the start. */
+static const char *bench_decay[3] = {
+    "TEST DECAY",
+    "1 99001U 10001A   10278.50000000  .00100000  00000-0  50000-1 0  9991",
+    "2 99001  96.5000 100.0000 0010000  90.0000 270.0000 16.20000000    11"
+};
+
+#define BENCH_SATELLITES    (int)(sizeof(bench_elements) / sizeof(bench_elements[0]))
+#define BENCH_DECAY_FROM    (22. * 86400.)
+#define BENCH_SPAN          (3. * 86400.)
+#define BENCH_MIN_EL        10.
+#define BENCH_SUN_SAMPLES   20000
+
+static SAT_POS_DATA q;
+
+/** bench_shadow
+ *
+ * @return int 1 if the satellite is in shadow at t, using the sun
+ * from Calculate_Solar_Position().
+ */
+static int bench_shadow(double t) {
+    vector_t sol;
+    double depth;
+    
+    q.tsince = t;
+    satapi_calculate(&q, 0);
+    SgpMagnitude(&q.pos);
+    Calculate_Solar_Position(q.jd_utc + t / 86400., &sol);
+    return Sat_Eclipsed(&q.pos, &sol, &depth);
+}
+
+/** bench_when
+ *
+ * Format seconds from the start as hh:mm:ss.s, or a dash if zero.
+ */
+static char *bench_when(double t, char *s) {
+    if (t == 0.) return strcpy(s, "-");
+    return bench_hms(t, s);
+}
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    SAT_PASS pass;
+    solar_cache_t cache;
+    vector_t a, b;
+    double jd0, jd, t0, direct, cached, err, max_err = 0., from, s = 0., es, ee, worst = 0.;
+    double found_evals, light_evals;
+    char h[7][16];
+    int i, j, in, was, passes, result;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 6; t.hour = 12; t.is_valid = 1;
+    host_set_time(&t);
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    jd0 = gps_julian_date(&t);
+    
+    /* The cached sun against the full theory, every few minutes over a month. */
+    memset(&cache, 0, sizeof(cache));
+    for (i = 0; i < BENCH_SUN_SAMPLES; i++) {
+        jd = jd0 + i * (30. / BENCH_SUN_SAMPLES);
+        Calculate_Solar_Position(jd, &a);
+        Solar_Position_Cached(&cache, jd, &b);
+        err = Degrees(Angle(&a, &b)) * 3600.;
+        if (err > max_err) max_err = err;
+    }
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_SUN_SAMPLES; i++) {
+        Calculate_Solar_Position(jd0 + i * (1. / BENCH_SUN_SAMPLES), &a);
+        s += a.x;
+    }
+    direct = (host_seconds() - t0) / BENCH_SUN_SAMPLES;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_SUN_SAMPLES; i++) {
+        Solar_Position_Cached(&cache, jd0 + i * (1. / BENCH_SUN_SAMPLES), &b);
+        s += b.x;
+    }
+    cached = (host_seconds() - t0) / BENCH_SUN_SAMPLES;
+    printf("sun: cached %.3f us, full %.3f us, worst difference %.3f arcsec\n\n", 
+        cached * 1e6, direct * 1e6, max_err);
+    
+    printf("%-12s %10s %5s %-4s | %10s %10s | %10s %10s | %10s %10s | %5s %5s\n", 
+        "satellite", "aos", "max", "lit", "dark", "to", "eclipse", "to", "visible", "to", "find", "light");
+    
+    for (i = 0; i < BENCH_SATELLITES; i++) {
+        memset(&q, 0, sizeof(q));
+        for (in = 0; in < 3; in++) strcpy(q.elements[in], bench_elements[i][in]);
+        observer_now(&q);
+        
+        found_evals = light_evals = 0.;
+        passes = 0;
+        for (from = 0.; satapi_next_pass(&q, from, BENCH_SPAN - from, BENCH_MIN_EL, &pass) == 0; from = pass.los + 1.) {
+            found_evals += pass.evaluations;
+            pass.evaluations = 0;
+            satapi_pass_light(&q, &pass);
+            light_evals += pass.evaluations;
+            passes++;
+            
+            printf("%-12s %10s %5.1f %c%c%c%c | %10s %10s | %10s %10s | %10s %10s\n", bench_elements[i][0],
+                bench_when(pass.aos, h[0]), pass.tca_elevation,
+                pass.light & SAT_LIGHT_DARK     ? 'D' : '.',
+                pass.light & SAT_LIGHT_SUNLIT   ? 'S' : '.',
+                pass.light & SAT_LIGHT_ECLIPSED ? 'E' : '.',
+                pass.light & SAT_LIGHT_VISIBLE  ? 'V' : '.',
+                bench_when(pass.dark_start, h[1]), bench_when(pass.dark_end, h[2]),
+                bench_when(pass.eclipse_start, h[3]), bench_when(pass.eclipse_end, h[4]),
+                bench_when(pass.visible_start, h[5]), bench_when(pass.visible_end, h[6]));
+            
+            /* The eclipse by a one second scan with the full solar theory. */
+            es = ee = 0.;
+            was = 0;
+            for (s = floor(pass.aos); s <= pass.los; s += 1.) {
+                in = bench_shadow(s);
+                if (in && !was && es == 0.) es = s > pass.aos ? s : pass.aos;
+                if (!in && was) ee = s;
+                was = in;
+            }
+            if (was) ee = pass.los;
+            if (fabs(es - pass.eclipse_start) > worst) worst = fabs(es - pass.eclipse_start);
+            if (fabs(ee - pass.eclipse_end) > worst) worst = fabs(ee - pass.eclipse_end);
+        }
+        if (passes) {
+            printf("%-12s %d passes, %.1f propagations to find each, %.1f for its lighting\n\n", 
+                bench_elements[i][0], passes, found_evals / passes, light_evals / passes);
+        }
+    }
+    printf("worst eclipse time against a one second scan: %.1f s\n", worst);
+    
+    /* The search has to give up on the decayed orbit, not step on 
+       through NaN for ever. */
+    memset(&q, 0, sizeof(q));
+    for (j = 0; j < 3; j++) strcpy(q.elements[j], bench_decay[j]);
+    observer_now(&q);
+    passes = 0;
+    for (from = BENCH_DECAY_FROM; (result = satapi_next_pass(&q, from, BENCH_SPAN, BENCH_MIN_EL, &pass)) == 0; from = pass.los + 1.) {
+        passes++;
+    }
+    printf("%s: %d passes, then %d after %d propagations %s\n", bench_decay[0], passes, result, 
+        pass.evaluations, result == -5 ? "ok" : "FAILED");
+    
+    return s == 12345. ? 1 : 0;
+}
@@ -0,0 +1,181 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Host check of the math kernel in sgp_math.c against libm. Every
+   function is run over a dense sweep of the arguments the
+   propagators give it and the worst error is compared with a limit,
+   so the exit status can be used by make. The times are for the PC
+   only, see bench_th_math() for the mbed. */
+
+#include "sowb.h"
+#include "sgp4sdp4.h"
+#include "host_hal.h"
+
+#define BENCH_N     2000000
+
+static int bench_failed = 0;
+
+/** bench_report
+ *
+ * Print one result line and note a failure.
+ */
+static void bench_report(const char *name, double err, double limit, double t_libm, double t_kern) {
+    printf("%-10s %10.3e %10.3e %8.1f %8.1f  %s\n", name, err, limit, t_libm * 1e9, t_kern * 1e9, 
+        err <= limit ? "ok" : "FAIL");
+    if (err > limit) bench_failed = 1;
+}
+
+/** bench_arg
+ *
+ * The i'th of BENCH_N arguments spread over -range to +range.
+ */
+static double bench_arg(int i, double range) {
+    return -range + 2. * range * i / (BENCH_N - 1);
+}
+
+int main(void) {
+    double x, y, s, c, e, err, t0, t_libm, t_kern, sink = 0.;
+    float sf, cf;
+    int i;
+    
+    printf("%-10s %10s %10s %8s %8s\n", "function", "max err", "limit", "libm ns", "kern ns");
+    
+    /* SinCos over the arguments seen, to ten thousand radians. */
+    err = 0.;
+    for (i = 0; i < BENCH_N; i++) {
+        x = bench_arg(i, 1.0E4);
+        SinCos(x, &s, &c);
+        e = fabs(s - sin(x)) + fabs(c - cos(x));
+        if (e > err) err = e;
+    }
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) { x = bench_arg(i, 10.); sink += sin(x) + cos(x); }
+    t_libm = (host_seconds() - t0) / BENCH_N;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) { x = bench_arg(i, 10.); SinCos(x, &s, &c); sink += s + c; }
+    t_kern = (host_seconds() - t0) / BENCH_N;
+    bench_report("SinCos", err, 1.0E-11, t_libm, t_kern);
+    
+    /* ArcTan, relative error as the result spans many decades. */
+    err = 0.;
+    for (i = 0; i < BENCH_N; i++) {
+        x = bench_arg(i, 1.0);
+        x = x * x * x * 1.0E3;
+        y = atan(x);
+        e = fabs(ArcTan(x) - y) / (fabs(y) > 1.0E-300 ? fabs(y) : 1.);
+        if (e > err) err = e;
+    }
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) sink += atan(bench_arg(i, 10.));
+    t_libm = (host_seconds() - t0) / BENCH_N;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) sink += ArcTan(bench_arg(i, 10.));
+    t_kern = (host_seconds() - t0) / BENCH_N;
+    bench_report("ArcTan", err, 1.0E-15, t_libm, t_kern);
+    
+    /* AcTan round the circle. */
+    err = 0.;
+    for (i = 0; i < BENCH_N; i++) {
+        x = bench_arg(i, pi);
+        y = atan2(sin(x), cos(x));
+        if (y < 0.) y += twopi;
+        e = fabs(AcTan(sin(x), cos(x)) - y);
+        if (e > pi) e = fabs(e - twopi);
+        if (e > err) err = e;
+    }
+    bench_report("AcTan", err, 2.0E-14, 0., 0.);
+    
+    /* FMod2p against fmod in long double. */
+    err = 0.;
+    for (i = 0; i < BENCH_N; i++) {
+        x = bench_arg(i, 1.0E4);
+        y = (double)fmodl((long double)x, 2.0L * 3.14159265358979323846264338327950288L);
+        if (y < 0.) y += 2. * M_PI;
+        e = fabs(FMod2p(x) - y);
+        if (e > pi) e = fabs(e - twopi);
+        if (e > err) err = e;
+    }
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) sink += fmod(bench_arg(i, 1.0E4), twopi);
+    t_libm = (host_seconds() - t0) / BENCH_N;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) sink += FMod2p(bench_arg(i, 1.0E4));
+    t_kern = (host_seconds() - t0) / BENCH_N;
+    bench_report("FMod2p", err, 1.0E-11, t_libm, t_kern);
+    
+    /* Kepler, by the residual of the equation it solves, up to the 
+       eccentricity of a Molniya orbit and beyond. */
+    err = 0.;
+    for (i = 0; i < BENCH_N / 100; i++) {
+        double capu = bench_arg(i, pi) + pi, ecc = 0.9 * (i % 100) / 100., w = 0.37 * i;
+        double axn = ecc * cos(w), ayn = ecc * sin(w), epw;
+        epw = Kepler(capu, axn, ayn, &s, &c);
+        e = fabs(epw - axn * sin(epw) + ayn * cos(epw) - capu) + fabs(s - sin(epw)) + fabs(c - cos(epw));
+        if (e > err) err = e;
+    }
+    bench_report("Kepler", err, 1.0E-9, 0., 0.);
+    
+    /* The single precision kernel, for the float and hybrid modes. */
+    err = 0.;
+    for (i = 0; i < BENCH_N; i++) {
+        x = bench_arg(i, 1.0E3);
+        SinCos_f((float)x, &sf, &cf);
+        e = fabs(sf - sin((float)x)) + fabs(cf - cos((float)x));
+        if (e > err) err = e;
+    }
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) { x = bench_arg(i, 10.); sink += sinf((float)x) + cosf((float)x); }
+    t_libm = (host_seconds() - t0) / BENCH_N;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) { x = bench_arg(i, 10.); SinCos_f((float)x, &sf, &cf); sink += sf + cf; }
+    t_kern = (host_seconds() - t0) / BENCH_N;
+    bench_report("SinCos_f", err, 5.0E-7, t_libm, t_kern);
+    
+    err = 0.;
+    for (i = 0; i < BENCH_N; i++) {
+        x = bench_arg(i, 1.0);
+        x = x * x * x * 1.0E3;
+        y = atan((float)x);
+        e = fabs(ArcTan_f((float)x) - y) / (fabs(y) > 1.0E-30 ? fabs(y) : 1.);
+        if (e > err) err = e;
+    }
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) sink += atanf((float)bench_arg(i, 10.));
+    t_libm = (host_seconds() - t0) / BENCH_N;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_N; i++) sink += ArcTan_f((float)bench_arg(i, 10.));
+    t_kern = (host_seconds() - t0) / BENCH_N;
+    bench_report("ArcTan_f", err, 3.0E-7, t_libm, t_kern);
+    
+    err = 0.;
+    for (i = 0; i < BENCH_N / 100; i++) {
+        float capu = bench_arg(i, pi) + pi, ecc = 0.1 * (i % 100) / 100., w = 0.37 * i;
+        float axn = ecc * cos(w), ayn = ecc * sin(w), epw;
+        epw = Kepler_f(capu, axn, ayn, &sf, &cf);
+        e = fabs(epw - axn * sin(epw) + ayn * cos(epw) - capu) + fabs(sf - sin(epw)) + fabs(cf - cos(epw));
+        if (e > err) err = e;
+    }
+    bench_report("Kepler_f", err, 2.0E-6, 0., 0.);
+    
+    if (sink == 12345.) printf("\n");
+    return bench_failed;
+}
@@ -0,0 +1,206 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Host benchmark for the SGP4_NUMERIC modes (see sgp4sdp4.h). Built
+   once per mode. The double build writes the reference observations
+   with -w FILE, the others read FILE and report the az/el error of 
+   every sample with the satellite above the horizon, and the same
+   for radec2altaz() over a grid of stars. The time per sample is 
+   shown too but a PC has a hardware FPU, see bench_th_numeric() for
+   the cycle counts on the mbed. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+
+/* The ISS elements from test/predict_th.c, made up low orbits and 
+   a made up GPS orbit to show the observer transforms alone as it 
+   is propagated by SDP4 in double whatever the mode. */
+static const char *bench_elements[][3] = {
+    { "ISS (ZARYA)",
+      "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147",
+      "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777" },
+    { "TEST 82 DEG",
+      "1 99003U 99003A   10278.50000000  .00000800  00000-0  60000-4 0  9993",
+      "2 99003  82.5000  60.0000 0012000 120.0000 240.0000 14.80000000  5004" },
+    { "TEST LOW SSO",
+      "1 99001U 99001A   10278.50000000  .00100000  00000-0  50000-3 0  9990",
+      "2 99001  96.5000 200.0000 0200000  10.0000 350.0000 16.20000000  1004" },
+    { "TEST GPS",
+      "1 24876U 97035A   10278.50000000  .00000000  00000-0  00000+0 0  9993",
+      "2 24876  55.0000 100.0000 0100000  50.0000 300.0000  2.00560000 99998" }
+};
+
+#define BENCH_SATELLITES    (int)(sizeof(bench_elements) / sizeof(bench_elements[0]))
+#define BENCH_DAYS          7
+#define BENCH_STEP          20.     /* seconds */
+#define BENCH_SAMPLES       (int)(BENCH_DAYS * 86400. / BENCH_STEP)
+#define BENCH_LIMIT         0.05    /* degrees */
+
+static const char *bench_mode_name[] = { "double", "hybrid" };
+
+/* Observer, 56.1920N 3.0339W 100m. */
+static geodetic_t bench_observer = { 56.1920 * de2ra, -3.0339 * de2ra, 0.1, 0. };
+
+typedef struct {
+    double  az, el, range;
+} BENCH_OBS;
+
+static BENCH_OBS obs[BENCH_SAMPLES];
+static BENCH_OBS ref[BENCH_SAMPLES];
+
+/** bench_observe
+ *
+ * Propagate the satellite and observe it for every sample.
+ *
+ * @return double The seconds taken per sample.
+ */
+static double bench_observe(sgp4_ctx_t *ctx, double jd_epoch, BENCH_OBS *out) {
+    vector_t pos, vel, obs_set;
+    double phase, tsince, t0;
+    int i;
+    
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_SAMPLES; i++) {
+        tsince = i * BENCH_STEP / 60.;
+        sgp4_propagate(ctx, tsince, &pos, &vel, &phase);
+        Convert_Sat_State(&pos, &vel);
+        Calculate_Obs(jd_epoch + tsince / xmnpda, &pos, &vel, &bench_observer, &obs_set);
+        out[i].az = Degrees(obs_set.x);
+        out[i].el = Degrees(obs_set.y);
+        out[i].range = obs_set.z;
+    }
+    return (host_seconds() - t0) / BENCH_SAMPLES;
+}
+
+/** bench_stars
+ *
+ * Convert a grid of stars, every 7.5 degrees of RA and 5 of Dec.
+ *
+ * @return int The number of stars.
+ */
+static int bench_stars(BENCH_OBS *out) {
+    GPS_LOCATION_AVERAGE l;
+    RaDec radec;
+    AltAz altaz;
+    int n = 0;
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude = 56.1920;
+    
+    for (radec.ra = 0.; radec.ra < 360.; radec.ra += 7.5) {
+        for (radec.dec = -85.; radec.dec <= 85.; radec.dec += 5.) {
+            radec2altaz(123.4567, &l, &radec, &altaz);
+            out[n].az = altaz.azm;
+            out[n].el = altaz.alt;
+            out[n].range = 0.;
+            n++;
+        }
+    }
+    return n;
+}
+
+/** bench_compare
+ *
+ * Print the worst and rms error of the samples above the horizon,
+ * azimuth scaled by cos(el).
+ */
+static void bench_compare(const char *name, int n, double seconds) {
+    double x, az = 0., el = 0., rg = 0., rms = 0.;
+    int i, used = 0;
+    
+    for (i = 0; i < n; i++) {
+        if (ref[i].el < 0.) continue;
+        x = fabs(obs[i].az - ref[i].az);
+        if (x > 180.) x = 360. - x;
+        x *= cos(ref[i].el * de2ra);
+        if (x > az) az = x;
+        rms += x * x;
+        x = fabs(obs[i].el - ref[i].el); 
+        if (x > el) el = x;
+        rms += x * x;
+        x = fabs(obs[i].range - ref[i].range);
+        if (x > rg) rg = x;
+        used++;
+    }
+    rms = used ? sqrt(rms / (2 * used)) : 0.;
+    
+    printf("%-14s %6d | %9.5f %9.5f %9.5f %9.4f | %8.3f %s\n", name, used, az, el, rms, rg, 
+        seconds * 1e6, az < BENCH_LIMIT && el < BENCH_LIMIT ? "ok" : "FAIL");
+}
+
+int main(int argc, char **argv) {
+    static sgp4_ctx_t ctx;
+    tle_t tle;
+    char elements[3][80];
+    double seconds;
+    int i, j, n, write;
+    FILE *fp;
+    
+    write = argc == 3 && !strcmp(argv[1], "-w");
+    if (argc != 2 && !write) {
+        fprintf(stderr, "usage: %s [-w] reference-file\n", argv[0]);
+        return 2;
+    }
+    fp = fopen(argv[argc - 1], write ? "wb" : "rb");
+    if (fp == NULL) {
+        perror(argv[argc - 1]);
+        return 2;
+    }
+    
+    printf("SGP4_NUMERIC %s, %d days every %.0fs, errors in degrees and km\n", 
+        bench_mode_name[SGP4_NUMERIC], BENCH_DAYS, BENCH_STEP);
+    printf("%-14s %6s | %9s %9s %9s %9s | %8s\n", 
+        "satellite", "above", "max az", "max el", "rms", "max km", "us");
+    
+    for (i = 0; i < BENCH_SATELLITES; i++) {
+        for (j = 0; j < 3; j++) strcpy(elements[j], bench_elements[i][j]);
+        Get_Next_Tle_Set(elements, &tle);
+        select_ephemeris(&tle);
+        sgp4_init(&ctx, &tle);
+        
+        seconds = bench_observe(&ctx, Julian_Date_of_Epoch(tle.epoch), obs);
+        if (write) {
+            fwrite(obs, sizeof(BENCH_OBS), BENCH_SAMPLES, fp);
+            memcpy(ref, obs, sizeof(ref));
+        }
+        else if (fread(ref, sizeof(BENCH_OBS), BENCH_SAMPLES, fp) != (size_t)BENCH_SAMPLES) {
+            fprintf(stderr, "%s: short reference file\n", argv[argc - 1]);
+            return 2;
+        }
+        bench_compare(bench_elements[i][0], BENCH_SAMPLES, seconds);
+    }
+    
+    n = bench_stars(obs);
+    if (write) {
+        fwrite(obs, sizeof(BENCH_OBS), n, fp);
+        memcpy(ref, obs, n * sizeof(BENCH_OBS));
+    }
+    else if (fread(ref, sizeof(BENCH_OBS), n, fp) != (size_t)n) {
+        fprintf(stderr, "%s: short reference file\n", argv[argc - 1]);
+        return 2;
+    }
+    bench_compare("radec2altaz", n, 0.);
+    
+    fclose(fp);
+    return 0;
+}
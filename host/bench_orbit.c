@@ -0,0 +1,211 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Host benchmark for the orbit-geometry prefilter in satapi_orbit.c.
+   A made up catalog, spread over the orbits found in a real one, is 
+   searched for passes over the next 24 hours from the site used by
+   bench_ephem.c, once with satapi_next_pass() on every satellite and
+   once skipping those satapi_orbit_visible() rules out and taking a 
+   single sample of the geostationary ones. It reports how many were
+   culled, how many of the rest had a pass, any culled satellite that
+   did have one (which would be a bug) and the time saved. A 
+   geostationary satellite that is always up has no AOS, so only the
+   single sample finds it. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+#define BENCH_MIN_EL        10.
+#define BENCH_SPAN          86400.
+#define BENCH_EPOCH         10278.5
+
+/* Groups of the catalog: how many, inclination (degrees, with the 
+   spread either side), mean motion (revolutions per day, with the
+   spread) and eccentricity. */
+typedef struct _bench_group {
+    const char  *name;
+    int         count;
+    double      incl, incl_spread;
+    double      revs, revs_spread;
+    double      ecc;
+} BENCH_GROUP;
+
+static BENCH_GROUP bench_groups[] = {
+    { "LEO equatorial",  30,   5.0, 5.0, 14.50, 1.00, 0.001 },
+    { "LEO 28 deg",      30,  28.5, 1.0, 15.20, 0.60, 0.001 },
+    { "LEO 40 deg",      20,  40.0, 3.0, 14.80, 0.60, 0.002 },
+    { "LEO 52 deg",      40,  52.0, 1.0, 15.30, 0.40, 0.001 },
+    { "LEO 65-82 deg",   40,  74.0, 8.0, 14.30, 0.50, 0.002 },
+    { "LEO polar/SSO",   60,  98.0, 2.0, 14.60, 0.40, 0.001 },
+    { "MEO equatorial",  10,   0.1, 0.1,  5.00, 0.00, 0.000 },
+    { "MEO GNSS",        30,  55.0, 2.0,  2.00, 0.05, 0.005 },
+    { "GTO",             10,   7.0, 5.0,  2.25, 0.05, 0.730 },
+    { "Molniya",         10,  63.4, 0.5,  2.006, 0.0, 0.720 },
+    { "GEO",             40,   0.05, 0.05, 1.0027, 0.0002, 0.0002 }
+};
+
+#define BENCH_GROUPS        (int)(sizeof(bench_groups) / sizeof(bench_groups[0]))
+#define BENCH_MAX           512
+
+static SAT_POS_DATA bench_sat[BENCH_MAX];
+static SAT_ORBIT    bench_orbit[BENCH_MAX];
+static int          bench_group_of[BENCH_MAX];
+static char         bench_visible[BENCH_MAX];
+
+/** bench_spread
+ *
+ * @return double Repeatable pseudo random number in [-1, 1).
+ */
+static double bench_spread(void) {
+    return 2. * bench_random() - 1.;
+}
+
+/** bench_make
+ *
+ * Make a satellite of a group. The elements are filled in as 
+ * Get_Next_Tle_Set() would leave them and loaded the way 
+ * satapi_load() does.
+ */
+static void bench_make(SAT_POS_DATA *q, SAT_ORBIT *o, BENCH_GROUP *g, int n) {
+    tle_t tle;
+    
+    memset(&tle, 0, sizeof(tle));
+    tle.catnr  = 90000 + n;
+    tle.epoch  = BENCH_EPOCH;
+    tle.bstar  = g->revs > 10. ? 1e-4 : 0.;
+    tle.xincl  = fabs(g->incl + g->incl_spread * bench_spread());
+    tle.xnodeo = 180. + 180. * bench_spread();
+    tle.eo     = g->ecc;
+    tle.omegao = 180. + 180. * bench_spread();
+    tle.xmo    = 180. + 180. * bench_spread();
+    tle.xno    = g->revs + g->revs_spread * bench_spread();
+    sprintf(tle.sat_name, "%s %d", g->name, n);
+    
+    select_ephemeris(&tle);
+    satapi_orbit(&tle, o);
+    
+    memset(q, 0, sizeof(*q));
+    strcpy(q->elements[0], tle.sat_name);
+    sgp4_init(&q->sat.ctx, &tle);
+    q->sat.jd_epoch = Julian_Date_of_Epoch(tle.epoch);
+    q->sat.is_valid = 1;
+}
+
+/** bench_pass
+ *
+ * @return int 1 if the satellite rises above BENCH_MIN_EL in the span.
+ */
+static int bench_pass(SAT_POS_DATA *q) {
+    SAT_PASS pass;
+    
+    observer_now(q);
+    return satapi_next_pass(q, 0., BENCH_SPAN, BENCH_MIN_EL, &pass) == 0;
+}
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    static char full_pass[BENCH_MAX], filtered_pass[BENCH_MAX];
+    int culled[BENCH_GROUPS], kept_pass[BENCH_GROUPS], size[BENCH_GROUPS];
+    int i, j, n = 0, fixed = 0, kept = 0, passes = 0, false_rejects = 0;
+    double t0, full, filtered, classify;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 6; t.hour = 18; t.is_valid = 1;
+    host_set_time(&t);
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    
+    for (i = 0; i < BENCH_GROUPS; i++) {
+        culled[i] = kept_pass[i] = 0;
+        size[i] = bench_groups[i].count;
+        for (j = 0; j < bench_groups[i].count && n < BENCH_MAX; j++, n++) {
+            bench_make(&bench_sat[n], &bench_orbit[n], &bench_groups[i], n);
+            bench_group_of[n] = i;
+        }
+    }
+    
+    /* Every satellite searched, as without the filter. */
+    t0 = host_seconds();
+    for (i = 0; i < n; i++) full_pass[i] = bench_pass(&bench_sat[i]);
+    full = host_seconds() - t0;
+    
+    /* Classed once for the site, which is all satapi_sky.c does when
+       the catalog is loaded or the site moves. */
+    t0 = host_seconds();
+    for (i = 0; i < n; i++) {
+        bench_visible[i] = satapi_orbit_visible(&bench_orbit[i], l.latitude, BENCH_MIN_EL);
+    }
+    classify = host_seconds() - t0;
+    
+    /* The same search skipping the culled satellites. A geostationary
+       satellite stays where it is, one sample says if it is up. */
+    t0 = host_seconds();
+    for (i = 0; i < n; i++) {
+        filtered_pass[i] = 0;
+        if (!bench_visible[i]) continue;
+        if (bench_orbit[i].fixed) {
+            observer_now(&bench_sat[i]);
+            bench_sat[i].tsince = 0.;
+            satapi_calculate(&bench_sat[i], SAT_OUT_AZEL);
+            filtered_pass[i] = bench_sat[i].elevation > BENCH_MIN_EL;
+        }
+        else {
+            filtered_pass[i] = bench_pass(&bench_sat[i]);
+        }
+    }
+    filtered = host_seconds() - t0 + classify;
+    
+    for (i = 0; i < n; i++) {
+        j = bench_group_of[i];
+        if (!bench_visible[i]) {
+            culled[j]++;
+            false_rejects += full_pass[i];
+        }
+        else {
+            kept++;
+            fixed += bench_orbit[i].fixed;
+            kept_pass[j] += filtered_pass[i];
+            passes += filtered_pass[i];
+        }
+    }
+    
+    printf("site %.1fN, min elevation %.0f, %.0f hour search\n\n", l.latitude, BENCH_MIN_EL, BENCH_SPAN / 3600.);
+    printf("%-16s %5s %6s %5s %10s\n", "group", "sats", "culled", "kept", "kept pass");
+    for (i = 0; i < BENCH_GROUPS; i++) {
+        printf("%-16s %5d %6d %5d %10d\n", bench_groups[i].name, size[i], 
+            culled[i], size[i] - culled[i], kept_pass[i]);
+    }
+    printf("\n%d satellites, %d culled, %d kept of which %d geostationary\n", n, n - kept, kept, fixed);
+    printf("hit rate %.1f%% (%d of the kept satellites are or come up), %d false rejects\n", 
+        100. * passes / kept, passes, false_rejects);
+    printf("full scan %.1f ms, filtered %.1f ms (classing %.3f ms), %.1f%% saved\n", 
+        full * 1e3, filtered * 1e3, classify * 1e3, 100. * (full - filtered) / full);
+    
+    return false_rejects != 0;
+}
@@ -0,0 +1,152 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the session scheduler in satapi_session.c. A 
+   made up catalog of low orbit satellites is put in the sky engine 
+   and its pass table filled in. Sessions are then planned over the 
+   evening for each goal, with the mount starting parked. Each plan 
+   is checked to leave time to slew from one pass to the next, and is
+   set against picking by hand: after each pass, go to the next one 
+   to rise that can still be caught. It also times the planning, on 
+   each call to satapi_session_process() and in all. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+#define BENCH_EPOCH         10278.5
+#define BENCH_SATS          20
+#define BENCH_HOURS         6.
+
+/* As SESSION_MIN_EL and SESSION_SETTLE. */
+#define BENCH_MIN_EL        10.
+#define BENCH_SETTLE        15.
+
+/** bench_move
+ *
+ * @return double Seconds to slew between two azimuths at BENCH_MIN_EL
+ * and settle.
+ */
+static double bench_move(double az1, double az2) {
+    return bench_slew(BENCH_MIN_EL, az1, BENCH_MIN_EL, az2) + BENCH_SETTLE;
+}
+
+/** bench_check
+ *
+ * @return int Non-zero if each pass of the plan is joined in its 
+ * span and after the one before it has set and the mount has slewed.
+ */
+static int bench_check(int goal, int32_t now) {
+    SAT_SESSION_ITEM *s, *p = NULL;
+    int32_t ready;
+    int i;
+    
+    for (i = 0; (s = satapi_session_get(i)) != NULL; p = s, i++) {
+        ready = p == NULL ? now : p->pass.aos + p->pass.los;
+        if (s->start < ready + (int32_t)s->slew || s->start < s->pass.aos) return 0;
+        if (p != NULL && s->slew < bench_move(p->pass.los_azimuth / 100., s->pass.aos_azimuth / 100.) - 0.01) return 0;
+        if (goal == SAT_SESSION_PASSES && s->start > s->pass.aos + s->pass.tca) return 0;
+        if (s->start > s->pass.aos + s->pass.los) return 0;
+    }
+    return 1;
+}
+
+/** bench_by_hand
+ *
+ * @return int The passes caught before their highest point by going,
+ * after each pass, to the next to rise that can still be caught.
+ */
+static int bench_by_hand(int32_t now, int32_t end, double azimuth) {
+    SAT_PASS_ENTRY *e;
+    double ready = now;
+    int i, caught = 0;
+    
+    for (i = 0; (e = satapi_passes_get(i)) != NULL && e->aos < end; i++) {
+        double arrive = ready + bench_move(azimuth, e->aos_azimuth / 100.);
+        if (arrive > e->aos + e->tca) continue;
+        caught++;
+        ready = e->aos + e->los;
+        azimuth = e->los_azimuth / 100.;
+    }
+    return caught;
+}
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    char elements[3][80], name[16];
+    const char *goals[] = { "most passes", "most elevation-weighted time" };
+    double t0, t1, worst, all, score;
+    int32_t now;
+    int i, goal, planned, calls, loaded = 0;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 6; t.hour = 18; t.is_valid = 1;
+    host_set_time(&t);
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    host_set_pointing(0., 0.);
+    
+    /* Low orbits at a spread of inclinations, planes and heights. */
+    satapi_sky_clear();
+    for (i = 0; i < BENCH_SATS; i++) {
+        sprintf(name, "LEO %d", i);
+        bench_tle(elements, name, 92000 + i, BENCH_EPOCH, 0., 50. + (i * 37) % 50, fmod(i * 67., 360.), 
+            0.001 + 0.00005 * i, 90., fmod(i * 131., 360.), 12.4 + 0.1 * i);
+        if (satapi_sky_add(elements) == 0) loaded++;
+    }
+    
+    for (i = 0; i < 20000; i++) satapi_passes_process();
+    now = (int32_t)((gps_julian_date(&t) - satapi_passes_jd()) * 86400.);
+    printf("%d satellites, %d passes in the table\n\n", loaded, satapi_passes_count());
+    
+    for (goal = SAT_SESSION_PASSES; goal <= SAT_SESSION_WEIGHTED; goal++) {
+        printf("Session for the %s over %.0f hours:\n", goals[goal], BENCH_HOURS);
+        
+        t0 = host_seconds();
+        planned = satapi_session_plan(BENCH_HOURS, 0, goal);
+        worst = host_seconds() - t0;
+        for (calls = 0; satapi_session_count() < 0; calls++) {
+            t1 = host_seconds();
+            satapi_session_process();
+            t1 = host_seconds() - t1;
+            if (t1 > worst) worst = t1;
+        }
+        all = host_seconds() - t0;
+        
+        for (i = 0, score = 0.; satapi_session_get(i) != NULL; i++) score += satapi_session_get(i)->score;
+        printf("%d of %d passes, %.0f deg s, plan %s\n", satapi_session_count(), planned, score,
+            bench_check(goal, now) ? "can be flown" : "CANNOT BE FLOWN");
+        if (goal == SAT_SESSION_PASSES) {
+            printf("by hand, next to rise that can be caught: %d passes\n", 
+                bench_by_hand(now, now + (int32_t)(BENCH_HOURS * 3600.), 0.));
+        }
+        printf("planned in %d calls, %.1f us in all, at most %.1f us a call\n\n", calls, all * 1e6, worst * 1e6);
+    }
+    
+    return 0;
+}
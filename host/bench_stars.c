@@ -0,0 +1,223 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the catalog searches in star.c. At random points
+   over the sky, with more taken near the poles and either side of RA
+   0/360, it checks star_cone(), star_nearest(), star_knearest() and 
+   star_closest() against a scan of the whole packed catalog, then 
+   times each against the scan. It prints the points where they differ,
+   the time per query and the size of the catalog. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "star.h"
+#include "host_hal.h"
+
+#define BENCH_POINTS        20000
+#define BENCH_RADIUS        5.0
+#define BENCH_MAG           5.0
+#define BENCH_K             8
+#define BENCH_FOUND         512
+
+static RaDec bench_points[BENCH_POINTS];
+
+/** bench_star_separation
+ *
+ * @return double Degrees between a point and a star.
+ */
+static double bench_star_separation(RaDec *p, const packedStarData *s) {
+    double c, dra;
+    
+    /* de2ra is short of pi / 180 by a part in 1E9, too much for an RA
+       difference near 360 degrees. */
+    dra = fabs(p->ra - STAR_RA(s));
+    if (dra > 180.) dra = 360. - dra;
+    c = sin(Radians(p->dec)) * sin(Radians(STAR_DEC(s))) + cos(Radians(p->dec)) * cos(Radians(STAR_DEC(s))) * cos(Radians(dra));
+    if (c > 1.) c = 1.;
+    return Degrees(acos(c));
+}
+
+/** bench_scan_cone
+ *
+ * star_cone() by a scan of the whole catalog, in catalog order.
+ */
+static int bench_scan_cone(RaDec *p, double radius, double mag, int *found, int max) {
+    int i, n = 0;
+    
+    for (i = 0; i < STAR_COUNT && n < max; i++) {
+        if (STAR_MAG(&star_packed[i]) > mag + 1E-6) continue;
+        if (bench_star_separation(p, &star_packed[i]) <= radius) found[n++] = i;
+    }
+    return n;
+}
+
+/** bench_scan_knearest
+ *
+ * star_knearest() by a scan of the whole catalog.
+ */
+static int bench_scan_knearest(RaDec *p, double mag, int k, int *found, double *sep) {
+    double d;
+    int i, j, n = 0;
+    
+    for (i = 0; i < STAR_COUNT; i++) {
+        if (STAR_MAG(&star_packed[i]) > mag + 1E-6) continue;
+        d = bench_star_separation(p, &star_packed[i]);
+        if (n == k && d >= sep[n - 1]) continue;
+        j = n < k ? n++ : n - 1;
+        for (; j > 0 && sep[j - 1] > d; j--) {
+            sep[j] = sep[j - 1];
+            found[j] = found[j - 1];
+        }
+        sep[j] = d;
+        found[j] = i;
+    }
+    return n;
+}
+
+/** bench_scan_brightest
+ *
+ * star_closest() by a scan of the whole catalog.
+ *
+ * @return int The catalog index of the star, -1 if there is none.
+ */
+static int bench_scan_brightest(RaDec *p, double radius) {
+    int i, best = -1;
+    
+    for (i = 0; i < STAR_COUNT; i++) {
+        if (best >= 0 && star_packed[i].mag >= star_packed[best].mag) continue;
+        if (bench_star_separation(p, &star_packed[i]) <= radius) best = i;
+    }
+    return best;
+}
+
+static int bench_int_compare(const void *a, const void *b) {
+    return *(const int *)a - *(const int *)b;
+}
+
+/** bench_check
+ *
+ * Check the searches at one point against the scans.
+ *
+ * @return int The number of differences.
+ */
+static int bench_check(RaDec *p) {
+    int a[BENCH_FOUND], b[BENCH_FOUND], na, nb, i, bad = 0;
+    double sa[STAR_KNEAREST_MAX], sb[STAR_KNEAREST_MAX];
+    basicStarData star;
+    
+    na = star_cone(p, BENCH_RADIUS, BENCH_MAG, a, BENCH_FOUND);
+    nb = bench_scan_cone(p, BENCH_RADIUS, BENCH_MAG, b, BENCH_FOUND);
+    qsort(a, na, sizeof(int), bench_int_compare);
+    if (na != nb || memcmp(a, b, na * sizeof(int))) {
+        printf("  cone at %.4f %.4f: %d stars, the scan %d\n", p->ra, p->dec, na, nb);
+        bad++;
+    }
+    
+    /* Equal separations may come in either order, so compare those. */
+    na = star_knearest(p, BENCH_MAG, BENCH_K, a, sa);
+    nb = bench_scan_knearest(p, BENCH_MAG, BENCH_K, b, sb);
+    for (i = 0; i < na && i < nb; i++) {
+        if (fabs(sa[i] - sb[i]) > 1E-9) break;
+    }
+    if (na != nb || i != na) {
+        printf("  %d nearest at %.4f %.4f: %d stars, the scan %d, differ from the %d\n", BENCH_K, p->ra, p->dec, na, nb, i + 1);
+        bad++;
+    }
+    
+    if (star_nearest(p, BENCH_MAG, sa) != b[0] && fabs(sa[0] - sb[0]) > 1E-9) {
+        printf("  nearest at %.4f %.4f: not HR%d\n", p->ra, p->dec, get_bright_star(b[0], &star)->hr);
+        bad++;
+    }
+    
+    /* Stars of the same magnitude may come in either order. */
+    i = bench_scan_brightest(p, BENCH_RADIUS);
+    if (star_closest(p, &star) == NULL ? i >= 0 : i < 0 || star.mag != (float)STAR_MAG(&star_packed[i])) {
+        printf("  brightest at %.4f %.4f: not HR%d\n", p->ra, p->dec, i < 0 ? 0 : (int)star_packed[i].hr);
+        bad++;
+    }
+    
+    return bad;
+}
+
+int main(void) {
+    int found[BENCH_FOUND];
+    double sep[STAR_KNEAREST_MAX], t0, t_index, t_scan;
+    basicStarData star;
+    long total = 0;
+    int i, bad = 0;
+    
+    srand(1);
+    for (i = 0; i < BENCH_POINTS; i++) {
+        bench_points[i].ra  = 360. * rand() / RAND_MAX;
+        bench_points[i].dec = Degrees(asin(2. * rand() / RAND_MAX - 1.));
+        switch (i % 8) {
+            case 0: bench_points[i].dec = (i & 8 ? 1 : -1) * (90. - 6. * rand() / RAND_MAX); break;
+            case 1: bench_points[i].ra  = 6. * rand() / RAND_MAX; break;
+            case 2: bench_points[i].ra  = 360. - 6. * rand() / RAND_MAX; break;
+        }
+    }
+    bench_points[0].ra = 0.;   bench_points[0].dec = 90.;
+    bench_points[1].ra = 180.; bench_points[1].dec = -90.;
+    bench_points[2].ra = 0.;   bench_points[2].dec = 0.;
+    bench_points[3].ra = 360.; bench_points[3].dec = -20.;
+    
+    printf("Star searches, %d points, %.0f degree cones and %d nearest, mag %.1f\n", BENCH_POINTS, BENCH_RADIUS, BENCH_K, BENCH_MAG);
+    for (i = 0; i < BENCH_POINTS; i++) bad += bench_check(&bench_points[i]);
+    printf("  %d differences from the scan\n", bad);
+    
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total += bench_scan_cone(&bench_points[i], BENCH_RADIUS, BENCH_MAG, found, BENCH_FOUND);
+    t_scan = host_seconds() - t0;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total -= star_cone(&bench_points[i], BENCH_RADIUS, BENCH_MAG, found, BENCH_FOUND);
+    t_index = host_seconds() - t0;
+    printf("  cone:      scan %8.2f us, index %6.2f us, x%.0f\n", t_scan * 1E6 / BENCH_POINTS, t_index * 1E6 / BENCH_POINTS, t_scan / t_index);
+    
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total += bench_scan_knearest(&bench_points[i], BENCH_MAG, BENCH_K, found, sep);
+    t_scan = host_seconds() - t0;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total -= star_knearest(&bench_points[i], BENCH_MAG, BENCH_K, found, sep);
+    t_index = host_seconds() - t0;
+    printf("  %d nearest: scan %8.2f us, index %6.2f us, x%.0f\n", BENCH_K, t_scan * 1E6 / BENCH_POINTS, t_index * 1E6 / BENCH_POINTS, t_scan / t_index);
+    
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total += bench_scan_knearest(&bench_points[i], BENCH_MAG, 1, found, sep);
+    t_scan = host_seconds() - t0;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total -= star_nearest(&bench_points[i], BENCH_MAG, sep) >= 0;
+    t_index = host_seconds() - t0;
+    printf("  nearest:   scan %8.2f us, index %6.2f us, x%.0f\n", t_scan * 1E6 / BENCH_POINTS, t_index * 1E6 / BENCH_POINTS, t_scan / t_index);
+    
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total += bench_scan_brightest(&bench_points[i], BENCH_RADIUS) >= 0;
+    t_scan = host_seconds() - t0;
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_POINTS; i++) total -= star_closest(&bench_points[i], &star) != NULL;
+    t_index = host_seconds() - t0;
+    printf("  brightest: scan %8.2f us, index %6.2f us, x%.0f\n", t_scan * 1E6 / BENCH_POINTS, t_index * 1E6 / BENCH_POINTS, t_scan / t_index);
+    
+    printf("  catalog %d stars, %d bytes\n", STAR_COUNT, (int)(STAR_COUNT * sizeof(packedStarData) + sizeof(star_zone_start)));
+    
+    if (total != 0) printf("  the searches and scans found %ld more or fewer stars\n", total);
+    return bad != 0 || total != 0;
+}
@@ -0,0 +1,137 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the look-ahead track in satapi_track.c. It 
+   finds a high pass of the ISS and steps the RIT uptime through it a
+   millisecond at a time, calling satapi_track_process() every 20 ms
+   as the process loop would and satapi_track_read() every 10 ms as 
+   the RIT callback does. What is read is checked against 
+   satapi_calculate() at that time. The process loop is held up 
+   twice, once for less than the ring holds and once for more, to 
+   show the counters. It also times a read. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+static char bench_elements[3][80] = {
+    "ISS (ZARYA)",
+    "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147",
+    "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777"
+};
+
+#define BENCH_UPTIME        1000        /* Uptime at the start, milliseconds. */
+#define BENCH_PROCESS_MS    20
+#define BENCH_READ_MS       10
+#define BENCH_READS         1000000
+
+/* Times the process loop is held up, seconds after the start. */
+#define BENCH_STALL1        120
+#define BENCH_STALL1_LEN    4
+#define BENCH_STALL2        240
+#define BENCH_STALL2_LEN    10
+
+int main(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    SAT_POS_DATA q;
+    SAT_PASS pass;
+    SAT_TRACK_SAMPLE s;
+    SAT_TRACK_COUNTERS c;
+    double from, end, err, rate, worst = 0., worst_rate = 0., az0, el0, t0, sum = 0.;
+    uint32_t ms;
+    int i, stalled;
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 5; t.hour = 12; t.is_valid = 1;
+    host_set_time(&t);
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    
+    /* A pass that goes over 30 degrees. */
+    memset(&q, 0, sizeof(q));
+    for (i = 0; i < 3; i++) strcpy(q.elements[i], bench_elements[i]);
+    observer_now(&q);
+    for (from = 0.; satapi_next_pass(&q, from, 86400., 10., &pass) == 0; from = pass.los + 60.) {
+        if (pass.tca_elevation > 30.) break;
+    }
+    printf("pass of %.1f deg, %.0f s long\n", pass.tca_elevation, pass.los - pass.aos);
+    
+    /* Start a little before AOS, on an odd hundredth of a second. */
+    bench_time(gps_julian_date(&q.time) + (pass.aos - 30.43) / 86400., &t);
+    host_set_time(&t);
+    host_set_uptime(BENCH_UPTIME);
+    if (satapi_track_start(bench_elements) != 0) {
+        printf("could not start tracking\n");
+        return 1;
+    }
+    observer_now(&q);
+    end = pass.los - pass.aos + 60.;
+    
+    for (ms = BENCH_UPTIME; ms < BENCH_UPTIME + end * 1000.; ms++) {
+        host_set_uptime(ms);
+        stalled = (ms - BENCH_UPTIME >= BENCH_STALL1 * 1000 && ms - BENCH_UPTIME < (BENCH_STALL1 + BENCH_STALL1_LEN) * 1000) ||
+            (ms - BENCH_UPTIME >= BENCH_STALL2 * 1000 && ms - BENCH_UPTIME < (BENCH_STALL2 + BENCH_STALL2_LEN) * 1000);
+        if (ms % BENCH_PROCESS_MS == 0 && !stalled) satapi_track_process();
+        if (ms % BENCH_READ_MS != 0 || satapi_track_read(ms, &s) != 0) continue;
+        
+        /* The truth, and its rates across 100 ms. */
+        q.tsince = (ms - BENCH_UPTIME) / 1000. - 0.05;
+        satapi_calculate(&q, SAT_OUT_AZEL);
+        az0 = q.azimuth; el0 = q.elevation;
+        q.tsince += 0.1;
+        satapi_calculate(&q, SAT_OUT_AZEL);
+        rate = fabs(s.elevation_rate - (q.elevation - el0) / 0.1);
+        if (q.elevation > 0.) {
+            err = fabs(s.azimuth_rate - (q.azimuth - az0 + (q.azimuth - az0 > 180. ? -360. : q.azimuth - az0 < -180. ? 360. : 0.)) / 0.1) * cos(Radians(q.elevation));
+            if (err > rate) rate = err;
+            if (rate > worst_rate) worst_rate = rate;
+        }
+        q.tsince -= 0.05;
+        satapi_calculate(&q, SAT_OUT_AZEL);
+        err = bench_separation(s.azimuth, s.elevation, q.azimuth, q.elevation);
+        if (err > worst) worst = err;
+    }
+    
+    satapi_track_counters(&c);
+    printf("%u reads, %u underruns, %u samples skipped, at least %d ms ahead\n", 
+        c.reads, c.underruns, c.skipped, (int)c.least_ahead);
+    printf("held up %d s and %d s, the ring holds %.1f s\n", BENCH_STALL1_LEN, BENCH_STALL2_LEN, 31 * 0.2);
+    printf("worst error read %.2f\", in rate %.5f deg/s\n", worst, worst_rate);
+    
+    /* A read at the same time, over and over. */
+    satapi_track_process();
+    t0 = host_seconds();
+    for (i = 0; i < BENCH_READS; i++) {
+        satapi_track_read(ms + (i & 63), &s);
+        sum += s.azimuth;
+    }
+    printf("read %.1f ns\n", (host_seconds() - t0) / BENCH_READS * 1e9);
+    
+    satapi_track_stop();
+    return sum == 12345. ? 1 : 0;
+}
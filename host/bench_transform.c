@@ -0,0 +1,186 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the batch transforms in satapi_transform.c. A 
+   grid over the whole sky, and points just either side of the 
+   meridian, are put through radec2altaz() and radec2altaz_batch() at
+   a St Andrews sidereal time, and both answers back through 
+   altaz2radec() and altaz2radec_batch(). It prints the time per 
+   point, the disagreement going forward and the round trip error 
+   coming back, worst over all points and over those on the meridian.
+   The frame versions are compared the same way. Errors are angles on
+   the sky in arc seconds. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "host_hal.h"
+
+#define BENCH_SIDEREAL      123.4567    /* Degrees. */
+#define BENCH_REPEAT        50
+#define BENCH_POINTS        20000
+
+static RaDec radec[BENCH_POINTS], back[BENCH_POINTS];
+static AltAz altaz[BENCH_POINTS], ref[BENCH_POINTS];
+static char meridian[BENCH_POINTS];
+
+/** bench_grid
+ *
+ * The sky every 2 degrees to within 2 of the poles, then hour 
+ * angles from 1E-6 to 1 degree either side of the meridian at 
+ * declinations from -30 to 88.
+ *
+ * @return int The number of points.
+ */
+static int bench_grid(void) {
+    static const double ha[] = { 1E-6, 1E-4, 1E-2, 1. };
+    double ra, dec;
+    int i, j, n = 0;
+    
+    for (ra = 0.; ra < 360.; ra += 2.) {
+        for (dec = -88.; dec <= 88.; dec += 2.) {
+            radec[n].ra = ra; radec[n].dec = dec; meridian[n] = 0;
+            n++;
+        }
+    }
+    for (dec = -30.; dec <= 88.; dec += 2.) {
+        for (i = 0; i < 4; i++) {
+            for (j = -1; j <= 1; j += 2) {
+                radec[n].ra = BENCH_SIDEREAL + j * ha[i]; radec[n].dec = dec; meridian[n] = 1;
+                n++;
+            }
+        }
+    }
+    return n;
+}
+
+/** bench_sep
+ *
+ * @return double Arc seconds between two directions, by atan2() so 
+ * it is good for tiny angles.
+ */
+static double bench_sep(double lon1, double lat1, double lon2, double lat2) {
+    double a[3], b[3], c[3], r = M_PI / 180.;
+    
+    /* Not de2ra, which is short enough to part RA 0 and 360. */
+    lon1 *= r; lat1 *= r; lon2 *= r; lat2 *= r;
+    a[0] = cos(lat1) * cos(lon1); a[1] = cos(lat1) * sin(lon1); a[2] = sin(lat1);
+    b[0] = cos(lat2) * cos(lon2); b[1] = cos(lat2) * sin(lon2); b[2] = sin(lat2);
+    c[0] = a[1] * b[2] - a[2] * b[1];
+    c[1] = a[2] * b[0] - a[0] * b[2];
+    c[2] = a[0] * b[1] - a[1] * b[0];
+    return atan2(sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]), a[0] * b[0] + a[1] * b[1] + a[2] * b[2]) * 206264.806;
+}
+
+/** bench_forward
+ *
+ * Print the worst angle between the Alt/Az in altaz[] and ref[].
+ */
+static void bench_forward(const char *name, int n, double t_ref, double t_batch) {
+    double d, worst = 0.;
+    int i;
+    
+    for (i = 0; i < n; i++) {
+        d = bench_sep(altaz[i].azm, altaz[i].alt, ref[i].azm, ref[i].alt);
+        if (d > worst) worst = d;
+    }
+    printf("%-26s %6.3f %6.3f us/point, differ by %.1e\"\n", name, t_ref * 1E6 / n, t_batch * 1E6 / n, worst);
+}
+
+/** bench_back
+ *
+ * Print the worst round trip error of back[] against radec[], with
+ * the declination folded into -90 to 90 as altaz2radec() leaves it 
+ * in 0 to 360.
+ */
+static void bench_back(const char *name, int n, double t) {
+    double d, dec, worst = 0., worst_meridian = 0.;
+    int i, bad = 0;
+    
+    for (i = 0; i < n; i++) {
+        dec = back[i].dec > 180. ? back[i].dec - 360. : back[i].dec;
+        d = bench_sep(back[i].ra, dec, radec[i].ra, radec[i].dec);
+        if (d != d) { bad++; continue; }
+        if (d > worst) worst = d;
+        if (meridian[i] && d > worst_meridian) worst_meridian = d;
+    }
+    printf("%-26s %6.3f us/point, round trip %.1e\", on the meridian %.1e\", %d NaN\n", 
+        name, t * 1E6 / n, worst, worst_meridian, bad);
+}
+
+int main(void) {
+    GPS_LOCATION_AVERAGE l;
+    GPS_TIME gt;
+    SAT_TRANSFORM t;
+    obs_frame_t frame;
+    double t0, t_ref, t_batch;
+    int i, k, n;
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    
+    n = bench_grid();
+    printf("%d points, %d on the meridian\n", n, n - 180 * 89);
+    
+    t0 = host_seconds();
+    for (k = 0; k < BENCH_REPEAT; k++) {
+        for (i = 0; i < n; i++) radec2altaz(BENCH_SIDEREAL, &l, &radec[i], &ref[i]);
+    }
+    t_ref = (host_seconds() - t0) / BENCH_REPEAT;
+    t0 = host_seconds();
+    for (k = 0; k < BENCH_REPEAT; k++) {
+        satapi_transform_site(BENCH_SIDEREAL, &l, &t);
+        radec2altaz_batch(&t, radec, altaz, n);
+    }
+    t_batch = (host_seconds() - t0) / BENCH_REPEAT;
+    bench_forward("radec2altaz / batch", n, t_ref, t_batch);
+    
+    t0 = host_seconds();
+    for (k = 0; k < BENCH_REPEAT; k++) {
+        for (i = 0; i < n; i++) altaz2radec(BENCH_SIDEREAL, &l, &ref[i], &back[i]);
+    }
+    bench_back("altaz2radec", n, (host_seconds() - t0) / BENCH_REPEAT);
+    t0 = host_seconds();
+    for (k = 0; k < BENCH_REPEAT; k++) {
+        satapi_transform_site(BENCH_SIDEREAL, &l, &t);
+        altaz2radec_batch(&t, altaz, back, n);
+    }
+    bench_back("altaz2radec_batch", n, (host_seconds() - t0) / BENCH_REPEAT);
+    
+    memset(&gt, 0, sizeof(gt));
+    gt.year = 2010; gt.month = 10; gt.day = 5; gt.hour = 21; gt.is_valid = 1;
+    satapi_observer_frame(&l, gps_julian_date(&gt), &frame);
+    t0 = host_seconds();
+    for (k = 0; k < BENCH_REPEAT; k++) {
+        for (i = 0; i < n; i++) radec2altaz_frame(&frame, &radec[i], &ref[i]);
+    }
+    t_ref = (host_seconds() - t0) / BENCH_REPEAT;
+    t0 = host_seconds();
+    for (k = 0; k < BENCH_REPEAT; k++) {
+        satapi_transform_frame(&frame, &t);
+        radec2altaz_batch(&t, radec, altaz, n);
+    }
+    t_batch = (host_seconds() - t0) / BENCH_REPEAT;
+    bench_forward("radec2altaz_frame / batch", n, t_ref, t_batch);
+    return 0;
+}
@@ -0,0 +1,138 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include "sowb.h"
+#include "satapi.h"
+#include "bench_util.h"
+
+static uint32_t bench_seed = 12345;
+
+/** bench_time
+ *
+ * Fill in a GPS_TIME from a Julian date (Meeus, Astronomical 
+ * Algorithms, chapter 7), to the hundredth of a second.
+ */
+void bench_time(double jd, GPS_TIME *t) {
+    double z, f, a, b, c, d, e, day;
+    long cs;
+    
+    z = floor(jd + 0.5);
+    f = jd + 0.5 - z;
+    a = floor((z - 1867216.25) / 36524.25);
+    a = z + 1 + a - floor(a / 4);
+    b = a + 1524;
+    c = floor((b - 122.1) / 365.25);
+    d = floor(365.25 * c);
+    e = floor((b - d) / 30.6001);
+    day = b - d - floor(30.6001 * e);
+    
+    memset(t, 0, sizeof(GPS_TIME));
+    t->month = (char)(e < 14 ? e - 1 : e - 13);
+    t->year  = (int)(t->month > 2 ? c - 4716 : c - 4715);
+    t->day   = (char)day;
+    cs = (long)floor(f * 8640000. + 0.5);
+    t->hour     = (char)(cs / 360000);
+    t->minute   = (char)(cs / 6000 % 60);
+    t->second   = (char)(cs / 100 % 60);
+    t->tenth    = (char)(cs / 10 % 10);
+    t->hundreth = (char)(cs % 10);
+    t->is_valid = 1;
+}
+
+/** bench_separation
+ *
+ * @return double Arc seconds between two az/el positions.
+ */
+double bench_separation(double az1, double el1, double az2, double el2) {
+    double c;
+    
+    c = sin(Radians(el1)) * sin(Radians(el2)) + cos(Radians(el1)) * cos(Radians(el2)) * cos(Radians(az1 - az2));
+    return c >= 1. ? 0. : Degrees(acos(c)) * 3600.;
+}
+
+/** bench_slew
+ *
+ * @return double Seconds for the mount to slew between two el/az 
+ * positions, both axes at once at BENCH_SLEW_RATE.
+ */
+double bench_slew(double el1, double az1, double el2, double az2) {
+    double daz, del;
+    
+    daz = fabs(az1 - az2);
+    if (daz > 180.) daz = 360. - daz;
+    del = fabs(el1 - el2);
+    return (daz > del ? daz : del) / BENCH_SLEW_RATE;
+}
+
+/** bench_random
+ *
+ * @return double A repeatable pseudo random number, 0 to 1.
+ */
+double bench_random(void) {
+    bench_seed = bench_seed * 1103515245u + 12345u;
+    return ((bench_seed >> 8) & 0xFFFF) / 65536.;
+}
+
+/** bench_checksum
+ *
+ * Append the TLE checksum digit to a line.
+ */
+static void bench_checksum(char *line) {
+    int i, sum = 0;
+    
+    for (i = 0; line[i]; i++) {
+        if (line[i] >= '0' && line[i] <= '9') sum += line[i] - '0';
+        if (line[i] == '-') sum++;
+    }
+    sprintf(line + i, "%d", sum % 10);
+}
+
+/** bench_tle
+ *
+ * Write a TLE, with its checksums. Angles are in degrees, the mean
+ * motion in revolutions a day and the epoch as in the TLE.
+ */
+void bench_tle(char e[3][80], const char *name, int catnr, double epoch, double bstar, 
+        double incl, double raan, double ecc, double argp, double m, double revs) {
+    sprintf(e[0], "%s", name);
+    sprintf(e[1], "1 %05dU 10001A   %014.8f  .00000000  00000-0  %05d-3 0  999", 
+        catnr % 100000, epoch, (int)(bstar * 1e8 + 0.5));
+    bench_checksum(e[1]);
+    sprintf(e[2], "2 %05d %8.4f %8.4f %07d %8.4f %8.4f %11.8f%05d", catnr % 100000,
+        incl, raan, (int)(ecc * 1e7 + 0.5), argp, m, revs, 1);
+    bench_checksum(e[2]);
+}
+
+/** bench_hms
+ *
+ * Format seconds from the start as hh:mm:ss.s
+ */
+char *bench_hms(double t, char *s) {
+    long n = (long)floor(t);
+    
+    sprintf(s, "%02ld:%02ld:%04.1f", n / 3600, (n / 60) % 60, fmod(t, 60.));
+    return s;
+}
@@ -0,0 +1,40 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include "gps.h"
+
+/* As NEXSTAR_SLEW_RATE, degrees a second on the faster axis. */
+#define BENCH_SLEW_RATE     4.
+
+/* Helpers shared by the benchmarks, see bench_util.c. */
+void    bench_time(double jd, GPS_TIME *t);
+double  bench_separation(double az1, double el1, double az2, double el2);
+double  bench_slew(double el1, double az1, double el2, double az2);
+double  bench_random(void);
+void    bench_tle(char e[3][80], const char *name, int catnr, double epoch, double bstar, 
+            double incl, double raan, double ecc, double argp, double m, double revs);
+char   *bench_hms(double t, char *s);
+
+#endif
@@ -0,0 +1,169 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Host benchmark for the star engine in satapi_stars.c. Through a 
+   night at the St Andrews site, every ten seconds, it calls 
+   satapi_stars_process() until the list is up to date and checks it
+   against every catalog star put through radec2altaz_frame(): stars 
+   missing from the list or in it but below the elevation, and the 
+   worst error in the positions. It prints those, the rises and sets
+   seen and the time per update against working out every star. 
+   Then it starts the engine to a magnitude with more stars than it
+   holds and checks that those it lists are the brightest. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "star.h"
+#include "host_hal.h"
+#include "bench_util.h"
+
+#define BENCH_MIN_EL        SAT_STARS_MIN_EL
+#define BENCH_MAX_MAG       SAT_STARS_MAX_MAG
+#define BENCH_FULL_MAG      4.0         /* More than SAT_STARS_MAX can rise. */
+#define BENCH_STEP          10.         /* Seconds. */
+#define BENCH_SPAN          (14. * 3600.)
+
+/* Stars this close to the elevation may be either side of it. */
+#define BENCH_EDGE          0.01
+
+/** bench_all
+ *
+ * Work out where every star bright enough is.
+ *
+ * @param obs_frame_t * The frame.
+ * @param double The faintest magnitude.
+ * @param AltAz * Filled in for each catalog index.
+ * @return int The number above the elevation.
+ */
+static int bench_all(obs_frame_t *frame, double max_mag, AltAz *altaz) {
+    basicStarData s;
+    RaDec radec;
+    int i, n = 0;
+    
+    for (i = 0; get_bright_star(i, &s) != NULL; i++) {
+        altaz[i].alt = -90.;
+        if (s.mag > max_mag) continue;
+        radec.ra = s.ra; radec.dec = s.dec;
+        radec2altaz_frame(frame, &radec, &altaz[i]);
+        if (altaz[i].alt > BENCH_MIN_EL) n++;
+    }
+    return n;
+}
+
+int main(void) {
+    static AltAz altaz[10000];
+    static char listed[10000];
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    obs_frame_t frame;
+    SAT_STAR *s;
+    double jd0, jd, t0, t_engine = 0., t_all = 0., d, err, worst = 0.;
+    int i, n, calls = 0, steps = 0, missing = 0, extra = 0, least = 9999, most = 0, prev = -1, changes = 0;
+    int faintest, up, brighter = 0;
+    
+    memset(&l, 0, sizeof(l));
+    l.north_south = 'N'; l.latitude  = 56.1920;
+    l.east_west   = 'W'; l.longitude = 3.0339;
+    l.height = 100.; l.is_valid = '1';
+    host_set_location(&l);
+    
+    memset(&t, 0, sizeof(t));
+    t.year = 2010; t.month = 10; t.day = 5; t.hour = 17; t.is_valid = 1;
+    host_set_time(&t);
+    jd0 = gps_julian_date(&t);
+    
+    satapi_stars_start(BENCH_MIN_EL, BENCH_MAX_MAG);
+    
+    for (d = 0.; d <= BENCH_SPAN; d += BENCH_STEP) {
+        jd = jd0 + d / 86400.;
+        bench_time(jd, &t);
+        host_set_time(&t);
+        jd = gps_julian_date(&t);
+        
+        t0 = host_seconds();
+        do {
+            satapi_stars_process();
+            calls++;
+        } while (satapi_stars_jd() != jd);
+        if (d > 0.) t_engine += host_seconds() - t0;
+        steps++;
+        
+        t0 = host_seconds();
+        satapi_observer_frame(&l, jd, &frame);
+        bench_all(&frame, BENCH_MAX_MAG, altaz);
+        t_all += host_seconds() - t0;
+        
+        n = satapi_stars_count();
+        if (n < least) least = n;
+        if (n > most) most = n;
+        memset(listed, 0, sizeof(listed));
+        for (i = 0; i < n; i++) {
+            s = satapi_stars_get(i);
+            listed[s->star] = 1;
+            if (altaz[s->star].alt < BENCH_MIN_EL - BENCH_EDGE) {
+                extra++;
+                printf("  HR%d listed at %.3f\n", (int)star_packed[s->star].hr, altaz[s->star].alt);
+            }
+            err = fabs(s->elevation - altaz[s->star].alt);
+            if (err > worst) worst = err;
+            err = fabs(s->azimuth - altaz[s->star].azm);
+            if (err > 180.) err = 360. - err;
+            err *= cos(Radians(altaz[s->star].alt));
+            if (err > worst) worst = err;
+        }
+        for (i = 0; i < STAR_COUNT; i++) {
+            if (!listed[i] && altaz[i].alt > BENCH_MIN_EL + BENCH_EDGE) {
+                missing++;
+                printf("  HR%d missing at %.3f\n", (int)star_packed[i].hr, altaz[i].alt);
+            }
+        }
+        if (prev >= 0 && n != prev) changes++;
+        prev = n;
+    }
+    
+    printf("Star engine, elevation %.0f, magnitude %.1f, %d steps of %.0f s\n", BENCH_MIN_EL, BENCH_MAX_MAG, steps, BENCH_STEP);
+    printf("  %d to %d stars up, the count changed %d times\n", least, most, changes);
+    printf("  %d missing, %d listed below the elevation, worst position error %.5f deg\n", missing, extra, worst);
+    printf("  %.1f process calls a step, update %.1f us, every star %.1f us\n", (double)calls / steps, 
+        t_engine * 1E6 / (steps - 1), t_all * 1E6 / steps);
+    
+    /* Too many stars for the engine. Every star up that is brighter
+       than the faintest listed should be listed. */
+    satapi_stars_start(BENCH_MIN_EL, BENCH_FULL_MAG);
+    do satapi_stars_process(); while (satapi_stars_jd() != jd);
+    satapi_observer_frame(&l, jd, &frame);
+    up = bench_all(&frame, BENCH_FULL_MAG, altaz);
+    n = satapi_stars_count();
+    memset(listed, 0, sizeof(listed));
+    for (i = 0, faintest = 0; i < n; i++) {
+        s = satapi_stars_get(i);
+        listed[s->star] = 1;
+        if (star_packed[s->star].mag > faintest) faintest = star_packed[s->star].mag;
+    }
+    for (i = 0; i < STAR_COUNT; i++) {
+        if (!listed[i] && altaz[i].alt > BENCH_MIN_EL + BENCH_EDGE && star_packed[i].mag < faintest) brighter++;
+    }
+    printf("Magnitude %.1f: %d stars up, %d listed to magnitude %.2f, %d left out, %d brighter left out\n", 
+        BENCH_FULL_MAG, up, n, faintest / 100. + STAR_MAG_MIN, satapi_stars_dropped(), brighter);
+    
+    return missing != 0 || extra != 0 || satapi_stars_dropped() == 0 || brighter != 0;
+}
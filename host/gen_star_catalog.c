@@ -0,0 +1,203 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Writes utils/star_packed.c, the packed catalog star.c searches (see
+   star.h), from brightstars[] in star_catalog.c. Run it with 
+   "make star_catalog" whenever the catalog changes. The empty rows of
+   brightstars[] (all zero but the HR number) and rows with the same 
+   position and magnitude as another are left out. It prints the worst
+   error of the fixed point. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "star.h"
+
+#define GEN_STARS           10000
+
+typedef struct _gen_star {
+    int             row, tier, zone;
+    packedStarData  p;
+} GEN_STAR;
+
+static GEN_STAR gen_stars[GEN_STARS];
+
+/** gen_compare_row
+ *
+ * qsort() order of rows of brightstars[]: position, then magnitude,
+ * then HR number, so repeats follow the first of them.
+ */
+static int gen_compare_row(const void *a, const void *b) {
+    const basicStarData *s = &brightstars[*(const int *)a], *t = &brightstars[*(const int *)b];
+    
+    if (s->ra != t->ra) return s->ra < t->ra ? -1 : 1;
+    if (s->dec != t->dec) return s->dec < t->dec ? -1 : 1;
+    if (s->mag != t->mag) return s->mag < t->mag ? -1 : 1;
+    return s->hr - t->hr;
+}
+
+/** gen_compare
+ *
+ * qsort() order of the packed catalog: tier, zone, RA, then row.
+ */
+static int gen_compare(const void *a, const void *b) {
+    const GEN_STAR *s = (const GEN_STAR *)a, *t = (const GEN_STAR *)b;
+    
+    if (s->tier != t->tier) return s->tier - t->tier;
+    if (s->zone != t->zone) return s->zone - t->zone;
+    if (s->p.ra != t->p.ra) return s->p.ra < t->p.ra ? -1 : 1;
+    return s->row - t->row;
+}
+
+/** gen_pack
+ *
+ * Pack a star and find its tier and zone, as star.c will.
+ */
+static void gen_pack(int row, GEN_STAR *g) {
+    const basicStarData *s = &brightstars[row];
+    int z;
+    
+    g->row  = row;
+    g->p.hr = s->hr;
+    g->p.ra = (uint32_t)floor(s->ra * (STAR_RA_STEPS / 360.) + 0.5) % STAR_RA_STEPS;
+    g->p.dec = (uint32_t)floor((s->dec + 90.) * (STAR_DEC_STEPS / 180.) + 0.5);
+    g->p.mag = (uint32_t)floor((s->mag - STAR_MAG_MIN) * 100. + 0.5);
+    
+    /* As star_zone() in star.c, from the packed declination. */
+    z = (int)floor((STAR_DEC(&g->p) + 90.) / STAR_ZONE_DEG);
+    g->zone = z < 0 ? 0 : (z >= STAR_ZONES ? STAR_ZONES - 1 : z);
+    
+    for (g->tier = 0; g->tier < STAR_TIERS - 1 && STAR_MAG(&g->p) >= STAR_TIER_MAG(g->tier + 1); g->tier++) ;
+}
+
+/** gen_error
+ *
+ * @return double The arc seconds between a star and its packed self.
+ */
+static double gen_error(const basicStarData *s, const packedStarData *p) {
+    double c, dra;
+    
+    dra = fabs(s->ra - STAR_RA(p));
+    if (dra > 180.) dra = 360. - dra;
+    c = sin(Radians(s->dec)) * sin(Radians(STAR_DEC(p))) + cos(Radians(s->dec)) * cos(Radians(STAR_DEC(p))) * cos(Radians(dra));
+    return c >= 1. ? 0. : Degrees(acos(c)) * 3600.;
+}
+
+int main(int argc, char **argv) {
+    static int rows[GEN_STARS];
+    static uint16_t start[STAR_TIERS * STAR_ZONES + 1];
+    const basicStarData *s, *t;
+    double e, worst = 0., worst_mag = 0.;
+    int i, j, n = 0, empty = 0, repeats = 0, nrows, tiers[STAR_TIERS] = { 0 };
+    FILE *fp;
+    
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s star_packed.c\n", argv[0]);
+        return 1;
+    }
+    
+    for (nrows = 0; brightstars[nrows].hr != 0; nrows++) {
+        if (nrows == GEN_STARS) {
+            fprintf(stderr, "more than %d stars\n", GEN_STARS);
+            return 1;
+        }
+        rows[nrows] = nrows;
+    }
+    qsort(rows, nrows, sizeof(int), gen_compare_row);
+    
+    for (i = 0; i < nrows; i++) {
+        s = &brightstars[rows[i]];
+        if (s->ra == 0. && s->dec == 0. && s->mag == 0.) { empty++; continue; }
+        if (i > 0) {
+            t = &brightstars[rows[i - 1]];
+            if (s->ra == t->ra && s->dec == t->dec && s->mag == t->mag) { repeats++; continue; }
+        }
+        gen_pack(rows[i], &gen_stars[n]);
+        e = gen_error(s, &gen_stars[n].p);
+        if (e > worst) worst = e;
+        e = fabs(s->mag - STAR_MAG(&gen_stars[n].p));
+        if (e > worst_mag) worst_mag = e;
+        tiers[gen_stars[n].tier]++;
+        n++;
+    }
+    qsort(gen_stars, n, sizeof(GEN_STAR), gen_compare);
+    
+    for (i = 0, j = 0; i <= STAR_TIERS * STAR_ZONES; i++) {
+        while (j < n && gen_stars[j].tier * STAR_ZONES + gen_stars[j].zone < i) j++;
+        start[i] = j;
+    }
+    
+    if ((fp = fopen(argv[1], "wb")) == NULL) {
+        perror(argv[1]);
+        return 1;
+    }
+    
+    /* The licence header of this file, with CRLF line endings as the
+       rest of utils/. */
+    fprintf(fp, "/****************************************************************************\r\n");
+    fprintf(fp, " *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd\r\n");
+    fprintf(fp, " *    \r\n");
+    fprintf(fp, " *    This file is part of the Satellite Observers Workbench (SOWB).\r\n");
+    fprintf(fp, " *\r\n");
+    fprintf(fp, " *    SOWB is free software: you can redistribute it and/or modify\r\n");
+    fprintf(fp, " *    it under the terms of the GNU General Public License as published by\r\n");
+    fprintf(fp, " *    the Free Software Foundation, either version 3 of the License, or\r\n");
+    fprintf(fp, " *    (at your option) any later version.\r\n");
+    fprintf(fp, " *\r\n");
+    fprintf(fp, " *    SOWB is distributed in the hope that it will be useful,\r\n");
+    fprintf(fp, " *    but WITHOUT ANY WARRANTY; without even the implied warranty of\r\n");
+    fprintf(fp, " *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\r\n");
+    fprintf(fp, " *    GNU General Public License for more details.\r\n");
+    fprintf(fp, " *\r\n");
+    fprintf(fp, " *    You should have received a copy of the GNU General Public License\r\n");
+    fprintf(fp, " *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.\r\n");
+    fprintf(fp, " *\r\n");
+    fprintf(fp, " *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $\r\n");
+    fprintf(fp, " *    \r\n");
+    fprintf(fp, " ***************************************************************************/\r\n");
+    fprintf(fp, "\r\n");
+    fprintf(fp, "/* Written by host/gen_star_catalog.c from star_catalog.c, do not edit.\r\n");
+    fprintf(fp, "   %d stars of %d rows, %d bytes. See star.h. */\r\n", n, nrows, (int)(n * sizeof(packedStarData) + sizeof(start)));
+    fprintf(fp, "\r\n");
+    fprintf(fp, "#include \"sowb.h\"\r\n");
+    fprintf(fp, "#include \"satapi.h\"\r\n");
+    fprintf(fp, "#include \"star.h\"\r\n");
+    fprintf(fp, "\r\n");
+    fprintf(fp, "const uint16_t star_zone_start[%d] = {\r\n", STAR_TIERS * STAR_ZONES + 1);
+    for (i = 0; i <= STAR_TIERS * STAR_ZONES; i++) {
+        fprintf(fp, "%s%5d%s", i % 12 == 0 ? "   " : "", start[i], i == STAR_TIERS * STAR_ZONES ? "\r\n" : (i % 12 == 11 ? ",\r\n" : ","));
+    }
+    fprintf(fp, "};\r\n");
+    fprintf(fp, "\r\n");
+    fprintf(fp, "const packedStarData star_packed[%d] = {\r\n", n);
+    for (i = 0; i < n; i++) {
+        fprintf(fp, "%s{ %7u, %4u, %6u, %4u }%s", i % 4 == 0 ? " " : " ", (unsigned)gen_stars[i].p.ra, (unsigned)gen_stars[i].p.mag, 
+            (unsigned)gen_stars[i].p.dec, (unsigned)gen_stars[i].p.hr, i == n - 1 ? "\r\n" : (i % 4 == 3 ? ",\r\n" : ","));
+    }
+    fprintf(fp, "};\r\n");
+    fclose(fp);
+    
+    printf("%d stars of %d rows, %d empty, %d repeated\n", n, nrows, empty, repeats);
+    printf("%d bytes, brightstars[] %d\n", (int)(n * sizeof(packedStarData) + sizeof(start)), (int)((nrows + 1) * sizeof(basicStarData)));
+    printf("worst error %.2f arcsec, %.3f mag\n", worst, worst_mag);
+    for (i = 0; i < STAR_TIERS; i++) printf("tier %d: %d stars\n", i, tiers[i]);
+    return 0;
+}
@@ -0,0 +1,211 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#include <stdarg.h>
+#include <sys/time.h>
+#include "sowb.h"
+#include "gps.h"
+#include "osd.h"
+#include "nexstar.h"
+#include "rit.h"
+#include "flash.h"
+#include "user.h"
+#include "debug.h"
+#include "host_hal.h"
+
+static GPS_TIME             host_time;
+static GPS_LOCATION_AVERAGE host_location;
+
+/* The SPI flash, 4096 pages, allocated when first written. */
+#define HOST_FLASH_PAGES    4096
+static char                *host_flash;
+
+/* The RIT uptime, milliseconds, or < 0 to follow the wall clock. */
+static double               host_uptime = -1.;
+
+/* Where the NexStar points, degrees. */
+static double               host_elevation, host_azimuth;
+
+/** host_set_time
+ *
+ * Set the time returned by gps_get_time().
+ *
+ * @param GPS_TIME * The time to use.
+ */
+void host_set_time(GPS_TIME *t) {
+    memcpy(&host_time, t, sizeof(GPS_TIME));
+}
+
+/** host_set_location
+ *
+ * Set the place returned by gps_get_location_average().
+ *
+ * @param GPS_LOCATION_AVERAGE * The place to use.
+ */
+void host_set_location(GPS_LOCATION_AVERAGE *l) {
+    memcpy(&host_location, l, sizeof(GPS_LOCATION_AVERAGE));
+}
+
+/** host_set_pointing
+ *
+ * Set where nexstar_get_elazm() says the mount points.
+ *
+ * @param double The elevation, degrees.
+ * @param double The azimuth, degrees.
+ */
+void host_set_pointing(double elevation, double azimuth) {
+    host_elevation = elevation;
+    host_azimuth = azimuth;
+}
+
+/** host_set_uptime
+ *
+ * Hold rit_read_uptime() at a time, for benchmarks that need to 
+ * step the clock themselves.
+ *
+ * @param double Milliseconds, < 0 to follow the wall clock again.
+ */
+void host_set_uptime(double ms) {
+    host_uptime = ms;
+}
+
+/** host_seconds
+ *
+ * @return double Wall clock time in seconds, for benchmarks.
+ */
+double host_seconds(void) {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.;
+}
+
+GPS_TIME * gps_get_time(GPS_TIME *q) {
+    memcpy(q, &host_time, sizeof(GPS_TIME));
+    return q;
+}
+
+GPS_LOCATION_AVERAGE * gps_get_location_average(GPS_LOCATION_AVERAGE *q) {
+    memcpy(q, &host_location, sizeof(GPS_LOCATION_AVERAGE));
+    return q;
+}
+
+/* As gps/gps.c, which cannot be built for the host. */
+double gps_julian_day_number(GPS_TIME *t) {
+    return (double)(1461 * ((int)t->year + 4800 + ((int)t->month - 14) / 12)) / 4 + (367 * ((int)t->month - 2 - 12 * (((int)t->month - 14) / 12))) / 12 - (3 * (((int)t->year + 4900 + ((int)t->month - 14) / 12 ) / 100)) / 4 + (int)t->day - 32075;
+}
+
+/* As gps/gps.c, which cannot be built for the host. */
+double gps_julian_date(GPS_TIME *t) {
+    double hour, minute, second;
+    hour   = (double)t->hour;
+    minute = (double)t->minute;
+    second = (double)t->second + ((double)t->tenth / 10.) + ((double)t->hundreth / 100.);
+    return gps_julian_day_number(t) - 0.5 + ((hour - 12.) / 24.) + (minute / 1440.) + (second / 86400.);
+}
+
+int debug_printf(const char *format, ...) {
+    va_list args;
+    int n;
+    va_start(args, format);
+    n = vprintf(format, args);
+    va_end(args);
+    return n;
+}
+
+void osd_string_xy(int x, int y, char *s) {
+    printf("OSD %2d,%2d: %s\n", x, y, s);
+}
+
+void osd_clear_line(int line) {
+}
+
+int _nexstar_goto(uint32_t elevation, uint32_t azimuth) {
+    return 0;
+}
+
+void nexstar_get_elazm(double *el, double *azm) {
+    *el  = host_elevation;
+    *azm = host_azimuth;
+}
+
+/* There is no process loop on the host. */
+void user_call_process(void) {
+}
+
+/* Milliseconds of wall clock, as the RIT's uptime counter, unless
+   held by host_set_uptime(). There are no RIT timers. */
+void rit_read_uptime(uint32_t *h, uint32_t *l) {
+    double ms = host_uptime >= 0. ? host_uptime : host_seconds() * 1000.;
+    *h = (uint32_t)(ms / 4294967296.);
+    *l = (uint32_t)fmod(ms, 4294967296.);
+}
+
+void rit_timer_set_counter(int index, uint32_t value) {
+}
+
+void rit_timer_set_reload(int index, uint32_t value) {
+}
+
+/** host_flash_write
+ *
+ * Put data in the flash read by flash_read_page(), which otherwise 
+ * reads as erased.
+ *
+ * @param unsigned int The first page.
+ * @param const char * The data.
+ * @param int The number of bytes.
+ */
+void host_flash_write(unsigned int page, const char *data, int len) {
+    if (host_flash == NULL) {
+        host_flash = (char *)malloc(HOST_FLASH_PAGES * FLASH_PAGE_SIZE);
+        memset(host_flash, 0xFF, HOST_FLASH_PAGES * FLASH_PAGE_SIZE);
+    }
+    memcpy(host_flash + page * FLASH_PAGE_SIZE, data, len);
+}
+
+/* Writes and erases finish at once. */
+int flash_page_write(int page, char *buffer) {
+    host_flash_write(page, buffer, FLASH_PAGE_SIZE);
+    return 0;
+}
+
+int flash_erase_sector(int sector) {
+    char erased[FLASH_PAGE_SIZE];
+    int i;
+    
+    memset(erased, 0xFF, FLASH_PAGE_SIZE);
+    for (i = 0; i < FLASH_SECTOR_PAGES; i++) host_flash_write(sector * FLASH_SECTOR_PAGES + i, erased, FLASH_PAGE_SIZE);
+    return 0;
+}
+
+bool flash_write_in_progress(void) {
+    return false;
+}
+
+bool flash_sector_erase_in_progress(void) {
+    return false;
+}
+
+void flash_read_page(unsigned int page_address, char *buffer, bool block) {
+    if (host_flash == NULL || page_address >= HOST_FLASH_PAGES) memset(buffer, 0xFF, FLASH_PAGE_SIZE);
+    else memcpy(buffer, host_flash + page_address * FLASH_PAGE_SIZE, FLASH_PAGE_SIZE);
+}
@@ -0,0 +1,40 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+#include "gps.h"
+
+/* The host build replaces the GPS receiver with a time and place 
+   set by the program, and the OSD, debug UART and NexStar with 
+   stdout or nothing at all; the NexStar points where it is told to.
+   The RIT uptime is the wall clock unless held, there are no RIT 
+   timers and the flash is held in memory. */
+void    host_set_time(GPS_TIME *t);
+void    host_set_location(GPS_LOCATION_AVERAGE *l);
+void    host_set_pointing(double elevation, double azimuth);
+void    host_set_uptime(double ms);
+double  host_seconds(void);
+void    host_flash_write(unsigned int page, const char *data, int len);
+
+#endif
@@ -0,0 +1,383 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* SGP4 over structure-of-arrays catalogs for the host, see sgp4_batch.h.
+   sgp4_batch_propagate() is SGP4_Propagate() in sgp4sdp4.c written 
+   out lane by lane, so that with the flags in the Makefile the compiler
+   turns each lane loop into AVX code. It must be kept in step with 
+   SGP4_Propagate(). */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "sgp4_batch.h"
+
+#if SGP4_NUMERIC != SGP4_DOUBLE
+#error "sgp4_batch.c reads the double SGP4 constants, build it with SGP4_NUMERIC=SGP4_DOUBLE"
+#endif
+
+#define BATCH_ARRAYS        41
+#define BATCH_PIO2_HI       1.57079632673412561417e+00  /* As sgp_math.c */
+#define BATCH_PIO2_LO       6.07710050650619224932e-11
+#define BATCH_KEPLER_PASSES 10
+
+/** batch_sincos
+ *
+ * SinCos() in sgp_math.c, the same reduction and polynomials with the
+ * quadrant chosen without branches so that it inlines into the lane 
+ * loops. The arguments of a TLE of any reasonable age are well within 
+ * SinCos()'s range for them, so its fallback to libm is left out.
+ *
+ * @param double The angle, radians.
+ * @param double * Set to its sine.
+ * @param double * Set to its cosine.
+ */
+static inline void batch_sincos(double x, double *s, double *c) {
+    double r, z, sr, cr, ts, tc;
+    int q;
+    
+    q = (int)(x * (1 / (BATCH_PIO2_HI + BATCH_PIO2_LO)) + (x < 0 ? -0.5 : 0.5));
+    r = (x - q * BATCH_PIO2_HI) - q * BATCH_PIO2_LO;
+    z = r * r;
+    sr = r + r * z * (-1.66666666666666324348e-01 + z * (8.33333333332248946124e-03 +
+         z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 +
+         z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)))));
+    cr = 1 - 0.5 * z + z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 +
+         z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 +
+         z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+    ts = q & 1 ? cr : sr;
+    tc = q & 1 ? sr : cr;
+    *s = q & 2 ? -ts : ts;
+    *c = (q + 1) & 2 ? -tc : tc;
+}
+
+/** batch_arrays
+ *
+ * The addresses of every per-satellite double array in a batch.
+ *
+ * @param sgp4_batch_t * The batch.
+ * @param double *** BATCH_ARRAYS pointers to fill in.
+ */
+static void batch_arrays(sgp4_batch_t *b, double **a[BATCH_ARRAYS]) {
+    int n = 0;
+    
+    a[n++] = &b->jd_epoch; a[n++] = &b->xmo;    a[n++] = &b->omegao; a[n++] = &b->xnodeo;
+    a[n++] = &b->bstar;    a[n++] = &b->eo;     a[n++] = &b->xincl;  a[n++] = &b->c1;
+    a[n++] = &b->c4;       a[n++] = &b->c5;     a[n++] = &b->d2;     a[n++] = &b->d3;
+    a[n++] = &b->d4;       a[n++] = &b->omgcof; a[n++] = &b->omgdot; a[n++] = &b->xnodp;
+    a[n++] = &b->t2cof;    a[n++] = &b->t3cof;  a[n++] = &b->t4cof;  a[n++] = &b->t5cof;
+    a[n++] = &b->xmdot;    a[n++] = &b->xnodcf; a[n++] = &b->xnodot; a[n++] = &b->aodp;
+    a[n++] = &b->aycof;    a[n++] = &b->cosio;  a[n++] = &b->delmo;  a[n++] = &b->eta;
+    a[n++] = &b->sinio;    a[n++] = &b->sinmo;  a[n++] = &b->x1mth2; a[n++] = &b->x3thm1;
+    a[n++] = &b->x7thm1;   a[n++] = &b->xmcof;  a[n++] = &b->xlcof;  a[n++] = &b->x;
+    a[n++] = &b->y;        a[n++] = &b->z;      a[n++] = &b->vx;     a[n++] = &b->vy;
+    a[n++] = &b->vz;
+}
+
+/** batch_idle
+ *
+ * Give a lane a circular equatorial orbit with no drag. Lanes past 
+ * the last satellite and those of deep-space satellites, which the
+ * kernel works out only to throw away, are kept idle so that they 
+ * cost no more than any other lane.
+ *
+ * @param sgp4_batch_t * The batch.
+ * @param int The lane.
+ */
+static void batch_idle(sgp4_batch_t *b, int i) {
+    double **a[BATCH_ARRAYS];
+    int n;
+    
+    batch_arrays(b, a);
+    for (n = 0; n < BATCH_ARRAYS; n++) (*a[n])[i] = 0.;
+    b->aodp[i] = 1.1;
+}
+
+/** sgp4_batch_init
+ *
+ * Start an empty batch.
+ *
+ * @param sgp4_batch_t * The batch.
+ */
+void sgp4_batch_init(sgp4_batch_t *b) {
+    memset(b, 0, sizeof(sgp4_batch_t));
+}
+
+/** sgp4_batch_free
+ *
+ * Release a batch's arrays and deep-space contexts.
+ *
+ * @param sgp4_batch_t * The batch.
+ */
+void sgp4_batch_free(sgp4_batch_t *b) {
+    double **a[BATCH_ARRAYS];
+    int i;
+    
+    batch_arrays(b, a);
+    for (i = 0; i < BATCH_ARRAYS; i++) free(*a[i]);
+    for (i = 0; i < b->count; i++) free(b->deep[i]);
+    free(b->deep);
+    sgp4_batch_init(b);
+}
+
+/** sgp4_batch_add
+ *
+ * Add a satellite to a batch.
+ *
+ * @param sgp4_batch_t * The batch.
+ * @param sgp4_ctx_t * The satellite, prepared by sgp4_init().
+ * @param double The Julian date of the TLE epoch.
+ * @return int The satellite's index in the output arrays, -1 if out of memory.
+ */
+int sgp4_batch_add(sgp4_batch_t *b, sgp4_ctx_t *ctx, double jd_epoch) {
+    double **a[BATCH_ARRAYS];
+    sgp4_near_t *k = &ctx->model.sgp4;
+    tle_t *tle = &ctx->tle;
+    void *p;
+    int i, n, capacity;
+    
+    batch_arrays(b, a);
+    
+    if (b->count == b->capacity) {
+        capacity = b->capacity ? b->capacity * 2 : 1024;
+        for (n = 0; n < BATCH_ARRAYS; n++) {
+            if ((p = realloc(*a[n], capacity * sizeof(double))) == NULL) return -1;
+            *a[n] = (double *)p;
+        }
+        if ((p = realloc(b->deep, capacity * sizeof(sgp4_ctx_t *))) == NULL) return -1;
+        b->deep = (sgp4_ctx_t **)p;
+        for (n = b->capacity; n < capacity; n++) batch_idle(b, n);
+        b->capacity = capacity;
+    }
+    
+    i = b->count;
+    b->jd_epoch[i] = jd_epoch;
+    b->deep[i] = NULL;
+    if (ctx->flags & DEEP_SPACE_EPHEM_FLAG) {
+        if ((b->deep[i] = (sgp4_ctx_t *)malloc(sizeof(sgp4_ctx_t))) == NULL) return -1;
+        memcpy(b->deep[i], ctx, sizeof(sgp4_ctx_t));
+        b->count++;
+        return i;
+    }
+    
+    b->xmo[i] = tle->xmo;       b->omegao[i] = tle->omegao; b->xnodeo[i] = tle->xnodeo;
+    b->bstar[i] = tle->bstar;   b->eo[i] = tle->eo;         b->xincl[i] = tle->xincl;
+    b->c1[i] = k->c1;           b->c4[i] = k->c4;           b->xnodp[i] = k->xnodp;
+    b->t2cof[i] = k->t2cof;     b->omgdot[i] = k->omgdot;   b->xmdot[i] = k->xmdot;
+    b->xnodcf[i] = k->xnodcf;   b->xnodot[i] = k->xnodot;   b->aodp[i] = k->aodp;
+    b->aycof[i] = k->aycof;     b->cosio[i] = k->cosio;     b->sinio[i] = k->sinio;
+    b->eta[i] = k->eta;         b->x1mth2[i] = k->x1mth2;   b->x3thm1[i] = k->x3thm1;
+    b->x7thm1[i] = k->x7thm1;   b->xlcof[i] = k->xlcof;
+    
+    /* The terms SGP4_Propagate() skips for a SIMPLE_FLAG satellite 
+       come to nothing when their coefficients are zero. */
+    if (!(ctx->flags & SIMPLE_FLAG)) {
+        b->c5[i] = k->c5;       b->d2[i] = k->d2;           b->d3[i] = k->d3;
+        b->d4[i] = k->d4;       b->omgcof[i] = k->omgcof;   b->t3cof[i] = k->t3cof;
+        b->t4cof[i] = k->t4cof; b->t5cof[i] = k->t5cof;     b->delmo[i] = k->delmo;
+        b->sinmo[i] = k->sinmo; b->xmcof[i] = k->xmcof;
+    }
+    else {
+        b->c5[i] = b->d2[i] = b->d3[i] = b->d4[i] = b->omgcof[i] = b->t3cof[i] = 0.;
+        b->t4cof[i] = b->t5cof[i] = b->delmo[i] = b->sinmo[i] = b->xmcof[i] = 0.;
+    }
+    
+    b->count++;
+    return i;
+}
+
+/** sgp4_batch_propagate
+ *
+ * Propagate every satellite in a batch to one time. The results are
+ * left in b->x, y, z (km) and b->vx, vy, vz (km/s), ECI, by the index 
+ * sgp4_batch_add() gave. Near-earth satellites are propagated as 
+ * SGP4_Propagate() does, SGP4_BATCH_LANES at a time; each lane loop 
+ * below is one SIMD loop. Kepler's equation is solved as Kepler() 
+ * does, each lane stopping on the pass that Kepler() would have.
+ * Deep-space satellites go through sgp4_propagate().
+ *
+ * @param sgp4_batch_t * The batch.
+ * @param double The Julian date, UT.
+ */
+void sgp4_batch_propagate(sgp4_batch_t *b, double jd) {
+    double a[SGP4_BATCH_LANES], axn[SGP4_BATCH_LANES], ayn[SGP4_BATCH_LANES];
+    double xn[SGP4_BATCH_LANES], xnode[SGP4_BATCH_LANES], capu[SGP4_BATCH_LANES];
+    double epw[SGP4_BATCH_LANES], s[SGP4_BATCH_LANES], c[SGP4_BATCH_LANES];
+    double delta[SGP4_BATCH_LANES];
+    int active[SGP4_BATCH_LANES];
+    vector_t pos, vel;
+    double phase;
+    int base, l, i, pass, more;
+    /* A copy the stores below cannot alias, so that the array pointers
+       stay in registers and the lane loops vectorize. */
+    const sgp4_batch_t k = *b;
+    
+    for (base = 0; base < k.count; base += SGP4_BATCH_LANES) {
+        
+        /* Secular gravity and drag, long period periodics. */
+        #pragma omp simd
+        for (l = 0; l < SGP4_BATCH_LANES; l++) {
+            double t, tsq, tcube, tfour, xmdf, omgadf, xnoddf, xnodel, tempa, tempe, templ;
+            double temp, delm, temps, xmp, omega, al, e, xl, beta, xlt, axnl, u;
+            double sinmdf, cosmdf, sinmp, cosmp, sinomg, cosomg;
+            int i = base + l;
+            t = (jd - k.jd_epoch[i]) * xmnpda;
+            xmdf = k.xmo[i] + k.xmdot[i] * t;
+            omgadf = k.omegao[i] + k.omgdot[i] * t;
+            xnoddf = k.xnodeo[i] + k.xnodot[i] * t;
+            tsq = t * t;
+            xnodel = xnoddf + k.xnodcf[i] * tsq;
+            tempa = 1 - k.c1[i] * t;
+            tempe = k.bstar[i] * k.c4[i] * t;
+            templ = k.t2cof[i] * tsq;
+            batch_sincos(xmdf, &sinmdf, &cosmdf);
+            temp = 1 + k.eta[i] * cosmdf;
+            delm = k.xmcof[i] * (temp * temp * temp - k.delmo[i]);
+            temps = k.omgcof[i] * t + delm;
+            xmp = xmdf + temps;
+            omega = omgadf - temps;
+            tcube = tsq * t;
+            tfour = t * tcube;
+            tempa = tempa - k.d2[i] * tsq - k.d3[i] * tcube - k.d4[i] * tfour;
+            batch_sincos(xmp, &sinmp, &cosmp);
+            tempe = tempe + k.bstar[i] * k.c5[i] * (sinmp - k.sinmo[i]);
+            templ = templ + k.t3cof[i] * tcube + tfour * (k.t4cof[i] + t * k.t5cof[i]);
+            
+            al = k.aodp[i] * tempa * tempa;
+            e = k.eo[i] - tempe;
+            xl = xmp + omega + xnodel + k.xnodp[i] * templ;
+            beta = sqrt(1 - e * e);
+            
+            batch_sincos(omega, &sinomg, &cosomg);
+            axnl = e * cosomg;
+            temp = 1 / (al * beta * beta);
+            xlt = xl + temp * k.xlcof[i] * axnl;
+            
+            u = xlt - xnodel;
+            u = u - twopi * floor(u / twopi);
+            a[l] = al;
+            xn[l] = xke / (al * sqrt(al));
+            xnode[l] = xnodel;
+            axn[l] = axnl;
+            ayn[l] = e * sinomg + temp * k.aycof[i];
+            capu[l] = u;
+            epw[l] = u;
+            active[l] = 1;
+        }
+        
+        /* Kepler's equation, a pass of Kepler() at a time until every 
+           lane has stopped. */
+        for (pass = 0; pass < BATCH_KEPLER_PASSES; pass++) {
+            more = 0;
+            #pragma omp simd reduction(|:more)
+            for (l = 0; l < SGP4_BATCH_LANES; l++) {
+                double sl, cl, f, fdot, fddot, d;
+                int on = active[l];
+                batch_sincos(epw[l], &sl, &cl);
+                f = epw[l] - axn[l] * sl + ayn[l] * cl - capu[l];
+                fdot = 1 - axn[l] * cl - ayn[l] * sl;
+                fddot = axn[l] * sl - ayn[l] * cl;
+                d = f * fdot / (fdot * fdot - 0.5 * f * fddot);
+                d = d > 0.95 ? 0.95 : (d < -0.95 ? -0.95 : d);
+                /* Lanes that have stopped keep their last pass. */
+                epw[l] = on ? epw[l] - d : epw[l];
+                s[l] = on ? sl : s[l];
+                c[l] = on ? cl : c[l];
+                delta[l] = on ? d : delta[l];
+                active[l] = on && fabs(d) > e6a;
+                more |= active[l];
+            }
+            if (!more) break;
+        }
+        
+        /* Short period periodics, position and velocity. */
+        #pragma omp simd
+        for (l = 0; l < SGP4_BATCH_LANES; l++) {
+            double sinepw, cosepw, ecose, esine, elsq, temp, temp1, temp2, temp3, pl, r;
+            double rdot, rfdot, betal, cosu, sinu, sin2u, cos2u, rk, du, sindu, cosdu, xnodek, xinck;
+            double rdotk, rfdotk, sinuk, cosuk, sinik, cosik, sinnok, cosnok;
+            double xmx, xmy, ux, uy, uz, vx, vy, vz;
+            int i = base + l;
+            sinepw = s[l] - delta[l] * c[l];
+            cosepw = c[l] + delta[l] * s[l];
+            ecose = axn[l] * cosepw + ayn[l] * sinepw;
+            esine = axn[l] * sinepw - ayn[l] * cosepw;
+            elsq = axn[l] * axn[l] + ayn[l] * ayn[l];
+            temp = 1 - elsq;
+            pl = a[l] * temp;
+            r = a[l] * (1 - ecose);
+            temp1 = 1 / r;
+            rdot = xke * sqrt(a[l]) * esine * temp1;
+            rfdot = xke * sqrt(pl) * temp1;
+            temp2 = a[l] * temp1;
+            betal = sqrt(temp);
+            temp3 = 1 / (1 + betal);
+            cosu = temp2 * (cosepw - axn[l] + ayn[l] * esine * temp3);
+            sinu = temp2 * (sinepw - ayn[l] - axn[l] * esine * temp3);
+            sin2u = 2 * sinu * cosu;
+            cos2u = 2 * cosu * cosu - 1;
+            temp = 1 / pl;
+            temp1 = ck2 * temp;
+            temp2 = temp1 * temp;
+            
+            rk = r * (1 - 1.5 * temp2 * betal * k.x3thm1[i]) + 0.5 * temp1 * k.x1mth2[i] * cos2u;
+            du = 0.25 * temp2 * k.x7thm1[i] * sin2u;
+            xnodek = xnode[l] + 1.5 * temp2 * k.cosio[i] * sin2u;
+            xinck = k.xincl[i] + 1.5 * temp2 * k.cosio[i] * k.sinio[i] * cos2u;
+            rdotk = rdot - xn[l] * temp1 * k.x1mth2[i] * sin2u;
+            rfdotk = rfdot + xn[l] * temp1 * (k.x1mth2[i] * cos2u + 1.5 * k.x3thm1[i]);
+            
+            /* uk = u - du, by the angle difference rather than finding u
+               with AcTan(). */
+            batch_sincos(du, &sindu, &cosdu);
+            sinuk = sinu * cosdu - cosu * sindu;
+            cosuk = cosu * cosdu + sinu * sindu;
+            batch_sincos(xinck, &sinik, &cosik);
+            batch_sincos(xnodek, &sinnok, &cosnok);
+            xmx = -sinnok * cosik;
+            xmy = cosnok * cosik;
+            ux = xmx * sinuk + cosnok * cosuk;
+            uy = xmy * sinuk + sinnok * cosuk;
+            uz = sinik * sinuk;
+            vx = xmx * cosuk - cosnok * sinuk;
+            vy = xmy * cosuk - sinnok * sinuk;
+            vz = sinik * cosuk;
+            
+            /* In km and km/s, as Convert_Sat_State(). */
+            k.x[i] = rk * ux * xkmper;
+            k.y[i] = rk * uy * xkmper;
+            k.z[i] = rk * uz * xkmper;
+            k.vx[i] = (rdotk * ux + rfdotk * vx) * (xkmper * xmnpda / secday);
+            k.vy[i] = (rdotk * uy + rfdotk * vy) * (xkmper * xmnpda / secday);
+            k.vz[i] = (rdotk * uz + rfdotk * vz) * (xkmper * xmnpda / secday);
+        }
+    }
+    
+    /* Deep-space satellites, one at a time. */
+    for (i = 0; i < k.count; i++) {
+        if (k.deep[i] == NULL) continue;
+        sgp4_propagate(k.deep[i], (jd - k.jd_epoch[i]) * xmnpda, &pos, &vel, &phase);
+        Convert_Sat_State(&pos, &vel);
+        k.x[i] = pos.x;  k.y[i] = pos.y;  k.z[i] = pos.z;
+        k.vx[i] = vel.x; k.vy[i] = vel.y; k.vz[i] = vel.z;
+    }
+}
@@ -0,0 +1,64 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#ifndef SGP4_BATCH_H
+#define SGP4_BATCH_H
+
+#include "sgp4sdp4.h"
+
+/* Host batch propagator for whole catalogs, as the PC needs when it
+   makes pass tables to upload. The SGP4 constants of each satellite,
+   worked out by sgp4_init() as on the device, are copied into one 
+   array per constant (structure of arrays) so that SGP4_Propagate()'s
+   arithmetic runs over SGP4_BATCH_LANES satellites at a time in SIMD 
+   registers. Deep-space satellites are left to sgp4_propagate() one
+   at a time; they are few and SDP4's Deep() does not vectorize. */
+
+/* Satellites propagated together by sgp4_batch_propagate(). */
+#define SGP4_BATCH_LANES    8
+
+typedef struct
+{
+  int
+    count,      /* Satellites added */
+    capacity;   /* Allocated, a multiple of SGP4_BATCH_LANES */
+  /* Elements and SGP4_Init() constants, one array each */
+  double
+    *jd_epoch,*xmo,*omegao,*xnodeo,*bstar,*eo,*xincl,
+    *c1,*c4,*c5,*d2,*d3,*d4,*omgcof,*omgdot,*xnodp,
+    *t2cof,*t3cof,*t4cof,*t5cof,*xmdot,*xnodcf,*xnodot,
+    *aodp,*aycof,*cosio,*delmo,*eta,*sinio,*sinmo,
+    *x1mth2,*x3thm1,*x7thm1,*xmcof,*xlcof;
+  /* Deep-space contexts, NULL for near-earth satellites */
+  sgp4_ctx_t
+    **deep;
+  /* Output of sgp4_batch_propagate(), ECI km and km/s */
+  double
+    *x,*y,*z,*vx,*vy,*vz;
+} sgp4_batch_t;
+
+void    sgp4_batch_init(sgp4_batch_t *b);
+int     sgp4_batch_add(sgp4_batch_t *b, sgp4_ctx_t *ctx, double jd_epoch);
+void    sgp4_batch_propagate(sgp4_batch_t *b, double jd);
+void    sgp4_batch_free(sgp4_batch_t *b);
+
+#endif
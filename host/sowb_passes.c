@@ -0,0 +1,382 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Pass prediction on the PC with the firmware's own satapi and 
+   sgp4sdp4 sources, so the passes are those the device will show, 
+   for cross-checking it and for making tables ahead of time. Passes 
+   are found as satapi_passes.c finds them for the device's table, 
+   each lit by satapi_pass_light(). 
+   
+   The satellites are shared out between threads that each keep a 
+   queue of their own, taking the last one they were given, and steal
+   the first of another thread's queue once theirs is empty. Long 
+   deep-space searches then do not hold up the threads left with only 
+   short ones. The TLEs are loaded before the threads start, as 
+   select_ephemeris() works through sgp4sdp4.c's flags.
+   
+     sowb_passes [-t threads] [-h hours] [-e elevation] 
+                 [-s "YYYY-MM-DD HH:MM:SS"] [-b] tle_file cospar
+   
+   -b times the whole prediction for 1, 2, 4... threads up to -t, 
+   which is the number of processors unless given, and reports passes
+   a second for each rather than listing the passes. */
+
+#include <pthread.h>
+#include <unistd.h>
+#include "sowb.h"
+#include "satapi.h"
+#include "stations.h"
+#include "host_hal.h"
+
+#define CLI_MAX_THREADS     64
+#define CLI_HOURS           24.     /* As PASS_SPAN in satapi_passes.c. */
+#define CLI_MIN_EL          10.     /* As PASS_MIN_EL in satapi_passes.c. */
+
+/* A satellite and the passes found for it. */
+typedef struct _cli_sat {
+    SAT_POS_DATA    q;
+    SAT_PASS        *passes;
+    int             count, max;
+} CLI_SAT;
+
+/* A thread's queue of satellites. The owner takes from the tail and 
+   thieves from the head. */
+typedef struct _cli_queue {
+    pthread_mutex_t lock;
+    int             *items;
+    int             head, tail;
+    int             steals;
+} CLI_QUEUE;
+
+/* One pass in the listing, sorted by AOS. */
+typedef struct _cli_entry {
+    CLI_SAT     *sat;
+    SAT_PASS    *pass;
+} CLI_ENTRY;
+
+static SAT_POS_DATA *cli_loaded;    /* As loaded, each run starts from a copy. */
+static CLI_SAT      *cli_sats;
+static int          cli_count;
+static CLI_QUEUE    cli_queues[CLI_MAX_THREADS];
+static int          cli_threads;
+static double       cli_span = CLI_HOURS * 3600.;
+static double       cli_min_el = CLI_MIN_EL;
+
+/** cli_predict
+ *
+ * Find and light every pass of a satellite over the span.
+ *
+ * @param CLI_SAT * The satellite.
+ */
+static void cli_predict(CLI_SAT *s) {
+    SAT_PASS pass;
+    double from = 0.;
+    
+    while (from < cli_span && satapi_next_pass(&s->q, from, cli_span - from, cli_min_el, &pass) == 0) {
+        if (pass.aos >= cli_span) break;
+        satapi_pass_light(&s->q, &pass);
+        if (s->count == s->max) {
+            s->max = s->max ? s->max * 2 : 16;
+            s->passes = (SAT_PASS *)realloc(s->passes, s->max * sizeof(SAT_PASS));
+        }
+        s->passes[s->count++] = pass;
+        from = pass.los + 1.;
+    }
+}
+
+/** cli_take
+ *
+ * The next satellite for a thread, from its own queue or stolen.
+ *
+ * @param int The thread.
+ * @return int The satellite, -1 once every queue is empty.
+ */
+static int cli_take(int self) {
+    CLI_QUEUE *o;
+    int i, n = -1;
+    
+    o = &cli_queues[self];
+    pthread_mutex_lock(&o->lock);
+    if (o->tail > o->head) n = o->items[--o->tail];
+    pthread_mutex_unlock(&o->lock);
+    
+    for (i = 1; n < 0 && i < cli_threads; i++) {
+        o = &cli_queues[(self + i) % cli_threads];
+        pthread_mutex_lock(&o->lock);
+        if (o->tail > o->head) {
+            n = o->items[o->head++];
+            cli_queues[self].steals++;
+        }
+        pthread_mutex_unlock(&o->lock);
+    }
+    
+    return n;
+}
+
+/** cli_worker
+ *
+ * A thread of the pool, its index passed as the argument.
+ */
+static void * cli_worker(void *arg) {
+    int n, self = (int)(intptr_t)arg;
+    
+    while ((n = cli_take(self)) >= 0) {
+        cli_predict(&cli_sats[n]);
+    }
+    return NULL;
+}
+
+/** cli_run
+ *
+ * Predict every satellite with a pool of threads, each first given 
+ * an equal run of the catalog.
+ *
+ * @param int The threads to use.
+ * @param int * Set to the steals made.
+ * @return int The passes found.
+ */
+static int cli_run(int threads, int *steals) {
+    pthread_t id[CLI_MAX_THREADS];
+    CLI_QUEUE *o;
+    int i, t, passes = 0;
+    
+    for (i = 0; i < cli_count; i++) {
+        cli_sats[i].q = cli_loaded[i];
+        cli_sats[i].count = 0;
+    }
+    
+    cli_threads = threads;
+    for (t = 0; t < threads; t++) {
+        o = &cli_queues[t];
+        o->head = o->tail = o->steals = 0;
+        for (i = cli_count * t / threads; i < cli_count * (t + 1) / threads; i++) {
+            o->items[o->tail++] = i;
+        }
+    }
+    
+    for (t = 1; t < threads; t++) {
+        pthread_create(&id[t], NULL, cli_worker, (void *)(intptr_t)t);
+    }
+    cli_worker((void *)0);
+    for (t = 1; t < threads; t++) {
+        pthread_join(id[t], NULL);
+    }
+    
+    *steals = 0;
+    for (t = 0; t < threads; t++) *steals += cli_queues[t].steals;
+    for (i = 0; i < cli_count; i++) passes += cli_sats[i].count;
+    return passes;
+}
+
+/** cli_load
+ *
+ * Read a file of three line TLEs and load each for the observer.
+ *
+ * @return int The satellites loaded, -1 if the file cannot be read.
+ */
+static int cli_load(const char *file, GPS_TIME *t, GPS_LOCATION_AVERAGE *l) {
+    FILE *f;
+    SAT_POS_DATA *q;
+    char line[3][80];
+    int n = 0, max = 0, i;
+    
+    if ((f = fopen(file, "r")) == NULL) return -1;
+    
+    while (fgets(line[0], 80, f) && fgets(line[1], 80, f) && fgets(line[2], 80, f)) {
+        if (n == max) {
+            max = max ? max * 2 : 256;
+            cli_loaded = (SAT_POS_DATA *)realloc(cli_loaded, max * sizeof(SAT_POS_DATA));
+        }
+        q = &cli_loaded[n];
+        memset(q, 0, sizeof(SAT_POS_DATA));
+        for (i = 0; i < 3; i++) {
+            line[i][strcspn(line[i], "\r\n")] = '\0';
+            strcpy(q->elements[i], line[i]);
+        }
+        q->time = *t;
+        q->location = *l;
+        if (satapi_load(&q->sat, q->elements) != 0) {
+            fprintf(stderr, "skipping bad TLE \"%s\"\n", line[0]);
+            continue;
+        }
+        n++;
+    }
+    
+    fclose(f);
+    return n;
+}
+
+/** cli_compare
+ *
+ * qsort() order of the listing, by AOS.
+ */
+static int cli_compare(const void *a, const void *b) {
+    double d = ((CLI_ENTRY *)a)->pass->aos - ((CLI_ENTRY *)b)->pass->aos;
+    
+    return d < 0. ? -1 : d > 0.;
+}
+
+/** cli_time
+ *
+ * Write the UTC time of a pass event, seconds after start.
+ */
+static char * cli_time(char *buf, double start, double seconds) {
+    struct tm t;
+    
+    Date_Time(start + (floor(seconds + 0.5) / 86400.), &t);
+    sprintf(buf, "%02d:%02d:%02d", t.tm_hour, t.tm_min, t.tm_sec);
+    return buf;
+}
+
+/** cli_list
+ *
+ * Print every pass found, in order of AOS.
+ */
+static void cli_list(double start) {
+    CLI_ENTRY *e;
+    SAT_PASS *p;
+    struct tm t;
+    char aos[12], tca[12], los[12];
+    int i, j, n = 0;
+    
+    for (i = 0; i < cli_count; i++) n += cli_sats[i].count;
+    e = (CLI_ENTRY *)malloc((n ? n : 1) * sizeof(CLI_ENTRY));
+    for (n = 0, i = 0; i < cli_count; i++) {
+        for (j = 0; j < cli_sats[i].count; j++, n++) {
+            e[n].sat = &cli_sats[i];
+            e[n].pass = &cli_sats[i].passes[j];
+        }
+    }
+    qsort(e, n, sizeof(CLI_ENTRY), cli_compare);
+    
+    printf("date        AOS      az    TCA      el    LOS      az    light     satellite\n");
+    for (i = 0; i < n; i++) {
+        p = e[i].pass;
+        Date_Time(start + p->aos / 86400., &t);
+        printf("%04d-%02d-%02d  %s %5.1f  %s %4.1f  %s %5.1f  %c%c%c%c      %s\n",
+            t.tm_year + 1900, t.tm_mon + 1, t.tm_mday,
+            cli_time(aos, start, p->aos), p->aos_azimuth,
+            cli_time(tca, start, p->tca), p->tca_elevation,
+            cli_time(los, start, p->los), p->los_azimuth,
+            p->light & SAT_LIGHT_VISIBLE  ? 'V' : '-',
+            p->light & SAT_LIGHT_SUNLIT   ? 'S' : '-',
+            p->light & SAT_LIGHT_ECLIPSED ? 'E' : '-',
+            p->light & SAT_LIGHT_DARK     ? 'D' : '-',
+            e[i].sat->q.elements[0]);
+    }
+    free(e);
+}
+
+static void cli_usage(void) {
+    fprintf(stderr, "usage: sowb_passes [-t threads] [-h hours] [-e elevation]\n"
+                    "                   [-s \"YYYY-MM-DD HH:MM:SS\"] [-b] tle_file cospar\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[]) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    const STATION_t *station;
+    struct tm *now;
+    time_t clock;
+    double t0, seconds, start, single = 0.;
+    int c, i, threads, passes, steals, cospar, bench = 0;
+    int year, month, day, hour, minute, second;
+    
+    threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    
+    clock = time(NULL);
+    now = gmtime(&clock);
+    memset(&t, 0, sizeof(t));
+    t.year = now->tm_year + 1900; t.month = now->tm_mon + 1; t.day = now->tm_mday;
+    t.hour = now->tm_hour; t.minute = now->tm_min; t.second = now->tm_sec;
+    t.is_valid = 1;
+    
+    while ((c = getopt(argc, argv, "t:h:e:s:b")) != -1) {
+        switch (c) {
+            case 't': threads = atoi(optarg); break;
+            case 'h': cli_span = atof(optarg) * 3600.; break;
+            case 'e': cli_min_el = atof(optarg); break;
+            case 'b': bench = 1; break;
+            case 's':
+                if (sscanf(optarg, "%d-%d-%d %d:%d:%d", &year, &month, &day, &hour, &minute, &second) != 6) cli_usage();
+                t.year = year; t.month = month; t.day = day;
+                t.hour = hour; t.minute = minute; t.second = second;
+                break;
+            default: cli_usage();
+        }
+    }
+    if (argc - optind != 2) cli_usage();
+    if (threads < 1) threads = 1;
+    if (threads > CLI_MAX_THREADS) threads = CLI_MAX_THREADS;
+    
+    /* The station, by its COSPAR number. */
+    cospar = atoi(argv[optind + 1]);
+    for (i = 0; cospar_station(i)->cospar != 0 && cospar_station(i)->cospar != cospar; i++);
+    station = cospar_station(i);
+    if (station->cospar == 0) {
+        fprintf(stderr, "no COSPAR station %d\n", cospar);
+        return 1;
+    }
+    memset(&l, 0, sizeof(l));
+    l.north_south = station->latitude  < 0. ? 'S' : 'N';
+    l.latitude    = fabs(station->latitude);
+    l.east_west   = station->longitude < 0. ? 'W' : 'E';
+    l.longitude   = fabs(station->longitude);
+    l.height      = station->hasl;
+    l.is_valid    = '1';
+    
+    cli_count = cli_load(argv[optind], &t, &l);
+    if (cli_count < 0) {
+        fprintf(stderr, "cannot read %s\n", argv[optind]);
+        return 1;
+    }
+    cli_sats = (CLI_SAT *)calloc(cli_count ? cli_count : 1, sizeof(CLI_SAT));
+    for (i = 0; i < threads; i++) {
+        pthread_mutex_init(&cli_queues[i].lock, NULL);
+        cli_queues[i].items = (int *)malloc((cli_count ? cli_count : 1) * sizeof(int));
+    }
+    
+    start = gps_julian_date(&t);
+    printf("%d satellites, %.1f hours from %04d-%02d-%02d %02d:%02d:%02d UTC, station %d %s (%s)\n",
+        cli_count, cli_span / 3600., t.year, t.month, t.day, t.hour, t.minute, t.second,
+        station->cospar, station->long_name, station->short_name);
+    
+    if (!bench) {
+        passes = cli_run(threads, &steals);
+        cli_list(start);
+        return 0;
+    }
+    
+    for (c = 1; ; c *= 2) {
+        if (c > threads) c = threads;
+        t0 = host_seconds();
+        passes = cli_run(c, &steals);
+        seconds = host_seconds() - t0;
+        if (c == 1) single = seconds;
+        printf("%2d threads: %d passes in %.2f s, %.0f passes/s, x%.2f, %d steals\n", 
+            c, passes, seconds, passes / seconds, single / seconds, steals);
+        if (c == threads) break;
+    }
+    
+    return 0;
+}
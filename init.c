@@ -60,8 +60,15 @@ PROCESS_FUNC *process_callbacks[] = {
     gps_process,
     gpioirq_process,
     nexstar_process,
+    nexstar_align_process,
     sdcard_process,
     config_process,
+    satapi_sky_process,
+    satapi_passes_process,
+    satapi_geo_process,
+    satapi_session_process,
+    satapi_track_process,
+    satapi_stars_process,
     NULL
 };
 
@@ -100,6 +107,15 @@ void SOWBinit(void) {
     sdcard_init();
     config_init();
     th_xbox360gamepad_init();
+    satapi_sky_load();
+    if (satapi_sky_dropped() > 0) {
+        char buf[32];
+        sprintf(buf, "  %d TLEs did not fit", satapi_sky_dropped());
+        MAX7456_cursor(0, 12);  MAX7456_string((unsigned char *)buf);
+        debug_printf("Sky catalog full, %d TLEs left out.\r\n", satapi_sky_dropped());
+    }
+    satapi_passes_load();
+    satapi_stars_start(SAT_STARS_MIN_EL, SAT_STARS_MAX_MAG);
     
     if (!_nexstar_is_aligned()) {
         debug_printf("Nexstar not aligned, forcing user to align.\r\n");
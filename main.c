@@ -55,6 +55,10 @@
 #include "init.h"
 
 #include "predict_th.h"
+#include "bench_th.h"
+
+/* Hours ahead the A button plans an observing session for. */
+#define MAIN_SESSION_HOURS  3.
 
 int test_flash_page;
 
@@ -65,6 +69,7 @@ int main() {
     FILINFO fInfo;
     int f_return;
     GPS_LOCATION_RAW location;
+    int geo_rank = -1;
     
     SOWBinit();
         
@@ -85,6 +90,32 @@ int main() {
                 }
                 break;
             
+            case BUTT_A_PRESS:
+                /* Plan a session of the visible passes over the next
+                   few hours, see satapi_session.c, or drop the one 
+                   shown. */
+                if (satapi_session_count() != 0) {
+                    satapi_session_clear();
+                }
+                else if (satapi_session_plan(MAIN_SESSION_HOURS, SAT_LIGHT_VISIBLE, SAT_SESSION_PASSES) < 0) {
+                    osd_string_xy(1, 14, "No pass table yet");
+                }
+                break;
+                
+            case BUTT_BACK_PRESS:
+                /* GEO belt survey, see satapi_geo.c. The first press 
+                   starts it, each press after that slews to the next
+                   object along the belt, from north round through east. */
+                if (geo_rank < 0) {
+                    geo_rank = satapi_geo_start() > 0 ? 0 : -1;
+                    osd_string_xy(1, 14, geo_rank < 0 ? "No GEO objects" : "GEO survey started");
+                }
+                else {
+                    if (geo_rank >= satapi_geo_count()) geo_rank = 0;
+                    if (satapi_geo_goto(geo_rank) != -1) geo_rank++;
+                }
+                break;
+                
             case BUTT_XBOX_PRESS:
                 //SAT_POS_DATA q;
                 //satapi_aos(&q, true);
@@ -208,6 +239,13 @@ int main() {
         }
         
         //sgp4sdp4_th_init(); 
+        //bench_th_satapi_load();
+        //bench_th_numeric();
+        //bench_th_math();
+        //bench_th_frame();
+        //bench_th_outputs();
+        //bench_th_appulse();
+        //bench_th_stars();
         
    /* 
         for(int i = 0; process_callbacks[i] != NULL; i++) {
@@ -89,8 +89,30 @@ double nexstar_get_rate_alt(void);
 
 bool _nexstar_is_aligned(void);
 
+/* Degrees per second the mount slews at on each axis in a goto. */
+#define NEXSTAR_SLEW_RATE   4.
+
+/* Defined in nexstar_slew.c */
+float nexstar_slew_time(double el1, double az1, double el2, double az2);
+
 /* Defined in nexstar_align.c */
 void nexstar_force_align(void);
+void nexstar_align_process(void);
+
+/* Most stars nexstar_align_select() proposes. */
+#define NEXSTAR_ALIGN_MAX   3
+
+/* A star proposed for aligning the mount, see nexstar_align_stars.c. */
+typedef struct _nexstar_align_star {
+    int     star;           /* Index for get_bright_star(). */
+    float   azimuth;        /* Degrees, when proposed. */
+    float   elevation;      /* Degrees, when proposed. */
+    float   slew;           /* Seconds to slew to it from the one before, the first from where the mount pointed. */
+} NEXSTAR_ALIGN_STAR;
+
+/* Defined in nexstar_align_stars.c */
+int nexstar_align_select(double elevation, double azimuth, int n, NEXSTAR_ALIGN_STAR *out);
+int nexstar_align_goto(NEXSTAR_ALIGN_STAR *s);
 
 /* Macros */
             
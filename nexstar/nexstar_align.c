@@ -25,29 +25,89 @@
 #include "nexstar.h"
 #include "xbox360gamepad.h"
 #include "user.h"
+#include "star.h"
+
+/* The stars proposed by nexstar_align_process() while 
+   nexstar_force_align() waits for the user. */
+static NEXSTAR_ALIGN_STAR align_stars[NEXSTAR_ALIGN_MAX];
+static int  align_count;            /* Stars proposed, 0 until the star engine has its list. */
+static int  align_next;             /* The next to go to. */
+static bool align_waiting;          /* Set until the stars are proposed. */
+
+/** align_show
+ *
+ * Show the proposed alignment stars, the next to go to marked, on
+ * the lines above the prompt.
+ */
+static void align_show(void) {
+    basicStarData s;
+    char buf[32];
+    int i;
+    
+    for (i = 0; i < align_count; i++) {
+        get_bright_star(align_stars[i].star, &s);
+        osd_stringl(8 + i, buf, sprintf(buf, " %c HR%-4d %4.1f AZ%3d EL%2d", i == align_next ? '>' : ' ', 
+            s.hr, s.mag, (int)align_stars[i].azimuth, (int)align_stars[i].elevation));
+    }
+}
+
+/** nexstar_align_process
+ *
+ * _process() function. While nexstar_force_align() waits for the
+ * user, propose the stars to align on once the star engine has its
+ * list up. Done here so that nexstar_force_align() can block in 
+ * user_get_button(), which keeps the sticks slewing the mount.
+ */
+void nexstar_align_process(void) {
+    double el, azm;
+    char buf[32];
+    
+    if (!align_waiting || satapi_stars_jd() == 0.) return;
+    align_waiting = false;
+    
+    nexstar_get_elazm(&el, &azm);
+    align_count = nexstar_align_select(el, azm, NEXSTAR_ALIGN_MAX, align_stars);
+    if (align_count > 0) {
+        osd_stringl(12, buf, sprintf(buf, "  'A' goto, 'start' done"));
+        align_show();
+    }
+}
 
 /** nexstar_force_align
  *
  * On boot-up if main() detects the Nexstar is not aligned
  * full control is passed here to force the user to align 
- * the Nexstar.
+ * the Nexstar. Once the star engine has its list up, the
+ * stars to align on are proposed and 'A' slews to each in
+ * turn.
  */
 void nexstar_force_align(void) {
+    int i;
     char c, buf[32];
 
     osd_stringl(11, buf, sprintf(buf, "  Please align the NexStar"));
     osd_stringl(12, buf, sprintf(buf, "  Press 'start'  when done"));
     
+    align_count = align_next = 0;
+    align_waiting = true;
+    
     do {
         c = 0;
         while(c != BUTT_START_PRESS) {
             c = user_get_button(false);
+            if (c == BUTT_A_PRESS && align_count > 0) {
+                nexstar_align_goto(&align_stars[align_next]);
+                align_next = (align_next + 1) % align_count;
+                align_show();
+            }
         }
     }
     while(!_nexstar_is_aligned());
     
+    align_waiting = false;
     osd_clear_line(11);
     osd_clear_line(12);
+    for (i = 0; i < align_count; i++) osd_clear_line(8 + i);
     
     _nexstar_set_tracking_mode(0);
     
@@ -0,0 +1,220 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Picks the stars to align the mount on. The candidates are the 
+   stars the star engine (satapi_stars.c) has above the horizon, each
+   costed by its magnitude plus a penalty for being outside a band of
+   elevation that is comfortable to centre in an alt-az mount. The 
+   ALIGN_CANDIDATES cheapest are kept and every set of n of them is 
+   tried in every order, adding a cost for being close together in 
+   azimuth and one for the slews from where the mount points through
+   the set. The slews are only worked out for the sets whose other
+   costs could still beat the best found. Costs are in magnitudes. */
+
+#include "sowb.h"
+#include "nexstar.h"
+#include "satapi.h"
+#include "star.h"
+
+/* Candidates kept for the search. There are ALIGN_CANDIDATES^3 / 6 
+   sets of three to try. */
+#define ALIGN_CANDIDATES    24
+
+/* Elevations a star may be at, and the band inside them it costs 
+   nothing to be in, degrees. */
+#define ALIGN_MIN_EL        20.
+#define ALIGN_MAX_EL        75.
+#define ALIGN_LOW_EL        30.
+#define ALIGN_HIGH_EL       60.
+
+/* Degrees outside the band that cost a magnitude. */
+#define ALIGN_EL_COST       10.
+
+/* The stars should be this far apart in azimuth, degrees; each 
+   ALIGN_SEP_COST short of it costs a magnitude. */
+#define ALIGN_SEPARATION    120.
+#define ALIGN_SEP_COST      15.
+
+/* Seconds of slewing that cost a magnitude, see nexstar_slew_time(). */
+#define ALIGN_SLEW_COST     30.
+
+typedef struct _align_cand {
+    int     star;
+    float   azimuth, elevation;
+    float   cost;
+} ALIGN_CAND;
+
+/** align_gap
+ *
+ * @return float The degrees of azimuth between two stars.
+ */
+static float align_gap(ALIGN_CAND *a, ALIGN_CAND *b) {
+    float d = fabs(a->azimuth - b->azimuth);
+    return d > 180. ? 360. - d : d;
+}
+
+/** align_order
+ *
+ * Find the order of a set of stars that slews the least.
+ *
+ * @param int * The set, indices of the candidates, put in order.
+ * @param int n The size of the set, 1 to NEXSTAR_ALIGN_MAX.
+ * @param ALIGN_CAND * The candidates.
+ * @param ALIGN_CAND * Where the mount points.
+ * @return float The seconds of slewing in that order.
+ */
+static float align_order(int *set, int n, ALIGN_CAND *cand, ALIGN_CAND *mount) {
+    static const int orders[6][3] = { {0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0} };
+    int o, k, best_o = 0, tmp[NEXSTAR_ALIGN_MAX];
+    ALIGN_CAND *from, *to;
+    float t, best = 1E30;
+    
+    for (o = 0; o < 6; o++) {
+        from = mount;
+        t = 0.;
+        for (k = 0; k < n; k++) {
+            if (orders[o][k] >= n) break;
+            to = &cand[set[orders[o][k]]];
+            t += nexstar_slew_time(from->elevation, from->azimuth, to->elevation, to->azimuth);
+            from = to;
+        }
+        if (k < n) continue;
+        if (t < best) { best = t; best_o = o; }
+    }
+    
+    for (k = 0, o = 0; o < 3; o++) {
+        if (orders[best_o][o] < n) tmp[k++] = set[orders[best_o][o]];
+    }
+    for (k = 0; k < n; k++) set[k] = tmp[k];
+    return best;
+}
+
+/** nexstar_align_select
+ *
+ * Propose stars to align the mount on and the order to go to them.
+ * The star engine must have its list up, see satapi_stars_jd().
+ *
+ * @param double elevation Where the mount points, degrees.
+ * @param double azimuth
+ * @param int n The stars wanted, 1 to NEXSTAR_ALIGN_MAX.
+ * @param NEXSTAR_ALIGN_STAR * Filled in with the stars in goto order.
+ * @return int The number proposed, fewer than n if there are not 
+ * enough stars up, -1 if n is out of range.
+ */
+int nexstar_align_select(double elevation, double azimuth, int n, NEXSTAR_ALIGN_STAR *out) {
+    ALIGN_CAND cand[ALIGN_CANDIDATES], mount, *from;
+    float cost, best = 1E30, gap, g, t;
+    int set[NEXSTAR_ALIGN_MAX], best_set[NEXSTAR_ALIGN_MAX];
+    SAT_STAR *s;
+    basicStarData star;
+    double el;
+    int i, j, k, m = 0;
+    
+    if (n < 1 || n > NEXSTAR_ALIGN_MAX) return -1;
+    
+    /* The cheapest stars, kept in cost order. */
+    for (i = 0; (s = satapi_stars_get(i)) != NULL; i++) {
+        el = s->elevation;
+        if (el < ALIGN_MIN_EL || el > ALIGN_MAX_EL) continue;
+        get_bright_star(s->star, &star);
+        cost = star.mag;
+        if (el < ALIGN_LOW_EL) cost += (ALIGN_LOW_EL - el) / ALIGN_EL_COST;
+        if (el > ALIGN_HIGH_EL) cost += (el - ALIGN_HIGH_EL) / ALIGN_EL_COST;
+        if (m == ALIGN_CANDIDATES && cost >= cand[m - 1].cost) continue;
+        j = m < ALIGN_CANDIDATES ? m++ : m - 1;
+        for (; j > 0 && cand[j - 1].cost > cost; j--) cand[j] = cand[j - 1];
+        cand[j].star = s->star;
+        cand[j].azimuth = s->azimuth;
+        cand[j].elevation = s->elevation;
+        cand[j].cost = cost;
+    }
+    if (m < n) n = m;
+    if (n == 0) return 0;
+    
+    mount.elevation = elevation;
+    mount.azimuth = azimuth;
+    
+    /* Every set of n, taken as indices i < j < k; the unused ones 
+       stay at their last value and are not looked at. */
+    for (i = 0; i < m; i++) {
+        for (j = n > 1 ? i + 1 : m - 1; j < m; j++) {
+            for (k = n > 2 ? j + 1 : m - 1; k < m; k++) {
+                set[0] = i; set[1] = j; set[2] = k;
+                cost = cand[i].cost;
+                gap = ALIGN_SEPARATION;
+                if (n > 1) {
+                    cost += cand[j].cost;
+                    g = align_gap(&cand[i], &cand[j]);
+                    if (g < gap) gap = g;
+                }
+                if (n > 2) {
+                    cost += cand[k].cost;
+                    g = align_gap(&cand[i], &cand[k]);
+                    if (g < gap) gap = g;
+                    g = align_gap(&cand[j], &cand[k]);
+                    if (g < gap) gap = g;
+                }
+                cost += (ALIGN_SEPARATION - gap) / ALIGN_SEP_COST;
+                if (cost >= best) continue;
+                t = align_order(set, n, cand, &mount);
+                cost += t / ALIGN_SLEW_COST;
+                if (cost < best) {
+                    best = cost;
+                    memcpy(best_set, set, sizeof(set));
+                }
+                if (n < 3) break;
+            }
+            if (n < 2) break;
+        }
+    }
+    
+    for (i = 0, from = &mount; i < n; i++) {
+        out[i].star = cand[best_set[i]].star;
+        out[i].azimuth = cand[best_set[i]].azimuth;
+        out[i].elevation = cand[best_set[i]].elevation;
+        out[i].slew = nexstar_slew_time(from->elevation, from->azimuth, out[i].elevation, out[i].azimuth);
+        from = &cand[best_set[i]];
+    }
+    return n;
+}
+
+/** nexstar_align_goto
+ *
+ * Slew the mount to a proposed star, where it is now if it is still
+ * in the star engine's list, and bring its place up to date.
+ *
+ * @param NEXSTAR_ALIGN_STAR * The star.
+ * @return int As _nexstar_goto().
+ */
+int nexstar_align_goto(NEXSTAR_ALIGN_STAR *a) {
+    SAT_STAR *s;
+    int i;
+    
+    for (i = 0; (s = satapi_stars_get(i)) != NULL; i++) {
+        if (s->star == a->star) {
+            a->azimuth = s->azimuth;
+            a->elevation = s->elevation;
+            break;
+        }
+    }
+    return _nexstar_goto((uint32_t)((a->elevation / 360.) * 65536.0), (uint32_t)((a->azimuth / 360.) * 65536.0));
+}
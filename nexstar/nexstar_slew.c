@@ -0,0 +1,50 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+
+/* How long the mount takes to slew between two places. Shared by the
+   planners that cost slews, see nexstar_align_stars.c and 
+   satapi_session.c. It has no hardware in it so the host benchmarks
+   can link it. */
+
+#include "sowb.h"
+#include "nexstar.h"
+
+/** nexstar_slew_time
+ *
+ * Both axes move together at NEXSTAR_SLEW_RATE, so the slew takes as
+ * long as the longer axis does. Azimuth goes the short way round.
+ *
+ * @param double Elevation of the first place, degrees.
+ * @param double Azimuth of the first place, degrees.
+ * @param double Elevation of the second place, degrees.
+ * @param double Azimuth of the second place, degrees.
+ * @return float Seconds to slew.
+ */
+float nexstar_slew_time(double el1, double az1, double el2, double az2) {
+    double daz, del;
+    
+    daz = fabs(az1 - az2);
+    if (daz > 180.) daz = 360. - daz;
+    del = fabs(el1 - el2);
+    return (float)((daz > del ? daz : del) / NEXSTAR_SLEW_RATE);
+}
@@ -49,8 +49,6 @@ Where:-
 #include "flash.h"
 #include "pccomms.h"
 
-#define FLASH_BASE_TLE_FILE 10
-
 /* Error flags to send back on failure. */
 #define FLAG_BAD_CHECKSUM   '1'
 #define FLAG_INVALID_LENGTH '2'
@@ -37,6 +37,7 @@ void _nexstar_one_second_timer(int index);
 void _nexstar_100th_timer(int index);
 void _flash_write_timer_callback(int index);
 void _sdcard_timer_callback(int index);
+void _satapi_track_timer_cb(int index);
 
 /* Define an array of timers that the ISR should handle. */
 volatile RIT_TIMER timers[] = {
@@ -47,7 +48,8 @@ volatile RIT_TIMER timers[] = {
     {  0,  0, _nexstar_100th_timer          },      /* Index 4 */
     {  0,  0, _flash_write_timer_callback   },      /* Index 5 */
     {  0,  0, _sdcard_timer_callback        },      /* Index 6 */
-//    {  0,  0, _main_test_callback           },      /* Index 7 */
+    {  0,  0, _satapi_track_timer_cb        },      /* Index 7 */
+//    {  0,  0, _main_test_callback           },      /* Index 8 */
     {  0,  0, NULL                          }       /* Always the last entry. */
 };
 
@@ -30,7 +30,8 @@
 #define RIT_100TH_NEXSTAR   4
 #define FLASH_WRITE_CB      5
 #define SDCARD_TIMER_CB     6
-#define MAIN_TEST_CB        7
+#define SATAPI_TRACK_CB     7
+#define MAIN_TEST_CB        8
 
 #include "sowb.h"
 
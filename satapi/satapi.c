@@ -34,13 +34,16 @@
 #define M_PI 3.1415926535898
 #endif
 
-#define SCAN_INTERVAL 60 
+/* satapi_aos() looks this far ahead (seconds) for a pass that 
+   rises above AOS_MIN_ELEVATION (degrees). */
+#define AOS_SEARCH_SPAN     (60 * 90)
+#define AOS_MIN_ELEVATION   10.
 
 SAT_POS_DATA satellite;
 
 double satapi_aos(char *l0, char *l1, char *l2, SAT_POS_DATA *q, bool goto_aos) {
-    double tsince;
-    char temp1[32], temp2[32];
+    SAT_PASS pass;
+    char temp1[64], temp2[32];
     
     if (q == (SAT_POS_DATA *)NULL) {
         q = &satellite;
@@ -49,84 +52,166 @@ double satapi_aos(char *l0, char *l1, char *l2, SAT_POS_DATA *q, bool goto_aos)
     strcpy(q->elements[0], l0);
     strcpy(q->elements[1], l1);
     strcpy(q->elements[2], l2);
+    
+    if (satapi_load(&q->sat, q->elements) != 0) {
+        return 0.;
+    }
         
     observer_now(q);
-       
-    for (q->tsince = 0; q->tsince < (SCAN_INTERVAL * 90); q->tsince += SCAN_INTERVAL) {
-        KICK_WATCHDOG; /* We are busy! */
-        satallite_calculate(q);
-        if (q->elevation >= 10.) {
-            /* Above horizon viewing. Work back to AOS. */
-            for (tsince = q->tsince, q->tsince--; q->elevation > 10. ; tsince = q->tsince--) {
-                satallite_calculate(q);
-                if (q->elevation < 10.) {
-                    //sprintf(temp, "%03f Q AOS El:%.1f AZ:%.1f %dKm\r\n", q->tsince, q->elevation, q->azimuth, (int)q->range);
-                    //debug_printf(temp);
-                    q->tsince = tsince;
-                    satallite_calculate(q);
-                    sprintf(temp1, "%03f T AOS El:%.1f AZ:%.1f %dKm\r\n", q->tsince, q->elevation, q->azimuth, (int)q->range);
-                    debug_printf(temp1);
-                    P22_DEASSERT;
-                    if (goto_aos) {
-                        sprintf(temp1, "%s  T-%.2f", q->elements[0], tsince);                                     
-                        osd_string_xy(1, 12, temp1);                        
-                        sprintf(temp1, "AOS %.2f%c %s%c %dKm", q->elevation, 176, printDouble_3_2(temp2, q->azimuth), 176, (int)q->range);
-                        osd_string_xy(1, 13, temp1);
-                        _nexstar_goto((uint32_t)((q->elevation / 360.) * 65536.0), (uint32_t)((q->azimuth / 360.) * 65536.0));
-                    }
-                    return tsince;
-                }
-            }
-        }        
+    
+    if (satapi_next_pass(q, 0., AOS_SEARCH_SPAN, AOS_MIN_ELEVATION, &pass) != 0) {
+        return 0.;
     }
-           
-    return 0.;     
+    
+    /* satapi_next_pass() leaves q at the AOS. */
+    sprintf(temp1, "%03f T AOS El:%.1f AZ:%.1f %dKm\r\n", q->tsince, q->elevation, q->azimuth, (int)q->range);
+    debug_printf(temp1);
+    P22_DEASSERT;
+    if (goto_aos) {
+        sprintf(temp1, "%s  T-%.2f", q->elements[0], pass.aos);                                     
+        osd_string_xy(1, 12, temp1);                        
+        sprintf(temp1, "AOS %.2f%c %s%c %dKm", q->elevation, 176, printDouble_3_2(temp2, q->azimuth), 176, (int)q->range);
+        osd_string_xy(1, 13, temp1);
+        _nexstar_goto((uint32_t)((q->elevation / 360.) * 65536.0), (uint32_t)((q->azimuth / 360.) * 65536.0));
+    }
+    
+    return pass.aos;
+}
+
+/** satapi_load
+ *
+ * Parse, validate and preprocess a TLE into a satellite handle. This 
+ * is the expensive part of a prediction (column parsing, checksums, 
+ * unit conversion and the SGP4/SDP4 initialization) so it is done 
+ * once per TLE and the handle is then propagated as often as needed.
+ *
+ * @param SAT_HANDLE * A pointer to the handle to load.
+ * @param char[3][80] The name line and two element lines of the TLE.
+ * @return int 0 on success, -3 if the TLE is invalid.
+ */
+int satapi_load(SAT_HANDLE *h, char elements[3][80]) {
+    tle_t tle;
+    
+    h->is_valid = 0;
+    
+    if (Get_Next_Tle_Set(elements, &tle) != 1) return -3;
+    
+    select_ephemeris(&tle);
+    sgp4_init(&h->ctx, &tle);
+    h->jd_epoch = Julian_Date_of_Epoch(tle.epoch);
+    h->is_valid = 1;
+    
+    return 0;
 }
 
 int satallite_calculate(SAT_POS_DATA *q) {
-    double tsince;
+    return satapi_calculate(q, SAT_OUT_ALL);
+}
+
+/** satapi_calculate
+ *
+ * satallite_calculate() for only some of the outputs. Stages whose
+ * outputs are not asked for are skipped, for example a search for 
+ * AOS needs only SAT_OUT_AZEL and does not pay for the iterative 
+ * sub-satellite point in SAT_OUT_GEODETIC.
+ *
+ * @param SAT_POS_DATA * A pointer to the data structure.
+ * @param int The SAT_OUT_ flags of the outputs wanted.
+ * @return int 0 on success, -1 no time, -2 no location, -3 bad TLE.
+ */
+int satapi_calculate(SAT_POS_DATA *q, int outputs) {
+    obs_frame_t frame;
 
     /* Ensure the time and place are valid. */
     if (!q->time.is_valid)      return -1;
     if (!q->location.is_valid)  return -2;
-        
-    ClearFlag(ALL_FLAGS);
     
-    Get_Next_Tle_Set(q->elements, &q->tle);
-
-    select_ephemeris(&q->tle);
+    /* Only parse the TLE the first time round. */
+    if (!q->sat.is_valid) {
+        if (satapi_load(&q->sat, q->elements) != 0) return -3;
+    }
     
     q->jd_utc = gps_julian_date(&q->time);
-    q->jd_epoch = Julian_Date_of_Epoch(q->tle.epoch);
     
-    tsince = ((q->jd_utc + (q->tsince * (1 / 86400.))) - q->jd_epoch) * xmnpda;
+    /* The observer must be placed at the same instant as the satellite. */
+    satapi_observer_frame(&q->location, q->jd_utc + (q->tsince * (1 / 86400.)), &frame);
+    q->observer = frame.geodetic;
+    
+    return satapi_observe(q, &frame, outputs);
+}
+
+/** satapi_observer_frame
+ *
+ * Build the observer frame for a place and time. It holds the 
+ * sidereal time, the observer's ECI position and the rotation to
+ * the horizon, which are the same for every satellite and star 
+ * looked at then. Build it once per instant and pass it to
+ * satapi_observe() and radec2altaz_frame() for each object.
+ *
+ * @param GPS_LOCATION_AVERAGE * The observer's location.
+ * @param double The Julian date.
+ * @param obs_frame_t * The frame to fill.
+ * @return obs_frame_t * The frame.
+ */
+obs_frame_t * satapi_observer_frame(GPS_LOCATION_AVERAGE *location, double jd, obs_frame_t *frame) {
+    geodetic_t observer;
+    
+    observer.lat   = location->latitude  * de2ra;
+    observer.lon   = location->longitude * de2ra;
+    observer.alt   = location->height / 1000.;
+    observer.theta = 0.;
+    if (location->north_south == 'S') observer.lat *= -1.;
+    if (location->east_west   == 'W') observer.lon *= -1.;
+    
+    Observer_Frame(jd, &observer, frame);
+    return frame;
+}
+
+/** satapi_observe
+ *
+ * Propagate a loaded satellite to the time of an observer frame 
+ * and fill in the outputs asked for. Only q->sat is read; the 
+ * time, location and tsince are not used.
+ *
+ * @param SAT_POS_DATA * A pointer to the data structure.
+ * @param obs_frame_t * The frame from satapi_observer_frame().
+ * @param int The SAT_OUT_ flags of the outputs wanted.
+ * @return int 0 on success, -3 if no TLE is loaded.
+ */
+int satapi_observe(SAT_POS_DATA *q, obs_frame_t *frame, int outputs) {
+    double tsince;
+    
+    if (!q->sat.is_valid) return -3;
+    
+    q->jd_epoch = q->sat.jd_epoch;
+    tsince = (frame->jd - q->jd_epoch) * xmnpda;
     
-    if (isFlagSet(DEEP_SPACE_EPHEM_FLAG)) {
-        SDP4(tsince, &q->tle, &q->pos, &q->vel, &q->phase);
+    sgp4_propagate(&q->sat.ctx, tsince, &q->pos, &q->vel, &q->phase);
+
+    if (outputs & SAT_OUT_VELOCITY) {
+        Convert_Sat_State(&q->pos, &q->vel);
+        q->velocity = q->vel.w; // scalar magnitude, not brightness...
     }
     else {
-        SGP4(tsince, &q->tle, &q->pos, &q->vel, &q->phase);
+        /* Convert_Sat_State() without the magnitudes. */
+        q->pos.x *= xkmper; q->pos.y *= xkmper; q->pos.z *= xkmper;
+        q->vel.x *= xkmper * xmnpda / secday; 
+        q->vel.y *= xkmper * xmnpda / secday; 
+        q->vel.z *= xkmper * xmnpda / secday;
     }
 
-    Convert_Sat_State(&q->pos, &q->vel);
-    SgpMagnitude(&q->vel); // scalar magnitude, not brightness...
-    q->velocity = q->vel.w;
-
-    /* Populate the geodetic_t struct from data supplied. */
-    q->observer.lat   = q->location.latitude  * de2ra;
-    q->observer.lon   = q->location.longitude * de2ra;
-    q->observer.alt   = q->location.height / 1000.;
-    if (q->location.north_south == 'S') q->observer.lat *= -1.;
-    if (q->location.east_west   == 'W') q->observer.lon *= -1.;
-    
-    Calculate_Obs(q->jd_utc, &q->pos, &q->vel, &q->observer, &q->obs_set);
-    Calculate_LatLonAlt(q->jd_utc, &q->pos, &q->sat_geodetic);
-
-    q->azimuth   = Degrees(q->obs_set.x);
-    q->elevation = Degrees(q->obs_set.y);
-    q->range     = q->obs_set.z;
-    q->rangeRate = q->obs_set.w;
-    q->height    = q->sat_geodetic.alt;
+    if (outputs & (SAT_OUT_AZEL | SAT_OUT_RANGE)) {
+        Calculate_Obs_Frame(frame, &q->pos, &q->vel, &q->obs_set);
+        q->azimuth   = Degrees(q->obs_set.x);
+        q->elevation = Degrees(q->obs_set.y);
+        q->range     = q->obs_set.z;
+        q->rangeRate = q->obs_set.w;
+    }
+    
+    if (outputs & SAT_OUT_GEODETIC) {
+        Calculate_LatLonAlt_Frame(frame, &q->pos, &q->sat_geodetic);
+        q->height    = q->sat_geodetic.alt;
+    }
         
     return 0;
 }
@@ -143,27 +228,67 @@ SAT_POS_DATA * observer_now(SAT_POS_DATA *q) {
     return q;    
 }
 
+/** radec2altaz
+ *
+ * Convert RA/Dec to Alt/Az. Done in the precision chosen by 
+ * SGP4_NUMERIC (see sgp4sdp4.h), like the satellite observations.
+ *
+ * @param double The local sidereal time in degrees.
+ * @param GPS_LOCATION_AVERAGE * The observer's location.
+ * @param RaDec * The position to convert.
+ * @param AltAz * Filled with the result.
+ * @return AltAz * The result.
+ */
 AltAz * radec2altaz(double siderealDegrees, GPS_LOCATION_AVERAGE *location, RaDec *radec, AltAz *altaz) {
-    double HA, DEC, LAT, mul, altitude, azimuth;
+    sgp4_real_t HA, DEC, LAT, mul, altitude, azimuth;
     
-    mul = location->north_south == 'S' ? -1.0 : 1.0;
+    mul = location->north_south == 'S' ? SGP4_REAL(-1.0) : SGP4_REAL(1.0);
      
     /* Convert to radians. */
-    HA = siderealDegrees * (M_PI / 180.0) - (radec->ra * (M_PI / 180));
-    DEC = radec->dec * (M_PI / 180.0);
-    LAT = (location->latitude * mul) * (M_PI / 180.0);
+    HA = (sgp4_real_t)siderealDegrees * SGP4_REAL(M_PI / 180.0) - ((sgp4_real_t)radec->ra * SGP4_REAL(M_PI / 180));
+    DEC = (sgp4_real_t)radec->dec * SGP4_REAL(M_PI / 180.0);
+    LAT = ((sgp4_real_t)location->latitude * mul) * SGP4_REAL(M_PI / 180.0);
     
-    altitude = atan2(- sin(HA) * cos(DEC), cos(LAT) * sin(DEC) - sin(LAT) * cos(DEC) * cos(HA));
-    azimuth = asin(sin(LAT) * sin(DEC) + cos(LAT) * cos(DEC) * cos(HA));
+    altitude = SGP4_ATAN2(- SGP4_SIN(HA) * SGP4_COS(DEC), SGP4_COS(LAT) * SGP4_SIN(DEC) - SGP4_SIN(LAT) * SGP4_COS(DEC) * SGP4_COS(HA));
+    azimuth = SGP4_ASIN(SGP4_SIN(LAT) * SGP4_SIN(DEC) + SGP4_COS(LAT) * SGP4_COS(DEC) * SGP4_COS(HA));
 
     // Convert to degrees and swing azimuth around if needed.
-    altaz->alt = azimuth * 180.0 / M_PI;
-    altaz->azm = altitude * 180.0 / M_PI;
+    altaz->alt = azimuth * SGP4_REAL(180.0) / SGP4_REAL(M_PI);
+    altaz->azm = altitude * SGP4_REAL(180.0) / SGP4_REAL(M_PI);
     if (altaz->azm < 0) altaz->azm += 360.0;
   
     return altaz;
 }
 
+/** radec2altaz_frame
+ *
+ * Convert RA/Dec to Alt/Az for the place and time of an observer
+ * frame. The sidereal time and the sine and cosine of the latitude
+ * come from the frame, so converting many stars for one instant 
+ * costs only the trig of each star's own hour angle and declination.
+ *
+ * @param obs_frame_t * The frame from satapi_observer_frame().
+ * @param RaDec * The position to convert.
+ * @param AltAz * Filled with the result.
+ * @return AltAz * The result.
+ */
+AltAz * radec2altaz_frame(obs_frame_t *frame, RaDec *radec, AltAz *altaz) {
+    sgp4_real_t HA, sin_ha, cos_ha, sin_dec, cos_dec, altitude, azimuth;
+    
+    HA = (sgp4_real_t)frame->geodetic.theta - ((sgp4_real_t)radec->ra * SGP4_REAL(M_PI / 180));
+    SGP4_SINCOS(HA, &sin_ha, &cos_ha);
+    SGP4_SINCOS((sgp4_real_t)radec->dec * SGP4_REAL(M_PI / 180.0), &sin_dec, &cos_dec);
+    
+    altitude = SGP4_ASIN(frame->sin_lat * sin_dec + frame->cos_lat * cos_dec * cos_ha);
+    azimuth = SGP4_ATAN2(- sin_ha * cos_dec, frame->cos_lat * sin_dec - frame->sin_lat * cos_dec * cos_ha);
+    
+    altaz->alt = altitude * SGP4_REAL(180.0) / SGP4_REAL(M_PI);
+    altaz->azm = azimuth * SGP4_REAL(180.0) / SGP4_REAL(M_PI);
+    if (altaz->azm < 0) altaz->azm += 360.0;
+    
+    return altaz;
+}
+
 RaDec * altaz2radec(double siderealDegrees, GPS_LOCATION_AVERAGE *location, AltAz *altaz, RaDec *radec) {
     double ALT, AZM, LAT, HA, DEC, mul;
     
@@ -31,6 +31,12 @@
 #define JD_HOUR     (JD_MINUTE * 60.)
 #define JD_DAY      (JD_HOUR   * 24.)
 
+/* Milliseconds each satapi_*_process() may run for on one call, as 
+   rit_read_uptime() counts. Each does at least one step of its work
+   per call whatever the budget, so none of them stalls when the main
+   loop is busy. */
+#define SAT_PROCESS_BUDGET_MS   2
+
 typedef struct _altaz {
     double  alt;
     double  azm;
@@ -51,9 +57,192 @@ typedef struct _eci {
     double atTime;
 } Eci;
 
+/* Outputs of satapi_calculate(). The stages for outputs not asked 
+   for are skipped and their fields in SAT_POS_DATA are left as they 
+   were. pos, vel and phase are always filled in, the magnitudes of 
+   pos and vel (w) only with SAT_OUT_VELOCITY. */
+#define SAT_OUT_AZEL        0x01    /* azimuth, elevation */
+#define SAT_OUT_RANGE       0x02    /* range, rangeRate */
+#define SAT_OUT_GEODETIC    0x04    /* sat_geodetic, height */
+#define SAT_OUT_VELOCITY    0x08    /* velocity */
+#define SAT_OUT_ALL         0x0F
+
+typedef struct _sat_handle {
+    sgp4_ctx_t  ctx;        /* Propagator state, holds the preprocessed TLE. */
+    double      jd_epoch;   /* Computed from the TLE epoch time. */
+    char        is_valid;   /* Set by satapi_load() once the TLE is good. */
+} SAT_HANDLE;
+
+/* Lighting of a pass, see satapi_pass_light(). A pass that is only
+   partly eclipsed has both SUNLIT and ECLIPSED set. */
+#define SAT_LIGHT_DARK      0x01    /* The observer is in darkness for some of the pass. */
+#define SAT_LIGHT_SUNLIT    0x02    /* The satellite is sunlit for some of the pass. */
+#define SAT_LIGHT_ECLIPSED  0x04    /* The satellite is in the Earth's shadow for some of the pass. */
+#define SAT_LIGHT_VISIBLE   0x08    /* Sunlit while the observer is in darkness. */
+
+typedef struct _sat_pass {
+    double  aos;            /* Seconds from SAT_POS_DATA time of AOS. */
+    double  tca;            /* Seconds from SAT_POS_DATA time of closest approach. */
+    double  los;            /* Seconds from SAT_POS_DATA time of LOS. */
+    double  aos_azimuth;
+    double  tca_azimuth;
+    double  tca_elevation;  /* Maximum elevation of the pass. */
+    double  los_azimuth;
+    int     evaluations;    /* Propagations used to find the pass. */
+    
+    /* Filled in by satapi_pass_light(), times as aos. Each pair is 
+       zero when its flag is not set. */
+    int     light;          /* SAT_LIGHT_ flags. */
+    double  dark_start, dark_end;
+    double  eclipse_start, eclipse_end;
+    double  visible_start, visible_end;
+} SAT_PASS;
+
+/* Chebyshev ephemeris of a pass, see satapi_ephem_fit(). */
+#define SAT_EPHEM_ORDER     8   /* Coefficients per value per segment. */
+#define SAT_EPHEM_SEGMENTS  24  /* Most segments one ephemeris can hold. */
+#define SAT_EPHEM_VALUES    4
+#define SAT_EPHEM_AZ        0   /* Azimuth, degrees. */
+#define SAT_EPHEM_EL        1   /* Elevation, degrees. */
+#define SAT_EPHEM_RG        2   /* Range, km. */
+#define SAT_EPHEM_RATE      3   /* Range rate, km/s. */
+
+typedef struct _sat_ephem_segment {
+    double  start;          /* Seconds from the ephemeris time. */
+    double  half;           /* Half the segment length, seconds. */
+    float   c[SAT_EPHEM_VALUES][SAT_EPHEM_ORDER];
+} SAT_EPHEM_SEGMENT;
+
+typedef struct _sat_ephem {
+    double  jd_utc;         /* Julian date that times are relative to. */
+    double  start;          /* Seconds from jd_utc covered by the fit. */
+    double  end;
+    float   max_error[SAT_EPHEM_VALUES];  /* Worst error estimated for the fit. */
+    int     evaluations;    /* Propagations used by the fit. */
+    int     segments;
+    int     last;           /* Segment used by the last evaluation. */
+    SAT_EPHEM_SEGMENT seg[SAT_EPHEM_SEGMENTS];
+} SAT_EPHEM;
+
+/* A satellite passing close to a catalog star, see satapi_appulse(). */
+typedef struct _sat_appulse {
+    double  t;              /* Seconds from SAT_POS_DATA time of closest approach. */
+    int     star;           /* Index for get_bright_star(). */
+    float   separation;     /* Arc minutes. */
+    float   position_angle; /* Of the satellite from the star, degrees north through east. */
+} SAT_APPULSE;
+
+/* Mean orbit geometry of a TLE, see satapi_orbit(). */
+typedef struct _sat_orbit {
+    float   perigee;        /* Height, km. */
+    float   apogee;         /* Height, km. */
+    float   max_latitude;   /* Furthest the sub-satellite point goes from the equator, degrees. */
+    char    fixed;          /* Non-zero for a geostationary orbit. */
+} SAT_ORBIT;
+
+/* Most satellites the sky engine holds, as many near-earth ones as
+   its pool has room for, see satapi_sky.c. The pass table saves 
+   them to flash 16 to a page, so it is a multiple of 16. */
+#define SAT_SKY_MAX         16
+
+/* One satellite of the sky engine, see satapi_sky.c. */
+typedef struct _sat_sky {
+    double      jd;         /* When the values below were found, 0 if not yet. */
+    double      jd_epoch;
+    float       azimuth;    /* Degrees. */
+    float       elevation;  /* Degrees. */
+    float       range;      /* Km. */
+    float       rangeRate;  /* Km/s. */
+    SAT_ORBIT   orbit;
+    char        visible;    /* Zero if it can never rise at the site. */
+    int         size;       /* Bytes it takes in the pool. */
+    sgp4_ctx_t  ctx;        /* Cut short to sgp4_ctx_size(), so must be last. */
+} SAT_SKY;
+
+/* Most belt objects the GEO survey holds. */
+#define SAT_GEO_MAX         32
+
+/* One object of the GEO belt survey, see satapi_geo.c. */
+typedef struct _sat_geo {
+    double      jd;             /* When the values below were found, 0 if not yet. */
+    float       azimuth;        /* Degrees. */
+    float       elevation;      /* Degrees. */
+    float       azimuth_rate;   /* Drift, degrees per minute. */
+    float       elevation_rate; /* Drift, degrees per minute. */
+    uint32_t    offset;         /* Of its TLE in the TLE file, see satapi_tle_read(). */
+    int32_t     catnr;
+} SAT_GEO;
+
+/* A sample of the tracked satellite, see satapi_track.c. */
+typedef struct _sat_track_sample {
+    uint32_t    ms;             /* RIT uptime it is for, milliseconds. */
+    float       azimuth;        /* Degrees. */
+    float       elevation;      /* Degrees. */
+    float       azimuth_rate;   /* Degrees per second. */
+    float       elevation_rate; /* Degrees per second. */
+} SAT_TRACK_SAMPLE;
+
+typedef struct _sat_track_counters {
+    uint32_t    reads;          /* Calls of satapi_track_read(). */
+    uint32_t    underruns;      /* Reads with no samples for the time. */
+    uint32_t    skipped;        /* Samples the producer skipped, having fallen behind. */
+    int32_t     least_ahead;    /* Fewest milliseconds of track left at a read. */
+} SAT_TRACK_COUNTERS;
+
+/* Most stars the star engine holds, see satapi_stars.c, and the 
+   elevation and magnitude it is started with. There are 174 stars
+   to magnitude 3.0 in the catalog. */
+#define SAT_STARS_MAX       192
+#define SAT_STARS_MIN_EL    15.
+#define SAT_STARS_MAX_MAG   3.0
+
+/* A star above the horizon, see satapi_stars.c. */
+typedef struct _sat_star {
+    uint16_t    star;           /* Index for get_bright_star(). */
+    uint16_t    cand;           /* Private to satapi_stars.c. */
+    float       azimuth;        /* Degrees. */
+    float       elevation;      /* Degrees. */
+} SAT_STAR;
+
+/* The rotation between RA/Dec and the horizon for one place and 
+   instant, see satapi_transform.c. */
+typedef struct _sat_transform {
+    sgp4_real_t m[3][3];        /* Rows south, east and zenith, columns the equinox, 90 degrees east of it and the pole. */
+} SAT_TRANSFORM;
+
+/* Called by satapi_tle_scan() with each TLE in the file. */
+typedef int (SAT_TLE_FOUND)(char elements[3][80], uint32_t offset);
+
+/* One pass of the pass table, see satapi_passes.c. 16 bytes so a 
+   flash page holds a whole number of them. */
+typedef struct _sat_pass_entry {
+    int32_t     aos;            /* Seconds after satapi_passes_jd(). */
+    uint16_t    tca;            /* Seconds after aos. */
+    uint16_t    los;            /* Seconds after aos. */
+    uint16_t    tca_elevation;  /* Hundredths of a degree. */
+    uint16_t    aos_azimuth;    /* Hundredths of a degree. */
+    uint16_t    los_azimuth;    /* Hundredths of a degree. */
+    uint8_t     sat;            /* Index for satapi_sky_sat(). */
+    uint8_t     light;          /* SAT_LIGHT_ flags. */
+} SAT_PASS_ENTRY;
+
+/* What satapi_session_plan() makes the most of. */
+#define SAT_SESSION_PASSES      0   /* Passes caught before their highest point. */
+#define SAT_SESSION_WEIGHTED    1   /* Time observed, weighted by elevation. */
+
+/* One pass of an observing session, see satapi_session.c. */
+typedef struct _sat_session_item {
+    SAT_PASS_ENTRY  pass;
+    int32_t         start;      /* Seconds after satapi_passes_jd() it is joined, AOS or later. */
+    float           slew;       /* Seconds slewing to it and settling. */
+    float           score;      /* Elevation-weighted time from start, degree seconds. */
+} SAT_SESSION_ITEM;
+
 typedef struct _sat_pos_data {
 
-    /* Inputs. */
+    /* Inputs. 
+       After changing elements clear sat.is_valid so the TLE is 
+       loaded again on the next satallite_calculate() call. */
     char                    elements[3][80];
     GPS_TIME                time;
     GPS_LOCATION_AVERAGE    location;    
@@ -66,7 +255,7 @@ typedef struct _sat_pos_data {
     double      tsince;
     
     /* Intermediates. */
-    tle_t       tle;        /* Constructed from the elements arrays. */
+    SAT_HANDLE  sat;        /* Loaded once from the elements arrays. */
     geodetic_t  observer;   /* Derived from input observer's location. */
     double      jd_epoch;   /* Computed from the TLE epoch time. */
     double      jd_utc;     /* Computed from the GPS_TIME t */
@@ -87,10 +276,70 @@ typedef struct _sat_pos_data {
 } SAT_POS_DATA;
 
 double satapi_aos(char *, char *, char *, SAT_POS_DATA *, bool);
+int satapi_load(SAT_HANDLE *h, char elements[3][80]);
 int satallite_calculate(SAT_POS_DATA *q);
+int satapi_calculate(SAT_POS_DATA *q, int outputs);
+obs_frame_t * satapi_observer_frame(GPS_LOCATION_AVERAGE *location, double jd, obs_frame_t *frame);
+int satapi_observe(SAT_POS_DATA *q, obs_frame_t *frame, int outputs);
+int satapi_next_pass(SAT_POS_DATA *q, double from, double span, double min_el, SAT_PASS *pass);
+int satapi_pass_light(SAT_POS_DATA *q, SAT_PASS *pass);
+int satapi_ephem_fit(SAT_POS_DATA *q, double start, double end, SAT_EPHEM *e);
+int satapi_ephem_eval(SAT_EPHEM *e, double t, double *v);
+int satapi_appulse(SAT_POS_DATA *q, SAT_PASS *pass, double max_sep, double max_mag, SAT_APPULSE *found, int max);
+void satapi_orbit(tle_t *tle, SAT_ORBIT *o);
+int satapi_orbit_visible(SAT_ORBIT *o, double latitude, double min_el);
+void satapi_sky_clear(void);
+int satapi_sky_add(char elements[3][80]);
+int satapi_sky_load(void);
+void satapi_sky_process(void);
+int satapi_sky_count(void);
+int satapi_sky_dropped(void);
+SAT_SKY * satapi_sky_get(int rank);
+SAT_SKY * satapi_sky_sat(int index);
+int satapi_passes_load(void);
+int satapi_passes_save(void);
+void satapi_passes_process(void);
+int satapi_passes_count(void);
+double satapi_passes_jd(void);
+SAT_PASS_ENTRY * satapi_passes_next(double jd, int sat, int light);
+SAT_PASS_ENTRY * satapi_passes_get(int i);
+int satapi_tle_scan(SAT_TLE_FOUND *found);
+int satapi_tle_read(uint32_t offset, char elements[3][80]);
+int satapi_geo_start(void);
+void satapi_geo_stop(void);
+void satapi_geo_process(void);
+int satapi_geo_count(void);
+SAT_GEO * satapi_geo_get(int rank);
+int satapi_geo_position(SAT_GEO *g, double jd, double *azimuth, double *elevation);
+int satapi_geo_goto(int rank);
+int satapi_session_plan(double hours, int light, int goal);
+void satapi_session_process(void);
+void satapi_session_clear(void);
+int satapi_session_count(void);
+SAT_SESSION_ITEM * satapi_session_get(int i);
+int satapi_track_start(char elements[3][80]);
+void satapi_track_stop(void);
+void satapi_track_process(void);
+int satapi_track_read(uint32_t ms, SAT_TRACK_SAMPLE *out);
+int satapi_track_command(SAT_TRACK_SAMPLE *out);
+void satapi_track_counters(SAT_TRACK_COUNTERS *c);
+int satapi_stars_start(double min_el, double max_mag);
+void satapi_stars_stop(void);
+void satapi_stars_process(void);
+int satapi_stars_count(void);
+int satapi_stars_dropped(void);
+SAT_STAR * satapi_stars_get(int i);
+double satapi_stars_jd(void);
 SAT_POS_DATA * observer_now(SAT_POS_DATA *q);
 
 AltAz * radec2altaz(double siderealDegrees, GPS_LOCATION_AVERAGE *location, RaDec *radec, AltAz *altaz);
+AltAz * radec2altaz_frame(obs_frame_t *frame, RaDec *radec, AltAz *altaz);
 RaDec * altaz2radec(double siderealDegrees, GPS_LOCATION_AVERAGE *location, AltAz *altaz, RaDec *radec);
 
+/* Defined in satapi_transform.c */
+SAT_TRANSFORM * satapi_transform_frame(obs_frame_t *frame, SAT_TRANSFORM *t);
+SAT_TRANSFORM * satapi_transform_site(double siderealDegrees, GPS_LOCATION_AVERAGE *location, SAT_TRANSFORM *t);
+int radec2altaz_batch(SAT_TRANSFORM *t, RaDec *radec, AltAz *altaz, int n);
+int altaz2radec_batch(SAT_TRANSFORM *t, AltAz *altaz, RaDec *radec, int n);
+
 #endif
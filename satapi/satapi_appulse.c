@@ -0,0 +1,337 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Appulses: the moments in a pass when the satellite comes close to a
+   catalog star, as a visual observer times it against one. The pass
+   is sampled at nodes APPULSE_STEPS times an orbit and between them 
+   the satellite's topocentric position is a cubic Hermite curve 
+   through the position and velocity at the nodes, good to far better
+   than an arc second. A run of nodes spanning up to APPULSE_CONE of 
+   sky is bounded by a cone and only the stars star_cone() finds in 
+   it are looked at.
+
+   Positions are geometric, without refraction, as the catalog's are;
+   at a few arc minutes the refraction of the star and the satellite 
+   is the same. The catalog (J2000) is precessed to the date, the
+   satellite is in the propagator's equator and equinox of date. */
+
+#include "sowb.h"
+#include "user.h"
+#include "satapi.h"
+#include "star.h"
+
+/* Nodes per orbit, about 30 seconds apart for a low orbit. */
+#define APPULSE_STEPS       180
+
+/* Most nodes in a run, and the most sky a run spans, degrees. */
+#define APPULSE_RUN         16
+#define APPULSE_CONE        5.
+
+/* Most stars looked at for one run. */
+#define APPULSE_STARS       32
+
+/* The track between two nodes is no longer than this times the 
+   angle between them. */
+#define APPULSE_BOW         1.2
+
+/* Closest approach is found to this many seconds. */
+#define APPULSE_TOLERANCE   0.01
+
+/* The most precession moves a star, degrees per year. */
+#define APPULSE_PRECESSION  (50.3 / 3600.)
+
+#define APPULSE_J2000       2451545.0
+
+typedef struct _appulse_node {
+    double      t;      /* Seconds from q->time. */
+    vector_t    r;      /* Topocentric position, km. */
+    vector_t    v;      /* Topocentric velocity, km/s. */
+    double      arc;    /* Radians of sky to the next node. */
+} APPULSE_NODE;
+
+static APPULSE_NODE appulse_node[APPULSE_RUN];
+
+/** appulse_precession
+ *
+ * The IAU 1976 precession matrix from J2000 to a date.
+ *
+ * @param double The Julian date.
+ * @param double[3][3] Filled with the matrix.
+ */
+static void appulse_precession(double jd, double p[3][3]) {
+    double t, zeta, z, theta, cz, sz, cZ, sZ, ct, st;
+    
+    t = (jd - APPULSE_J2000) / 36525.;
+    zeta  = ((2306.2181 + (0.30188 + 0.017998 * t) * t) * t) * (de2ra / 3600.);
+    z     = ((2306.2181 + (1.09468 + 0.018203 * t) * t) * t) * (de2ra / 3600.);
+    theta = ((2004.3109 - (0.42665 + 0.041833 * t) * t) * t) * (de2ra / 3600.);
+    cz = cos(zeta);  sz = sin(zeta);
+    cZ = cos(z);     sZ = sin(z);
+    ct = cos(theta); st = sin(theta);
+    
+    p[0][0] =  cz * ct * cZ - sz * sZ;
+    p[0][1] = -sz * ct * cZ - cz * sZ;
+    p[0][2] = -st * cZ;
+    p[1][0] =  cz * ct * sZ + sz * cZ;
+    p[1][1] = -sz * ct * sZ + cz * cZ;
+    p[1][2] = -st * sZ;
+    p[2][0] =  cz * st;
+    p[2][1] = -sz * st;
+    p[2][2] =  ct;
+}
+
+/** appulse_sample
+ *
+ * Propagate to a node.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param double t Seconds from q->time.
+ * @param APPULSE_NODE * Filled in.
+ */
+static void appulse_sample(SAT_POS_DATA *q, double t, APPULSE_NODE *n) {
+    obs_frame_t frame;
+    
+    satapi_observer_frame(&q->location, q->jd_utc + t / 86400., &frame);
+    satapi_observe(q, &frame, 0);
+    n->t = t;
+    Vec_Sub(&q->pos, &frame.pos, &n->r);
+    Vec_Sub(&q->vel, &frame.vel, &n->v);
+}
+
+/** appulse_track
+ *
+ * The unit vector towards the satellite at a time between two nodes.
+ *
+ * @param APPULSE_NODE * The node before.
+ * @param APPULSE_NODE * The node after.
+ * @param double t Seconds from q->time.
+ * @param vector_t * Filled with the unit vector.
+ */
+static void appulse_track(APPULSE_NODE *a, APPULSE_NODE *b, double t, vector_t *u) {
+    double h, s, s2, s3, h00, h10, h01, h11;
+    
+    h  = b->t - a->t;
+    s  = (t - a->t) / h;
+    s2 = s * s;
+    s3 = s2 * s;
+    h00 = 2. * s3 - 3. * s2 + 1.;
+    h10 = (s3 - 2. * s2 + s) * h;
+    h01 = 3. * s2 - 2. * s3;
+    h11 = (s3 - s2) * h;
+    u->x = h00 * a->r.x + h10 * a->v.x + h01 * b->r.x + h11 * b->v.x;
+    u->y = h00 * a->r.y + h10 * a->v.y + h01 * b->r.y + h11 * b->v.y;
+    u->z = h00 * a->r.z + h10 * a->v.z + h01 * b->r.z + h11 * b->v.z;
+    SgpMagnitude(u);
+    Normalize(u);
+}
+
+/** appulse_closest
+ *
+ * Find the closest approach to a star between two nodes by golden
+ * section search, the track between nodes being very nearly a 
+ * straight line.
+ *
+ * @param APPULSE_NODE * The node before.
+ * @param APPULSE_NODE * The node after.
+ * @param vector_t * The unit vector towards the star.
+ * @param double * Filled with the time.
+ * @return double The cosine of the separation.
+ */
+static double appulse_closest(APPULSE_NODE *a, APPULSE_NODE *b, vector_t *star, double *t) {
+    vector_t u;
+    double lo = a->t, hi = b->t, x1, x2, f1, f2;
+    
+    x1 = hi - 0.618034 * (hi - lo);
+    x2 = lo + 0.618034 * (hi - lo);
+    appulse_track(a, b, x1, &u); f1 = Dot(&u, star);
+    appulse_track(a, b, x2, &u); f2 = Dot(&u, star);
+    while (hi - lo > APPULSE_TOLERANCE) {
+        if (f1 > f2) {
+            hi = x2; x2 = x1; f2 = f1;
+            x1 = hi - 0.618034 * (hi - lo);
+            appulse_track(a, b, x1, &u); f1 = Dot(&u, star);
+        }
+        else {
+            lo = x1; x1 = x2; f1 = f2;
+            x2 = lo + 0.618034 * (hi - lo);
+            appulse_track(a, b, x2, &u); f2 = Dot(&u, star);
+        }
+    }
+    
+    /* The ends are not reached by the search. */
+    *t = (lo + hi) / 2.;
+    appulse_track(a, b, *t, &u); f1 = Dot(&u, star);
+    f2 = Dot(&a->r, star) / a->r.w;
+    if (f2 > f1) { *t = a->t; f1 = f2; }
+    f2 = Dot(&b->r, star) / b->r.w;
+    if (f2 > f1) { *t = b->t; f1 = f2; }
+    return f1;
+}
+
+/** appulse_radec
+ *
+ * @param vector_t * A unit vector.
+ * @param RaDec * Filled with its RA and Dec, degrees.
+ */
+static void appulse_radec(vector_t *u, RaDec *radec) {
+    radec->ra  = Degrees(FMod2p(atan2(u->y, u->x)));
+    radec->dec = Degrees(asin(u->z));
+}
+
+/** appulse_run
+ *
+ * Look for appulses along a run of nodes. Runs share their end 
+ * nodes, so an approach close to one can be found by both runs;
+ * the two are merged, keeping the closer.
+ *
+ * @param int nodes The number of nodes in appulse_node[].
+ * @param double step Seconds between nodes.
+ * @param double[3][3] The precession matrix.
+ * @param double max_sep Degrees.
+ * @param double max_mag The faintest star wanted.
+ * @param double widen Degrees to widen the star search by for precession.
+ * @param SAT_APPULSE * The appulses found so far.
+ * @param int count How many there are.
+ * @param int max The most to find.
+ * @return int The new count.
+ */
+static int appulse_run(int nodes, double step, double p[3][3], double max_sep, double max_mag, double widen, SAT_APPULSE *found, int count, int max) {
+    basicStarData bright, *s;
+    vector_t centre, u, star, cat;
+    RaDec radec, sr;
+    double radius = 0., a, b, best, t, bt, d;
+    int stars[APPULSE_STARS], n, i, j, k;
+    
+    /* A cone round the run, including the middle of each segment
+       in case the track bows out. */
+    centre.x = centre.y = centre.z = 0.;
+    for (k = 0; k < nodes; k++) {
+        Scalar_Multiply(1. / appulse_node[k].r.w, &appulse_node[k].r, &u);
+        centre.x += u.x; centre.y += u.y; centre.z += u.z;
+    }
+    SgpMagnitude(&centre);
+    Normalize(&centre);
+    for (k = 0; k < nodes; k++) {
+        a = Angle(&centre, &appulse_node[k].r);
+        if (a > radius) radius = a;
+        if (k + 1 < nodes) {
+            appulse_node[k].arc = Angle(&appulse_node[k].r, &appulse_node[k + 1].r);
+            appulse_track(&appulse_node[k], &appulse_node[k + 1], (appulse_node[k].t + appulse_node[k + 1].t) / 2., &u);
+            a = Angle(&centre, &u);
+            if (a > radius) radius = a;
+        }
+    }
+    appulse_radec(&centre, &radec);
+    n = star_cone(&radec, Degrees(radius) + max_sep + widen, max_mag, stars, APPULSE_STARS);
+    
+    for (i = 0; i < n; i++) {
+        KICK_WATCHDOG;
+        s = get_bright_star(stars[i], &bright);
+        cat.x = cos(s->dec * de2ra) * cos(s->ra * de2ra);
+        cat.y = cos(s->dec * de2ra) * sin(s->ra * de2ra);
+        cat.z = sin(s->dec * de2ra);
+        star.x = p[0][0] * cat.x + p[0][1] * cat.y + p[0][2] * cat.z;
+        star.y = p[1][0] * cat.x + p[1][1] * cat.y + p[1][2] * cat.z;
+        star.z = p[2][0] * cat.x + p[2][1] * cat.y + p[2][2] * cat.z;
+        
+        best = -2.; bt = 0.;
+        b = Angle(&appulse_node[0].r, &star);
+        for (k = 0; k + 1 < nodes; k++) {
+            /* No point of the segment is closer than this to the star,
+               by the triangle inequality, so most are not searched. */
+            a = b;
+            b = Angle(&appulse_node[k + 1].r, &star);
+            if ((a + b - APPULSE_BOW * appulse_node[k].arc) / 2. > max_sep * de2ra) continue;
+            d = appulse_closest(&appulse_node[k], &appulse_node[k + 1], &star, &t);
+            if (d > best) { best = d; bt = t; }
+        }
+        if (best < cos(max_sep * de2ra)) continue;
+        d = best < 1. ? Degrees(acos(best)) : 0.;
+        for (j = 0; j < count && (found[j].star != stars[i] || fabs(found[j].t - bt) > step); j++) ;
+        if (j == max || (j < count && found[j].separation <= d * 60.)) continue;
+        
+        /* Position angle of the satellite from the star. */
+        for (k = 0; k + 2 < nodes && appulse_node[k + 1].t < bt; k++) ;
+        appulse_track(&appulse_node[k], &appulse_node[k + 1], bt, &u);
+        appulse_radec(&u, &radec);
+        appulse_radec(&star, &sr);
+        a = (radec.ra - sr.ra) * de2ra;
+        found[j].t = bt;
+        found[j].star = stars[i];
+        found[j].separation = d * 60.;
+        found[j].position_angle = Degrees(FMod2p(atan2(sin(a) * cos(radec.dec * de2ra), 
+            cos(sr.dec * de2ra) * sin(radec.dec * de2ra) - sin(sr.dec * de2ra) * cos(radec.dec * de2ra) * cos(a))));
+        if (j == count) count++;
+    }
+    
+    return count;
+}
+
+/** satapi_appulse
+ *
+ * Find when the satellite passes within max_sep of a catalog star
+ * at least as bright as max_mag during a pass.
+ *
+ * @param SAT_POS_DATA * The satellite and observer, as used to find the pass.
+ * @param SAT_PASS * The pass.
+ * @param double max_sep The widest separation wanted, arc minutes.
+ * @param double max_mag The faintest star wanted.
+ * @param SAT_APPULSE * Filled with the appulses found, in time order.
+ * @param int max The most to find.
+ * @return int The number found.
+ */
+int satapi_appulse(SAT_POS_DATA *q, SAT_PASS *pass, double max_sep, double max_mag, SAT_APPULSE *found, int max) {
+    SAT_APPULSE swap;
+    double p[3][3], orbit, step, widen;
+    int steps, nodes, count = 0, i, j;
+    
+    q->jd_utc = gps_julian_date(&q->time);
+    appulse_precession(q->jd_utc, p);
+    widen = fabs(q->jd_utc - APPULSE_J2000) / 365.25 * APPULSE_PRECESSION;
+    max_sep /= 60.;
+    
+    orbit = (twopi / q->sat.ctx.tle.xno) * 60.;
+    steps = (int)ceil((pass->los - pass->aos) * APPULSE_STEPS / orbit);
+    if (steps < 1) steps = 1;
+    step = (pass->los - pass->aos) / steps;
+    
+    appulse_sample(q, pass->aos, &appulse_node[0]);
+    nodes = 1;
+    for (i = 1; i <= steps && count < max; i++) {
+        appulse_sample(q, pass->aos + i * step, &appulse_node[nodes++]);
+        if (i == steps || nodes == APPULSE_RUN || 
+            Degrees(Angle(&appulse_node[0].r, &appulse_node[nodes - 1].r)) > APPULSE_CONE) {
+            count = appulse_run(nodes, step, p, max_sep, max_mag, widen, found, count, max);
+            appulse_node[0] = appulse_node[nodes - 1];
+            nodes = 1;
+        }
+    }
+    
+    /* Runs are in time order, the stars in a run are not. */
+    for (i = 1; i < count; i++) {
+        swap = found[i];
+        for (j = i; j > 0 && found[j - 1].t > swap.t; j--) found[j] = found[j - 1];
+        found[j] = swap;
+    }
+    
+    return count;
+}
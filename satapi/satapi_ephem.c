@@ -0,0 +1,240 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+#include "sowb.h"
+#include "user.h"
+#include "satapi.h"
+
+#ifndef M_PI
+#define M_PI 3.1415926535898
+#endif
+
+/* A segment is split if its pointing error (degrees on the sky) 
+   exceeds EPHEM_TOLERANCE, unless it is already EPHEM_MIN_SPAN
+   seconds or less. */
+#define EPHEM_TOLERANCE     0.005
+#define EPHEM_MIN_SPAN      8.
+
+/** ephem_sample
+ *
+ * Propagate to time t and store the values to be fitted. Azimuth is 
+ * unwrapped to be within 180 degrees of the previous sample so that 
+ * a pass through north does not jump from 359 to 0.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param SAT_EPHEM * The ephemeris being built, counts the propagations.
+ * @param double t Seconds from q->time.
+ * @param double *v Where to store the values.
+ * @param double *prev_az The previous azimuth, or NULL for the first sample.
+ */
+static void ephem_sample(SAT_POS_DATA *q, SAT_EPHEM *e, double t, double *v, double *prev_az) {
+    q->tsince = t;
+    satapi_calculate(q, SAT_OUT_AZEL | SAT_OUT_RANGE);
+    e->evaluations++;
+    v[SAT_EPHEM_AZ]   = q->azimuth;
+    v[SAT_EPHEM_EL]   = q->elevation;
+    v[SAT_EPHEM_RG]   = q->range;
+    v[SAT_EPHEM_RATE] = q->rangeRate;
+    if (prev_az != NULL) {
+        while (v[SAT_EPHEM_AZ] - *prev_az > 180.) v[SAT_EPHEM_AZ] -= 360.;
+        while (v[SAT_EPHEM_AZ] - *prev_az < -180.) v[SAT_EPHEM_AZ] += 360.;
+    }
+}
+
+/** ephem_clenshaw
+ *
+ * Sum a Chebyshev series at x in [-1, 1].
+ *
+ * @param float *c The SAT_EPHEM_ORDER coefficients.
+ * @param double x Where to evaluate.
+ * @return double The value.
+ */
+static double ephem_clenshaw(const float *c, double x) {
+    double b0 = 0., b1 = 0., b2 = 0., x2 = 2. * x;
+    int j;
+    
+    for (j = SAT_EPHEM_ORDER - 1; j > 0; j--) {
+        b2 = b1;
+        b1 = b0;
+        b0 = x2 * b1 - b2 + c[j];
+    }
+    
+    return x * b0 - b1 + c[0] * 0.5;
+}
+
+/** ephem_fit_segment
+ *
+ * Fit one segment from SAT_EPHEM_ORDER propagations at the Chebyshev
+ * nodes. The error of each value is taken as the larger of the size 
+ * of the last two coefficients, which estimates the truncated terms,
+ * and the difference from the propagator at both ends and the middle 
+ * of the segment, where the fit is least constrained.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param SAT_EPHEM * The ephemeris being built.
+ * @param SAT_EPHEM_SEGMENT * The segment to fill in.
+ * @param double a, b The start and end of the segment.
+ * @param double *err Set to the estimated error of each value.
+ * @return double The worst pointing error, degrees on the sky.
+ */
+static double ephem_fit_segment(SAT_POS_DATA *q, SAT_EPHEM *e, SAT_EPHEM_SEGMENT *s, double a, double b, double *err) {
+    double f[SAT_EPHEM_ORDER][SAT_EPHEM_VALUES], v[SAT_EPHEM_VALUES];
+    double mid, half, sum, x, pointing, worst = 0.;
+    static const double check[3] = { -1., 0., 1. };
+    int i, j, k;
+    
+    mid  = (a + b) / 2.;
+    half = (b - a) / 2.;
+    s->start = a;
+    s->half  = half;
+    
+    /* Nodes run from b back to a, each unwrapped against the last. */
+    for (k = 0; k < SAT_EPHEM_ORDER; k++) {
+        x = cos(M_PI * (k + 0.5) / SAT_EPHEM_ORDER);
+        ephem_sample(q, e, mid + half * x, f[k], k ? &f[k - 1][SAT_EPHEM_AZ] : NULL);
+    }
+    
+    for (i = 0; i < SAT_EPHEM_VALUES; i++) {
+        for (j = 0; j < SAT_EPHEM_ORDER; j++) {
+            for (sum = 0., k = 0; k < SAT_EPHEM_ORDER; k++) {
+                sum += f[k][i] * cos(M_PI * j * (k + 0.5) / SAT_EPHEM_ORDER);
+            }
+            s->c[i][j] = (float)(sum * 2. / SAT_EPHEM_ORDER);
+        }
+        /* The size of the last terms estimates what was truncated. */
+        err[i] = fabs(s->c[i][SAT_EPHEM_ORDER - 1]) + fabs(s->c[i][SAT_EPHEM_ORDER - 2]);
+    }
+    
+    for (k = 0; k < 3; k++) {
+        ephem_sample(q, e, mid + half * check[k], v, &f[SAT_EPHEM_ORDER / 2][SAT_EPHEM_AZ]);
+        for (i = 0; i < SAT_EPHEM_VALUES; i++) {
+            x = fabs(ephem_clenshaw(s->c[i], check[k]) - v[i]);
+            if (x > err[i]) err[i] = x;
+        }
+        pointing = hypot(err[SAT_EPHEM_AZ] * cos(v[SAT_EPHEM_EL] * (M_PI / 180.)), err[SAT_EPHEM_EL]);
+        if (pointing > worst) worst = pointing;
+    }
+    
+    return worst;
+}
+
+/** satapi_ephem_fit
+ *
+ * Build a Chebyshev ephemeris of azimuth, elevation, range and range 
+ * rate between start and end, typically the AOS and LOS found by 
+ * satapi_next_pass(). This is the slow part and is meant to be run 
+ * once per pass ahead of time, after which satapi_ephem_eval() gives 
+ * any instant of the pass for a few multiply-adds.
+ *
+ * The pass is covered left to right with segments of up to 1/32 of 
+ * an orbit. A segment whose pointing error is over EPHEM_TOLERANCE is
+ * halved and refitted while enough segments remain to finish the 
+ * pass. The worst error estimated for each value is kept in 
+ * e->max_error so the caller knows how far the fit can be trusted.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param double start, end The period to cover, seconds from q->time.
+ * @param SAT_EPHEM * The ephemeris to fill.
+ * @return int 0 on success, else as satallite_calculate().
+ */
+int satapi_ephem_fit(SAT_POS_DATA *q, double start, double end, SAT_EPHEM *e) {
+    double t, span, max_span, pointing, err[SAT_EPHEM_VALUES];
+    int i, result, needed;
+    
+    memset(e, 0, sizeof(SAT_EPHEM));
+    
+    q->tsince = start;
+    result = satapi_calculate(q, SAT_OUT_AZEL | SAT_OUT_RANGE);
+    if (result != 0) return result;
+    
+    e->jd_utc = q->jd_utc;
+    e->start  = start;
+    e->end    = end;
+    max_span  = (twopi / q->sat.ctx.tle.xno) * 60. / 32.;
+    
+    for (t = start; t < end && e->segments < SAT_EPHEM_SEGMENTS; t += span) {
+        KICK_WATCHDOG;
+        span = end - t;
+        if (span > max_span) span = max_span;
+        for (;;) {
+            pointing = ephem_fit_segment(q, e, &e->seg[e->segments], t, t + span, err);
+            needed = (int)ceil((end - t - span / 2.) / max_span);
+            if (pointing <= EPHEM_TOLERANCE || span / 2. < EPHEM_MIN_SPAN || 
+                e->segments + 1 + needed > SAT_EPHEM_SEGMENTS) break;
+            span /= 2.;
+        }
+        for (i = 0; i < SAT_EPHEM_VALUES; i++) {
+            if (err[i] > e->max_error[i]) e->max_error[i] = (float)err[i];
+        }
+        e->segments++;
+    }
+    
+    /* Out of segments, only the part fitted can be evaluated. */
+    if (t < end) e->end = t;
+    
+    return 0;
+}
+
+/** satapi_ephem_eval
+ *
+ * Evaluate a fitted ephemeris at time t.
+ *
+ * @param SAT_EPHEM * The ephemeris from satapi_ephem_fit().
+ * @param double t Seconds from the time the ephemeris was fitted for.
+ * @param double *v Filled with the SAT_EPHEM_VALUES values, azimuth 0 to 360.
+ * @return int 0 on success, -5 if t is outside the ephemeris.
+ */
+int satapi_ephem_eval(SAT_EPHEM *e, double t, double *v) {
+    SAT_EPHEM_SEGMENT *s;
+    double x;
+    int i, lo, hi;
+    
+    if (e->segments == 0 || t < e->start || t > e->end) return -5;
+    
+    /* Tracking moves forward through the pass, so try the segment 
+       used last time and the one after it before searching. */
+    i = e->last;
+    if (i >= e->segments || t < e->seg[i].start) {
+        i = 0;
+    }
+    if (i + 1 < e->segments && t >= e->seg[i + 1].start) {
+        i++;
+        if (i + 1 < e->segments && t >= e->seg[i + 1].start) {
+            for (lo = i, hi = e->segments - 1; lo < hi; ) {
+                i = (lo + hi + 1) / 2;
+                if (e->seg[i].start <= t) lo = i; else hi = i - 1;
+            }
+            i = lo;
+        }
+    }
+    e->last = i;
+    
+    s = &e->seg[i];
+    x = (t - s->start) / s->half - 1.;
+    for (i = 0; i < SAT_EPHEM_VALUES; i++) {
+        v[i] = ephem_clenshaw(s->c[i], x);
+    }
+    v[SAT_EPHEM_AZ] = fmod(v[SAT_EPHEM_AZ], 360.);
+    if (v[SAT_EPHEM_AZ] < 0.) v[SAT_EPHEM_AZ] += 360.;
+    
+    return 0;
+}
@@ -0,0 +1,269 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* GEO belt survey. Near-synchronous objects hardly move in the sky,
+   so once satapi_geo_start() has picked them out of the TLE file 
+   satapi_geo_process() puts them in the sky only once a round, every
+   GEO_INTERVAL seconds, all at the same instant. They are all 
+   deep-space and there is no room to hold a context for each, so 
+   each is read back from the file and loaded again, deep-space terms
+   and all, when its turn comes; only the observer frame is shared.
+   Between rounds, positions are carried on with the drift seen 
+   between the last two. The objects above GEO_MIN_EL are kept in
+   azimuth order so that satapi_geo_goto() can step the mount along
+   the belt. Start the survey again after a new TLE file is sent. */
+
+#include "sowb.h"
+#include "user.h"
+#include "rit.h"
+#include "gps.h"
+#include "nexstar.h"
+#include "satapi.h"
+
+/* A near-synchronous orbit. */
+#define GEO_REVS_MIN        0.9     /* Revolutions per day. */
+#define GEO_REVS_MAX        1.1
+#define GEO_ECC_MAX         0.1
+#define GEO_INCL_MAX        20.     /* Degrees. */
+
+/* Objects lower than this, degrees, are not listed. */
+#define GEO_MIN_EL          5.
+
+/* Seconds between rounds. */
+#define GEO_INTERVAL        300
+
+/* The objects, those listed first by azimuth and then the rest, and
+   the object being updated are kept in the USB RAM bank. It is not
+   cleared at reset; geo_found() and satapi_load() fill them in 
+   before they are used. */
+static SAT_GEO    geo[SAT_GEO_MAX] __attribute__((section("AHBSRAM0")));
+static SAT_HANDLE geo_sat __attribute__((section("AHBSRAM0")));
+static int      geo_count;              /* Objects held. */
+static int      geo_listed;             /* Objects above GEO_MIN_EL. */
+static int      geo_next;               /* Next to update, 0 between rounds. */
+static bool     geo_running;
+static bool     geo_block_process;
+static obs_frame_t geo_frame;
+
+/** geo_found
+ *
+ * Hold a TLE found by satapi_tle_scan() if it is near-synchronous,
+ * stopping the scan once full. The elements are as the TLE has them,
+ * before select_ephemeris().
+ */
+static int geo_found(char elements[3][80], uint32_t offset) {
+    tle_t tle;
+    
+    if (Get_Next_Tle_Set(elements, &tle) != 1) return 0;
+    if (tle.xno < GEO_REVS_MIN || tle.xno > GEO_REVS_MAX) return 0;
+    if (tle.eo > GEO_ECC_MAX || tle.xincl > GEO_INCL_MAX) return 0;
+    
+    memset(&geo[geo_count], 0, sizeof(SAT_GEO));
+    geo[geo_count].offset = offset;
+    geo[geo_count].catnr = tle.catnr;
+    geo[geo_count].elevation = -90.;
+    return ++geo_count == SAT_GEO_MAX;
+}
+
+/** satapi_geo_start
+ *
+ * Pick the near-synchronous objects out of the TLE file and start 
+ * the survey. The first SAT_GEO_MAX found are held.
+ *
+ * @return int The number of objects held.
+ */
+int satapi_geo_start(void) {
+    geo_count = geo_listed = geo_next = 0;
+    geo_frame.jd = 0.;
+    satapi_tle_scan(geo_found);
+    geo_running = geo_count > 0;
+    return geo_count;
+}
+
+/** satapi_geo_stop
+ *
+ * Stop updating the survey. What it holds can still be read.
+ */
+void satapi_geo_stop(void) {
+    geo_running = false;
+}
+
+/** geo_update
+ *
+ * Put one object in the round's frame and work out its drift since
+ * the last round.
+ *
+ * @param SAT_GEO * The object.
+ */
+static void geo_update(SAT_GEO *g) {
+    char elements[3][80];
+    vector_t pos, vel, obs_set;
+    double phase, azimuth, elevation, minutes, drift;
+    
+    if (satapi_tle_read(g->offset, elements) != 0) return;
+    if (satapi_load(&geo_sat, elements) != 0) return;
+    
+    sgp4_propagate(&geo_sat.ctx, (geo_frame.jd - geo_sat.jd_epoch) * xmnpda, &pos, &vel, &phase);
+    Convert_Sat_State(&pos, &vel);
+    Calculate_Obs_Frame(&geo_frame, &pos, &vel, &obs_set);
+    azimuth   = Degrees(obs_set.x);
+    elevation = Degrees(obs_set.y);
+    
+    if (g->jd != 0.) {
+        minutes = (geo_frame.jd - g->jd) * xmnpda;
+        drift = azimuth - g->azimuth;
+        if (drift > 180.) drift -= 360.;
+        if (drift < -180.) drift += 360.;
+        g->azimuth_rate   = drift / minutes;
+        g->elevation_rate = (elevation - g->elevation) / minutes;
+    }
+    g->jd        = geo_frame.jd;
+    g->azimuth   = azimuth;
+    g->elevation = elevation;
+}
+
+/** geo_sort
+ *
+ * Put the objects above GEO_MIN_EL first, in azimuth order, and the
+ * rest after them. The order hardly changes between rounds so an
+ * insertion sort is all that is needed.
+ */
+static void geo_sort(void) {
+    SAT_GEO g;
+    int i, j, listed;
+    
+    geo_listed = 0;
+    for (i = 0; i < geo_count; i++) {
+        g = geo[i];
+        listed = g.elevation >= GEO_MIN_EL;
+        if (listed) geo_listed++;
+        for (j = i; j > 0; j--) {
+            if (geo[j - 1].elevation >= GEO_MIN_EL) {
+                if (!listed || geo[j - 1].azimuth <= g.azimuth) break;
+            }
+            else if (!listed && geo[j - 1].azimuth <= g.azimuth) break;
+            geo[j] = geo[j - 1];
+        }
+        geo[j] = g;
+    }
+}
+
+/** satapi_geo_process
+ *
+ * Once every GEO_INTERVAL seconds take a new observer frame from 
+ * the GPS and update the objects in it, a few on each call until 
+ * SAT_PROCESS_BUDGET_MS has passed. Nothing is done until the survey
+ * is started and the GPS has a valid time and place.
+ */
+void satapi_geo_process(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    uint32_t h, start, now;
+    double jd;
+    
+    if (!geo_running || geo_block_process) return;
+    geo_block_process = true;
+    
+    rit_read_uptime(&h, &start);
+    do {
+        if (geo_next == 0) {
+            gps_get_time(&t);
+            gps_get_location_average(&l);
+            if (!t.is_valid || !l.is_valid || l.is_valid == '0') break;
+            jd = gps_julian_date(&t);
+            if ((jd - geo_frame.jd) * 86400. < GEO_INTERVAL - 0.5) break;
+            satapi_observer_frame(&l, jd, &geo_frame);
+        }
+        geo_update(&geo[geo_next++]);
+        if (geo_next == geo_count) {
+            geo_next = 0;
+            geo_sort();
+            break;
+        }
+        rit_read_uptime(&h, &now);
+    }
+    while (now - start < SAT_PROCESS_BUDGET_MS);
+    
+    geo_block_process = false;
+}
+
+/** satapi_geo_count
+ *
+ * @return int The number of objects listed, those above GEO_MIN_EL
+ * at the last round.
+ */
+int satapi_geo_count(void) {
+    return geo_listed;
+}
+
+/** satapi_geo_get
+ *
+ * Get a listed object in azimuth order, from north round through
+ * east. The list is put in order at the end of each round.
+ *
+ * @param int The rank.
+ * @return SAT_GEO * The object, NULL if rank is out of range.
+ */
+SAT_GEO * satapi_geo_get(int rank) {
+    if (rank < 0 || rank >= geo_listed) return (SAT_GEO *)NULL;
+    return &geo[rank];
+}
+
+/** satapi_geo_position
+ *
+ * Carry an object's position on from the last round to a time with
+ * its drift.
+ *
+ * @param SAT_GEO * The object.
+ * @param double The Julian date.
+ * @param double * Filled with the azimuth, degrees.
+ * @param double * Filled with the elevation, degrees.
+ * @return int 0 on success, -1 if the object has not been updated yet.
+ */
+int satapi_geo_position(SAT_GEO *g, double jd, double *azimuth, double *elevation) {
+    double minutes;
+    
+    if (g->jd == 0.) return -1;
+    minutes = (jd - g->jd) * xmnpda;
+    *azimuth = fmod(g->azimuth + g->azimuth_rate * minutes, 360.);
+    if (*azimuth < 0.) *azimuth += 360.;
+    *elevation = g->elevation + g->elevation_rate * minutes;
+    return 0;
+}
+
+/** satapi_geo_goto
+ *
+ * Slew the mount to where a listed object is now.
+ *
+ * @param int The rank, as satapi_geo_get().
+ * @return int -1 if there is no such object, else as _nexstar_goto().
+ */
+int satapi_geo_goto(int rank) {
+    GPS_TIME t;
+    SAT_GEO *g;
+    double azimuth, elevation;
+    
+    if ((g = satapi_geo_get(rank)) == NULL) return -1;
+    gps_get_time(&t);
+    if (satapi_geo_position(g, gps_julian_date(&t), &azimuth, &elevation) != 0) return -1;
+    return _nexstar_goto((uint32_t)((elevation / 360.) * 65536.0), (uint32_t)((azimuth / 360.) * 65536.0));
+}
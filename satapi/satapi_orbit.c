@@ -0,0 +1,90 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* A cheap test, made once per TLE, of whether a satellite can ever 
+   be seen from a site. It uses only the mean elements: inclination 
+   bounds the latitudes the satellite passes over and apogee bounds
+   how far from the sub-satellite point it can be seen. Catalog-wide
+   searches use it to skip satellites that cannot rise at the site. */
+
+#include "sowb.h"
+#include "satapi.h"
+
+/* Allowance, degrees of arc, for everything the mean elements do not
+   say: the osculating orbit, the Earth's flattening and the 
+   difference between geodetic and geocentric latitude. */
+#define ORBIT_MARGIN        2.
+
+/* A geostationary orbit, held in a fixed place in the sky. */
+#define ORBIT_GEO_REVS      1.0027  /* Revolutions per day. */
+#define ORBIT_GEO_REVS_TOL  0.01
+#define ORBIT_GEO_ECC       0.01
+#define ORBIT_GEO_INCL      2.      /* Degrees. */
+
+/** satapi_orbit
+ *
+ * Work out the mean orbit geometry of a TLE. Call once per TLE, the
+ * result does not depend on the site.
+ *
+ * @param tle_t * The elements, after select_ephemeris().
+ * @param SAT_ORBIT * Filled in with the geometry.
+ */
+void satapi_orbit(tle_t *tle, SAT_ORBIT *o) {
+    double a, incl, revs;
+    
+    /* Semi-major axis from the mean motion, earth radii. */
+    a = pow(xke / tle->xno, tothrd);
+    o->perigee = (a * (1. - tle->eo) - 1.) * xkmper;
+    o->apogee  = (a * (1. + tle->eo) - 1.) * xkmper;
+    
+    /* A retrograde orbit reaches the same latitudes as its supplement. */
+    incl = Degrees(tle->xincl);
+    o->max_latitude = incl > 90. ? 180. - incl : incl;
+    
+    revs = tle->xno * xmnpda / twopi;
+    o->fixed = fabs(revs - ORBIT_GEO_REVS) < ORBIT_GEO_REVS_TOL && 
+               tle->eo < ORBIT_GEO_ECC && incl < ORBIT_GEO_INCL;
+}
+
+/** satapi_orbit_visible
+ *
+ * Can a satellite ever be seen above min_el from a latitude? From 
+ * height h a satellite is above min_el within a ground distance of
+ *   acos(Re * cos(min_el) / (Re + h)) - min_el
+ * of its sub-satellite point, which is largest at apogee. The sub-
+ * satellite point never gets closer to the site than the difference
+ * between the site's latitude and max_latitude.
+ *
+ * @param SAT_ORBIT * From satapi_orbit().
+ * @param double The site's latitude, degrees, north positive.
+ * @param double The minimum elevation, degrees.
+ * @return int 1 if it may be seen, 0 if it never can.
+ */
+int satapi_orbit_visible(SAT_ORBIT *o, double latitude, double min_el) {
+    double reach, gap;
+    
+    gap = fabs(latitude) - o->max_latitude;
+    if (gap <= 0.) return 1;
+    
+    reach = Degrees(acos(xkmper * cos(Radians(min_el)) / (xkmper + o->apogee))) - min_el;
+    return gap <= reach + ORBIT_MARGIN;
+}
@@ -0,0 +1,482 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+#include "sowb.h"
+#include "user.h"
+#include "satapi.h"
+
+/* Refined crossing times are good to this many seconds. */
+#define PASS_TOLERANCE      0.5
+
+/* Smallest coarse search step, in seconds. */
+#define PASS_MIN_STEP       20.
+
+/* Give up refining a crossing after this many propagations. */
+#define PASS_MAX_ITER       30
+
+/* Most coarse steps one orbit can take while the satellite is up,
+   pass_step() takes 64, with some to spare. The stepping loops are
+   held to a count of steps as well as a span of time, so none runs 
+   on for ever should its times stop moving. */
+#define PASS_ORBIT_STEPS    72
+
+/* The search needs only elevation, azimuth and range rate. */
+#define PASS_OUTPUTS        (SAT_OUT_AZEL | SAT_OUT_RANGE)
+
+/* What pass_value() returns for a given sample. */
+#define PASS_ELEVATION      0
+#define PASS_RANGE_RATE     1
+#define PASS_SHADOW         2   /* Depth into the Earth's shadow, degrees. */
+#define PASS_SUN            3   /* Solar elevation relative to min_el, needs no propagation. */
+
+/* The observer is in darkness once the sun is below this elevation,
+   degrees, the end of civil twilight. */
+#define LIGHT_TWILIGHT      -6.
+
+/* A pass is sampled for its lighting at least this many times an 
+   orbit, so no shadow crossing is stepped over. */
+#define LIGHT_SAMPLES       16
+
+/* The solar position, shared by every pass and satellite. */
+#ifdef SOWB_HOST
+/* See SOWB_HOST in host/Makefile. */
+static __thread solar_cache_t pass_solar;
+#else
+static solar_cache_t pass_solar;
+#endif
+
+/** pass_value
+ *
+ * Propagate the satellite to time t and return the elevation
+ * relative to min_el, the range rate or the depth into the Earth's
+ * shadow (positive in shadow). PASS_SUN gives the sun's elevation
+ * relative to min_el without propagating the satellite. A satellite
+ * that cannot be propagated to t, as once its orbit has decayed and
+ * SGP4 gives NaN, returns NaN whatever was asked for.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param SAT_PASS * The pass being built, counts the propagations.
+ * @param int Which value to return, one of the PASS_ values.
+ * @param double t Seconds from q->time.
+ * @param double min_el The elevation of the horizon, degrees.
+ * @return double The requested value, NaN if it could not be found.
+ */
+static double pass_value(SAT_POS_DATA *q, SAT_PASS *pass, int which, double t, double min_el) {
+    obs_frame_t frame;
+    vector_t sol, still, obs_set;
+    double depth;
+    
+    if (which == PASS_SUN) {
+        Solar_Position_Cached(&pass_solar, q->jd_utc + t / 86400., &sol);
+        satapi_observer_frame(&q->location, q->jd_utc + t / 86400., &frame);
+        memset(&still, 0, sizeof(vector_t));
+        Calculate_Obs_Frame(&frame, &sol, &still, &obs_set);
+        return Degrees(obs_set.y) - min_el;
+    }
+    
+    q->tsince = t;
+    pass->evaluations++;
+    if (satapi_calculate(q, which == PASS_SHADOW ? 0 : PASS_OUTPUTS) != 0) return NAN;
+    if (!isfinite(q->pos.x) || !isfinite(q->pos.y) || !isfinite(q->pos.z)) return NAN;
+    
+    if (which == PASS_SHADOW) {
+        Solar_Position_Cached(&pass_solar, q->jd_utc + t / 86400., &sol);
+        SgpMagnitude(&q->pos);
+        Sat_Eclipsed(&q->pos, &sol, &depth);
+        return Degrees(depth);
+    }
+    return which == PASS_ELEVATION ? q->elevation - min_el : q->rangeRate;
+}
+
+/** pass_root
+ *
+ * Refine a sign change of elevation or range rate bracketed by ta 
+ * and tb using regula falsi with the Illinois modification, which
+ * converges like the secant method but never loses the bracket.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param SAT_PASS * The pass being built.
+ * @param int Which value to solve for, one of the PASS_ values.
+ * @param double ta, fa One end of the bracket and its value.
+ * @param double tb, fb The other end of the bracket and its value.
+ * @param double min_el The elevation of the horizon, degrees.
+ * @return double The time of the crossing, seconds from q->time.
+ */
+static double pass_root(SAT_POS_DATA *q, SAT_PASS *pass, int which, double ta, double fa, double tb, double fb, double min_el) {
+    double t = (ta + tb) / 2., f;
+    int side = 0, i;
+    
+    for (i = 0; i < PASS_MAX_ITER && (tb - ta) > PASS_TOLERANCE; i++) {
+        t = (fa * tb - fb * ta) / (fa - fb);
+        f = pass_value(q, pass, which, t, min_el);
+        if (f == 0.) break;
+        if ((f < 0.) == (fb < 0.)) {
+            tb = t; fb = f;
+            if (side == -1) fa /= 2.;
+            side = -1;
+        }
+        else {
+            ta = t; fa = f;
+            if (side == 1) fb /= 2.;
+            side = 1;
+        }
+    }
+    
+    return t;
+}
+
+/** pass_culminate
+ *
+ * Find the time of maximum elevation near t by successive parabolic
+ * interpolation, falling back to a golden section step whenever the
+ * parabola is not usable. Near culmination elevation is very nearly
+ * a parabola in time so this usually takes only a few propagations.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param SAT_PASS * The pass being built.
+ * @param double t The first estimate, seconds from q->time.
+ * @param double h The expected error of that estimate, seconds.
+ * @param double lo, hi The AOS and LOS, the search stays inside them.
+ * @return double The time of culmination, seconds from q->time.
+ */
+static double pass_culminate(SAT_POS_DATA *q, SAT_PASS *pass, double t, double h, double lo, double hi) {
+    double a, b, c, x, fa, fb, fc, fx, p, r;
+    int i;
+    
+    a = t - h; if (a < lo) a = lo;
+    c = t + h; if (c > hi) c = hi;
+    b = t;
+    fa = pass_value(q, pass, PASS_ELEVATION, a, 0.);
+    fb = pass_value(q, pass, PASS_ELEVATION, b, 0.);
+    fc = pass_value(q, pass, PASS_ELEVATION, c, 0.);
+    
+    /* Walk the bracket uphill until b is the highest of the three. */
+    for (i = 0; i < PASS_MAX_ITER && (fa > fb || fc > fb); i++) {
+        if (fa > fb) {
+            if (a <= lo) return a;
+            c = b; fc = fb; b = a; fb = fa;
+            a = b - (c - b) * 1.618; if (a < lo) a = lo;
+            fa = pass_value(q, pass, PASS_ELEVATION, a, 0.);
+        }
+        else {
+            if (c >= hi) return c;
+            a = b; fa = fb; b = c; fb = fc;
+            c = b + (b - a) * 1.618; if (c > hi) c = hi;
+            fc = pass_value(q, pass, PASS_ELEVATION, c, 0.);
+        }
+    }
+    
+    for (i = 0; i < PASS_MAX_ITER && (c - a) > PASS_TOLERANCE; i++) {
+        p = (b - a) * (fb - fc);
+        r = (b - c) * (fb - fa);
+        x = (p - r) != 0. ? b - 0.5 * ((b - a) * p - (b - c) * r) / (p - r) : a;
+        if (x <= a || x >= c || x == b) {
+            x = (b - a) > (c - b) ? b - 0.382 * (b - a) : b + 0.382 * (c - b);
+        }
+        fx = pass_value(q, pass, PASS_ELEVATION, x, 0.);
+        if (fabs(x - b) < PASS_TOLERANCE) {
+            if (fx > fb) b = x;
+            break;
+        }
+        if (fx > fb) {
+            if (x < b) { c = b; fc = fb; } else { a = b; fa = fb; }
+            b = x; fb = fx;
+        }
+        else {
+            if (x < b) { a = x; fa = fx; } else { c = x; fc = fx; }
+        }
+    }
+    
+    return b;
+}
+
+/** pass_step
+ *
+ * How far ahead the next coarse sample can safely be taken. Below 
+ * the horizon the step grows with the depth and height of the 
+ * satellite, so a satellite on the far side of the Earth is skipped 
+ * over quickly. It never exceeds an eighth of an orbit so at least 
+ * one sample lands on each side of every closest approach. Above 
+ * min_el an eighth of that is used so the LOS is not overshot. The
+ * height is taken above a spherical Earth, which is close enough 
+ * for a step size and saves finding the sub-satellite point. Should
+ * the last sample have been NaN the step is max_step, so the search
+ * still moves on.
+ *
+ * @param SAT_POS_DATA * The satellite and observer at the last sample.
+ * @param double f The elevation relative to min_el at the last sample.
+ * @param double max_step The eighth-orbit limit, seconds.
+ * @return double The step, seconds.
+ */
+static double pass_step(SAT_POS_DATA *q, double f, double max_step) {
+    double step, height;
+    
+    if (f >= 0.) {
+        step = max_step / 8.;
+    }
+    else {
+        height = sqrt(q->pos.x * q->pos.x + q->pos.y * q->pos.y + q->pos.z * q->pos.z) - xkmper;
+        step = 30.24 * (2. - f * ((height / 8400.) + 0.46));
+    }
+    
+    if (!isfinite(step)) return max_step;
+    if (step < PASS_MIN_STEP) step = PASS_MIN_STEP;
+    if (step > max_step) step = max_step;
+    return step;
+}
+
+/** satapi_next_pass
+ *
+ * Find the first pass above min_el that is in progress at, or starts 
+ * after, the time from. Rather than sampling at a fixed interval the 
+ * search takes coarse steps sized by pass_step() and looks for sign 
+ * changes of elevation (horizon crossings) and of range rate (closest 
+ * approach). Crossings are refined with pass_root() and culmination 
+ * with pass_culminate(), seeded from the closest approach. Watching 
+ * range rate means a short pass that rises and sets between two 
+ * coarse samples is still found.
+ *
+ * All times are seconds from q->time, the same as q->tsince. The AOS 
+ * of a pass already in progress at from will be before from. On 
+ * return q holds the satellite at the AOS. Each stepping loop stops
+ * after a set number of steps as well as at the end of its span, and
+ * the search gives up as soon as a sample cannot be propagated.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param double from Where to start looking, seconds.
+ * @param double span How far to look ahead, seconds.
+ * @param double min_el The elevation of the horizon, degrees.
+ * @param SAT_PASS * Filled in with the pass found.
+ * @return int 0 if a pass was found, -4 if not, -5 if the satellite
+ * could not be propagated, else as satallite_calculate().
+ */
+int satapi_next_pass(SAT_POS_DATA *q, double from, double span, double min_el, SAT_PASS *pass) {
+    double ta, tb, fa, fb, ra, rb, t, f, orbit, max_step, seed, best;
+    int result, have_los = 0, steps = 0, max_steps;
+    
+    memset(pass, 0, sizeof(SAT_PASS));
+    
+    q->tsince = from;
+    result = satapi_calculate(q, PASS_OUTPUTS);
+    if (result != 0) return result;
+    pass->evaluations++;
+    
+    orbit = (twopi / q->sat.ctx.tle.xno) * 60.;
+    max_step = orbit / 8.;
+    if (!isfinite(orbit) || orbit <= 0.) return -5;
+    max_steps = (int)(span / PASS_MIN_STEP) + PASS_ORBIT_STEPS;
+    
+    ta = from;
+    fa = q->elevation - min_el;
+    ra = q->rangeRate;
+    if (!isfinite(fa)) return -5;
+    seed = ta; best = fa;
+    
+    if (fa >= 0.) {
+        /* A pass already in progress, work back to its AOS. */
+        tb = ta; fb = fa;
+        do {
+            KICK_WATCHDOG;
+            t = tb; f = fb;
+            tb = t - max_step;
+            if (tb < from - orbit || ++steps > PASS_ORBIT_STEPS) return -4;
+            fb = pass_value(q, pass, PASS_ELEVATION, tb, min_el);
+            if (!isfinite(fb)) return -5;
+        }
+        while (fb >= 0.);
+        pass->aos = pass_root(q, pass, PASS_ELEVATION, tb, fb, t, f, min_el);
+    }
+    else {
+        /* Step forward until a rise or a closest approach is bracketed. */
+        for (;;) {
+            KICK_WATCHDOG;
+            if (ta > from + span || ++steps > max_steps) return -4;
+            tb = ta + pass_step(q, fa, max_step);
+            fb = pass_value(q, pass, PASS_ELEVATION, tb, min_el);
+            rb = q->rangeRate;
+            if (!isfinite(fb) || !isfinite(rb)) return -5;
+            if (fb >= 0.) {
+                pass->aos = pass_root(q, pass, PASS_ELEVATION, ta, fa, tb, fb, min_el);
+                seed = tb; best = fb;
+                ta = tb; fa = fb; ra = rb;
+                break;
+            }
+            if (ra < 0. && rb >= 0.) {
+                /* Closest approach between samples, is it above min_el? */
+                t = pass_root(q, pass, PASS_RANGE_RATE, ta, ra, tb, rb, min_el);
+                f = pass_value(q, pass, PASS_ELEVATION, t, min_el);
+                if (!isfinite(f)) return -5;
+                if (f >= 0.) {
+                    pass->aos = pass_root(q, pass, PASS_ELEVATION, ta, fa, t, f, min_el);
+                    pass->los = pass_root(q, pass, PASS_ELEVATION, t, f, tb, fb, min_el);
+                    seed = t; best = f;
+                    have_los = 1;
+                    break;
+                }
+            }
+            ta = tb; fa = fb; ra = rb;
+        }
+    }
+    
+    /* The satellite is up at ta, step on to the LOS keeping the
+       highest sample as the starting point for the culmination. */
+    steps = 0;
+    while (!have_los) {
+        KICK_WATCHDOG;
+        if (ta > pass->aos + orbit || ++steps > PASS_ORBIT_STEPS) return -4;
+        tb = ta + pass_step(q, fa, max_step);
+        fb = pass_value(q, pass, PASS_ELEVATION, tb, min_el);
+        if (!isfinite(fb)) return -5;
+        if (fb > best) {
+            seed = tb; best = fb;
+        }
+        if (fb < 0.) {
+            pass->los = pass_root(q, pass, PASS_ELEVATION, ta, fa, tb, fb, min_el);
+            have_los = 1;
+        }
+        ta = tb; fa = fb;
+    }
+    
+    t = (pass->los - pass->aos) / 4.;
+    if (t > max_step / 8.) t = max_step / 8.;
+    pass->tca = pass_culminate(q, pass, seed, t, pass->aos, pass->los);
+    
+    if (!isfinite(pass_value(q, pass, PASS_ELEVATION, pass->los, min_el))) return -5;
+    pass->los_azimuth = q->azimuth;
+    if (!isfinite(pass_value(q, pass, PASS_ELEVATION, pass->tca, min_el))) return -5;
+    pass->tca_azimuth = q->azimuth;
+    pass->tca_elevation = q->elevation;
+    if (!isfinite(pass_value(q, pass, PASS_ELEVATION, pass->aos, min_el))) return -5;
+    pass->aos_azimuth = q->azimuth;
+    
+    return 0;
+}
+
+/** light_window
+ *
+ * Sample a pass n times and find when the observer is in darkness 
+ * (PASS_SUN, the sun below min_el) or the satellite is in shadow 
+ * (PASS_SHADOW). Crossings between samples are refined with 
+ * pass_root(). Should there be more than one such span in the pass
+ * the start of the first and the end of the last are given.
+ *
+ * @param SAT_POS_DATA * The satellite and observer.
+ * @param SAT_PASS * The pass.
+ * @param int PASS_SUN or PASS_SHADOW.
+ * @param double min_el The sun's elevation at twilight, degrees.
+ * @param int n The number of steps from AOS to LOS.
+ * @param double * Filled with the start of the span, seconds.
+ * @param double * Filled with the end of the span, seconds.
+ * @return int 1 if there is such a span, else 0.
+ */
+static int light_window(SAT_POS_DATA *q, SAT_PASS *pass, int which, double min_el, int n, double *start, double *end) {
+    double ta, fa, tb, fb, t;
+    int in_a, in_b, found = 0, i;
+    
+    *start = *end = 0.;
+    ta = pass->aos;
+    fa = pass_value(q, pass, which, ta, min_el);
+    in_a = which == PASS_SUN ? fa < 0. : fa >= 0.;
+    if (in_a) {
+        *start = ta;
+        found = 1;
+    }
+    
+    for (i = 1; i <= n; i++) {
+        KICK_WATCHDOG;
+        tb = pass->aos + (pass->los - pass->aos) * i / n;
+        fb = pass_value(q, pass, which, tb, min_el);
+        in_b = which == PASS_SUN ? fb < 0. : fb >= 0.;
+        if (in_a != in_b) {
+            t = pass_root(q, pass, which, ta, fa, tb, fb, min_el);
+            if (in_b && !found) {
+                *start = t;
+                found = 1;
+            }
+            if (!in_b) *end = t;
+        }
+        ta = tb; fa = fb; in_a = in_b;
+    }
+    if (in_a) *end = pass->los;
+    
+    return found;
+}
+
+/** satapi_pass_light
+ *
+ * Find how a pass from satapi_next_pass() is lit: when the observer
+ * is in darkness, when the satellite is in the Earth's shadow and 
+ * so when it can be seen by reflected sunlight. The solar position
+ * comes from a cache updated a few times a day rather than being 
+ * worked out for each sample. A low orbit pass takes about three 
+ * more propagations, plus a few for each shadow crossing.
+ *
+ * @param SAT_POS_DATA * The satellite and observer, as used to find the pass.
+ * @param SAT_PASS * The pass, its lighting fields are filled in.
+ * @return int The SAT_LIGHT_ flags.
+ */
+int satapi_pass_light(SAT_POS_DATA *q, SAT_PASS *pass) {
+    double orbit, part[2][2], a, b, best = 0.;
+    int n, i, parts = 0;
+    
+    q->jd_utc = gps_julian_date(&q->time);
+    orbit = (twopi / q->sat.ctx.tle.xno) * 60.;
+    n = (int)ceil((pass->los - pass->aos) * LIGHT_SAMPLES / orbit);
+    if (n < 2) n = 2;
+    
+    pass->light = 0;
+    pass->visible_start = pass->visible_end = 0.;
+    if (light_window(q, pass, PASS_SUN, LIGHT_TWILIGHT, n, &pass->dark_start, &pass->dark_end)) {
+        pass->light |= SAT_LIGHT_DARK;
+    }
+    if (light_window(q, pass, PASS_SHADOW, 0., n, &pass->eclipse_start, &pass->eclipse_end)) {
+        pass->light |= SAT_LIGHT_ECLIPSED;
+    }
+    
+    /* The satellite is sunlit either side of its eclipse. */
+    if (pass->light & SAT_LIGHT_ECLIPSED) {
+        if (pass->eclipse_start > pass->aos) {
+            part[parts][0] = pass->aos; part[parts++][1] = pass->eclipse_start;
+        }
+        if (pass->eclipse_end < pass->los) {
+            part[parts][0] = pass->eclipse_end; part[parts++][1] = pass->los;
+        }
+    }
+    else {
+        part[parts][0] = pass->aos; part[parts++][1] = pass->los;
+    }
+    if (parts) pass->light |= SAT_LIGHT_SUNLIT;
+    
+    /* Visible for the longest time it is both sunlit and dark. */
+    for (i = 0; i < parts && (pass->light & SAT_LIGHT_DARK); i++) {
+        a = part[i][0] > pass->dark_start ? part[i][0] : pass->dark_start;
+        b = part[i][1] < pass->dark_end   ? part[i][1] : pass->dark_end;
+        if (b - a > best) {
+            best = b - a;
+            pass->visible_start = a;
+            pass->visible_end = b;
+            pass->light |= SAT_LIGHT_VISIBLE;
+        }
+    }
+    
+    return pass->light;
+}
@@ -0,0 +1,489 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* The pass table holds every pass of the satellites in the sky 
+   engine's catalog (see satapi_sky.c) over the next 24 hours, sorted
+   by AOS, so finding the next pass is a binary search rather than a
+   prediction. Each pass is classed by how it is lit, so a search 
+   can ask for passes that can be seen. satapi_passes_process() 
+   fills it in the background, slices of the satellites' days on 
+   each call until its CPU budget for the call is spent. Once a 
+   satellite has been searched its passes are kept until its TLE 
+   changes; the table is moved on an hour at a time as it ages and
+   started again if the observer moves. Each time the table is 
+   complete it is saved to the SPI flash, so it survives a reboot. 
+
+   Two flash sectors are used in turn. A copy is written header page
+   last, so a copy cut short by a reset is never read back and the 
+   one before it is used instead. */
+
+#include "sowb.h"
+#include "user.h"
+#include "rit.h"
+#include "gps.h"
+#include "flash.h"
+#include "satapi.h"
+
+/* Most passes held, 16 to a flash page. The table shares the 
+   Ethernet RAM bank with the sky engine. */
+#define PASS_MAX            192
+
+/* Seconds the table covers, and the most of it searched for one 
+   satellite on each call. */
+#define PASS_SPAN           86400.
+#define PASS_CHUNK          1800.
+
+/* Passes are timed as the satellite crosses this elevation, degrees. */
+#define PASS_MIN_EL         10.
+
+/* Seconds old the table gets before it is moved on. */
+#define PASS_SLIDE          3600
+
+/* Kilometres the observer may move before the table is started again. */
+#define PASS_MOVE_KM        2.
+
+/* The first of the two flash sectors used. */
+#define PASS_SECTOR         12
+#define PASS_MAGIC          0x33545053  /* "SPT3" */
+
+/* Which TLE a satellite's passes were found for, and how much of
+   the table's span has been searched. */
+typedef struct _pass_sat {
+    double  jd_epoch;
+    int32_t catnr;              /* 0 if there is no satellite. */
+    float   searched;           /* Seconds after the table's jd. */
+} PASS_SAT;
+
+typedef struct _pass_header {
+    uint32_t    magic;
+    uint32_t    sequence;       /* Counts saves, the highest copy is read. */
+    double      jd;             /* Start of the table. */
+    float       latitude;       /* Degrees, north positive. */
+    float       longitude;      /* Degrees, east positive. */
+    int32_t     count;
+} PASS_HEADER;
+
+/* Layout of a copy in its sector: the header, the satellites, then
+   the passes. The satellites and the passes are written and read a
+   whole page at a time, so both must fill whole pages, see the 
+   checks below. */
+#define PASS_PER_PAGE       (int)(FLASH_PAGE_SIZE / sizeof(SAT_PASS_ENTRY))
+#define PASS_PAGE_SATS      1
+#define PASS_SAT_PAGES      (int)(sizeof(pass_sat) / FLASH_PAGE_SIZE)
+#define PASS_PAGE_ENTRIES   (PASS_PAGE_SATS + PASS_SAT_PAGES)
+
+static SAT_PASS_ENTRY pass_entry[PASS_MAX] __attribute__((section("AHBSRAM1")));
+static PASS_SAT     pass_sat[SAT_SKY_MAX] __attribute__((section("AHBSRAM1")));
+static PASS_HEADER  pass_header;
+static SAT_POS_DATA pass_q;
+
+typedef char pass_sat_fills_pages[sizeof(pass_sat) % FLASH_PAGE_SIZE == 0 ? 1 : -1];
+typedef char pass_entry_fills_pages[sizeof(pass_entry) % FLASH_PAGE_SIZE == 0 ? 1 : -1];
+static int          pass_next;          /* Next satellite to search. */
+static bool         pass_dirty;         /* Changed since it was last saved. */
+static bool         pass_block_process;
+
+/** pass_find
+ *
+ * Binary search for the first pass with AOS at or after a time.
+ *
+ * @param int32_t Seconds after the table's jd.
+ * @return int The index, pass_header.count if there is none.
+ */
+static int pass_find(int32_t aos) {
+    int low = 0, high = pass_header.count, mid;
+    
+    while (low < high) {
+        mid = (low + high) / 2;
+        if (pass_entry[mid].aos < aos) low = mid + 1;
+        else high = mid;
+    }
+    return low;
+}
+
+/** pass_drop
+ *
+ * A pass that does not fit in a full table is searched for again
+ * once there is room, so its satellite is wound back to its AOS.
+ */
+static void pass_drop(SAT_PASS_ENTRY *e) {
+    if (pass_sat[e->sat].searched > e->aos) pass_sat[e->sat].searched = e->aos;
+}
+
+/** pass_done
+ *
+ * @return int Non-zero if a satellite has no more to search, all of
+ * the span or, with the table full, up to the last pass held.
+ */
+static int pass_done(int sat) {
+    if (pass_sat[sat].searched >= PASS_SPAN) return 1;
+    return pass_header.count == PASS_MAX && pass_sat[sat].searched >= pass_entry[PASS_MAX - 1].aos;
+}
+
+/** pass_insert
+ *
+ * Add a pass in AOS order. A full table keeps the earliest passes,
+ * the one left out is given to pass_drop().
+ */
+static void pass_insert(SAT_PASS_ENTRY *e) {
+    int i = pass_find(e->aos + 1);
+    
+    if (i == PASS_MAX) {
+        pass_drop(e);
+        return;
+    }
+    if (pass_header.count == PASS_MAX) pass_drop(&pass_entry[--pass_header.count]);
+    memmove(&pass_entry[i + 1], &pass_entry[i], (pass_header.count - i) * sizeof(SAT_PASS_ENTRY));
+    pass_entry[i] = *e;
+    pass_header.count++;
+    pass_dirty = true;
+}
+
+/** pass_remove
+ *
+ * Remove the passes of a satellite.
+ */
+static void pass_remove(int sat) {
+    int i, j;
+    
+    for (i = j = 0; i < pass_header.count; i++) {
+        if (pass_entry[i].sat != sat) pass_entry[j++] = pass_entry[i];
+    }
+    if (j != pass_header.count) pass_dirty = true;
+    pass_header.count = j;
+}
+
+/** pass_sync
+ *
+ * Match the satellites to the sky engine's catalog. One whose TLE 
+ * has changed loses its passes and is searched again.
+ */
+static void pass_sync(void) {
+    SAT_SKY *s;
+    PASS_SAT *p;
+    int i;
+    
+    for (i = 0; i < SAT_SKY_MAX; i++) {
+        s = satapi_sky_sat(i);
+        p = &pass_sat[i];
+        if (s == NULL) {
+            if (p->catnr != 0) pass_remove(i);
+            p->catnr = 0;
+            p->searched = PASS_SPAN;
+        }
+        else if (p->catnr != s->ctx.tle.catnr || p->jd_epoch != s->jd_epoch) {
+            pass_remove(i);
+            p->catnr = s->ctx.tle.catnr;
+            p->jd_epoch = s->jd_epoch;
+            p->searched = 0.;
+            pass_dirty = true;
+        }
+    }
+}
+
+/** pass_restart
+ *
+ * Empty the table and start it again from a time and place.
+ */
+static void pass_restart(double jd, float latitude, float longitude) {
+    int i;
+    
+    pass_header.jd = jd;
+    pass_header.latitude = latitude;
+    pass_header.longitude = longitude;
+    pass_header.count = 0;
+    for (i = 0; i < SAT_SKY_MAX; i++) pass_sat[i].searched = 0.;
+    pass_dirty = true;
+}
+
+/** pass_slide
+ *
+ * Move the start of the table on to a time, in whole seconds, if it 
+ * is more than PASS_SLIDE old. Passes over by then are dropped.
+ */
+static void pass_slide(double jd) {
+    int32_t delta;
+    int i, j;
+    
+    delta = (int32_t)((jd - pass_header.jd) * 86400.);
+    if (delta < PASS_SLIDE) return;
+    
+    for (i = j = 0; i < pass_header.count; i++) {
+        if (pass_entry[i].aos + pass_entry[i].los >= delta) {
+            pass_entry[j] = pass_entry[i];
+            pass_entry[j++].aos -= delta;
+        }
+    }
+    pass_header.count = j;
+    for (i = 0; i < SAT_SKY_MAX; i++) {
+        pass_sat[i].searched -= delta;
+        if (pass_sat[i].searched < 0.) pass_sat[i].searched = 0.;
+    }
+    pass_header.jd += delta / 86400.;
+    pass_dirty = true;
+}
+
+/** pass_moved
+ *
+ * @return int Non-zero if a place is more than PASS_MOVE_KM from 
+ * the one the table is for.
+ */
+static int pass_moved(float latitude, float longitude) {
+    double x, y;
+    
+    y = (latitude - pass_header.latitude) * (xkmper * de2ra);
+    x = (longitude - pass_header.longitude) * (xkmper * de2ra) * cos(latitude * de2ra);
+    return x * x + y * y > PASS_MOVE_KM * PASS_MOVE_KM;
+}
+
+/** pass_search
+ *
+ * Search the next PASS_CHUNK of a satellite's span, or up to the 
+ * end of the first pass in it. Satellites that cannot rise at the
+ * site, and geostationary ones, have no passes. Nor has one that
+ * cannot be propagated, as once its orbit has decayed, which is given
+ * up on for the rest of the span rather than tried on every call.
+ *
+ * @param int The satellite.
+ * @param double The Julian date of pass_q's time.
+ */
+static void pass_search(int sat, double jd) {
+    SAT_SKY *s = satapi_sky_sat(sat);
+    PASS_SAT *p = &pass_sat[sat];
+    SAT_PASS pass;
+    SAT_PASS_ENTRY e;
+    double offset, span;
+    int result;
+    
+    if (!s->visible || s->orbit.fixed) {
+        p->searched = PASS_SPAN;
+        return;
+    }
+    
+    memcpy(&pass_q.sat.ctx, &s->ctx, sgp4_ctx_size(&s->ctx));
+    pass_q.sat.jd_epoch = s->jd_epoch;
+    pass_q.sat.is_valid = 1;
+    
+    /* satapi_next_pass() times are from pass_q's time. */
+    offset = (pass_header.jd - jd) * 86400.;
+    span = PASS_SPAN - p->searched;
+    if (span > PASS_CHUNK) span = PASS_CHUNK;
+    
+    result = satapi_next_pass(&pass_q, p->searched + offset, span, PASS_MIN_EL, &pass);
+    if (result != 0 && result != -4) {
+        p->searched = PASS_SPAN;
+        return;
+    }
+    if (result == -4 || pass.aos - offset >= PASS_SPAN) {
+        p->searched += span;
+        return;
+    }
+    
+    e.aos           = (int32_t)floor(pass.aos - offset + 0.5);
+    e.tca           = (uint16_t)(pass.tca - pass.aos + 0.5);
+    e.los           = (uint16_t)(pass.los - pass.aos + 0.5);
+    e.tca_elevation = (uint16_t)(pass.tca_elevation * 100. + 0.5);
+    e.aos_azimuth   = (uint16_t)(pass.aos_azimuth * 100. + 0.5);
+    e.los_azimuth   = (uint16_t)(pass.los_azimuth * 100. + 0.5);
+    e.sat           = sat;
+    e.light         = satapi_pass_light(&pass_q, &pass);
+    p->searched = pass.los - offset + 1.;
+    pass_insert(&e);
+}
+
+/** satapi_passes_process
+ *
+ * Bring the table up to date with the time, place and catalog and
+ * search slices, one satellite after another, until 
+ * SAT_PROCESS_BUDGET_MS has passed. A complete table that has changed
+ * is saved. Nothing is done until the GPS has a valid time and place.
+ */
+void satapi_passes_process(void) {
+    GPS_LOCATION_AVERAGE *l = &pass_q.location;
+    uint32_t h, start, now;
+    double jd;
+    float latitude, longitude;
+    int i;
+    
+    if (pass_block_process) return;
+    
+    observer_now(&pass_q);
+    if (!pass_q.time.is_valid || !l->is_valid || l->is_valid == '0') return;
+    pass_block_process = true;
+    
+    jd = gps_julian_date(&pass_q.time);
+    latitude  = l->north_south == 'S' ? -l->latitude  : l->latitude;
+    longitude = l->east_west   == 'W' ? -l->longitude : l->longitude;
+    if (pass_header.jd == 0. || pass_moved(latitude, longitude)) {
+        pass_restart(jd, latitude, longitude);
+    }
+    else {
+        pass_slide(jd);
+    }
+    pass_sync();
+    
+    rit_read_uptime(&h, &start);
+    do {
+        for (i = 0; i < SAT_SKY_MAX && pass_done(pass_next); i++) {
+            if (++pass_next == SAT_SKY_MAX) pass_next = 0;
+        }
+        if (i == SAT_SKY_MAX) break;
+        pass_search(pass_next, jd);
+        rit_read_uptime(&h, &now);
+    }
+    while (now - start < SAT_PROCESS_BUDGET_MS);
+    
+    pass_block_process = false;
+    if (i == SAT_SKY_MAX && pass_dirty) satapi_passes_save();
+}
+
+/** satapi_passes_save
+ *
+ * Write the table to the flash sector not holding the last copy.
+ * Blocks, calling the _process() functions, until it is done.
+ *
+ * @return int The number of passes saved.
+ */
+int satapi_passes_save(void) {
+    char buffer[FLASH_PAGE_SIZE];
+    int i, sector, page;
+    
+    /* Don't re-enter from _process(). */
+    pass_block_process = true;
+    
+    pass_header.magic = PASS_MAGIC;
+    pass_header.sequence++;
+    sector = PASS_SECTOR + (pass_header.sequence & 1);
+    page = sector * FLASH_SECTOR_PAGES;
+    
+    while (flash_sector_erase_in_progress()) WHILE_WAITING_DO_PROCESS_FUNCTIONS;
+    flash_erase_sector(sector);
+    while (flash_sector_erase_in_progress()) WHILE_WAITING_DO_PROCESS_FUNCTIONS;
+    
+    for (i = 0; i < PASS_SAT_PAGES; i++) {
+        while (flash_write_in_progress()) WHILE_WAITING_DO_PROCESS_FUNCTIONS;
+        flash_page_write(page + PASS_PAGE_SATS + i, (char *)pass_sat + i * FLASH_PAGE_SIZE);
+    }
+    for (i = 0; i * PASS_PER_PAGE < pass_header.count; i++) {
+        while (flash_write_in_progress()) WHILE_WAITING_DO_PROCESS_FUNCTIONS;
+        flash_page_write(page + PASS_PAGE_ENTRIES + i, (char *)&pass_entry[i * PASS_PER_PAGE]);
+    }
+    
+    memset(buffer, 0xFF, FLASH_PAGE_SIZE);
+    memcpy(buffer, &pass_header, sizeof(PASS_HEADER));
+    while (flash_write_in_progress()) WHILE_WAITING_DO_PROCESS_FUNCTIONS;
+    flash_page_write(page, buffer);
+    while (flash_write_in_progress()) WHILE_WAITING_DO_PROCESS_FUNCTIONS;
+    
+    pass_dirty = false;
+    pass_block_process = false;
+    return pass_header.count;
+}
+
+/** satapi_passes_load
+ *
+ * Read back the last copy of the table saved. Call once the sky 
+ * engine's catalog is loaded; satapi_passes_process() then drops 
+ * what is out of date.
+ *
+ * @return int The number of passes loaded.
+ */
+int satapi_passes_load(void) {
+    PASS_HEADER h[2];
+    char buffer[FLASH_PAGE_SIZE];
+    int i, copy = -1, page;
+    
+    memset(&pass_header, 0, sizeof(PASS_HEADER));
+    memset(pass_sat, 0, sizeof(pass_sat));
+    pass_next = 0;
+    pass_dirty = false;
+    
+    for (i = 0; i < 2; i++) {
+        flash_read_page((PASS_SECTOR + i) * FLASH_SECTOR_PAGES, buffer, true);
+        memcpy(&h[i], buffer, sizeof(PASS_HEADER));
+        if (h[i].magic != PASS_MAGIC || h[i].count < 0 || h[i].count > PASS_MAX) continue;
+        if (copy < 0 || h[i].sequence > h[copy].sequence) copy = i;
+    }
+    if (copy < 0) return 0;
+    
+    page = (PASS_SECTOR + copy) * FLASH_SECTOR_PAGES;
+    for (i = 0; i < PASS_SAT_PAGES; i++) {
+        KICK_WATCHDOG;
+        flash_read_page(page + PASS_PAGE_SATS + i, (char *)pass_sat + i * FLASH_PAGE_SIZE, true);
+    }
+    for (i = 0; i * PASS_PER_PAGE < h[copy].count; i++) {
+        KICK_WATCHDOG;
+        flash_read_page(page + PASS_PAGE_ENTRIES + i, (char *)&pass_entry[i * PASS_PER_PAGE], true);
+    }
+    pass_header = h[copy];
+    return pass_header.count;
+}
+
+/** satapi_passes_count
+ *
+ * @return int The number of passes in the table.
+ */
+int satapi_passes_count(void) {
+    return pass_header.count;
+}
+
+/** satapi_passes_jd
+ *
+ * @return double The Julian date the pass times are from, 0 if the
+ * table has not been started.
+ */
+double satapi_passes_jd(void) {
+    return pass_header.jd;
+}
+
+/** satapi_passes_next
+ *
+ * Find the next pass to start at or after a time, of one satellite
+ * or of any. Only the part of the table already searched is looked
+ * in, so a pass may be missing until the table is complete.
+ *
+ * @param double The Julian date.
+ * @param int The satellite's index for satapi_sky_sat(), -1 for any.
+ * @param int SAT_LIGHT_ flags the pass must all have, e.g. 
+ *        SAT_LIGHT_VISIBLE, 0 for any pass.
+ * @return SAT_PASS_ENTRY * The pass, NULL if there is none.
+ */
+SAT_PASS_ENTRY * satapi_passes_next(double jd, int sat, int light) {
+    int i;
+    
+    i = pass_find((int32_t)ceil((jd - pass_header.jd) * 86400.));
+    for (; i < pass_header.count; i++) {
+        if ((pass_entry[i].light & light) != light) continue;
+        if (sat < 0 || pass_entry[i].sat == sat) return &pass_entry[i];
+    }
+    return (SAT_PASS_ENTRY *)NULL;
+}
+
+/** satapi_passes_get
+ *
+ * @param int The index, passes are in AOS order.
+ * @return SAT_PASS_ENTRY * The pass, NULL if there is none.
+ */
+SAT_PASS_ENTRY * satapi_passes_get(int i) {
+    if (i < 0 || i >= pass_header.count) return (SAT_PASS_ENTRY *)NULL;
+    return &pass_entry[i];
+}
@@ -0,0 +1,341 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Observing session scheduler. When several satellites pass in the 
+   same evening only some can be caught, as the mount has to slew from
+   where one pass sets to where the next rises. satapi_session_plan()
+   takes the passes of the pass table (see satapi_passes.c) over the
+   next few hours and satapi_session_process() finds, a few passes on
+   each call, the sequence that catches the most passes or the most
+   elevation-weighted time. The plan is shown on the OSD as a timeline
+   once it is found.
+
+   The passes are taken in LOS order. The best plan ending with a 
+   pass is the best of those ending with an earlier pass that leaves
+   time to slew to it, plus what it adds, so each pass is looked at 
+   once against each pass before it. A pass reached after its AOS is
+   joined late; the slew is still timed to its AOS point, which is
+   close enough for a pass already under way. */
+
+#include "sowb.h"
+#include "user.h"
+#include "rit.h"
+#include "gps.h"
+#include "osd.h"
+#include "nexstar.h"
+#include "satapi.h"
+
+/* Most passes a session is planned from, a busy evening's worth. */
+#define SESSION_MAX         32
+
+/* The elevation passes are timed at, PASS_MIN_EL in satapi_passes.c. */
+#define SESSION_MIN_EL      10.
+
+/* Seconds to find and centre a satellite once the mount is there. */
+#define SESSION_SETTLE      15.
+
+/* Least seconds of a pass worth joining for SAT_SESSION_WEIGHTED. */
+#define SESSION_MIN_TRACK   30.
+
+/* What a pass counts for with SAT_SESSION_PASSES, more than the 
+   elevation-weighted time of any plan so that only breaks ties. */
+#define SESSION_PASS_VALUE  1E7
+
+/* Where the timeline goes on the OSD, a title then a line a pass. */
+#define SESSION_OSD_LINE    3
+#define SESSION_OSD_LINES   8
+
+#define SESSION_IDLE        0
+#define SESSION_PLANNING    1
+#define SESSION_DONE        2
+
+typedef struct _session_node {
+    SAT_SESSION_ITEM item;      /* As joined in the best plan ending with it. */
+    double  value;              /* Of that plan, < 0 if the pass cannot be reached. */
+    int     prev;               /* The pass before it in that plan, -1 for none. */
+} SESSION_NODE;
+
+/* Kept in the USB RAM bank, which is not cleared at reset. Each node
+   is filled in by satapi_session_plan() before it is used. */
+static SESSION_NODE session_node[SESSION_MAX] __attribute__((section("AHBSRAM0")));
+static int      session_count;
+static int      session_next;           /* Next pass to plan. */
+static int      session_state;
+static int      session_goal;
+static int32_t  session_now;            /* Seconds after satapi_passes_jd(). */
+static double   session_elevation;      /* Where the mount pointed, degrees. */
+static double   session_azimuth;
+static bool     session_block_process;
+
+/** session_slew
+ *
+ * @return float Seconds to slew between two places and settle.
+ */
+static float session_slew(double el1, double az1, double el2, double az2) {
+    return nexstar_slew_time(el1, az1, el2, az2) + SESSION_SETTLE;
+}
+
+/** session_score
+ *
+ * The elevation-weighted time of a pass from a time to its LOS. The
+ * elevation is taken to rise from SESSION_MIN_EL at AOS to its 
+ * highest at TCA and fall back by LOS as a quarter sine each way.
+ *
+ * @param SAT_PASS_ENTRY * The pass.
+ * @param double The time it is joined, seconds as its aos.
+ * @return double Degree seconds.
+ */
+static double session_score(SAT_PASS_ENTRY *e, double start) {
+    double peak, t, rise, fall, score;
+    
+    peak  = e->tca_elevation / 100. - SESSION_MIN_EL;
+    rise  = e->tca;
+    fall  = e->los - e->tca;
+    t     = start - e->aos;
+    score = SESSION_MIN_EL * (e->los - t);
+    if (t < rise) {
+        score += peak * rise * cos(pio2 * t / rise) / pio2;
+        t = rise;
+    }
+    if (fall > 0.) {
+        score += peak * fall * (1. - cos(pio2 * (e->los - t) / fall)) / pio2;
+    }
+    return score;
+}
+
+/** session_try
+ *
+ * Keep a way of reaching a pass if it makes a better plan than the
+ * best found so far.
+ *
+ * @param SESSION_NODE * The pass.
+ * @param int The pass before it, -1 for none.
+ * @param double When the mount gets there, seconds as the pass's aos.
+ * @param float Seconds of that spent slewing.
+ * @param double The value of the plan up to the pass before it.
+ */
+static void session_try(SESSION_NODE *n, int prev, double arrive, float slew, double before) {
+    SAT_PASS_ENTRY *e = &n->item.pass;
+    double start, score, value;
+    
+    start = arrive > e->aos ? arrive : e->aos;
+    if (session_goal == SAT_SESSION_PASSES) {
+        if (start > e->aos + e->tca) return;
+    }
+    else if (start > e->aos + e->los - SESSION_MIN_TRACK) return;
+    
+    score = session_score(e, start);
+    value = before + score + (session_goal == SAT_SESSION_PASSES ? SESSION_PASS_VALUE : 0.);
+    if (value <= n->value) return;
+    
+    n->value      = value;
+    n->prev       = prev;
+    n->item.start = (int32_t)ceil(start);
+    n->item.slew  = slew;
+    n->item.score = (float)score;
+}
+
+/** session_step
+ *
+ * Find the best plan ending with a pass, from the mount where it 
+ * is now or from each pass that sets before it.
+ *
+ * @param int The pass.
+ */
+static void session_step(int j) {
+    SESSION_NODE *n = &session_node[j], *p;
+    double azimuth;
+    float slew;
+    int i;
+    
+    azimuth = n->item.pass.aos_azimuth / 100.;
+    n->value = -1.;
+    slew = session_slew(session_elevation, session_azimuth, SESSION_MIN_EL, azimuth);
+    session_try(n, -1, session_now + slew, slew, 0.);
+    
+    for (i = 0; i < j; i++) {
+        p = &session_node[i];
+        if (p->value < 0.) continue;
+        slew = session_slew(SESSION_MIN_EL, p->item.pass.los_azimuth / 100., SESSION_MIN_EL, azimuth);
+        session_try(n, i, p->item.pass.aos + p->item.pass.los + slew, slew, p->value);
+    }
+}
+
+/** session_show
+ *
+ * Put the timeline on the OSD: when each pass is joined (UTC), the
+ * satellite, its highest elevation and where it rises and sets.
+ */
+static void session_show(void) {
+    char buf[48];
+    SAT_SESSION_ITEM *s;
+    SAT_SKY *sky;
+    int i, minute;
+    
+    for (i = 0; i <= SESSION_OSD_LINES; i++) osd_clear_line(SESSION_OSD_LINE + i);
+    sprintf(buf, "SESSION %d PASSES", session_count);
+    osd_string_xy(1, SESSION_OSD_LINE, buf);
+    
+    for (i = 0; i < session_count && i < SESSION_OSD_LINES; i++) {
+        s = &session_node[i].item;
+        sky = satapi_sky_sat(s->pass.sat);
+        minute = (int)(fmod(satapi_passes_jd() + s->start / 86400. + 0.5, 1.) * 1440.);
+        sprintf(buf, "%02d:%02d %-10.10s %2d%c %03d-%03d", minute / 60, minute % 60, 
+            sky != NULL ? sky->ctx.tle.sat_name : "?", (s->pass.tca_elevation + 50) / 100, 176,
+            (s->pass.aos_azimuth + 50) / 100 % 360, (s->pass.los_azimuth + 50) / 100 % 360);
+        osd_string_xy(1, SESSION_OSD_LINE + 1 + i, buf);
+    }
+}
+
+/** session_finish
+ *
+ * Take the best plan found and move its passes, in order, to the 
+ * front of session_node[].
+ */
+static void session_finish(void) {
+    int path[SESSION_MAX], i, k, best = -1;
+    
+    for (i = 0; i < session_count; i++) {
+        if (session_node[i].value >= 0. && (best < 0 || session_node[i].value > session_node[best].value)) best = i;
+    }
+    for (k = 0; best >= 0; best = session_node[best].prev) path[k++] = best;
+    
+    /* Each pass of the plan comes after the one before it in 
+       session_node[], so moving them forward overwrites nothing 
+       still needed. */
+    for (i = 0; i < k; i++) session_node[i] = session_node[path[k - 1 - i]];
+    session_count = k;
+    session_state = SESSION_DONE;
+    session_show();
+}
+
+/** satapi_session_plan
+ *
+ * Start planning a session from the passes in the pass table that 
+ * are under way or rise in the next few hours. The mount is taken to
+ * start from where it points now. Call satapi_session_process() to 
+ * carry the planning on, if it is not in the process_callbacks[].
+ *
+ * @param double Hours from now the session may span.
+ * @param int SAT_LIGHT_ flags a pass must all have, e.g. 
+ *        SAT_LIGHT_VISIBLE, 0 for any pass.
+ * @param int SAT_SESSION_PASSES to catch the most passes before 
+ *        they reach their highest, SAT_SESSION_WEIGHTED for the most
+ *        elevation-weighted time.
+ * @return int The number of passes planned from, -1 if the pass 
+ * table has not been started or the GPS has no valid time.
+ */
+int satapi_session_plan(double hours, int light, int goal) {
+    GPS_TIME t;
+    SAT_PASS_ENTRY *e;
+    int32_t end;
+    int i, j;
+    
+    session_state = SESSION_IDLE;
+    session_count = 0;
+    gps_get_time(&t);
+    if (satapi_passes_jd() == 0. || !t.is_valid) return -1;
+    
+    session_now = (int32_t)((gps_julian_date(&t) - satapi_passes_jd()) * 86400.);
+    end = session_now + (int32_t)(hours * 3600.);
+    session_goal = goal;
+    nexstar_get_elazm(&session_elevation, &session_azimuth);
+    
+    /* The table is in AOS order; insert in LOS order. */
+    for (i = 0; (e = satapi_passes_get(i)) != NULL && e->aos < end; i++) {
+        if ((e->light & light) != light) continue;
+        if (e->aos + e->los < session_now + SESSION_MIN_TRACK) continue;
+        if (session_count == SESSION_MAX) break;
+        for (j = session_count++; j > 0; j--) {
+            SAT_PASS_ENTRY *p = &session_node[j - 1].item.pass;
+            if (p->aos + p->los <= e->aos + e->los) break;
+            session_node[j] = session_node[j - 1];
+        }
+        memset(&session_node[j], 0, sizeof(SESSION_NODE));
+        session_node[j].item.pass = *e;
+    }
+    
+    session_next = 0;
+    session_state = SESSION_PLANNING;
+    return session_count;
+}
+
+/** satapi_session_process
+ *
+ * Carry on planning a session, a pass at a time until 
+ * SAT_PROCESS_BUDGET_MS has passed. The timeline is shown on the OSD 
+ * once the plan is found.
+ */
+void satapi_session_process(void) {
+    uint32_t h, start, now;
+    
+    if (session_state != SESSION_PLANNING || session_block_process) return;
+    session_block_process = true;
+    
+    rit_read_uptime(&h, &start);
+    do {
+        if (session_next == session_count) {
+            session_finish();
+            break;
+        }
+        session_step(session_next++);
+        rit_read_uptime(&h, &now);
+    }
+    while (now - start < SAT_PROCESS_BUDGET_MS);
+    
+    session_block_process = false;
+}
+
+/** satapi_session_clear
+ *
+ * Drop the session, stopping any planning, and take the timeline off
+ * the OSD.
+ */
+void satapi_session_clear(void) {
+    int i;
+    
+    if (session_state == SESSION_DONE) {
+        for (i = 0; i <= SESSION_OSD_LINES; i++) osd_clear_line(SESSION_OSD_LINE + i);
+    }
+    session_state = SESSION_IDLE;
+    session_count = 0;
+}
+
+/** satapi_session_count
+ *
+ * @return int The number of passes in the plan, -1 while it is still
+ * being planned.
+ */
+int satapi_session_count(void) {
+    if (session_state == SESSION_PLANNING) return -1;
+    return session_state == SESSION_DONE ? session_count : 0;
+}
+
+/** satapi_session_get
+ *
+ * @param int The pass's place in the plan.
+ * @return SAT_SESSION_ITEM * The pass, NULL if there is none.
+ */
+SAT_SESSION_ITEM * satapi_session_get(int i) {
+    if (session_state != SESSION_DONE || i < 0 || i >= session_count) return (SAT_SESSION_ITEM *)NULL;
+    return &session_node[i].item;
+}
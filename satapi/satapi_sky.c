@@ -0,0 +1,300 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* The sky engine keeps the az/el/range of every satellite in the TLE
+   file sent by the host (see pccomms mode1) up to date in the 
+   background. satapi_sky_process() is a _process() function that 
+   updates a few satellites on each call, round-robin, until its CPU
+   budget for the call is spent. Every satellite in a round is put
+   in the same observer frame, taken at the start of the round. The
+   satellites are kept sorted by elevation so satapi_sky_get(0) is
+   always the highest one. Satellites that can never rise at the site
+   are not propagated at all, see satapi_orbit.c, and geostationary
+   ones only every few rounds. */
+
+#include "sowb.h"
+#include "user.h"
+#include "rit.h"
+#include "gps.h"
+#include "satapi.h"
+
+/* Most satellites held, and the pool their contexts are kept in.
+   A near-earth satellite takes about 440 bytes, a deep-space one 
+   about 1K, so the pool holds SKY_MAX near-earth ones but fewer if
+   some are deep-space, see the check below. The pool shares the 
+   Ethernet RAM bank with the pass table. */
+#define SKY_MAX             SAT_SKY_MAX
+#define SKY_POOL_SIZE       8192
+
+/* Bytes a near-earth satellite takes in the pool, see satapi_sky_add(). */
+#define SKY_NEAR_SIZE       ((offsetof(SAT_SKY, ctx) + offsetof(sgp4_ctx_t, model) + sizeof(sgp4_near_t) \
+                              + sizeof(double) - 1) & ~(sizeof(double) - 1))
+
+/* Geostationary satellites are updated once every this many rounds. */
+#define SKY_FIXED_ROUNDS    16
+
+/* The satellites are classed again when the site's latitude moves
+   by more than this many degrees. */
+#define SKY_LATITUDE_TOL    0.1
+
+static double   sky_pool[SKY_POOL_SIZE / sizeof(double)] __attribute__((section("AHBSRAM1")));
+static int      sky_used;               /* Bytes of the pool in use. */
+static SAT_SKY *sky_sat[SKY_MAX];       /* In load order. */
+static SAT_SKY *sky_order[SKY_MAX];     /* Highest elevation first. */
+static int      sky_count;
+static int      sky_dropped;            /* TLEs in the file left out for lack of room. */
+static int      sky_next;               /* Next to update, in load order. */
+static int      sky_round;              /* Rounds since the catalog was loaded. */
+static double   sky_latitude;           /* Site latitude the satellites were classed for. */
+static bool     sky_block_process;
+static obs_frame_t sky_frame;
+
+/* The last satellite is set up with room for a whole context. */
+typedef char sky_pool_holds_max[(SKY_MAX - 1) * SKY_NEAR_SIZE + sizeof(SAT_SKY) <= SKY_POOL_SIZE ? 1 : -1];
+
+/** satapi_sky_clear
+ *
+ * Empty the catalog.
+ */
+void satapi_sky_clear(void) {
+    sky_used = 0;
+    sky_count = 0;
+    sky_dropped = 0;
+    sky_next = 0;
+    sky_round = 0;
+}
+
+/** satapi_sky_add
+ *
+ * Load a TLE and add it to the catalog. The propagator context is
+ * set up in place at the end of the pool, which needs room for a 
+ * whole context, and then cut short to the part the model uses, 
+ * see sgp4_ctx_size().
+ *
+ * @param char[3][80] The name line and two element lines of the TLE.
+ * @return int 0 on success, -3 if the TLE is invalid, -5 if full.
+ */
+int satapi_sky_add(char elements[3][80]) {
+    tle_t tle;
+    SAT_SKY *s;
+    int size;
+    
+    if (sky_count == SKY_MAX) return -5;
+    if (sky_used + sizeof(SAT_SKY) > SKY_POOL_SIZE) return -5;
+    if (Get_Next_Tle_Set(elements, &tle) != 1) return -3;
+    
+    s = (SAT_SKY *)((char *)sky_pool + sky_used);
+    memset(s, 0, offsetof(SAT_SKY, ctx));
+    select_ephemeris(&tle);
+    sgp4_init(&s->ctx, &tle);
+    s->jd_epoch = Julian_Date_of_Epoch(tle.epoch);
+    s->elevation = -90.;
+    satapi_orbit(&tle, &s->orbit);
+    s->visible = 1;
+    
+    /* Round up to keep the doubles in the next entry aligned. */
+    size = offsetof(SAT_SKY, ctx) + sgp4_ctx_size(&s->ctx);
+    size = (size + sizeof(double) - 1) & ~(sizeof(double) - 1);
+    s->size = size;
+    sky_used += size;
+    
+    sky_sat[sky_count] = s;
+    sky_order[sky_count] = s;
+    sky_count++;
+    return 0;
+}
+
+/** sky_found
+ *
+ * Add a TLE found by satapi_tle_scan(). Once the catalog is full the
+ * scan carries on so the TLEs left out can be counted.
+ */
+static int sky_found(char elements[3][80], uint32_t offset) {
+    if (satapi_sky_add(elements) == -5) sky_dropped++;
+    return 0;
+}
+
+/** satapi_sky_load
+ *
+ * Empty the catalog and fill it from the TLE file in flash, see 
+ * satapi_tle_scan(). TLEs that do not fit are counted, see 
+ * satapi_sky_dropped().
+ *
+ * @return int The number of satellites loaded.
+ */
+int satapi_sky_load(void) {
+    satapi_sky_clear();
+    satapi_tle_scan(sky_found);
+    return sky_count;
+}
+
+/** sky_update
+ *
+ * Put one satellite in the frame and move it to its place in the 
+ * elevation order. The order is nearly right already, so a single
+ * insertion step is all that is needed.
+ *
+ * @param SAT_SKY * The satellite.
+ * @param obs_frame_t * The frame.
+ */
+static void sky_update(SAT_SKY *s, obs_frame_t *frame) {
+    vector_t pos, vel, obs_set;
+    double phase;
+    int i, j;
+    
+    sgp4_propagate(&s->ctx, (frame->jd - s->jd_epoch) * xmnpda, &pos, &vel, &phase);
+    Convert_Sat_State(&pos, &vel);
+    Calculate_Obs_Frame(frame, &pos, &vel, &obs_set);
+    
+    s->jd        = frame->jd;
+    s->azimuth   = Degrees(obs_set.x);
+    s->elevation = Degrees(obs_set.y);
+    s->range     = obs_set.z;
+    s->rangeRate = obs_set.w;
+    
+    for (i = 0; sky_order[i] != s; i++) ;
+    for (j = i; j > 0 && sky_order[j - 1]->elevation < s->elevation; j--) {
+        sky_order[j] = sky_order[j - 1];
+    }
+    for (; j < sky_count - 1 && sky_order[j + 1]->elevation > s->elevation; j++) {
+        sky_order[j] = sky_order[j + 1];
+    }
+    sky_order[j] = s;
+}
+
+/** sky_classify
+ *
+ * Mark which satellites can rise above the horizon at a latitude.
+ * Those that cannot are parked at the bottom of the order.
+ *
+ * @param double The site's latitude, degrees, north positive.
+ */
+static void sky_classify(double latitude) {
+    SAT_SKY *s;
+    int i, j;
+    
+    for (i = 0; i < sky_count; i++) {
+        s = sky_sat[i];
+        s->visible = satapi_orbit_visible(&s->orbit, latitude, 0.);
+        if (!s->visible) {
+            s->jd = 0;
+            s->elevation = -90.;
+        }
+    }
+    sky_latitude = latitude;
+    
+    for (i = 1; i < sky_count; i++) {
+        s = sky_order[i];
+        for (j = i; j > 0 && sky_order[j - 1]->elevation < s->elevation; j--) {
+            sky_order[j] = sky_order[j - 1];
+        }
+        sky_order[j] = s;
+    }
+}
+
+/** satapi_sky_process
+ *
+ * Update satellites until SAT_PROCESS_BUDGET_MS has passed or the
+ * round is done. A new observer frame is taken from the GPS at the
+ * start of each round; nothing is done until the GPS has a valid 
+ * time and place.
+ */
+void satapi_sky_process(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    SAT_SKY *s;
+    uint32_t h, start, now;
+    double latitude;
+    
+    if (sky_block_process || sky_count == 0) return;
+    sky_block_process = true;
+    
+    rit_read_uptime(&h, &start);
+    do {
+        if (sky_next == 0) {
+            gps_get_time(&t);
+            gps_get_location_average(&l);
+            if (!t.is_valid || !l.is_valid || l.is_valid == '0') break;
+            satapi_observer_frame(&l, gps_julian_date(&t), &sky_frame);
+            latitude = Degrees(sky_frame.geodetic.lat);
+            if (sky_round == 0 || fabs(latitude - sky_latitude) > SKY_LATITUDE_TOL) {
+                sky_classify(latitude);
+            }
+            sky_round++;
+        }
+        s = sky_sat[sky_next++];
+        if (s->visible && (!s->orbit.fixed || s->jd == 0 || sky_round % SKY_FIXED_ROUNDS == 1)) {
+            sky_update(s, &sky_frame);
+        }
+        if (sky_next == sky_count) {
+            sky_next = 0;
+            break;
+        }
+        rit_read_uptime(&h, &now);
+    }
+    while (now - start < SAT_PROCESS_BUDGET_MS);
+    
+    sky_block_process = false;
+}
+
+/** satapi_sky_count
+ *
+ * @return int The number of satellites in the catalog.
+ */
+int satapi_sky_count(void) {
+    return sky_count;
+}
+
+/** satapi_sky_dropped
+ *
+ * @return int The number of TLEs left out of the catalog by the last
+ *             satapi_sky_load() because it was full.
+ */
+int satapi_sky_dropped(void) {
+    return sky_dropped;
+}
+
+/** satapi_sky_get
+ *
+ * Get a satellite by elevation, 0 is the highest. Satellites not 
+ * yet updated have jd zero and are at the end.
+ *
+ * @param int The rank.
+ * @return SAT_SKY * The satellite, NULL if rank is out of range.
+ */
+SAT_SKY * satapi_sky_get(int rank) {
+    if (rank < 0 || rank >= sky_count) return (SAT_SKY *)NULL;
+    return sky_order[rank];
+}
+
+/** satapi_sky_sat
+ *
+ * Get a satellite by its place in the TLE file, which does not 
+ * change until the catalog is loaded again.
+ *
+ * @param int The index, 0 is the first loaded.
+ * @return SAT_SKY * The satellite, NULL if index is out of range.
+ */
+SAT_SKY * satapi_sky_sat(int index) {
+    if (index < 0 || index >= sky_count) return (SAT_SKY *)NULL;
+    return sky_sat[index];
+}
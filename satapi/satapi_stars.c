@@ -0,0 +1,446 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* The star engine keeps the list of catalog stars above an elevation
+   and brighter than a magnitude, with their azimuth and elevation, up
+   to date in the background, so alignment and the overlays can look 
+   stars up without working out where each one is.
+
+   At a latitude a star is above an elevation for a fixed span of 
+   local sidereal time either side of its RA, or always, or never. 
+   satapi_stars_process() works those spans out once, a few stars per
+   call, keeping the stars that can rise as candidates, and puts their
+   rises and sets into one list in sidereal time order. After that 
+   each round takes a new observer frame from the GPS and steps 
+   through the rises and sets since the last round, adding and 
+   removing stars from the list, so only stars crossing the horizon
+   are looked at. The azimuth and elevation of the stars in the list
+   are then brought up to date round-robin until the CPU budget for 
+   the call is spent, as satapi_sky.c does for satellites. 
+
+   Sidereal times are kept in steps of 1/65536 of a turn, 1.3 seconds,
+   so a star within about 0.005 degrees of the elevation may be added
+   or removed a step early or late. Coordinates are the catalog's 
+   J2000 ones, as radec2altaz() takes them. */
+
+#include "sowb.h"
+#include "user.h"
+#include "rit.h"
+#include "gps.h"
+#include "satapi.h"
+#include "star.h"
+
+/* Most candidates, and so most stars in the list. */
+#define STARS_MAX           SAT_STARS_MAX
+
+/* The candidates are found again when the site's latitude moves by
+   more than this many degrees. */
+#define STARS_LATITUDE_TOL  0.1
+
+/* A jump in sidereal time of more than this many steps, such as the
+   GPS time being set, puts the list together again from scratch 
+   rather than stepping through the rises and sets. */
+#define STARS_MAX_STEP      4096
+
+#define STARS_NONE          0xFFFF
+
+/* Where satapi_stars_process() is up to. */
+#define STARS_IDLE          0   /* Not started. */
+#define STARS_CLASSIFY      1   /* Finding the candidates. */
+#define STARS_READY         2   /* Keeping the list. */
+
+/* A star that can rise. rise == set if it never sets. */
+typedef struct _stars_cand {
+    uint16_t    star;           /* Catalog index. */
+    uint16_t    rise;           /* Local sidereal time, steps. */
+    uint16_t    set;
+    uint16_t    slot;           /* Its place in stars_list, STARS_NONE if not up. */
+    float       sin_dec, cos_dec;
+} STARS_CAND;
+
+/* The candidates, their rises and sets and the list are kept in the 
+   USB RAM bank, which is not cleared at reset. Each is filled in 
+   before it is read, up to stars_cands, stars_events and stars_count. */
+static STARS_CAND   stars_cand[STARS_MAX] __attribute__((section("AHBSRAM0")));
+static uint16_t     stars_event[STARS_MAX * 2] __attribute__((section("AHBSRAM0")));  /* Candidate << 1, | 1 for a set, in time order. */
+static SAT_STAR     stars_list[STARS_MAX] __attribute__((section("AHBSRAM0")));
+static int          stars_cands;
+static int          stars_faintest;         /* The candidate with the faintest star, once full. */
+static int          stars_dropped;          /* Stars that can rise left out for lack of room. */
+static int          stars_events;
+static int          stars_cursor;           /* The next event. */
+static uint16_t     stars_lst;              /* Sidereal time of the last round. */
+static int          stars_count;
+static int          stars_next;             /* Next in stars_list to bring up to date. */
+static int          stars_scan;             /* Next catalog index to classify. */
+static int          stars_scan_end;
+static int          stars_state;
+static double       stars_min_el, stars_max_mag, stars_latitude;
+static double       stars_jd;               /* Of the last whole round. */
+static bool         stars_block_process;
+static obs_frame_t  stars_frame;
+
+/** stars_steps
+ *
+ * @param double An angle, radians.
+ * @return uint16_t It in steps of 1/65536 of a turn.
+ */
+static uint16_t stars_steps(double a) {
+    return (uint16_t)((int32_t)floor(a * (65536. / twopi)) & 0xFFFF);
+}
+
+/** stars_up
+ *
+ * @return int Non-zero if a candidate is up at a sidereal time.
+ */
+static int stars_up(STARS_CAND *c, uint16_t lst) {
+    return c->rise == c->set || (uint16_t)(lst - c->rise) < (uint16_t)(c->set - c->rise);
+}
+
+/** stars_event_lst
+ *
+ * @return uint16_t The sidereal time of an event.
+ */
+static uint16_t stars_event_lst(uint16_t e) {
+    return e & 1 ? stars_cand[e >> 1].set : stars_cand[e >> 1].rise;
+}
+
+/** stars_update
+ *
+ * Work out where a star of the list is in the round's frame.
+ *
+ * @param int Its place in stars_list.
+ */
+static void stars_update(int i) {
+    SAT_STAR *s = &stars_list[i];
+    STARS_CAND *c = &stars_cand[s->cand];
+    sgp4_real_t ha, sin_ha, cos_ha, sin_dec, cos_dec;
+    
+    ha = (sgp4_real_t)stars_frame.geodetic.theta - (sgp4_real_t)(STAR_RA(&star_packed[c->star]) * de2ra);
+    SGP4_SINCOS(ha, &sin_ha, &cos_ha);
+    sin_dec = c->sin_dec; cos_dec = c->cos_dec;
+    
+    s->elevation = SGP4_ASIN(stars_frame.sin_lat * sin_dec + stars_frame.cos_lat * cos_dec * cos_ha) * SGP4_REAL(180.0 / M_PI);
+    s->azimuth = SGP4_ATAN2(- sin_ha * cos_dec, stars_frame.cos_lat * sin_dec - stars_frame.sin_lat * cos_dec * cos_ha) * SGP4_REAL(180.0 / M_PI);
+    if (s->azimuth < 0) s->azimuth += 360.;
+}
+
+/** stars_add
+ *
+ * Put a candidate in the list.
+ */
+static void stars_add(int cand) {
+    STARS_CAND *c = &stars_cand[cand];
+    
+    if (c->slot != STARS_NONE) return;
+    c->slot = stars_count;
+    stars_list[stars_count].star = c->star;
+    stars_list[stars_count].cand = cand;
+    stars_update(stars_count++);
+}
+
+/** stars_remove
+ *
+ * Take a candidate out of the list, moving the last star of the list
+ * into its place. If that is a place this round has already been 
+ * past, the moved star is brought up to date there and then.
+ */
+static void stars_remove(int cand) {
+    STARS_CAND *c = &stars_cand[cand];
+    int slot = c->slot;
+    
+    if (slot == STARS_NONE) return;
+    c->slot = STARS_NONE;
+    if (slot != --stars_count) {
+        stars_list[slot] = stars_list[stars_count];
+        stars_cand[stars_list[slot].cand].slot = slot;
+        if (slot < stars_next) stars_update(slot);
+    }
+    if (stars_next > stars_count) stars_next = stars_count;
+}
+
+/** stars_faint
+ *
+ * @return int The candidate with the faintest star.
+ */
+static int stars_faint(void) {
+    int i, f = 0;
+    
+    for (i = 1; i < stars_cands; i++) {
+        if (star_packed[stars_cand[i].star].mag > star_packed[stars_cand[f].star].mag) f = i;
+    }
+    return f;
+}
+
+/** stars_classify
+ *
+ * Work out the span a catalog star is up for and, if it can rise,
+ * make it a candidate. Once there are STARS_MAX candidates a star 
+ * takes the place of the faintest if it is brighter.
+ *
+ * @param int The catalog index.
+ */
+static void stars_classify(int star) {
+    const packedStarData *p = &star_packed[star];
+    STARS_CAND *c;
+    double dec, sin_dec, cos_dec, d, h;
+    int32_t half;
+    
+    if (STAR_MAG(p) > stars_max_mag) return;
+    
+    dec = STAR_DEC(p) * de2ra;
+    sin_dec = sin(dec); cos_dec = cos(dec);
+    d = stars_frame.cos_lat * cos_dec;
+    
+    /* cos(hour angle) at the elevation, beyond +-1 if it never gets
+       there. A star at the pole is always or never up. */
+    h = sin(stars_min_el * de2ra) - stars_frame.sin_lat * sin_dec;
+    if (fabs(d) < 1E-9) h = h < 0. ? -2. : 2.;
+    else h /= d;
+    if (h >= 1.) return;
+    
+    half = h <= -1. ? 32768 : (int32_t)floor(acos(h) * (65536. / twopi) + 0.5);
+    if (half == 0) return;
+    
+    if (stars_cands == STARS_MAX) {
+        stars_dropped++;
+        if (p->mag >= star_packed[stars_cand[stars_faintest].star].mag) return;
+        c = &stars_cand[stars_faintest];
+    }
+    else c = &stars_cand[stars_cands++];
+    c->star = star;
+    c->slot = STARS_NONE;
+    c->sin_dec = sin_dec;
+    c->cos_dec = cos_dec;
+    c->rise = stars_steps(STAR_RA(p) * de2ra) - half;
+    c->set  = half == 32768 ? c->rise : c->rise + 2 * half;
+    if (stars_cands == STARS_MAX) stars_faintest = stars_faint();
+}
+
+/** stars_build
+ *
+ * Sort the rises and sets of the candidates, a shell sort as there 
+ * is no qsort() on the board, and put the list together for the 
+ * sidereal time of the frame.
+ */
+static void stars_build(void) {
+    static const int gaps[] = { 132, 57, 23, 10, 4, 1 };
+    uint16_t e, lst;
+    int g, i, j, gap;
+    
+    stars_events = 0;
+    for (i = 0; i < stars_cands; i++) {
+        if (stars_cand[i].rise == stars_cand[i].set) continue;
+        stars_event[stars_events++] = i << 1;
+        stars_event[stars_events++] = (i << 1) | 1;
+    }
+    for (g = 0; g < (int)(sizeof(gaps) / sizeof(gaps[0])); g++) {
+        gap = gaps[g];
+        for (i = gap; i < stars_events; i++) {
+            e = stars_event[i];
+            lst = stars_event_lst(e);
+            for (j = i; j >= gap && stars_event_lst(stars_event[j - gap]) > lst; j -= gap) {
+                stars_event[j] = stars_event[j - gap];
+            }
+            stars_event[j] = e;
+        }
+    }
+    
+    stars_count = 0;
+    stars_next = 0;
+    stars_lst = stars_steps(stars_frame.geodetic.theta);
+    for (i = 0; i < stars_cands; i++) {
+        stars_cand[i].slot = STARS_NONE;
+        if (stars_up(&stars_cand[i], stars_lst)) stars_add(i);
+    }
+    for (stars_cursor = 0; stars_cursor < stars_events && stars_event_lst(stars_event[stars_cursor]) <= stars_lst; stars_cursor++) ;
+    if (stars_cursor == stars_events) stars_cursor = 0;
+}
+
+/** stars_advance
+ *
+ * Step through the rises and sets from the last round's sidereal 
+ * time up to the frame's.
+ */
+static void stars_advance(void) {
+    uint16_t lst, e, span;
+    int n;
+    
+    lst = stars_steps(stars_frame.geodetic.theta);
+    span = lst - stars_lst;
+    if (span > STARS_MAX_STEP) {
+        stars_build();
+        return;
+    }
+    
+    for (n = 0; n < stars_events; n++) {
+        e = stars_event[stars_cursor];
+        if ((uint16_t)(stars_event_lst(e) - stars_lst) > span || stars_event_lst(e) == stars_lst) break;
+        if (e & 1) stars_remove(e >> 1);
+        else stars_add(e >> 1);
+        if (++stars_cursor == stars_events) stars_cursor = 0;
+    }
+    stars_lst = lst;
+}
+
+/** satapi_stars_start
+ *
+ * Start keeping the list of stars above an elevation and at most a
+ * magnitude. The list is empty until satapi_stars_process() has 
+ * found the candidates, which takes a few seconds. If more than 
+ * SAT_STARS_MAX stars can rise, the faintest are left out, see 
+ * satapi_stars_dropped().
+ *
+ * @param double min_el Degrees.
+ * @param double max_mag
+ * @return int 0 on success, -1 if min_el is not between -90 and 90.
+ */
+int satapi_stars_start(double min_el, double max_mag) {
+    int t;
+    
+    if (min_el <= -90. || min_el >= 90.) return -1;
+    
+    stars_block_process = true;
+    stars_min_el = min_el;
+    stars_max_mag = max_mag;
+    
+    /* The catalog is brightest tier first, so the scan can stop at 
+       the first tier too faint. */
+    for (t = 1; t < STAR_TIERS && STAR_TIER_MAG(t) <= max_mag; t++) ;
+    stars_scan_end = star_zone_start[t * STAR_ZONES];
+    
+    stars_cands = stars_events = stars_count = stars_next = 0;
+    stars_dropped = 0;
+    stars_jd = 0.;
+    stars_state = STARS_CLASSIFY;
+    stars_scan = -1;
+    stars_block_process = false;
+    return 0;
+}
+
+/** satapi_stars_stop
+ *
+ * Stop keeping the list and empty it.
+ */
+void satapi_stars_stop(void) {
+    stars_state = STARS_IDLE;
+    stars_count = 0;
+}
+
+/** satapi_stars_process
+ *
+ * Find the candidates or keep the list until SAT_PROCESS_BUDGET_MS has 
+ * passed or the round is done. Nothing is done until the GPS has a
+ * valid time and place.
+ */
+void satapi_stars_process(void) {
+    GPS_TIME t;
+    GPS_LOCATION_AVERAGE l;
+    uint32_t h, start, now;
+    double latitude;
+    
+    if (stars_block_process || stars_state == STARS_IDLE) return;
+    stars_block_process = true;
+    
+    rit_read_uptime(&h, &start);
+    do {
+        if (stars_scan < 0 || (stars_state == STARS_READY && stars_next == 0)) {
+            gps_get_time(&t);
+            gps_get_location_average(&l);
+            if (!t.is_valid || !l.is_valid || l.is_valid == '0') break;
+            satapi_observer_frame(&l, gps_julian_date(&t), &stars_frame);
+            latitude = Degrees(stars_frame.geodetic.lat);
+            
+            if (stars_scan < 0 || (stars_state == STARS_READY && fabs(latitude - stars_latitude) > STARS_LATITUDE_TOL)) {
+                stars_latitude = latitude;
+                stars_cands = stars_events = stars_count = stars_next = 0;
+                stars_dropped = 0;
+                stars_scan = 0;
+                stars_state = STARS_CLASSIFY;
+            }
+            else if (stars_state == STARS_READY) {
+                stars_advance();
+            }
+        }
+        
+        if (stars_state == STARS_CLASSIFY) {
+            if (stars_scan < stars_scan_end) stars_classify(stars_scan++);
+            if (stars_scan >= stars_scan_end) {
+                stars_build();
+                stars_state = STARS_READY;
+            }
+        }
+        else if (stars_next < stars_count) {
+            stars_update(stars_next++);
+        }
+        
+        if (stars_state == STARS_READY && stars_next >= stars_count) {
+            stars_next = 0;
+            stars_jd = stars_frame.jd;
+            break;
+        }
+        rit_read_uptime(&h, &now);
+    }
+    while (now - start < SAT_PROCESS_BUDGET_MS);
+    
+    stars_block_process = false;
+}
+
+/** satapi_stars_count
+ *
+ * @return int The number of stars in the list.
+ */
+int satapi_stars_count(void) {
+    return stars_count;
+}
+
+/** satapi_stars_dropped
+ *
+ * @return int The number of stars that can rise left out of the 
+ *             candidates because there were more than SAT_STARS_MAX.
+ */
+int satapi_stars_dropped(void) {
+    return stars_dropped;
+}
+
+/** satapi_stars_get
+ *
+ * Get a star of the list. The list is in no particular order and 
+ * changes as stars rise and set, so a star's place in it is only 
+ * good until the next satapi_stars_process().
+ *
+ * @param int Its place, 0 up to satapi_stars_count().
+ * @return SAT_STAR * The star, NULL if i is out of range.
+ */
+SAT_STAR * satapi_stars_get(int i) {
+    if (i < 0 || i >= stars_count) return (SAT_STAR *)NULL;
+    return &stars_list[i];
+}
+
+/** satapi_stars_jd
+ *
+ * @return double The Julian date the whole list was last brought up
+ * to date for, 0 if it has not been yet.
+ */
+double satapi_stars_jd(void) {
+    return stars_jd;
+}
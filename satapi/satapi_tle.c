@@ -0,0 +1,167 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* The TLE file in flash, as sent by the host (see pccomms mode1). 
+   satapi_tle_scan() reads it through, handing each TLE it finds to
+   a function along with where it starts in the file, so that those
+   that cannot all be held in RAM can be read back one at a time with
+   satapi_tle_read(). */
+
+#include "sowb.h"
+#include "user.h"
+#include "flash.h"
+#include "satapi.h"
+
+/* Most pages of TLE file read. */
+#define TLE_FILE_PAGES      512
+
+/** tle_line
+ *
+ * @return int Non-zero if the line looks like TLE line 1 or 2.
+ */
+static int tle_line(char *line, char n) {
+    return line[0] == n && line[1] == ' ' && strlen(line) >= 69;
+}
+
+/** tle_elements
+ *
+ * Fill in elements from the last three lines read, if the last two 
+ * are TLE lines 1 and 2. A TLE may have a name line or not, those
+ * without are named after their catalog number.
+ *
+ * @param char[3][80] The lines, oldest first.
+ * @param char[3][80] The elements to fill.
+ * @return int 1 if there was a name line, 0 if not, -3 if the lines are not a TLE.
+ */
+static int tle_elements(char lines[3][80], char elements[3][80]) {
+    int named;
+    
+    if (!tle_line(lines[2], '2') || !tle_line(lines[1], '1')) return -3;
+    
+    named = !(lines[0][0] == 0 || tle_line(lines[0], '1') || tle_line(lines[0], '2'));
+    if (named) {
+        strncpy(elements[0], lines[0], 24);
+        elements[0][24] = 0;
+    }
+    else {
+        memcpy(elements[0], &lines[1][2], 5);
+        elements[0][5] = 0;
+    }
+    strcpy(elements[1], lines[1]);
+    strcpy(elements[2], lines[2]);
+    return named;
+}
+
+/** satapi_tle_scan
+ *
+ * Read the TLE file a page at a time until the first erased (0xFF)
+ * or NUL character, calling found() with each TLE and the offset in
+ * the file of its first line, the name line if it has one. 
+ *
+ * @param SAT_TLE_FOUND * Called for each TLE, returns non-zero to stop.
+ * @return int The number of TLEs found.
+ */
+int satapi_tle_scan(SAT_TLE_FOUND *found) {
+    char buffer[FLASH_PAGE_SIZE], lines[3][80], elements[3][80];
+    uint32_t start[3];
+    int page, i, named, len = 0, done = 0, count = 0;
+    
+    memset(lines, 0, sizeof(lines));
+    memset(start, 0, sizeof(start));
+    
+    for (page = 0; page < TLE_FILE_PAGES && !done; page++) {
+        KICK_WATCHDOG;
+        flash_read_page(FLASH_BASE_TLE_FILE + page, buffer, true);
+        for (i = 0; i < FLASH_PAGE_SIZE && !done; i++) {
+            if (buffer[i] == (char)0xFF || buffer[i] == 0) done = 1;
+            if (buffer[i] == '\r') continue;
+            if (buffer[i] != '\n' && !done) {
+                if (len == 0) start[2] = page * FLASH_PAGE_SIZE + i;
+                if (len < 79) lines[2][len++] = buffer[i];
+                continue;
+            }
+            
+            /* A whole line, the last three are kept in lines[]. */
+            lines[2][len] = 0;
+            len = 0;
+            if ((named = tle_elements(lines, elements)) >= 0) {
+                count++;
+                if (found(elements, named ? start[0] : start[1]) != 0) done = 1;
+                lines[2][0] = 0;
+            }
+            memcpy(lines[0], lines[1], 80);
+            memcpy(lines[1], lines[2], 80);
+            memset(lines[2], 0, 80);
+            start[0] = start[1];
+            start[1] = start[2];
+        }
+    }
+    
+    return count;
+}
+
+/** satapi_tle_read
+ *
+ * Read back a TLE found by satapi_tle_scan().
+ *
+ * @param uint32_t The offset satapi_tle_scan() gave.
+ * @param char[3][80] The elements to fill.
+ * @return int 0 on success, -3 if there is no TLE there.
+ */
+int satapi_tle_read(uint32_t offset, char elements[3][80]) {
+    char buffer[FLASH_PAGE_SIZE], lines[3][80], c;
+    int page, i, n = 1, len = 0;
+    
+    memset(lines, 0, sizeof(lines));
+    page = offset / FLASH_PAGE_SIZE;
+    i = offset % FLASH_PAGE_SIZE;
+    if (page >= TLE_FILE_PAGES) return -3;
+    flash_read_page(FLASH_BASE_TLE_FILE + page, buffer, true);
+    
+    /* Lines go in from lines[1], as a TLE without a name line has 
+       only two; one with a name line is moved up after. */
+    while (n < 3) {
+        if (i == FLASH_PAGE_SIZE) {
+            if (++page == TLE_FILE_PAGES) break;
+            flash_read_page(FLASH_BASE_TLE_FILE + page, buffer, true);
+            i = 0;
+        }
+        c = buffer[i++];
+        if (c == '\r') continue;
+        if (c != '\n' && c != (char)0xFF && c != 0) {
+            if (len < 79) lines[n][len++] = c;
+            continue;
+        }
+        lines[n][len] = 0;
+        len = 0;
+        if (n == 2 && !tle_line(lines[1], '1')) {
+            memcpy(lines[0], lines[1], 80);
+            memcpy(lines[1], lines[2], 80);
+            memset(lines[2], 0, 80);
+            continue;
+        }
+        n++;
+        if (c != '\n') break;
+    }
+    
+    return tle_elements(lines, elements) >= 0 ? 0 : -3;
+}
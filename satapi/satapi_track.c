@@ -0,0 +1,327 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* Look-ahead track of one satellite for a tracking loop. Working out
+   where a satellite is takes too long for a timer callback, so 
+   satapi_track_process() works a few seconds ahead and puts a sample
+   every TRACK_STEP_MS into a ring, and the RIT callback only reads 
+   the ring and interpolates between the two samples either side of
+   the time. 
+
+   The ring has one writer, satapi_track_process(), which moves 
+   track_head, and one reader, satapi_track_read(), which moves 
+   track_tail, so neither needs to lock out the other. A sample is
+   written before track_head is moved on past it; both are volatile,
+   so the compiler keeps the stores in that order.
+
+   The rates of a sample are taken from the samples either side of
+   it, so a sample goes in the ring once the one after it has been
+   worked out. */
+
+#include "sowb.h"
+#include "user.h"
+#include "rit.h"
+#include "gps.h"
+#include "satapi.h"
+
+/* Samples in the ring, a power of two, and milliseconds between 
+   them; the ring holds 6.2 seconds ahead. */
+#define TRACK_SIZE          32
+#define TRACK_STEP_MS       200
+
+/* Milliseconds between calls of the RIT callback. */
+#define TRACK_TICK_MS       10
+
+static volatile SAT_TRACK_SAMPLE track_ring[TRACK_SIZE];
+static volatile uint32_t track_head;        /* Samples written, moved by the producer. */
+static volatile uint32_t track_tail;        /* Samples done with, moved by the reader. */
+static volatile bool     track_running;
+static volatile SAT_TRACK_COUNTERS track_counters;
+
+/* The last sample the RIT callback read, double buffered. */
+static volatile SAT_TRACK_SAMPLE track_command[2];
+static volatile int      track_command_index = -1;
+
+/* The satellite is kept in the USB RAM bank, which is not cleared
+   at reset; satapi_track_start() loads it before it is used. */
+static SAT_HANDLE   track_sat __attribute__((section("AHBSRAM0")));
+static GPS_LOCATION_AVERAGE track_location;
+static double       track_jd0;              /* The time when track_ms0 was read. */
+static uint32_t     track_ms0;
+static uint32_t     track_next;             /* Uptime of the next sample to work out. */
+static float        track_azimuth[2];       /* The two samples worked out but not yet in the ring. */
+static float        track_elevation[2];
+static int          track_pending;
+static bool         track_block_process;
+
+/** track_angle
+ *
+ * @return float An azimuth difference brought into -180 to 180.
+ */
+static float track_angle(float d) {
+    if (d > 180.f) d -= 360.f;
+    if (d < -180.f) d += 360.f;
+    return d;
+}
+
+/** satapi_track_start
+ *
+ * Start tracking a satellite, replacing any tracked before. The 
+ * ring starts to fill on the next satapi_track_process() call and
+ * the RIT callback starts reading it.
+ *
+ * @param char[3][80] The TLE.
+ * @return int 0 on success, -1 no time, -2 no location, -3 bad TLE.
+ */
+int satapi_track_start(char elements[3][80]) {
+    GPS_TIME t;
+    uint32_t h, ms, grid;
+    
+    satapi_track_stop();
+    
+    rit_read_uptime(&h, &track_ms0);
+    gps_get_time(&t);
+    gps_get_location_average(&track_location);
+    if (!t.is_valid) return -1;
+    if (!track_location.is_valid || track_location.is_valid == '0') return -2;
+    if (satapi_load(&track_sat, elements) != 0) return -3;
+    track_jd0 = gps_julian_date(&t);
+    
+    /* Samples are on whole TRACK_STEP_MS of the day. The first is a
+       step before the one at or before now, for the rates of that. */
+    ms = ((t.hour * 60 + t.minute) * 60 + t.second) * 1000 + t.tenth * 100 + t.hundreth * 10;
+    grid = ms % TRACK_STEP_MS;
+    track_next = track_ms0 - grid - TRACK_STEP_MS;
+    
+    track_head = track_tail = 0;
+    track_pending = 0;
+    memset((void *)&track_counters, 0, sizeof(SAT_TRACK_COUNTERS));
+    track_counters.least_ahead = TRACK_SIZE * TRACK_STEP_MS;
+    track_command_index = -1;
+    track_running = true;
+    
+    rit_timer_set_reload(SATAPI_TRACK_CB, TRACK_TICK_MS);
+    rit_timer_set_counter(SATAPI_TRACK_CB, TRACK_TICK_MS);
+    return 0;
+}
+
+/** satapi_track_stop
+ *
+ * Stop tracking and the RIT callback.
+ */
+void satapi_track_stop(void) {
+    track_running = false;
+    rit_timer_set_reload(SATAPI_TRACK_CB, 0);
+    rit_timer_set_counter(SATAPI_TRACK_CB, 0);
+}
+
+/** track_azel
+ *
+ * The azimuth and elevation of the tracked satellite, degrees.
+ *
+ * @param double The Julian date.
+ * @return int 0 on success, -5 if it could not be propagated.
+ */
+static int track_azel(double jd, float *azimuth, float *elevation) {
+    obs_frame_t frame;
+    vector_t pos, vel, obs_set;
+    double phase;
+    
+    satapi_observer_frame(&track_location, jd, &frame);
+    sgp4_propagate(&track_sat.ctx, (frame.jd - track_sat.jd_epoch) * xmnpda, &pos, &vel, &phase);
+    Convert_Sat_State(&pos, &vel);
+    Calculate_Obs_Frame(&frame, &pos, &vel, &obs_set);
+    if (!isfinite(obs_set.x) || !isfinite(obs_set.y)) return -5;
+    *azimuth   = Degrees(obs_set.x);
+    *elevation = Degrees(obs_set.y);
+    return 0;
+}
+
+/** track_sample
+ *
+ * Work out the sample at track_next and put the one before it in 
+ * the ring, now that its rates can be found.
+ */
+static void track_sample(void) {
+    volatile SAT_TRACK_SAMPLE *s;
+    float azimuth, elevation, h;
+    
+    if (track_azel(track_jd0 + (int32_t)(track_next - track_ms0) / 86400000., &azimuth, &elevation) != 0) return;
+    
+    if (track_pending == 2) {
+        h = 2.f * TRACK_STEP_MS / 1000.f;
+        s = &track_ring[track_head & (TRACK_SIZE - 1)];
+        s->ms             = track_next - TRACK_STEP_MS;
+        s->azimuth        = track_azimuth[1];
+        s->elevation      = track_elevation[1];
+        s->azimuth_rate   = track_angle(azimuth - track_azimuth[0]) / h;
+        s->elevation_rate = (elevation - track_elevation[0]) / h;
+        track_head++;
+        track_pending = 1;
+        track_azimuth[0]   = track_azimuth[1];
+        track_elevation[0] = track_elevation[1];
+    }
+    track_azimuth[track_pending]   = azimuth;
+    track_elevation[track_pending] = elevation;
+    track_pending++;
+}
+
+/** satapi_track_process
+ *
+ * Fill the ring until it is full or SAT_PROCESS_BUDGET_MS has 
+ * passed. If it has fallen so far behind that the samples worked out
+ * next could not cover now, it starts again from now as 
+ * satapi_track_start() does.
+ */
+void satapi_track_process(void) {
+    uint32_t h, start, now, skip;
+    
+    if (!track_running || track_block_process) return;
+    track_block_process = true;
+    
+    rit_read_uptime(&h, &start);
+    if ((int32_t)(start - track_next) > TRACK_STEP_MS) {
+        skip = (start - track_next) / TRACK_STEP_MS - 1;
+        track_counters.skipped += skip;
+        track_next += skip * TRACK_STEP_MS;
+        track_pending = 0;
+    }
+    
+    do {
+        if (track_head - track_tail >= TRACK_SIZE) break;
+        track_sample();
+        track_next += TRACK_STEP_MS;
+        rit_read_uptime(&h, &now);
+    }
+    while (now - start < SAT_PROCESS_BUDGET_MS);
+    
+    track_block_process = false;
+}
+
+/** satapi_track_read
+ *
+ * Interpolate the track at a time between the samples either side 
+ * of it, as a cubic with their rates. Samples before it are done 
+ * with and given back to the producer. Fast enough for a timer 
+ * callback; it must be the only reader of the ring.
+ *
+ * @param uint32_t The RIT uptime, milliseconds.
+ * @param SAT_TRACK_SAMPLE * Filled with the track then.
+ * @return int 0 on success, -1 if there are no samples for the time.
+ */
+int satapi_track_read(uint32_t ms, SAT_TRACK_SAMPLE *out) {
+    volatile SAT_TRACK_SAMPLE *a, *b;
+    uint32_t head = track_head, tail = track_tail;
+    float h, s, s2, s3, d, azimuth;
+    int32_t ahead;
+    
+    track_counters.reads++;
+    while (head - tail >= 2 && (int32_t)(ms - track_ring[(tail + 1) & (TRACK_SIZE - 1)].ms) >= 0) tail++;
+    track_tail = tail;
+    if (head - tail < 2 || (int32_t)(ms - track_ring[tail & (TRACK_SIZE - 1)].ms) < 0) {
+        track_counters.underruns++;
+        return -1;
+    }
+    
+    ahead = track_ring[(head - 1) & (TRACK_SIZE - 1)].ms - ms;
+    if (ahead < track_counters.least_ahead) track_counters.least_ahead = ahead;
+    
+    a = &track_ring[tail & (TRACK_SIZE - 1)];
+    b = &track_ring[(tail + 1) & (TRACK_SIZE - 1)];
+    h  = (b->ms - a->ms) / 1000.f;
+    s  = (ms - a->ms) / 1000.f / h;
+    s2 = s * s;
+    s3 = s2 * s;
+    
+    /* Cubic Hermite, from the values and rates at each end. */
+    d = track_angle(b->azimuth - a->azimuth);
+    azimuth = a->azimuth + (3.f * s2 - 2.f * s3) * d + 
+        (s3 - 2.f * s2 + s) * h * a->azimuth_rate + (s3 - s2) * h * b->azimuth_rate;
+    if (azimuth < 0.f) azimuth += 360.f;
+    if (azimuth >= 360.f) azimuth -= 360.f;
+    out->azimuth = azimuth;
+    out->azimuth_rate = (6.f * (s - s2) * d) / h + 
+        (3.f * s2 - 4.f * s + 1.f) * a->azimuth_rate + (3.f * s2 - 2.f * s) * b->azimuth_rate;
+    
+    d = b->elevation - a->elevation;
+    out->elevation = a->elevation + (3.f * s2 - 2.f * s3) * d + 
+        (s3 - 2.f * s2 + s) * h * a->elevation_rate + (s3 - s2) * h * b->elevation_rate;
+    out->elevation_rate = (6.f * (s - s2) * d) / h + 
+        (3.f * s2 - 4.f * s + 1.f) * a->elevation_rate + (3.f * s2 - 2.f * s) * b->elevation_rate;
+    out->ms = ms;
+    return 0;
+}
+
+/** _satapi_track_timer_cb
+ *
+ * RIT callback, every TRACK_TICK_MS while tracking. Reads the track
+ * for now into the half of track_command[] not being read.
+ */
+void _satapi_track_timer_cb(int index) {
+    SAT_TRACK_SAMPLE s;
+    uint32_t h, ms;
+    int i;
+    
+    if (!track_running) return;
+    rit_read_uptime(&h, &ms);
+    if (satapi_track_read(ms, &s) != 0) return;
+    i = track_command_index == 0 ? 1 : 0;
+    track_command[i].ms             = s.ms;
+    track_command[i].azimuth        = s.azimuth;
+    track_command[i].elevation      = s.elevation;
+    track_command[i].azimuth_rate   = s.azimuth_rate;
+    track_command[i].elevation_rate = s.elevation_rate;
+    track_command_index = i;
+}
+
+/** satapi_track_command
+ *
+ * Get the track as the RIT callback last read it, for the NexStar 
+ * rates. The callback writes the other half of track_command[], so
+ * this copy is whole unless it takes longer than TRACK_TICK_MS.
+ *
+ * @param SAT_TRACK_SAMPLE * Filled with the track.
+ * @return int 0 on success, -1 if there is none.
+ */
+int satapi_track_command(SAT_TRACK_SAMPLE *out) {
+    int i = track_command_index;
+    
+    if (i < 0 || !track_running) return -1;
+    out->ms             = track_command[i].ms;
+    out->azimuth        = track_command[i].azimuth;
+    out->elevation      = track_command[i].elevation;
+    out->azimuth_rate   = track_command[i].azimuth_rate;
+    out->elevation_rate = track_command[i].elevation_rate;
+    return 0;
+}
+
+/** satapi_track_counters
+ *
+ * @param SAT_TRACK_COUNTERS * Filled with the counters since 
+ *        satapi_track_start().
+ */
+void satapi_track_counters(SAT_TRACK_COUNTERS *c) {
+    c->reads       = track_counters.reads;
+    c->underruns   = track_counters.underruns;
+    c->skipped     = track_counters.skipped;
+    c->least_ahead = track_counters.least_ahead;
+}
@@ -0,0 +1,151 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+ 
+/* RA/Dec to and from the horizon as a rotation. A direction on the 
+   sky is a unit vector, x to the equinox, z to the pole; the rows of
+   the rotation give its south, east and zenith parts for one place 
+   and local sidereal time. A SAT_TRANSFORM is built once for an 
+   instant and then each point costs the sine and cosine of its own
+   two angles, nine multiplies and two atan2(). 
+
+   Both ways round, every angle is got back with atan2() from two
+   parts of the vector, never with asin() or acos() of one part, so
+   the hour angle is good on the meridian and the elevation and 
+   declination are good near the zenith and the pole, where the slope
+   of asin() and acos() runs away. */
+
+#include "sowb.h"
+#include "satapi.h"
+
+#ifndef M_PI
+#define M_PI 3.1415926535898
+#endif
+
+/** satapi_transform_frame
+ *
+ * Build the transform for the place and time of an observer frame.
+ * The frame's own rotation to the horizon is the one wanted.
+ *
+ * @param obs_frame_t * The frame from satapi_observer_frame().
+ * @param SAT_TRANSFORM * The transform to fill.
+ * @return SAT_TRANSFORM * The transform.
+ */
+SAT_TRANSFORM * satapi_transform_frame(obs_frame_t *frame, SAT_TRANSFORM *t) {
+    memcpy(t->m, frame->topo, sizeof(t->m));
+    return t;
+}
+
+/** satapi_transform_site
+ *
+ * Build the transform from a local sidereal time and a location, as
+ * radec2altaz() and altaz2radec() take them. Only the latitude of the
+ * location is used.
+ *
+ * @param double The local sidereal time in degrees.
+ * @param GPS_LOCATION_AVERAGE * The observer's location.
+ * @param SAT_TRANSFORM * The transform to fill.
+ * @return SAT_TRANSFORM * The transform.
+ */
+SAT_TRANSFORM * satapi_transform_site(double siderealDegrees, GPS_LOCATION_AVERAGE *location, SAT_TRANSFORM *t) {
+    sgp4_real_t lat, sin_lat, cos_lat, sin_theta, cos_theta;
+    
+    lat = (sgp4_real_t)location->latitude * SGP4_REAL(M_PI / 180.0);
+    if (location->north_south == 'S') lat = -lat;
+    SGP4_SINCOS(lat, &sin_lat, &cos_lat);
+    SGP4_SINCOS((sgp4_real_t)siderealDegrees * SGP4_REAL(M_PI / 180.0), &sin_theta, &cos_theta);
+    
+    t->m[0][0] =  sin_lat * cos_theta;      /* South */
+    t->m[0][1] =  sin_lat * sin_theta;
+    t->m[0][2] = -cos_lat;
+    t->m[1][0] = -sin_theta;                /* East */
+    t->m[1][1] =  cos_theta;
+    t->m[1][2] =  SGP4_REAL(0.0);
+    t->m[2][0] =  cos_lat * cos_theta;      /* Zenith */
+    t->m[2][1] =  cos_lat * sin_theta;
+    t->m[2][2] =  sin_lat;
+    return t;
+}
+
+/** radec2altaz_batch
+ *
+ * Convert RA/Dec to Alt/Az for the place and time of a transform.
+ *
+ * @param SAT_TRANSFORM * The transform.
+ * @param RaDec * The positions to convert.
+ * @param AltAz * Filled with the results.
+ * @param int n The number of positions.
+ * @return int n.
+ */
+int radec2altaz_batch(SAT_TRANSFORM *t, RaDec *radec, AltAz *altaz, int n) {
+    sgp4_real_t sin_ra, cos_ra, sin_dec, cos_dec, x, y, z, s, e, u;
+    int i;
+    
+    for (i = 0; i < n; i++) {
+        SGP4_SINCOS((sgp4_real_t)radec[i].ra  * SGP4_REAL(M_PI / 180.0), &sin_ra,  &cos_ra);
+        SGP4_SINCOS((sgp4_real_t)radec[i].dec * SGP4_REAL(M_PI / 180.0), &sin_dec, &cos_dec);
+        x = cos_dec * cos_ra;
+        y = cos_dec * sin_ra;
+        z = sin_dec;
+        
+        s = t->m[0][0] * x + t->m[0][1] * y + t->m[0][2] * z;
+        e = t->m[1][0] * x + t->m[1][1] * y;
+        u = t->m[2][0] * x + t->m[2][1] * y + t->m[2][2] * z;
+        
+        altaz[i].alt = SGP4_ATAN2(u, SGP4_SQRT(s * s + e * e)) * SGP4_REAL(180.0 / M_PI);
+        altaz[i].azm = SGP4_ATAN2(e, -s) * SGP4_REAL(180.0 / M_PI);
+        if (altaz[i].azm < 0) altaz[i].azm += 360.0;
+    }
+    return n;
+}
+
+/** altaz2radec_batch
+ *
+ * Convert Alt/Az to RA/Dec for the place and time of a transform,
+ * with the transposed rotation.
+ *
+ * @param SAT_TRANSFORM * The transform.
+ * @param AltAz * The positions to convert.
+ * @param RaDec * Filled with the results.
+ * @param int n The number of positions.
+ * @return int n.
+ */
+int altaz2radec_batch(SAT_TRANSFORM *t, AltAz *altaz, RaDec *radec, int n) {
+    sgp4_real_t sin_alt, cos_alt, sin_azm, cos_azm, x, y, z, s, e, u;
+    int i;
+    
+    for (i = 0; i < n; i++) {
+        SGP4_SINCOS((sgp4_real_t)altaz[i].alt * SGP4_REAL(M_PI / 180.0), &sin_alt, &cos_alt);
+        SGP4_SINCOS((sgp4_real_t)altaz[i].azm * SGP4_REAL(M_PI / 180.0), &sin_azm, &cos_azm);
+        s = -cos_alt * cos_azm;
+        e =  cos_alt * sin_azm;
+        u =  sin_alt;
+        
+        x = t->m[0][0] * s + t->m[1][0] * e + t->m[2][0] * u;
+        y = t->m[0][1] * s + t->m[1][1] * e + t->m[2][1] * u;
+        z = t->m[0][2] * s + t->m[2][2] * u;
+        
+        radec[i].dec = SGP4_ATAN2(z, SGP4_SQRT(x * x + y * y)) * SGP4_REAL(180.0 / M_PI);
+        radec[i].ra  = SGP4_ATAN2(y, x) * SGP4_REAL(180.0 / M_PI);
+        if (radec[i].ra < 0) radec[i].ra += 360.0;
+    }
+    return n;
+}
@@ -11,190 +11,205 @@
 
 #include "sgp4sdp4.h"
 
-/* SGP4 */
-/* This function is used to calculate the position and velocity */
-/* of near-earth (period < 225 minutes) satellites. tsince is   */
-/* time since epoch in minutes, tle is a pointer to a tle_t     */
-/* structure with Keplerian orbital elements and pos and vel    */
-/* are vector_t structures returning ECI satellite position and */
-/* velocity. Use Convert_Sat_State() to convert to km and km/s.*/
-void
-SGP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
+/* Flag tests on a propagator context. These mirror isFlagSet() */
+/* and friends below but act on the context's own flag word.    */
+#define CTX_FLAG_SET(ctx, flag)    ((ctx)->flags & (flag))
+#define CTX_FLAG_CLEAR(ctx, flag)  (~(ctx)->flags & (flag))
+#define CTX_SET_FLAG(ctx, flag)    ((ctx)->flags |= (flag))
+#define CTX_CLEAR_FLAG(ctx, flag)  ((ctx)->flags &= ~(flag))
+
+/* Context shared by the original SGP4() and SDP4() entry points. */
+/* Only one of them is initialized at a time, see SGP4() below.   */
+static sgp4_ctx_t legacy_ctx;
+
+/* SGP4_INIT */
+/* Computes the near-earth initialization constants for the  */
+/* elements held in ctx->tle. Only ever needs doing once per */
+/* TLE, after which SGP4_Propagate() does the time-dependent */
+/* part of the model.                                         */
+static void
+SGP4_Init(sgp4_ctx_t *ctx)
 {
-  static double
-    aodp,aycof,c1,c4,c5,cosio,d2,d3,d4,delmo,omgcof,
-    eta,omgdot,sinio,xnodp,sinmo,t2cof,t3cof,t4cof,t5cof,
-    x1mth2,x3thm1,x7thm1,xmcof,xmdot,xnodcf,xnodot,xlcof;
- 
+  sgp4_near_t *k = &ctx->model.sgp4;
+  tle_t *tle = &ctx->tle;
+
   double
-    cosuk,sinuk,rfdotk,vx,vy,vz,ux,uy,uz,xmy,xmx,
-    cosnok,sinnok,cosik,sinik,rdotk,xinck,xnodek,uk,
-    rk,cos2u,sin2u,u,sinu,cosu,betal,rfdot,rdot,r,pl,
-    elsq,esine,ecose,epw,cosepw,x1m5th,xhdot1,tfour,
-    sinepw,capu,ayn,xlt,aynl,xll,axn,xn,beta,xl,e,a,
-    tcube,delm,delomg,templ,tempe,tempa,xnode,tsq,xmp,
-    omega,xnoddf,omgadf,xmdf,a1,a3ovk2,ao,betao,betao2,
+    x1m5th,xhdot1,a1,a3ovk2,ao,betao,betao2,
     c1sq,c2,c3,coef,coef1,del1,delo,eeta,eosq,etasq,
     perige,pinvsq,psisq,qoms24,s4,temp,temp1,temp2,
-    temp3,temp4,temp5,temp6,theta2,theta4,tsi;
-
-  int i;  
-
-  /* Initialization */
-  if (isFlagClear(SGP4_INITIALIZED_FLAG))
+    temp3,theta2,theta4,tsi;
+
+  /* Recover original mean motion (xnodp) and   */
+  /* semimajor axis (aodp) from input elements. */
+  a1 = pow(xke/tle->xno,tothrd);
+  k->cosio = cos(tle->xincl);
+  theta2 = k->cosio*k->cosio;
+  k->x3thm1 = 3*theta2-1.0;
+  eosq = tle->eo*tle->eo;
+  betao2 = 1-eosq;
+  betao = sqrt(betao2);
+  del1 = 1.5*ck2*k->x3thm1/(a1*a1*betao*betao2);
+  ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
+  delo = 1.5*ck2*k->x3thm1/(ao*ao*betao*betao2);
+  k->xnodp = tle->xno/(1+delo);
+  k->aodp = ao/(1-delo);
+
+  /* For perigee less than 220 kilometers, the "simple" flag is set */
+  /* and the equations are truncated to linear variation in sqrt a  */
+  /* and quadratic variation in mean anomaly.  Also, the c3 term,   */
+  /* the delta omega term, and the delta m term are dropped.        */
+  if((k->aodp*(1-tle->eo)/ae) < (220/xkmper+ae))
+    CTX_SET_FLAG(ctx, SIMPLE_FLAG);
+  else
+    CTX_CLEAR_FLAG(ctx, SIMPLE_FLAG);
+
+  /* For perigee below 156 km, the       */ 
+  /* values of s and qoms2t are altered. */
+  s4 = __s__;
+  qoms24 = qoms2t;
+  perige = (k->aodp*(1-tle->eo)-ae)*xkmper;
+  if(perige < 156)
     {
-      SetFlag(SGP4_INITIALIZED_FLAG);
-
-      /* Recover original mean motion (xnodp) and   */
-      /* semimajor axis (aodp) from input elements. */
-      a1 = pow(xke/tle->xno,tothrd);
-      cosio = cos(tle->xincl);
-      theta2 = cosio*cosio;
-      x3thm1 = 3*theta2-1.0;
-      eosq = tle->eo*tle->eo;
-      betao2 = 1-eosq;
-      betao = sqrt(betao2);
-      del1 = 1.5*ck2*x3thm1/(a1*a1*betao*betao2);
-      ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
-      delo = 1.5*ck2*x3thm1/(ao*ao*betao*betao2);
-      xnodp = tle->xno/(1+delo);
-      aodp = ao/(1-delo);
-
-      /* For perigee less than 220 kilometers, the "simple" flag is set */
-      /* and the equations are truncated to linear variation in sqrt a  */
-      /* and quadratic variation in mean anomaly.  Also, the c3 term,   */
-      /* the delta omega term, and the delta m term are dropped.        */
-      if((aodp*(1-tle->eo)/ae) < (220/xkmper+ae))
-    SetFlag(SIMPLE_FLAG);
-      else
-    ClearFlag(SIMPLE_FLAG);
-
-      /* For perigee below 156 km, the       */ 
-      /* values of s and qoms2t are altered. */
-      s4 = __s__;
-      qoms24 = qoms2t;
-      perige = (aodp*(1-tle->eo)-ae)*xkmper;
-      if(perige < 156)
-    {
-             if(perige <= 98)
+      if(perige <= 98)
         s4 = 20;
-          else
+      else
         s4 = perige-78;
       qoms24 = pow((120-s4)*ae/xkmper,4);
       s4 = s4/xkmper+ae;
     }; /* End of if(perige <= 98) */
 
-      pinvsq = 1/(aodp*aodp*betao2*betao2);
-      tsi = 1/(aodp-s4);
-      eta = aodp*tle->eo*tsi;
-      etasq = eta*eta;
-      eeta = tle->eo*eta;
-      psisq = fabs(1-etasq);
-      coef = qoms24*pow(tsi,4);
-      coef1 = coef/pow(psisq,3.5);
-      c2 = coef1*xnodp*(aodp*(1+1.5*etasq+eeta*(4+etasq))+
-       0.75*ck2*tsi/psisq*x3thm1*(8+3*etasq*(8+etasq)));
-      c1 = tle->bstar*c2;
-      sinio = sin(tle->xincl);
-      a3ovk2 = -xj3/ck2*pow(ae,3);
-      c3 = coef*tsi*a3ovk2*xnodp*ae*sinio/tle->eo;
-      x1mth2 = 1-theta2;
-      c4 = 2*xnodp*coef1*aodp*betao2*(eta*(2+0.5*etasq)+
-       tle->eo*(0.5+2*etasq)-2*ck2*tsi/(aodp*psisq)*
-       (-3*x3thm1*(1-2*eeta+etasq*(1.5-0.5*eeta))+0.75*
-       x1mth2*(2*etasq-eeta*(1+etasq))*cos(2*tle->omegao)));
-      c5 = 2*coef1*aodp*betao2*(1+2.75*(etasq+eeta)+eeta*etasq);
-      theta4 = theta2*theta2;
-      temp1 = 3*ck2*pinvsq*xnodp;
-      temp2 = temp1*ck2*pinvsq;
-      temp3 = 1.25*ck4*pinvsq*pinvsq*xnodp;
-      xmdot = xnodp+0.5*temp1*betao*x3thm1+
-          0.0625*temp2*betao*(13-78*theta2+137*theta4);
-      x1m5th = 1-5*theta2;
-      omgdot = -0.5*temp1*x1m5th+0.0625*temp2*(7-114*theta2+
-           395*theta4)+temp3*(3-36*theta2+49*theta4);
-      xhdot1 = -temp1*cosio;
-      xnodot = xhdot1+(0.5*temp2*(4-19*theta2)+
-           2*temp3*(3-7*theta2))*cosio;
-      omgcof = tle->bstar*c3*cos(tle->omegao);
-      xmcof = -tothrd*coef*tle->bstar*ae/eeta;
-      xnodcf = 3.5*betao2*xhdot1*c1;
-      t2cof = 1.5*c1;
-      xlcof = 0.125*a3ovk2*sinio*(3+5*cosio)/(1+cosio);
-      aycof = 0.25*a3ovk2*sinio;
-      delmo = pow(1+eta*cos(tle->xmo),3);
-      sinmo = sin(tle->xmo);
-      x7thm1 = 7*theta2-1;
-      if (isFlagClear(SIMPLE_FLAG))
+  pinvsq = 1/(k->aodp*k->aodp*betao2*betao2);
+  tsi = 1/(k->aodp-s4);
+  k->eta = k->aodp*tle->eo*tsi;
+  etasq = k->eta*k->eta;
+  eeta = tle->eo*k->eta;
+  psisq = fabs(1-etasq);
+  coef = qoms24*pow(tsi,4);
+  coef1 = coef/pow(psisq,3.5);
+  c2 = coef1*k->xnodp*(k->aodp*(1+1.5*etasq+eeta*(4+etasq))+
+   0.75*ck2*tsi/psisq*k->x3thm1*(8+3*etasq*(8+etasq)));
+  k->c1 = tle->bstar*c2;
+  k->sinio = sin(tle->xincl);
+  a3ovk2 = -xj3/ck2*pow(ae,3);
+  c3 = coef*tsi*a3ovk2*k->xnodp*ae*k->sinio/tle->eo;
+  k->x1mth2 = 1-theta2;
+  k->c4 = 2*k->xnodp*coef1*k->aodp*betao2*(k->eta*(2+0.5*etasq)+
+   tle->eo*(0.5+2*etasq)-2*ck2*tsi/(k->aodp*psisq)*
+   (-3*k->x3thm1*(1-2*eeta+etasq*(1.5-0.5*eeta))+0.75*
+   k->x1mth2*(2*etasq-eeta*(1+etasq))*cos(2*tle->omegao)));
+  k->c5 = 2*coef1*k->aodp*betao2*(1+2.75*(etasq+eeta)+eeta*etasq);
+  theta4 = theta2*theta2;
+  temp1 = 3*ck2*pinvsq*k->xnodp;
+  temp2 = temp1*ck2*pinvsq;
+  temp3 = 1.25*ck4*pinvsq*pinvsq*k->xnodp;
+  k->xmdot = k->xnodp+0.5*temp1*betao*k->x3thm1+
+      0.0625*temp2*betao*(13-78*theta2+137*theta4);
+  x1m5th = 1-5*theta2;
+  k->omgdot = -0.5*temp1*x1m5th+0.0625*temp2*(7-114*theta2+
+       395*theta4)+temp3*(3-36*theta2+49*theta4);
+  xhdot1 = -temp1*k->cosio;
+  k->xnodot = xhdot1+(0.5*temp2*(4-19*theta2)+
+       2*temp3*(3-7*theta2))*k->cosio;
+  k->omgcof = tle->bstar*c3*cos(tle->omegao);
+  k->xmcof = -tothrd*coef*tle->bstar*ae/eeta;
+  k->xnodcf = 3.5*betao2*xhdot1*k->c1;
+  k->t2cof = 1.5*k->c1;
+  k->xlcof = 0.125*a3ovk2*k->sinio*(3+5*k->cosio)/(1+k->cosio);
+  k->aycof = 0.25*a3ovk2*k->sinio;
+  k->delmo = pow(1+k->eta*cos(tle->xmo),3);
+  k->sinmo = sin(tle->xmo);
+  k->x7thm1 = 7*theta2-1;
+  if (CTX_FLAG_CLEAR(ctx, SIMPLE_FLAG))
     {
-      c1sq = c1*c1;
-      d2 = 4*aodp*tsi*c1sq;
-      temp = d2*tsi*c1/3;
-      d3 = (17*aodp+s4)*temp;
-      d4 = 0.5*temp*aodp*tsi*(221*aodp+31*s4)*c1;
-      t3cof = d2+2*c1sq;
-      t4cof = 0.25*(3*d3+c1*(12*d2+10*c1sq));
-      t5cof = 0.2*(3*d4+12*c1*d3+6*d2*d2+15*c1sq*(2*d2+c1sq));
-    }; /* End of if (isFlagClear(SIMPLE_FLAG)) */
-    }; /* End of SGP4() initialization */
+      c1sq = k->c1*k->c1;
+      k->d2 = 4*k->aodp*tsi*c1sq;
+      temp = k->d2*tsi*k->c1/3;
+      k->d3 = (17*k->aodp+s4)*temp;
+      k->d4 = 0.5*temp*k->aodp*tsi*(221*k->aodp+31*s4)*k->c1;
+      k->t3cof = k->d2+2*c1sq;
+      k->t4cof = 0.25*(3*k->d3+k->c1*(12*k->d2+10*c1sq));
+      k->t5cof = 0.2*(3*k->d4+12*k->c1*k->d3+6*k->d2*k->d2+15*c1sq*(2*k->d2+c1sq));
+    }; /* End of if (CTX_FLAG_CLEAR(ctx, SIMPLE_FLAG)) */
+} /* SGP4_Init */
+
+/*------------------------------------------------------------------*/
+
+/* SGP4_PROPAGATE */
+/* This function is used to calculate the position and velocity */
+/* of near-earth (period < 225 minutes) satellites. tsince is   */
+/* time since epoch in minutes, ctx is a context prepared by    */
+/* SGP4_Init() and pos and vel are vector_t structures returning */
+/* ECI satellite position and velocity. Use Convert_Sat_State() */
+/* to convert to km and km/s. The arithmetic is done in the     */
+/* precision chosen by SGP4_NUMERIC.                            */
+static void
+SGP4_Propagate(sgp4_ctx_t *ctx, double tsince,
+               vector_t *pos, vector_t *vel, double* phase)
+{
+  sgp4_near_t *k = &ctx->model.sgp4;
+  tle_t *tle = &ctx->tle;
+
+  sgp4_time_t
+    t,tcube,tfour,xlt,xl,delomg,templ,tempe,tempa,xnode,
+    tsq,xmp,omega,xnoddf,omgadf,xmdf,temps;
+
+  sgp4_real_t
+    cosuk,sinuk,rfdotk,vx,vy,vz,ux,uy,uz,xmy,xmx,
+    cosnok,sinnok,cosik,sinik,rdotk,xinck,xnodek,uk,
+    rk,cos2u,sin2u,u,sinu,cosu,betal,rfdot,rdot,r,pl,
+    elsq,esine,ecose,cosepw,sinepw,capu,ayn,aynl,
+    xll,axn,xn,beta,e,a,delm,temp,temp1,temp2,temp3,
+    temp4,temp5,temp6,sinomg,cosomg;
 
   /* Update for secular gravity and atmospheric drag. */
-  xmdf = tle->xmo+xmdot*tsince;
-  omgadf = tle->omegao+omgdot*tsince;
-  xnoddf = tle->xnodeo+xnodot*tsince;
+  t = tsince;
+  xmdf = (sgp4_time_t)tle->xmo+k->xmdot*t;
+  omgadf = (sgp4_time_t)tle->omegao+k->omgdot*t;
+  xnoddf = (sgp4_time_t)tle->xnodeo+k->xnodot*t;
   omega = omgadf;
   xmp = xmdf;
-  tsq = tsince*tsince;
-  xnode = xnoddf+xnodcf*tsq;
-  tempa = 1-c1*tsince;
-  tempe = tle->bstar*c4*tsince;
-  templ = t2cof*tsq;
-  if (isFlagClear(SIMPLE_FLAG))
+  tsq = t*t;
+  xnode = xnoddf+k->xnodcf*tsq;
+  tempa = 1-k->c1*t;
+  tempe = (sgp4_time_t)tle->bstar*k->c4*t;
+  templ = k->t2cof*tsq;
+  if (CTX_FLAG_CLEAR(ctx, SIMPLE_FLAG))
     {
-      delomg = omgcof*tsince;
-      delm = xmcof*(pow(1+eta*cos(xmdf),3)-delmo);
-      temp = delomg+delm;
-      xmp = xmdf+temp;
-      omega = omgadf-temp;
-      tcube = tsq*tsince;
-      tfour = tsince*tcube;
-      tempa = tempa-d2*tsq-d3*tcube-d4*tfour;
-      tempe = tempe+tle->bstar*c5*(sin(xmp)-sinmo);
-      templ = templ+t3cof*tcube+tfour*(t4cof+tsince*t5cof);
-    }; /* End of if (isFlagClear(SIMPLE_FLAG)) */
-
-  a = aodp*pow(tempa,2);
-  e = tle->eo-tempe;
-  xl = xmp+omega+xnode+xnodp*templ;
-  beta = sqrt(1-e*e);
-  xn = xke/pow(a,1.5);
+      delomg = k->omgcof*t;
+      temp = 1+k->eta*SGP4_COS(SGP4_ANGLE(xmdf));
+      delm = k->xmcof*(temp*temp*temp-k->delmo);
+      temps = delomg+delm;
+      xmp = xmdf+temps;
+      omega = omgadf-temps;
+      tcube = tsq*t;
+      tfour = t*tcube;
+      tempa = tempa-k->d2*tsq-k->d3*tcube-k->d4*tfour;
+      tempe = tempe+(sgp4_time_t)tle->bstar*k->c5*(SGP4_SIN(SGP4_ANGLE(xmp))-k->sinmo);
+      templ = templ+k->t3cof*tcube+tfour*(k->t4cof+t*k->t5cof);
+    }; /* End of if (CTX_FLAG_CLEAR(ctx, SIMPLE_FLAG)) */
+
+  a = k->aodp*(sgp4_real_t)tempa*(sgp4_real_t)tempa;
+  e = (sgp4_real_t)tle->eo-(sgp4_real_t)tempe;
+  xl = xmp+omega+xnode+k->xnodp*templ;
+  beta = SGP4_SQRT(1-e*e);
+  xn = SGP4_REAL(xke)/(a*SGP4_SQRT(a));
 
   /* Long period periodics */
-  axn = e*cos(omega);
+  SGP4_SINCOS(SGP4_ANGLE(omega), &sinomg, &cosomg);
+  axn = e*cosomg;
   temp = 1/(a*beta*beta);
-  xll = temp*xlcof*axn;
-  aynl = temp*aycof;
+  xll = temp*k->xlcof*axn;
+  aynl = temp*k->aycof;
   xlt = xl+xll;
-  ayn = e*sin(omega)+aynl;
+  ayn = e*sinomg+aynl;
 
   /* Solve Kepler's' Equation */
-  capu = FMod2p(xlt-xnode);
-  temp2 = capu;
-
-  i = 0;
-  do
-    {
-      sinepw = sin(temp2);
-      cosepw = cos(temp2);
-      temp3 = axn*sinepw;
-      temp4 = ayn*cosepw;
-      temp5 = axn*cosepw;
-      temp6 = ayn*sinepw;
-      epw = (capu-temp4+temp3-temp2)/(1-temp5-temp6)+temp2;
-      if(fabs(epw-temp2) <= e6a) break;
-      temp2 = epw;
-    }
-  while( i++ < 10 );
+  capu = SGP4_FMOD2P(xlt-xnode);
+  SGP4_KEPLER(capu, axn, ayn, &sinepw, &cosepw);
+  temp3 = axn*sinepw;
+  temp4 = ayn*cosepw;
+  temp5 = axn*cosepw;
+  temp6 = ayn*sinepw;
 
   /* Short period preliminary quantities */
   ecose = temp5+temp6;
@@ -204,35 +219,32 @@ SGP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
   pl = a*temp;
   r = a*(1-ecose);
   temp1 = 1/r;
-  rdot = xke*sqrt(a)*esine*temp1;
-  rfdot = xke*sqrt(pl)*temp1;
+  rdot = SGP4_REAL(xke)*SGP4_SQRT(a)*esine*temp1;
+  rfdot = SGP4_REAL(xke)*SGP4_SQRT(pl)*temp1;
   temp2 = a*temp1;
-  betal = sqrt(temp);
+  betal = SGP4_SQRT(temp);
   temp3 = 1/(1+betal);
   cosu = temp2*(cosepw-axn+ayn*esine*temp3);
   sinu = temp2*(sinepw-ayn-axn*esine*temp3);
-  u = AcTan(sinu, cosu);
+  u = SGP4_ACTAN(sinu, cosu);
   sin2u = 2*sinu*cosu;
   cos2u = 2*cosu*cosu-1;
   temp = 1/pl;
-  temp1 = ck2*temp;
+  temp1 = SGP4_REAL(ck2)*temp;
   temp2 = temp1*temp;
 
   /* Update for short periodics */
-  rk = r*(1-1.5*temp2*betal*x3thm1)+0.5*temp1*x1mth2*cos2u;
-  uk = u-0.25*temp2*x7thm1*sin2u;
-  xnodek = xnode+1.5*temp2*cosio*sin2u;
-  xinck = tle->xincl+1.5*temp2*cosio*sinio*cos2u;
-  rdotk = rdot-xn*temp1*x1mth2*sin2u;
-  rfdotk = rfdot+xn*temp1*(x1mth2*cos2u+1.5*x3thm1);
+  rk = r*(1-SGP4_REAL(1.5)*temp2*betal*k->x3thm1)+SGP4_REAL(0.5)*temp1*k->x1mth2*cos2u;
+  uk = u-SGP4_REAL(0.25)*temp2*k->x7thm1*sin2u;
+  xnodek = SGP4_ANGLE(xnode)+SGP4_REAL(1.5)*temp2*k->cosio*sin2u;
+  xinck = (sgp4_real_t)tle->xincl+SGP4_REAL(1.5)*temp2*k->cosio*k->sinio*cos2u;
+  rdotk = rdot-xn*temp1*k->x1mth2*sin2u;
+  rfdotk = rfdot+xn*temp1*(k->x1mth2*cos2u+SGP4_REAL(1.5)*k->x3thm1);
 
   /* Orientation vectors */
-  sinuk = sin(uk);
-  cosuk = cos(uk);
-  sinik = sin(xinck);
-  cosik = cos(xinck);
-  sinnok = sin(xnodek);
-  cosnok = cos(xnodek);
+  SGP4_SINCOS(uk, &sinuk, &cosuk);
+  SGP4_SINCOS(xinck, &sinik, &cosik);
+  SGP4_SINCOS(xnodek, &sinnok, &cosnok);
   xmx = -sinnok*cosik;
   xmy = cosnok*cosik;
   ux = xmx*sinuk+cosnok*cosuk;
@@ -257,178 +269,176 @@ SGP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
   tle->omegao1=omega;
   tle->xincl1=xinck;
   tle->xnodeo1=xnodek;
+} /* SGP4_Propagate */
 
-} /*SGP4*/
+/*------------------------------------------------------------------*/
+
+/* SDP4_INIT */
+/* Computes the deep-space initialization constants for the */
+/* elements held in ctx->tle, including the lunar, solar    */
+/* and resonance terms set up by Deep(dpinit).              */
+static void
+SDP4_Init(sgp4_ctx_t *ctx)
+{
+  sdp4_deep_t *k = &ctx->model.sdp4;
+  deep_arg_t *deep_arg = &k->deep_arg;
+  tle_t *tle = &ctx->tle;
+
+  double
+    theta4,a1,a3ovk2,ao,c2,coef,coef1,x1m5th,
+    xhdot1,del1,delo,eeta,eta,etasq,perige,
+    psisq,tsi,qoms24,s4,pinvsq,temp1,temp2,temp3;
+
+  /* Recover original mean motion (xnodp) and   */
+  /* semimajor axis (aodp) from input elements. */
+  a1 = pow(xke/tle->xno,tothrd);
+  deep_arg->cosio = cos(tle->xincl);
+  deep_arg->theta2 = deep_arg->cosio*deep_arg->cosio;
+  k->x3thm1 = 3*deep_arg->theta2-1;
+  deep_arg->eosq = tle->eo*tle->eo;
+  deep_arg->betao2 = 1-deep_arg->eosq;
+  deep_arg->betao = sqrt(deep_arg->betao2);
+  del1 = 1.5*ck2*k->x3thm1/(a1*a1*deep_arg->betao*deep_arg->betao2);
+  ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
+  delo = 1.5*ck2*k->x3thm1/(ao*ao*deep_arg->betao*deep_arg->betao2);
+  deep_arg->xnodp = tle->xno/(1+delo);
+  deep_arg->aodp = ao/(1-delo);
+
+  /* For perigee below 156 km, the values */
+  /* of s and qoms2t are altered.         */
+  s4 = __s__;
+  qoms24 = qoms2t;
+  perige = (deep_arg->aodp*(1-tle->eo)-ae)*xkmper;
+  if(perige < 156)
+    {
+      if(perige <= 98)
+        s4 = 20;
+      else
+        s4 = perige-78;
+      qoms24 = pow((120-s4)*ae/xkmper,4);
+      s4 = s4/xkmper+ae;
+    }
+  pinvsq = 1/(deep_arg->aodp*deep_arg->aodp*
+           deep_arg->betao2*deep_arg->betao2);
+  deep_arg->sing = sin(tle->omegao);
+  deep_arg->cosg = cos(tle->omegao);
+  tsi = 1/(deep_arg->aodp-s4);
+  eta = deep_arg->aodp*tle->eo*tsi;
+  etasq = eta*eta;
+  eeta = tle->eo*eta;
+  psisq = fabs(1-etasq);
+  coef = qoms24*pow(tsi,4);
+  coef1 = coef/pow(psisq,3.5);
+  c2 = coef1*deep_arg->xnodp*(deep_arg->aodp*(1+1.5*etasq+eeta*
+   (4+etasq))+0.75*ck2*tsi/psisq*k->x3thm1*(8+3*etasq*(8+etasq)));
+  k->c1 = tle->bstar*c2;
+  deep_arg->sinio = sin(tle->xincl);
+  a3ovk2 = -xj3/ck2*pow(ae,3);
+  k->x1mth2 = 1-deep_arg->theta2;
+  k->c4 = 2*deep_arg->xnodp*coef1*deep_arg->aodp*deep_arg->betao2*
+       (eta*(2+0.5*etasq)+tle->eo*(0.5+2*etasq)-2*ck2*tsi/
+       (deep_arg->aodp*psisq)*(-3*k->x3thm1*(1-2*eeta+etasq*
+       (1.5-0.5*eeta))+0.75*k->x1mth2*(2*etasq-eeta*(1+etasq))*
+       cos(2*tle->omegao)));
+  theta4 = deep_arg->theta2*deep_arg->theta2;
+  temp1 = 3*ck2*pinvsq*deep_arg->xnodp;
+  temp2 = temp1*ck2*pinvsq;
+  temp3 = 1.25*ck4*pinvsq*pinvsq*deep_arg->xnodp;
+  deep_arg->xmdot = deep_arg->xnodp+0.5*temp1*deep_arg->betao*
+               k->x3thm1+0.0625*temp2*deep_arg->betao*
+                   (13-78*deep_arg->theta2+137*theta4);
+  x1m5th = 1-5*deep_arg->theta2;
+  deep_arg->omgdot = -0.5*temp1*x1m5th+0.0625*temp2*
+                    (7-114*deep_arg->theta2+395*theta4)+
+                temp3*(3-36*deep_arg->theta2+49*theta4);
+  xhdot1 = -temp1*deep_arg->cosio;
+  deep_arg->xnodot = xhdot1+(0.5*temp2*(4-19*deep_arg->theta2)+
+            2*temp3*(3-7*deep_arg->theta2))*deep_arg->cosio;
+  k->xnodcf = 3.5*deep_arg->betao2*xhdot1*k->c1;
+  k->t2cof = 1.5*k->c1;
+  k->xlcof = 0.125*a3ovk2*deep_arg->sinio*(3+5*deep_arg->cosio)/
+          (1+deep_arg->cosio);
+  k->aycof = 0.25*a3ovk2*deep_arg->sinio;
+  k->x7thm1 = 7*deep_arg->theta2-1;
+
+  /* initialize Deep() */
+  Deep(dpinit, ctx);
+} /* SDP4_Init */
 
 /*------------------------------------------------------------------*/
 
-/* SDP4 */
+/* SDP4_PROPAGATE */
 /* This function is used to calculate the position and velocity */
 /* of deep-space (period > 225 minutes) satellites. tsince is   */
-/* time since epoch in minutes, tle is a pointer to a tle_t     */
-/* structure with Keplerian orbital elements and pos and vel    */
-/* are vector_t structures returning ECI satellite position and */
-/* velocity. Use Convert_Sat_State() to convert to km and km/s. */
-void 
-SDP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
+/* time since epoch in minutes, ctx is a context prepared by    */
+/* SDP4_Init() and pos and vel are vector_t structures returning */
+/* ECI satellite position and velocity. Use Convert_Sat_State() */
+/* to convert to km and km/s.                                   */
+static void
+SDP4_Propagate(sgp4_ctx_t *ctx, double tsince,
+               vector_t *pos, vector_t *vel, double* phase)
 {
-  int i;
-
-  static double
-    x3thm1,c1,x1mth2,c4,xnodcf,t2cof,xlcof,aycof,x7thm1;
+  sdp4_deep_t *k = &ctx->model.sdp4;
+  deep_arg_t *deep_arg = &k->deep_arg;
+  tle_t *tle = &ctx->tle;
 
   double
     a,axn,ayn,aynl,beta,betal,capu,cos2u,cosepw,cosik,
-    cosnok,cosu,cosuk,ecose,elsq,epw,esine,pl,theta4,
+    cosnok,cosu,cosuk,ecose,elsq,esine,pl,
     rdot,rdotk,rfdot,rfdotk,rk,sin2u,sinepw,sinik,
     sinnok,sinu,sinuk,tempe,templ,tsq,u,uk,ux,uy,uz,
     vx,vy,vz,xinck,xl,xlt,xmam,xmdf,xmx,xmy,xnoddf,
-    xnodek,xll,a1,a3ovk2,ao,c2,coef,coef1,x1m5th,
-    xhdot1,del1,r,delo,eeta,eta,etasq,perige,
-    psisq,tsi,qoms24,s4,pinvsq,temp,tempa,temp1,
-    temp2,temp3,temp4,temp5,temp6;
-
-  static deep_arg_t deep_arg;
-
-  /* Initialization */
-  if (isFlagClear(SDP4_INITIALIZED_FLAG))
-    {
-      SetFlag(SDP4_INITIALIZED_FLAG);
-
-      /* Recover original mean motion (xnodp) and   */
-      /* semimajor axis (aodp) from input elements. */
-      a1 = pow(xke/tle->xno,tothrd);
-      deep_arg.cosio = cos(tle->xincl);
-      deep_arg.theta2 = deep_arg.cosio*deep_arg.cosio;
-      x3thm1 = 3*deep_arg.theta2-1;
-      deep_arg.eosq = tle->eo*tle->eo;
-      deep_arg.betao2 = 1-deep_arg.eosq;
-      deep_arg.betao = sqrt(deep_arg.betao2);
-      del1 = 1.5*ck2*x3thm1/(a1*a1*deep_arg.betao*deep_arg.betao2);
-      ao = a1*(1-del1*(0.5*tothrd+del1*(1+134/81*del1)));
-      delo = 1.5*ck2*x3thm1/(ao*ao*deep_arg.betao*deep_arg.betao2);
-      deep_arg.xnodp = tle->xno/(1+delo);
-      deep_arg.aodp = ao/(1-delo);
-
-      /* For perigee below 156 km, the values */
-      /* of s and qoms2t are altered.         */
-      s4 = __s__;
-      qoms24 = qoms2t;
-      perige = (deep_arg.aodp*(1-tle->eo)-ae)*xkmper;
-      if(perige < 156)
-    {
-             if(perige <= 98)
-        s4 = 20;
-          else
-        s4 = perige-78;
-      qoms24 = pow((120-s4)*ae/xkmper,4);
-      s4 = s4/xkmper+ae;
-    }
-      pinvsq = 1/(deep_arg.aodp*deep_arg.aodp*
-               deep_arg.betao2*deep_arg.betao2);
-      deep_arg.sing = sin(tle->omegao);
-      deep_arg.cosg = cos(tle->omegao);
-      tsi = 1/(deep_arg.aodp-s4);
-      eta = deep_arg.aodp*tle->eo*tsi;
-      etasq = eta*eta;
-      eeta = tle->eo*eta;
-      psisq = fabs(1-etasq);
-      coef = qoms24*pow(tsi,4);
-      coef1 = coef/pow(psisq,3.5);
-      c2 = coef1*deep_arg.xnodp*(deep_arg.aodp*(1+1.5*etasq+eeta*
-       (4+etasq))+0.75*ck2*tsi/psisq*x3thm1*(8+3*etasq*(8+etasq)));
-      c1 = tle->bstar*c2;
-      deep_arg.sinio = sin(tle->xincl);
-      a3ovk2 = -xj3/ck2*pow(ae,3);
-      x1mth2 = 1-deep_arg.theta2;
-      c4 = 2*deep_arg.xnodp*coef1*deep_arg.aodp*deep_arg.betao2*
-           (eta*(2+0.5*etasq)+tle->eo*(0.5+2*etasq)-2*ck2*tsi/
-           (deep_arg.aodp*psisq)*(-3*x3thm1*(1-2*eeta+etasq*
-           (1.5-0.5*eeta))+0.75*x1mth2*(2*etasq-eeta*(1+etasq))*
-           cos(2*tle->omegao)));
-      theta4 = deep_arg.theta2*deep_arg.theta2;
-      temp1 = 3*ck2*pinvsq*deep_arg.xnodp;
-      temp2 = temp1*ck2*pinvsq;
-      temp3 = 1.25*ck4*pinvsq*pinvsq*deep_arg.xnodp;
-      deep_arg.xmdot = deep_arg.xnodp+0.5*temp1*deep_arg.betao*
-                   x3thm1+0.0625*temp2*deep_arg.betao*
-                       (13-78*deep_arg.theta2+137*theta4);
-      x1m5th = 1-5*deep_arg.theta2;
-      deep_arg.omgdot = -0.5*temp1*x1m5th+0.0625*temp2*
-                        (7-114*deep_arg.theta2+395*theta4)+
-                    temp3*(3-36*deep_arg.theta2+49*theta4);
-      xhdot1 = -temp1*deep_arg.cosio;
-      deep_arg.xnodot = xhdot1+(0.5*temp2*(4-19*deep_arg.theta2)+
-                2*temp3*(3-7*deep_arg.theta2))*deep_arg.cosio;
-      xnodcf = 3.5*deep_arg.betao2*xhdot1*c1;
-      t2cof = 1.5*c1;
-      xlcof = 0.125*a3ovk2*deep_arg.sinio*(3+5*deep_arg.cosio)/
-              (1+deep_arg.cosio);
-      aycof = 0.25*a3ovk2*deep_arg.sinio;
-      x7thm1 = 7*deep_arg.theta2-1;
-
-      /* initialize Deep() */
-      Deep(dpinit, tle, &deep_arg);
-    }; /*End of SDP4() initialization */
+    xnodek,xll,r,temp,tempa,temp1,
+    temp2,temp3,temp4,temp5,temp6,sinomg,cosomg;
 
   /* Update for secular gravity and atmospheric drag */
-  xmdf = tle->xmo+deep_arg.xmdot*tsince;
-  deep_arg.omgadf = tle->omegao+deep_arg.omgdot*tsince;
-  xnoddf = tle->xnodeo+deep_arg.xnodot*tsince;
+  xmdf = tle->xmo+deep_arg->xmdot*tsince;
+  deep_arg->omgadf = tle->omegao+deep_arg->omgdot*tsince;
+  xnoddf = tle->xnodeo+deep_arg->xnodot*tsince;
   tsq = tsince*tsince;
-  deep_arg.xnode = xnoddf+xnodcf*tsq;
-  tempa = 1-c1*tsince;
-  tempe = tle->bstar*c4*tsince;
-  templ = t2cof*tsq;
-  deep_arg.xn = deep_arg.xnodp;
+  deep_arg->xnode = xnoddf+k->xnodcf*tsq;
+  tempa = 1-k->c1*tsince;
+  tempe = tle->bstar*k->c4*tsince;
+  templ = k->t2cof*tsq;
+  deep_arg->xn = deep_arg->xnodp;
 
   /* Update for deep-space secular effects */
-  deep_arg.xll = xmdf;
-  deep_arg.t = tsince;
+  deep_arg->xll = xmdf;
+  deep_arg->t = tsince;
 
-  Deep(dpsec, tle, &deep_arg);
+  Deep(dpsec, ctx);
 
-  xmdf = deep_arg.xll;
-  a = pow(xke/deep_arg.xn,tothrd)*tempa*tempa;
-  deep_arg.em = deep_arg.em-tempe;
-  xmam = xmdf+deep_arg.xnodp*templ;
+  xmdf = deep_arg->xll;
+  a = pow(xke/deep_arg->xn,tothrd)*tempa*tempa;
+  deep_arg->em = deep_arg->em-tempe;
+  xmam = xmdf+deep_arg->xnodp*templ;
 
   /* Update for deep-space periodic effects */
-  deep_arg.xll = xmam;
+  deep_arg->xll = xmam;
 
-  Deep(dpper, tle, &deep_arg);
+  Deep(dpper, ctx);
 
-  xmam = deep_arg.xll;
-  xl = xmam+deep_arg.omgadf+deep_arg.xnode;
-  beta = sqrt(1-deep_arg.em*deep_arg.em);
-  deep_arg.xn = xke/pow(a,1.5);
+  xmam = deep_arg->xll;
+  xl = xmam+deep_arg->omgadf+deep_arg->xnode;
+  beta = sqrt(1-deep_arg->em*deep_arg->em);
+  deep_arg->xn = xke/(a*sqrt(a));
 
   /* Long period periodics */
-  axn = deep_arg.em*cos(deep_arg.omgadf);
+  SinCos(deep_arg->omgadf, &sinomg, &cosomg);
+  axn = deep_arg->em*cosomg;
   temp = 1/(a*beta*beta);
-  xll = temp*xlcof*axn;
-  aynl = temp*aycof;
+  xll = temp*k->xlcof*axn;
+  aynl = temp*k->aycof;
   xlt = xl+xll;
-  ayn = deep_arg.em*sin(deep_arg.omgadf)+aynl;
+  ayn = deep_arg->em*sinomg+aynl;
 
   /* Solve Kepler's Equation */
-  capu = FMod2p(xlt-deep_arg.xnode);
-  temp2 = capu;
-
-  i = 0;
-  do
-    {
-      sinepw = sin(temp2);
-      cosepw = cos(temp2);
-      temp3 = axn*sinepw;
-      temp4 = ayn*cosepw;
-      temp5 = axn*cosepw;
-      temp6 = ayn*sinepw;
-      epw = (capu-temp4+temp3-temp2)/(1-temp5-temp6)+temp2;
-      if(fabs(epw-temp2) <= e6a) break;
-      temp2 = epw;
-    }
-  while( i++ < 10 );
+  capu = FMod2p(xlt-deep_arg->xnode);
+  Kepler(capu, axn, ayn, &sinepw, &cosepw);
+  temp3 = axn*sinepw;
+  temp4 = ayn*cosepw;
+  temp5 = axn*cosepw;
+  temp6 = ayn*sinepw;
 
   /* Short period preliminary quantities */
   ecose = temp5+temp6;
@@ -453,20 +463,17 @@ SDP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
   temp2 = temp1*temp;
 
   /* Update for short periodics */
-  rk = r*(1-1.5*temp2*betal*x3thm1)+0.5*temp1*x1mth2*cos2u;
-  uk = u-0.25*temp2*x7thm1*sin2u;
-  xnodek = deep_arg.xnode+1.5*temp2*deep_arg.cosio*sin2u;
-  xinck = deep_arg.xinc+1.5*temp2*deep_arg.cosio*deep_arg.sinio*cos2u;
-  rdotk = rdot-deep_arg.xn*temp1*x1mth2*sin2u;
-  rfdotk = rfdot+deep_arg.xn*temp1*(x1mth2*cos2u+1.5*x3thm1);
+  rk = r*(1-1.5*temp2*betal*k->x3thm1)+0.5*temp1*k->x1mth2*cos2u;
+  uk = u-0.25*temp2*k->x7thm1*sin2u;
+  xnodek = deep_arg->xnode+1.5*temp2*deep_arg->cosio*sin2u;
+  xinck = deep_arg->xinc+1.5*temp2*deep_arg->cosio*deep_arg->sinio*cos2u;
+  rdotk = rdot-deep_arg->xn*temp1*k->x1mth2*sin2u;
+  rfdotk = rfdot+deep_arg->xn*temp1*(k->x1mth2*cos2u+1.5*k->x3thm1);
 
   /* Orientation vectors */
-  sinuk = sin(uk);
-  cosuk = cos(uk);
-  sinik = sin(xinck);
-  cosik = cos(xinck);
-  sinnok = sin(xnodek);
-  cosnok = cos(xnodek);
+  SinCos(uk, &sinuk, &cosuk);
+  SinCos(xinck, &sinik, &cosik);
+  SinCos(xnodek, &sinnok, &cosnok);
   xmx = -sinnok*cosik;
   xmy = cosnok*cosik;
   ux = xmx*sinuk+cosnok*cosuk;
@@ -485,32 +492,189 @@ SDP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
   vel->z = rdotk*uz+rfdotk*vz;
 
  /* Phase in rads */
-  *phase = xlt-deep_arg.xnode-deep_arg.omgadf+twopi;
+  *phase = xlt-deep_arg->xnode-deep_arg->omgadf+twopi;
   if(*phase < 0) *phase += twopi;
   *phase = FMod2p(*phase);
 
-  tle->omegao1=deep_arg.omgadf;
-  tle->xincl1=deep_arg.xinc;
-  tle->xnodeo1=deep_arg.xnode;
+  tle->omegao1=deep_arg->omgadf;
+  tle->xincl1=deep_arg->xinc;
+  tle->xnodeo1=deep_arg->xnode;
+} /* SDP4_Propagate */
+
+/*------------------------------------------------------------------*/
+
+/* sgp4_init */
+/* Prepares a propagator context for the satellite described by */
+/* tle, which must already have been through select_ephemeris(). */
+/* The near-earth or deep-space model is chosen here and all of  */
+/* its initialization constants are kept in the context, so any  */
+/* number of contexts may be propagated in any order.            */
+void
+sgp4_init(sgp4_ctx_t *ctx, tle_t *tle)
+{
+  memset(ctx, 0, sizeof(sgp4_ctx_t));
+  ctx->tle = *tle;
+
+  if (Is_Deep_Space(tle))
+    {
+      CTX_SET_FLAG(ctx, DEEP_SPACE_EPHEM_FLAG | SDP4_INITIALIZED_FLAG);
+      SDP4_Init(ctx);
+    }
+  else
+    {
+      CTX_SET_FLAG(ctx, SGP4_INITIALIZED_FLAG);
+      SGP4_Init(ctx);
+    }
+} /* sgp4_init */
+
+/*------------------------------------------------------------------*/
+
+/* sgp4_ctx_size */
+/* The number of bytes at the start of ctx that the model chosen */
+/* by sgp4_init() uses. A near-earth context needs much less     */
+/* than sizeof(sgp4_ctx_t) and may be copied into that many      */
+/* bytes and propagated there, to keep many of them in RAM.      */
+size_t
+sgp4_ctx_size(sgp4_ctx_t *ctx)
+{
+  if (CTX_FLAG_SET(ctx, DEEP_SPACE_EPHEM_FLAG))
+    return sizeof(sgp4_ctx_t);
+  else
+    return offsetof(sgp4_ctx_t, model) + sizeof(sgp4_near_t);
+} /* sgp4_ctx_size */
+
+/*------------------------------------------------------------------*/
+
+/* sgp4_propagate */
+/* Calculates the ECI position and velocity of the satellite */
+/* held in ctx at tsince minutes from its epoch, using the   */
+/* model selected by sgp4_init(). Only the time-dependent    */
+/* part of the model is evaluated.                           */
+void
+sgp4_propagate(sgp4_ctx_t *ctx, double tsince,
+               vector_t *pos, vector_t *vel, double* phase)
+{
+  if (CTX_FLAG_SET(ctx, DEEP_SPACE_EPHEM_FLAG))
+    SDP4_Propagate(ctx, tsince, pos, vel, phase);
+  else
+    SGP4_Propagate(ctx, tsince, pos, vel, phase);
+} /* sgp4_propagate */
+
+/*------------------------------------------------------------------*/
+
+/* SGP4 */
+/* Original single-satellite near-earth entry point, kept for  */
+/* existing callers. Initialization is redone whenever the     */
+/* global SGP4_INITIALIZED_FLAG is cleared. SGP4() and SDP4()  */
+/* share one context, so each clears the other's flag when it  */
+/* takes it over. New code should use sgp4_init() and          */
+/* sgp4_propagate() instead.                                   */
+void
+SGP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
+{
+  if (isFlagClear(SGP4_INITIALIZED_FLAG))
+    {
+      SetFlag(SGP4_INITIALIZED_FLAG);
+      ClearFlag(SDP4_INITIALIZED_FLAG);
+      memset(&legacy_ctx, 0, sizeof(sgp4_ctx_t));
+      legacy_ctx.tle = *tle;
+      SGP4_Init(&legacy_ctx);
+    }
+
+  SGP4_Propagate(&legacy_ctx, tsince, pos, vel, phase);
+
+  tle->omegao1 = legacy_ctx.tle.omegao1;
+  tle->xincl1  = legacy_ctx.tle.xincl1;
+  tle->xnodeo1 = legacy_ctx.tle.xnodeo1;
+} /*SGP4*/
+
+/*------------------------------------------------------------------*/
+
+/* SDP4 */
+/* Original single-satellite deep-space entry point, kept for */
+/* existing callers. Initialization is redone whenever the    */
+/* global SDP4_INITIALIZED_FLAG is cleared, or SGP4() has    */
+/* since taken the shared context over. New code should       */
+/* use sgp4_init() and sgp4_propagate() instead.              */
+void
+SDP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase)
+{
+  if (isFlagClear(SDP4_INITIALIZED_FLAG))
+    {
+      SetFlag(SDP4_INITIALIZED_FLAG);
+      ClearFlag(SGP4_INITIALIZED_FLAG);
+      memset(&legacy_ctx, 0, sizeof(sgp4_ctx_t));
+      legacy_ctx.tle = *tle;
+      CTX_SET_FLAG(&legacy_ctx, DEEP_SPACE_EPHEM_FLAG);
+      SDP4_Init(&legacy_ctx);
+    }
+
+  SDP4_Propagate(&legacy_ctx, tsince, pos, vel, phase);
+
+  tle->omegao1 = legacy_ctx.tle.omegao1;
+  tle->xincl1  = legacy_ctx.tle.xincl1;
+  tle->xnodeo1 = legacy_ctx.tle.xnodeo1;
 } /* SDP4 */
 
 /*------------------------------------------------------------------*/
 
+/* DEEP_RESUME */
+/* The resonance terms are always integrated outwards from epoch, */
+/* so the state at a step does not depend on the order of calls.  */
+/* This picks the furthest step already known that lies between   */
+/* epoch and t: the live state, a checkpoint or epoch itself.     */
+static void
+Deep_Resume(deep_state_t *d, double t)
+{
+  deep_checkpoint_t *chk;
+  int i;
+
+  if( (d->atime == 0) ||
+      ((t >= 0) && (d->atime < 0)) ||
+      ((t < 0) && (d->atime >= 0)) ||
+      (fabs(t) < fabs(d->atime)) )
+    {
+      /* Epoch restart */
+      d->atime = 0;
+      d->xni = d->xnq;
+      d->xli = d->xlamo;
+    }
+
+  for (i = 0; i < DEEP_CHECKPOINTS; i++)
+    {
+      chk = &d->chk[i];
+      if( (chk->atime == 0) ||
+          ((t >= 0) && (chk->atime < 0)) ||
+          ((t < 0) && (chk->atime > 0)) ||
+          (fabs(t) < fabs(chk->atime)) ||
+          (fabs(chk->atime) <= fabs(d->atime)) )
+        continue;
+      d->atime = chk->atime;
+      d->xni = chk->xni;
+      d->xli = chk->xli;
+    }
+} /* Function Deep_Resume */
+
+/*------------------------------------------------------------------*/
+
 /* DEEP */
 /* This function is used by SDP4 to add lunar and solar */
 /* perturbation effects to deep-space orbit objects.    */
 void
-Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
+Deep(int ientry, sgp4_ctx_t *ctx)
 {
-  static double
-    thgr,xnq,xqncl,omegaq,zmol,zmos,savtsn,ee2,e3,xi2,
-    xl2,xl3,xl4,xgh2,xgh3,xgh4,xh2,xh3,sse,ssi,ssg,xi3,
-    se2,si2,sl2,sgh2,sh2,se3,si3,sl3,sgh3,sh3,sl4,sgh4,
-    ssl,ssh,d3210,d3222,d4410,d4422,d5220,d5232,d5421,
-    d5433,del1,del2,del3,fasx2,fasx4,fasx6,xlamo,xfact,
-    xni,atime,stepp,stepn,step2,preep,pl,sghs,xli,
-    d2201,d2211,sghl,sh1,pinc,pe,shs,zsingl,zcosgl,
-    zsinhl,zcoshl,zsinil,zcosil;
+  /* Lunar terms, only needed while initializing */
+  double
+    zsingl,zcosgl,zsinhl,zcoshl,zsinil,zcosil;
+
+  /* Integrator step sizes and resonance phase constants */
+  const double
+    stepp = 720, stepn = -720, step2 = 259200,
+    fasx2 = 0.13130908, fasx4 = 2.8843198, fasx6 = 0.37448087;
+
+  tle_t *tle = &ctx->tle;
+  deep_arg_t *deep_arg = &ctx->model.sdp4.deep_arg;
+  deep_state_t *d = &ctx->model.sdp4.deep;
 
   double
     a1,a2,a3,a4,a5,a6,a7,a8,a9,a10,ainv2,alfdp,aqnv,
@@ -524,7 +688,8 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
     x2li,x2omi,x3,x4,x5,x6,x7,x8,xl,xldot,xmao,xnddt,
     xndot,xno2,xnodce,xnoi,xomi,xpidot,z1,z11,z12,z13,
     z2,z21,z22,z23,z3,z31,z32,z33,ze,zf,zm,/* zmo, (see below) */zn,
-    zsing,zsinh,zsini,zcosg,zcosh,zcosi,delt=0,ft=0;
+    zsing,zsinh,zsini,zcosg,zcosh,zcosi,delt=0,ft=0,
+    coszf,sn[10],cs[10];
 
   /* Compiler complains defined but not used. I never like to
      edit other peoples libraries but I also dislike compiler 
@@ -534,22 +699,19 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
   switch(ientry)
     {
     case dpinit : /* Entrance for deep space initialization */
-      thgr = ThetaG(tle->epoch, deep_arg);
+      d->thgr = ThetaG(tle->epoch, deep_arg);
       eq = tle->eo;
-      xnq = deep_arg->xnodp;
+      d->xnq = deep_arg->xnodp;
       aqnv = 1/deep_arg->aodp;
-      xqncl = tle->xincl;
+      d->xqncl = tle->xincl;
       xmao = tle->xmo;
       xpidot = deep_arg->omgdot+deep_arg->xnodot;
       sinq = sin(tle->xnodeo);
       cosq = cos(tle->xnodeo);
-      omegaq = tle->omegao;
+      d->omegaq = tle->omegao;
 
       /* Initialize lunar solar terms */
       day = deep_arg->ds50+18261.5;  /*Days since 1900 Jan 0.5*/
-      if (day != preep)
-    {
-      preep = day;
       xnodce = 4.5236020-9.2422029E-4*day;
       stem = sin(xnodce);
       ctem = cos(xnodce);
@@ -559,19 +721,18 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
       zcoshl = sqrt(1-zsinhl*zsinhl);
       c = 4.7199672+0.22997150*day;
       gam = 5.8351514+0.0019443680*day;
-      zmol = FMod2p(c-gam);
+      d->zmol = FMod2p(c-gam);
       zx = 0.39785416*stem/zsinil;
       zy = zcoshl*ctem+0.91744867*zsinhl*stem;
       zx = AcTan(zx,zy);
       zx = gam+zx-xnodce;
       zcosgl = cos(zx);
       zsingl = sin(zx);
-      zmos = 6.2565837+0.017201977*day;
-      zmos = FMod2p(zmos);
-    } /* End if(day != preep) */
+      d->zmos = 6.2565837+0.017201977*day;
+      d->zmos = FMod2p(d->zmos);
 
       /* Do solar terms */
-      savtsn = 1E20;
+      d->savtsn = 1E20;
       zcosg = zcosgs;
       zsing = zsings;
       zcosi = zcosis;
@@ -581,8 +742,8 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
       cc = c1ss;
       zn = zns;
       ze = zes;
-      zmo = zmos;
-      xnoi = 1/xnq;
+      zmo = d->zmos;
+      xnoi = 1/d->xnq;
 
       /* Loop breaks when Solar terms are done a second */
       /* time, after Lunar terms are initialized        */
@@ -636,40 +797,40 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
       sl = -zn*s3*(z1+z3-14-6*deep_arg->eosq);
       sgh = s4*zn*(z31+z33-6);
       sh = -zn*s2*(z21+z23);
-      if (xqncl < 5.2359877E-2) sh = 0;
-      ee2 = 2*s1*s6;
-      e3 = 2*s1*s7;
-      xi2 = 2*s2*z12;
-      xi3 = 2*s2*(z13-z11);
-      xl2 = -2*s3*z2;
-      xl3 = -2*s3*(z3-z1);
-      xl4 = -2*s3*(-21-9*deep_arg->eosq)*ze;
-      xgh2 = 2*s4*z32;
-      xgh3 = 2*s4*(z33-z31);
-      xgh4 = -18*s4*ze;
-      xh2 = -2*s2*z22;
-      xh3 = -2*s2*(z23-z21);
-
-      if(isFlagSet(LUNAR_TERMS_DONE_FLAG)) break;
+      if (d->xqncl < 5.2359877E-2) sh = 0;
+      d->ee2 = 2*s1*s6;
+      d->e3 = 2*s1*s7;
+      d->xi2 = 2*s2*z12;
+      d->xi3 = 2*s2*(z13-z11);
+      d->xl2 = -2*s3*z2;
+      d->xl3 = -2*s3*(z3-z1);
+      d->xl4 = -2*s3*(-21-9*deep_arg->eosq)*ze;
+      d->xgh2 = 2*s4*z32;
+      d->xgh3 = 2*s4*(z33-z31);
+      d->xgh4 = -18*s4*ze;
+      d->xh2 = -2*s2*z22;
+      d->xh3 = -2*s2*(z23-z21);
+
+      if(CTX_FLAG_SET(ctx, LUNAR_TERMS_DONE_FLAG)) break;
 
       /* Do lunar terms */
-      sse = se;
-      ssi = si;
-      ssl = sl;
-      ssh = sh/deep_arg->sinio;
-      ssg = sgh-deep_arg->cosio*ssh;
-      se2 = ee2;
-      si2 = xi2;
-      sl2 = xl2;
-      sgh2 = xgh2;
-      sh2 = xh2;
-      se3 = e3;
-      si3 = xi3;
-      sl3 = xl3;
-      sgh3 = xgh3;
-      sh3 = xh3;
-      sl4 = xl4;
-      sgh4 = xgh4;
+      d->sse = se;
+      d->ssi = si;
+      d->ssl = sl;
+      d->ssh = sh/deep_arg->sinio;
+      d->ssg = sgh-deep_arg->cosio*d->ssh;
+      d->se2 = d->ee2;
+      d->si2 = d->xi2;
+      d->sl2 = d->xl2;
+      d->sgh2 = d->xgh2;
+      d->sh2 = d->xh2;
+      d->se3 = d->e3;
+      d->si3 = d->xi3;
+      d->sl3 = d->xl3;
+      d->sgh3 = d->xgh3;
+      d->sh3 = d->xh3;
+      d->sl4 = d->xl4;
+      d->sgh4 = d->xgh4;
       zcosg = zcosgl;
       zsing = zsingl;
       zcosi = zcosil;
@@ -679,25 +840,25 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
       zn = znl;
       cc = c1l;
       ze = zel;
-      zmo = zmol;
-      SetFlag(LUNAR_TERMS_DONE_FLAG);
+      zmo = d->zmol;
+      CTX_SET_FLAG(ctx, LUNAR_TERMS_DONE_FLAG);
     } /* End of for(;;) */
 
-      sse = sse+se;
-      ssi = ssi+si;
-      ssl = ssl+sl;
-      ssg = ssg+sgh-deep_arg->cosio/deep_arg->sinio*sh;
-      ssh = ssh+sh/deep_arg->sinio;
+      d->sse = d->sse+se;
+      d->ssi = d->ssi+si;
+      d->ssl = d->ssl+sl;
+      d->ssg = d->ssg+sgh-deep_arg->cosio/deep_arg->sinio*sh;
+      d->ssh = d->ssh+sh/deep_arg->sinio;
 
       /* Geopotential resonance initialization for 12 hour orbits */
-      ClearFlag(RESONANCE_FLAG);
-      ClearFlag(SYNCHRONOUS_FLAG);
+      CTX_CLEAR_FLAG(ctx, RESONANCE_FLAG);
+      CTX_CLEAR_FLAG(ctx, SYNCHRONOUS_FLAG);
 
-      if( !((xnq < 0.0052359877) && (xnq > 0.0034906585)) )
+      if( !((d->xnq < 0.0052359877) && (d->xnq > 0.0034906585)) )
     {
-      if( (xnq < 0.00826) || (xnq > 0.00924) ) return;
+      if( (d->xnq < 0.00826) || (d->xnq > 0.00924) ) return;
       if (eq < 0.5) return;
-      SetFlag(RESONANCE_FLAG);
+      CTX_SET_FLAG(ctx, RESONANCE_FLAG);
       eoc = eq*deep_arg->eosq;
       g201 = -0.306-(eq-0.64)*0.440;
       if (eq <= 0.65)
@@ -773,36 +934,36 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
       f543 = 29.53125*deep_arg->sinio*(-2-8*deep_arg->cosio+
          deep_arg->theta2*(12+8*deep_arg->cosio-10*
                  deep_arg->theta2));
-      xno2 = xnq*xnq;
+      xno2 = d->xnq*d->xnq;
       ainv2 = aqnv*aqnv;
       temp1 = 3*xno2*ainv2;
       temp = temp1*root22;
-      d2201 = temp*f220*g201;
-      d2211 = temp*f221*g211;
+      d->d2201 = temp*f220*g201;
+      d->d2211 = temp*f221*g211;
       temp1 = temp1*aqnv;
       temp = temp1*root32;
-      d3210 = temp*f321*g310;
-      d3222 = temp*f322*g322;
+      d->d3210 = temp*f321*g310;
+      d->d3222 = temp*f322*g322;
       temp1 = temp1*aqnv;
       temp = 2*temp1*root44;
-      d4410 = temp*f441*g410;
-      d4422 = temp*f442*g422;
+      d->d4410 = temp*f441*g410;
+      d->d4422 = temp*f442*g422;
       temp1 = temp1*aqnv;
       temp = temp1*root52;
-      d5220 = temp*f522*g520;
-      d5232 = temp*f523*g532;
+      d->d5220 = temp*f522*g520;
+      d->d5232 = temp*f523*g532;
       temp = 2*temp1*root54;
-      d5421 = temp*f542*g521;
-      d5433 = temp*f543*g533;
-      xlamo = xmao+tle->xnodeo+tle->xnodeo-thgr-thgr;
+      d->d5421 = temp*f542*g521;
+      d->d5433 = temp*f543*g533;
+      d->xlamo = xmao+tle->xnodeo+tle->xnodeo-d->thgr-d->thgr;
       bfact = deep_arg->xmdot+deep_arg->xnodot+
                   deep_arg->xnodot-thdt-thdt;
-      bfact = bfact+ssl+ssh+ssh;
-    } /* if( !(xnq < 0.0052359877) && (xnq > 0.0034906585) ) */
+      bfact = bfact+d->ssl+d->ssh+d->ssh;
+    } /* if( !(d->xnq < 0.0052359877) && (d->xnq > 0.0034906585) ) */
       else
     {
-      SetFlag(RESONANCE_FLAG);
-      SetFlag(SYNCHRONOUS_FLAG);
+      CTX_SET_FLAG(ctx, RESONANCE_FLAG);
+      CTX_SET_FLAG(ctx, SYNCHRONOUS_FLAG);
       /* Synchronous resonance terms initialization */
       g200 = 1+deep_arg->eosq*(-2.5+0.8125*deep_arg->eosq);
       g310 = 1+2*deep_arg->eosq;
@@ -812,147 +973,131 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
              (1+3*deep_arg->cosio)-0.75*(1+deep_arg->cosio);
       f330 = 1+deep_arg->cosio;
       f330 = 1.875*f330*f330*f330;
-      del1 = 3*xnq*xnq*aqnv*aqnv;
-      del2 = 2*del1*f220*g200*q22;
-      del3 = 3*del1*f330*g300*q33*aqnv;
-      del1 = del1*f311*g310*q31*aqnv;
-      fasx2 = 0.13130908;
-      fasx4 = 2.8843198;
-      fasx6 = 0.37448087;
-      xlamo = xmao+tle->xnodeo+tle->omegao-thgr;
+      d->del1 = 3*d->xnq*d->xnq*aqnv*aqnv;
+      d->del2 = 2*d->del1*f220*g200*q22;
+      d->del3 = 3*d->del1*f330*g300*q33*aqnv;
+      d->del1 = d->del1*f311*g310*q31*aqnv;
+      d->xlamo = xmao+tle->xnodeo+tle->omegao-d->thgr;
       bfact = deep_arg->xmdot+xpidot-thdt;
-      bfact = bfact+ssl+ssg+ssh;
-    } /* End if( !(xnq < 0.0052359877) && (xnq > 0.0034906585) ) */
+      bfact = bfact+d->ssl+d->ssg+d->ssh;
+    } /* End if( !(d->xnq < 0.0052359877) && (d->xnq > 0.0034906585) ) */
 
-      xfact = bfact-xnq;
+      d->xfact = bfact-d->xnq;
 
       /* Initialize integrator */
-      xli = xlamo;
-      xni = xnq;
-      atime = 0;
-      stepp = 720;
-      stepn = -720;
-      step2 = 259200;
+      d->xli = d->xlamo;
+      d->xni = d->xnq;
+      d->atime = 0;
       /* End case dpinit: */
       return;
 
     case dpsec: /* Entrance for deep space secular effects */
-      deep_arg->xll = deep_arg->xll+ssl*deep_arg->t;
-      deep_arg->omgadf = deep_arg->omgadf+ssg*deep_arg->t;
-      deep_arg->xnode = deep_arg->xnode+ssh*deep_arg->t;
-      deep_arg->em = tle->eo+sse*deep_arg->t;
-      deep_arg->xinc = tle->xincl+ssi*deep_arg->t;
+      deep_arg->xll = deep_arg->xll+d->ssl*deep_arg->t;
+      deep_arg->omgadf = deep_arg->omgadf+d->ssg*deep_arg->t;
+      deep_arg->xnode = deep_arg->xnode+d->ssh*deep_arg->t;
+      deep_arg->em = tle->eo+d->sse*deep_arg->t;
+      deep_arg->xinc = tle->xincl+d->ssi*deep_arg->t;
       if (deep_arg->xinc < 0)
     {
       deep_arg->xinc = -deep_arg->xinc;
       deep_arg->xnode = deep_arg->xnode + pi;
       deep_arg->omgadf = deep_arg->omgadf-pi;
     }
-      if( isFlagClear(RESONANCE_FLAG) ) return;
-
-      do
-    {
-          if( (atime == 0) ||
-         ((deep_arg->t >= 0) && (atime < 0)) || 
-         ((deep_arg->t < 0) && (atime >= 0)) )
-        {
-          /* Epoch restart */
-          if( deep_arg->t >= 0 )
-        delt = stepp;
-          else
-        delt = stepn;
-
-          atime = 0;
-          xni = xnq;
-          xli = xlamo;
-        }
+      if( CTX_FLAG_CLEAR(ctx, RESONANCE_FLAG) ) return;
+
+      /* Step out from the nearest known state. The last      */
+      /* DEEP_CHECKPOINTS (four) steps taken are saved as      */
+      /* checkpoints so that going back over a step, or back   */
+      /* to where an earlier call was, does not integrate      */
+      /* again from epoch.                                     */
+      Deep_Resume(d, deep_arg->t);
+      if( deep_arg->t >= 0 )
+    delt = stepp;
       else
-        {      
-              if( fabs(deep_arg->t) >= fabs(atime) )
-        {
-          if ( deep_arg->t > 0 )
-            delt = stepp;
-          else
-            delt = stepn;
-        }
-        }
+    delt = stepn;
 
           do 
         {
-          if ( fabs(deep_arg->t-atime) >= stepp )
-        {
-          SetFlag(DO_LOOP_FLAG);
-          ClearFlag(EPOCH_RESTART_FLAG);
-        }
+          if ( fabs(deep_arg->t-d->atime) >= stepp )
+        CTX_SET_FLAG(ctx, DO_LOOP_FLAG);
           else
         {
-          ft = deep_arg->t-atime;
-          ClearFlag(DO_LOOP_FLAG);
-        }
-
-          if( fabs(deep_arg->t) < fabs(atime) )
-        {
-          if (deep_arg->t >= 0)
-            delt = stepn;
-          else
-            delt = stepp;
-          SetFlag(DO_LOOP_FLAG | EPOCH_RESTART_FLAG);
+          ft = deep_arg->t-d->atime;
+          CTX_CLEAR_FLAG(ctx, DO_LOOP_FLAG);
         }
 
           /* Dot terms calculated */
-              if( isFlagSet(SYNCHRONOUS_FLAG) )
+              if( CTX_FLAG_SET(ctx, SYNCHRONOUS_FLAG) )
         {
-          xndot = del1*sin(xli-fasx2)+del2*sin(2*(xli-fasx4))
-                  +del3*sin(3*(xli-fasx6));
-          xnddt = del1*cos(xli-fasx2)+2*del2*cos(2*(xli-fasx4))
-                  +3*del3*cos(3*(xli-fasx6));
+          SinCos(d->xli-fasx2, &sn[0], &cs[0]);
+          SinCos(2*(d->xli-fasx4), &sn[1], &cs[1]);
+          SinCos(3*(d->xli-fasx6), &sn[2], &cs[2]);
+          xndot = d->del1*sn[0]+d->del2*sn[1]+d->del3*sn[2];
+          xnddt = d->del1*cs[0]+2*d->del2*cs[1]+3*d->del3*cs[2];
         }
           else
         {
-          xomi = omegaq+deep_arg->omgdot*atime;
+          xomi = d->omegaq+deep_arg->omgdot*d->atime;
           x2omi = xomi+xomi;
-          x2li = xli+xli;
-          xndot = d2201*sin(x2omi+xli-g22)
-                  +d2211*sin(xli-g22)
-                  +d3210*sin(xomi+xli-g32)
-                  +d3222*sin(-xomi+xli-g32)
-                  +d4410*sin(x2omi+x2li-g44)
-                  +d4422*sin(x2li-g44)
-                  +d5220*sin(xomi+xli-g52)
-                  +d5232*sin(-xomi+xli-g52)
-                  +d5421*sin(xomi+x2li-g54)
-                  +d5433*sin(-xomi+x2li-g54);
-          xnddt = d2201*cos(x2omi+xli-g22)
-                  +d2211*cos(xli-g22)
-                  +d3210*cos(xomi+xli-g32)
-                  +d3222*cos(-xomi+xli-g32)
-                  +d5220*cos(xomi+xli-g52)
-                  +d5232*cos(-xomi+xli-g52)
-                  +2*(d4410*cos(x2omi+x2li-g44)
-                  +d4422*cos(x2li-g44)
-                  +d5421*cos(xomi+x2li-g54)
-                  +d5433*cos(-xomi+x2li-g54));
-        } /* End of if (isFlagSet(SYNCHRONOUS_FLAG)) */
-
-          xldot = xni+xfact;
+          x2li = d->xli+d->xli;
+          SinCos(x2omi+d->xli-g22, &sn[0], &cs[0]);
+          SinCos(d->xli-g22, &sn[1], &cs[1]);
+          SinCos(xomi+d->xli-g32, &sn[2], &cs[2]);
+          SinCos(-xomi+d->xli-g32, &sn[3], &cs[3]);
+          SinCos(x2omi+x2li-g44, &sn[4], &cs[4]);
+          SinCos(x2li-g44, &sn[5], &cs[5]);
+          SinCos(xomi+d->xli-g52, &sn[6], &cs[6]);
+          SinCos(-xomi+d->xli-g52, &sn[7], &cs[7]);
+          SinCos(xomi+x2li-g54, &sn[8], &cs[8]);
+          SinCos(-xomi+x2li-g54, &sn[9], &cs[9]);
+          xndot = d->d2201*sn[0]
+                  +d->d2211*sn[1]
+                  +d->d3210*sn[2]
+                  +d->d3222*sn[3]
+                  +d->d4410*sn[4]
+                  +d->d4422*sn[5]
+                  +d->d5220*sn[6]
+                  +d->d5232*sn[7]
+                  +d->d5421*sn[8]
+                  +d->d5433*sn[9];
+          xnddt = d->d2201*cs[0]
+                  +d->d2211*cs[1]
+                  +d->d3210*cs[2]
+                  +d->d3222*cs[3]
+                  +d->d5220*cs[6]
+                  +d->d5232*cs[7]
+                  +2*(d->d4410*cs[4]
+                  +d->d4422*cs[5]
+                  +d->d5421*cs[8]
+                  +d->d5433*cs[9]);
+        } /* End of if (CTX_FLAG_SET(ctx, SYNCHRONOUS_FLAG)) */
+
+          xldot = d->xni+d->xfact;
           xnddt = xnddt*xldot;
 
-          if(isFlagSet(DO_LOOP_FLAG))
+          if(CTX_FLAG_SET(ctx, DO_LOOP_FLAG))
         {
-          xli = xli+xldot*delt+xndot*step2;
-          xni = xni+xndot*delt+xnddt*step2;
-          atime = atime+delt;
+          d->xli = d->xli+xldot*delt+xndot*step2;
+          d->xni = d->xni+xndot*delt+xnddt*step2;
+          d->atime = d->atime+delt;
+
+          /* Keep the last two steps before t */
+          if ( fabs(deep_arg->t-d->atime) < 2*stepp )
+        {
+          d->chk[d->chk_next].atime = d->atime;
+          d->chk[d->chk_next].xni = d->xni;
+          d->chk[d->chk_next].xli = d->xli;
+          d->chk_next = (d->chk_next+1) % DEEP_CHECKPOINTS;
         }
         }
-      while(isFlagSet(DO_LOOP_FLAG) && isFlagClear(EPOCH_RESTART_FLAG));
-    }
-      while(isFlagSet(DO_LOOP_FLAG) && isFlagSet(EPOCH_RESTART_FLAG));
+        }
+      while(CTX_FLAG_SET(ctx, DO_LOOP_FLAG));
 
-      deep_arg->xn = xni+xndot*ft+xnddt*ft*ft*0.5;
-      xl = xli+xldot*ft+xndot*ft*ft*0.5;
-      temp = -deep_arg->xnode+thgr+deep_arg->t*thdt;
+      deep_arg->xn = d->xni+xndot*ft+xnddt*ft*ft*0.5;
+      xl = d->xli+xldot*ft+xndot*ft*ft*0.5;
+      temp = -deep_arg->xnode+d->thgr+deep_arg->t*thdt;
 
-      if (isFlagClear(SYNCHRONOUS_FLAG))
+      if (CTX_FLAG_CLEAR(ctx, SYNCHRONOUS_FLAG))
     deep_arg->xll = xl+temp+temp;
       else
     deep_arg->xll = xl-deep_arg->omgadf+temp;
@@ -961,64 +1106,62 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
       /*End case dpsec: */
 
     case dpper: /* Entrance for lunar-solar periodics */
-      sinis = sin(deep_arg->xinc);
-      cosis = cos(deep_arg->xinc);
-      if (fabs(savtsn-deep_arg->t) >= 30)
+      SinCos(deep_arg->xinc, &sinis, &cosis);
+      if (fabs(d->savtsn-deep_arg->t) >= 30)
     {
-      savtsn = deep_arg->t;
-      zm = zmos+zns*deep_arg->t;
+      d->savtsn = deep_arg->t;
+      zm = d->zmos+zns*deep_arg->t;
       zf = zm+2*zes*sin(zm);
-      sinzf = sin(zf);
+      SinCos(zf, &sinzf, &coszf);
       f2 = 0.5*sinzf*sinzf-0.25;
-      f3 = -0.5*sinzf*cos(zf);
-      ses = se2*f2+se3*f3;
-      sis = si2*f2+si3*f3;
-      sls = sl2*f2+sl3*f3+sl4*sinzf;
-      sghs = sgh2*f2+sgh3*f3+sgh4*sinzf;
-      shs = sh2*f2+sh3*f3;
-      zm = zmol+znl*deep_arg->t;
+      f3 = -0.5*sinzf*coszf;
+      ses = d->se2*f2+d->se3*f3;
+      sis = d->si2*f2+d->si3*f3;
+      sls = d->sl2*f2+d->sl3*f3+d->sl4*sinzf;
+      d->sghs = d->sgh2*f2+d->sgh3*f3+d->sgh4*sinzf;
+      d->shs = d->sh2*f2+d->sh3*f3;
+      zm = d->zmol+znl*deep_arg->t;
       zf = zm+2*zel*sin(zm);
-      sinzf = sin(zf);
+      SinCos(zf, &sinzf, &coszf);
       f2 = 0.5*sinzf*sinzf-0.25;
-      f3 = -0.5*sinzf*cos(zf);
-      sel = ee2*f2+e3*f3;
-      sil = xi2*f2+xi3*f3;
-      sll = xl2*f2+xl3*f3+xl4*sinzf;
-      sghl = xgh2*f2+xgh3*f3+xgh4*sinzf;
-      sh1 = xh2*f2+xh3*f3;
-      pe = ses+sel;
-      pinc = sis+sil;
-      pl = sls+sll;
+      f3 = -0.5*sinzf*coszf;
+      sel = d->ee2*f2+d->e3*f3;
+      sil = d->xi2*f2+d->xi3*f3;
+      sll = d->xl2*f2+d->xl3*f3+d->xl4*sinzf;
+      d->sghl = d->xgh2*f2+d->xgh3*f3+d->xgh4*sinzf;
+      d->sh1 = d->xh2*f2+d->xh3*f3;
+      d->pe = ses+sel;
+      d->pinc = sis+sil;
+      d->pl = sls+sll;
     }
 
-      pgh = sghs+sghl;
-      ph = shs+sh1;
-      deep_arg->xinc = deep_arg->xinc+pinc;
-      deep_arg->em = deep_arg->em+pe;
+      pgh = d->sghs+d->sghl;
+      ph = d->shs+d->sh1;
+      deep_arg->xinc = deep_arg->xinc+d->pinc;
+      deep_arg->em = deep_arg->em+d->pe;
 
-      if (xqncl >= 0.2)
+      if (d->xqncl >= 0.2)
     {
       /* Apply periodics directly */
       ph = ph/deep_arg->sinio;
       pgh = pgh-deep_arg->cosio*ph;
       deep_arg->omgadf = deep_arg->omgadf+pgh;
       deep_arg->xnode = deep_arg->xnode+ph;
-      deep_arg->xll = deep_arg->xll+pl;
+      deep_arg->xll = deep_arg->xll+d->pl;
     }
       else
         {
       /* Apply periodics with Lyddane modification */
-      sinok = sin(deep_arg->xnode);
-      cosok = cos(deep_arg->xnode);
+      SinCos(deep_arg->xnode, &sinok, &cosok);
       alfdp = sinis*sinok;
       betdp = sinis*cosok;
-      dalf = ph*cosok+pinc*cosis*sinok;
-      dbet = -ph*sinok+pinc*cosis*cosok;
+      dalf = ph*cosok+d->pinc*cosis*sinok;
+      dbet = -ph*sinok+d->pinc*cosis*cosok;
       alfdp = alfdp+dalf;
       betdp = betdp+dbet;
       deep_arg->xnode = FMod2p(deep_arg->xnode);
       xls = deep_arg->xll+deep_arg->omgadf+cosis*deep_arg->xnode;
-      dls = pl+pgh-pinc*deep_arg->xnode*sinis;
+      dls = d->pl+pgh-d->pinc*deep_arg->xnode*sinis;
       xls = xls+dls;
       xnoh = deep_arg->xnode;
       deep_arg->xnode = AcTan(alfdp,betdp);
@@ -1033,7 +1176,7 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
         deep_arg->xnode -=twopi;
         }
 
-      deep_arg->xll = deep_arg->xll+pl;
+      deep_arg->xll = deep_arg->xll+d->pl;
       deep_arg->omgadf = xls-deep_arg->xll-cos(deep_arg->xinc)*
                              deep_arg->xnode;
     } /* End case dpper: */
@@ -1048,7 +1191,12 @@ Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg)
 /* Functions for testing and setting/clearing flags */
 
 /* An int variable holding the single-bit flags */
+#ifdef SOWB_HOST
+/* See SOWB_HOST in host/Makefile. */
+static __thread int Flags = 0;
+#else
 static int Flags = 0;
+#endif
 
 int
 isFlagSet(int flag)
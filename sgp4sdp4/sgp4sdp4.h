@@ -15,6 +15,7 @@ extern "C" {
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <time.h>
 /* #include <unistd.h> */
 
@@ -74,6 +75,163 @@ typedef struct
     ds50;
 } deep_arg_t;
 
+/* Numeric modes of the near-earth model and the observer      */
+/* transforms, chosen at build time with -DSGP4_NUMERIC=...     */
+/*   SGP4_DOUBLE  everything in double, the reference.          */
+/*   SGP4_HYBRID  time and the secular terms that grow with it  */
+/*                in double, the periodics, Kepler's equation   */
+/*                and the trig in float.                        */
+/* Deep-space (SDP4) is always done in double. All in float was */
+/* tried and dropped, it is 0.07 degrees out on the ISS within  */
+/* a week, see host/bench_numeric.c.                            */
+#define SGP4_DOUBLE  0
+#define SGP4_HYBRID  1
+
+#ifndef SGP4_NUMERIC
+#define SGP4_NUMERIC SGP4_DOUBLE
+#endif
+
+#if SGP4_NUMERIC == SGP4_DOUBLE
+typedef double sgp4_real_t; /* Working precision              */
+typedef double sgp4_time_t; /* Time and secular precision     */
+#define SGP4_SIN(x)      sin(x)
+#define SGP4_COS(x)      cos(x)
+#define SGP4_SQRT(x)     sqrt(x)
+#define SGP4_FABS(x)     fabs(x)
+#define SGP4_ATAN2(y,x)  atan2(y,x)
+#define SGP4_ASIN(x)     asin(x)
+#define SGP4_SINCOS(x,s,c) SinCos(x,s,c)
+#define SGP4_ATAN(x)     ArcTan(x)
+#define SGP4_ACTAN(s,c)  AcTan(s,c)
+#define SGP4_ARCSIN(x)   ArcSin(x)
+#define SGP4_KEPLER(u,x,y,s,c) Kepler(u,x,y,s,c)
+#define SGP4_FMOD2P(x)   FMod2p(x)
+#else
+typedef float sgp4_real_t;
+typedef double sgp4_time_t;
+#define SGP4_FMOD2P(x)   ((sgp4_real_t)FMod2p(x))
+#define SGP4_SIN(x)      sinf(x)
+#define SGP4_COS(x)      cosf(x)
+#define SGP4_SQRT(x)     sqrtf(x)
+#define SGP4_FABS(x)     fabsf(x)
+#define SGP4_ATAN2(y,x)  atan2f(y,x)
+#define SGP4_ASIN(x)     asinf(x)
+#define SGP4_SINCOS(x,s,c) SinCos_f(x,s,c)
+#define SGP4_ATAN(x)     ArcTan_f(x)
+#define SGP4_ACTAN(s,c)  AcTan_f(s,c)
+#define SGP4_ARCSIN(x)   ArcSin_f(x)
+#define SGP4_KEPLER(u,x,y,s,c) Kepler_f(u,x,y,s,c)
+#endif
+
+/* Constants in working precision, so float */
+/* expressions are not promoted to double.  */
+#define SGP4_REAL(x)     ((sgp4_real_t)(x))
+
+/* A secular angle ready for the working precision trig. Only */
+/* the hybrid mode needs to reduce it while still in double.  */
+#if SGP4_NUMERIC == SGP4_HYBRID
+#define SGP4_ANGLE(x)    SGP4_FMOD2P(x)
+#else
+#define SGP4_ANGLE(x)    (x)
+#endif
+
+/* Near-earth (SGP4) initialization constants. Those */
+/* multiplying time are kept in secular precision.   */
+typedef struct
+{
+  sgp4_time_t
+    c1,c4,c5,d2,d3,d4,omgcof,omgdot,xnodp,t2cof,t3cof,
+    t4cof,t5cof,xmdot,xnodcf,xnodot;
+  sgp4_real_t
+    aodp,aycof,cosio,delmo,eta,sinio,sinmo,
+    x1mth2,x3thm1,x7thm1,xmcof,xlcof;
+} sgp4_near_t;
+
+/* Number of resonance integrator checkpoints kept per satellite */
+#ifndef DEEP_CHECKPOINTS
+#define DEEP_CHECKPOINTS 4
+#endif
+
+/* Resonance integrator state at one step, see Deep(dpsec) */
+typedef struct
+{
+  double
+    atime,xli,xni;
+} deep_checkpoint_t;
+
+/* Lunar, solar and resonance state kept by Deep() */
+typedef struct
+{
+  /* Set up by dpinit */
+  double
+    thgr,xnq,xqncl,omegaq,zmol,zmos,savtsn,ee2,e3,xi2,
+    xl2,xl3,xl4,xgh2,xgh3,xgh4,xh2,xh3,sse,ssi,ssg,xi3,
+    se2,si2,sl2,sgh2,sh2,se3,si3,sl3,sgh3,sh3,sl4,sgh4,
+    ssl,ssh,d3210,d3222,d4410,d4422,d5220,d5232,d5421,
+    d5433,del1,del2,del3,xlamo,xfact,d2201,d2211;
+  /* Resonance integrator, advanced by dpsec */
+  double
+    xni,atime,xli;
+  /* The last steps taken, oldest overwritten first */
+  deep_checkpoint_t chk[DEEP_CHECKPOINTS];
+  int chk_next;
+  /* Periodics, cached by dpper */
+  double
+    pl,pe,pinc,sghs,sghl,shs,sh1;
+} deep_state_t;
+
+/* Deep-space (SDP4) initialization constants and Deep() state */
+typedef struct
+{
+  double
+    x3thm1,c1,x1mth2,c4,xnodcf,t2cof,xlcof,aycof,x7thm1;
+  deep_arg_t   deep_arg;
+  deep_state_t deep;
+} sdp4_deep_t;
+
+/* Propagator context for one satellite, see sgp4_init() */
+typedef struct
+{
+  tle_t tle;
+  int   flags;
+  union
+  {
+    sgp4_near_t sgp4;
+    sdp4_deep_t sdp4;
+  } model;
+} sgp4_ctx_t;
+
+/* Observer frame at one instant, see Observer_Frame(). Everything */
+/* that depends only on the time and place, shared by all objects  */
+/* observed at that instant.                                       */
+typedef struct
+{
+  double
+    jd,       /* Julian date, UT */
+    gmst;     /* Greenwich mean sidereal time, radians */
+  geodetic_t
+    geodetic; /* Observer, theta is the local sidereal time */
+  vector_t
+    pos,vel;  /* Observer ECI position (km) and velocity (km/s) */
+  sgp4_real_t
+    sin_lat,cos_lat,
+    topo[3][3]; /* Rotates ECI into south, east and zenith */
+} obs_frame_t;
+
+/* Days between the solar positions kept by Solar_Position_Cached() */
+#ifndef SOLAR_CACHE_STEP
+#define SOLAR_CACHE_STEP 0.25
+#endif
+
+/* Solar positions either side of a time, see Solar_Position_Cached() */
+typedef struct
+{
+  double
+    jd;       /* Time of sol[0], 0 if empty */
+  vector_t
+    sol[2];   /* At jd and jd + SOLAR_CACHE_STEP */
+} solar_cache_t;
+
 /** Table of constant values **/
 #define de2ra    1.74532925E-2   /* Degrees to Radians */
 #define pi       3.1415926535898 /* Pi */
@@ -164,7 +322,10 @@ typedef struct
 /* sgp4sdp4.c */
 void    SGP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase);
 void    SDP4(double tsince, tle_t *tle, vector_t *pos, vector_t *vel, double* phase);
-void    Deep(int ientry, tle_t *tle, deep_arg_t *deep_arg);
+void    Deep(int ientry, sgp4_ctx_t *ctx);
+void    sgp4_init(sgp4_ctx_t *ctx, tle_t *tle);
+size_t  sgp4_ctx_size(sgp4_ctx_t *ctx);
+void    sgp4_propagate(sgp4_ctx_t *ctx, double tsince, vector_t *pos, vector_t *vel, double* phase);
 int     isFlagSet(int flag);
 int     isFlagClear(int flag);
 void    SetFlag(int flag);
@@ -175,6 +336,7 @@ int     Good_Elements(char *tle_set);
 void    Convert_Satellite_Data(char *tle_set, tle_t *tle);
 int     Get_Next_Tle_Set( char lines[3][80], tle_t *tle );
 void    select_ephemeris(tle_t *tle);
+int     Is_Deep_Space(tle_t *tle);
 /* sgp_math.c */
 int     Sign(double arg);
 double  Sqr(double arg);
@@ -194,6 +356,16 @@ void    Cross(vector_t *v1, vector_t *v2, vector_t *v3);
 void    Normalize(vector_t *v);
 double  AcTan(double sinx, double cosx);
 double  FMod2p(double x);
+void    SinCos(double x, double *s, double *c);
+double  ArcTan(double x);
+double  Kepler(double capu, double axn, double ayn,
+               double *sinepw, double *cosepw);
+void    SinCos_f(float x, float *s, float *c);
+float   ArcTan_f(float x);
+float   Kepler_f(float capu, float axn, float ayn,
+                 float *sinepw, float *cosepw);
+float   AcTan_f(float sinx, float cosx);
+float   ArcSin_f(float arg);
 double  Modulus(double arg1, double arg2);
 double  Frac(double arg);
 int     Round(double arg);
@@ -207,6 +379,11 @@ void    Calculate_Obs(double _time, vector_t *pos, vector_t *vel,
                       geodetic_t *geodetic, vector_t *obs_set);
 void    Calculate_RADec(double _time, vector_t *pos, vector_t *vel,
                         geodetic_t *geodetic, vector_t *obs_set);
+void    Observer_Frame(double _time, geodetic_t *geodetic, obs_frame_t *frame);
+void    Calculate_Obs_Frame(obs_frame_t *frame, vector_t *pos, vector_t *vel,
+                            vector_t *obs_set);
+void    Calculate_LatLonAlt_Frame(obs_frame_t *frame, vector_t *pos,
+                                  geodetic_t *geodetic);
 /* sgp_time.c */
 double  Julian_Date_of_Epoch(double epoch);
 double  Epoch_Time(double jd);
@@ -229,6 +406,7 @@ void    UTC_Calendar_Now(struct tm *cdate);
 /* solar.c */
 void    Calculate_Solar_Position(double _time, vector_t *solar_vector);
 int     Sat_Eclipsed(vector_t *pos, vector_t *sol, double *depth);
+void    Solar_Position_Cached(solar_cache_t *cache, double _time, vector_t *solar_vector);
 
 #ifdef __cplusplus
 }
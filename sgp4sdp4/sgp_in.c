@@ -212,7 +212,7 @@ Get_Next_Tle_Set( char line[3][80], tle_t *tle)
 void
 select_ephemeris(tle_t *tle)
 {
-  double ao,xnodp,dd1,dd2,delo,temp,a1,del1,r1;
+  double temp;
 
   /* Preprocess tle set */
   tle->xnodeo *= de2ra;
@@ -225,6 +225,25 @@ select_ephemeris(tle_t *tle)
   tle->xndd6o = tle->xndd6o*temp/xmnpda;
   tle->bstar /= ae;
 
+  /* Select a deep-space/near-earth ephemeris */
+  if (Is_Deep_Space(tle))
+    SetFlag(DEEP_SPACE_EPHEM_FLAG);
+  else
+    ClearFlag(DEEP_SPACE_EPHEM_FLAG);
+
+  return;
+} /* End of select_ephemeris() */
+
+/*------------------------------------------------------------------*/
+
+/* Returns 1 if the elements in a tle set already processed */
+/* by select_ephemeris() need the deep-space (SDP4) model,  */
+/* i.e. the period is 225 minutes or more, else returns 0.  */
+int
+Is_Deep_Space(tle_t *tle)
+{
+  double ao,xnodp,dd1,dd2,delo,temp,a1,del1,r1;
+
   /* Period > 225 minutes is deep space */
   dd1 = (xke/tle->xno);
   dd2 = tothrd;
@@ -238,14 +257,8 @@ select_ephemeris(tle_t *tle)
   delo = temp/(ao*ao);
   xnodp = tle->xno/(delo+1.0);
 
-  /* Select a deep-space/near-earth ephemeris */
-  if (twopi/xnodp/xmnpda >= .15625)
-    SetFlag(DEEP_SPACE_EPHEM_FLAG);
-  else
-    ClearFlag(DEEP_SPACE_EPHEM_FLAG);
-
-  return;
-} /* End of select_ephemeris() */
+  return (twopi/xnodp/xmnpda >= .15625);
+} /* End of Is_Deep_Space() */
 
 /*------------------------------------------------------------------*/
 
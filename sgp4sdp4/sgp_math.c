@@ -11,6 +11,17 @@
 
 #include "sgp4sdp4.h"
 
+/* Two part pi/2 and 2pi for range reduction. The high parts */
+/* have few enough bits that multiples of them are exact.    */
+#define PIO2_HI       1.57079632673412561417e+00
+#define PIO2_LO       6.07710050650619224932e-11
+#define TWOPI_HI      6.28318530693650245667e+00
+#define TWOPI_LO      2.43084020260247689973e-10
+
+/* Largest arguments reduced inline, beyond which libm is used */
+#define KERN_MAX_ARG    1.0E5
+#define KERN_MAX_ARG_F  8.0E3
+
 /* Returns sign of a double */
 int
 Sign(double arg)
@@ -68,7 +79,7 @@ ArcSin(double arg)
   if( fabs(arg) >= 1 )
     return( Sign(arg)*pio2 );
   else
-    return( atan(arg/sqrt(1-arg*arg)) );
+    return( ArcTan(arg/sqrt(1-arg*arg)) );
 } /*Function ArcSin*/
 
 /*------------------------------------------------------------------*/
@@ -200,28 +211,34 @@ AcTan(double sinx, double cosx)
       if(cosx > 0)
     {
       if(sinx > 0)
-        return ( atan(sinx/cosx) );
+        return ( ArcTan(sinx/cosx) );
       else
-        return ( twopi + atan(sinx/cosx) );
+        return ( twopi + ArcTan(sinx/cosx) );
     }
       else
-    return ( pi + atan(sinx/cosx) );
+    return ( pi + ArcTan(sinx/cosx) );
     }
 
 } /* Function AcTan */
 
 /*------------------------------------------------------------------*/
 
-/* Returns mod 2pi of argument */
+/* Returns mod 2pi of argument. The reduction uses a two part */
+/* 2pi so large angles, such as the mean anomaly days after   */
+/* epoch, keep their precision.                               */
 double
 FMod2p(double x)
 {
   int i;
   double ret_val;
 
-  ret_val = x;
-  i = ret_val/twopi;
-  ret_val -= i*twopi;
+  if( fabs(x) < KERN_MAX_ARG )
+    {
+      i = x*(1/(TWOPI_HI+TWOPI_LO));
+      ret_val = (x - i*TWOPI_HI) - i*TWOPI_LO;
+    }
+  else
+    ret_val = fmod(x, twopi);
   if (ret_val < 0) ret_val += twopi;
 
   return (ret_val);
@@ -229,6 +246,264 @@ FMod2p(double x)
 
 /*------------------------------------------------------------------*/
 
+/* Math kernel for the propagators and observer transforms.    */
+/* The argument is reduced inline to within pi/4 (Cody & Waite) */
+/* and the polynomials are those of fdlibm for double and of   */
+/* Cephes for float. Both stay within a few ulp of libm while  */
+/* saving its general purpose checks, and SinCos() shares one  */
+/* reduction between sine and cosine. Build with SGP4_LIBM     */
+/* defined to use libm instead, for comparison.                */
+
+/* Returns the sine and cosine of x in s and c */
+void
+SinCos(double x, double *s, double *c)
+{
+#ifndef SGP4_LIBM
+  double r,z,sr,cr;
+  int q;
+
+  if( fabs(x) < KERN_MAX_ARG )
+    {
+      q = (int)(x*(1/(PIO2_HI+PIO2_LO)) + (x < 0 ? -0.5 : 0.5));
+      r = (x - q*PIO2_HI) - q*PIO2_LO;
+      z = r*r;
+      sr = r + r*z*(-1.66666666666666324348e-01+z*(8.33333333332248946124e-03+
+           z*(-1.98412698298579493134e-04+z*(2.75573137070700676789e-06+
+           z*(-2.50507602534068634195e-08+z*1.58969099521155010221e-10)))));
+      cr = 1 - 0.5*z + z*z*(4.16666666666666019037e-02+z*(-1.38888888888741095749e-03+
+           z*(2.48015872894767294178e-05+z*(-2.75573143513906633035e-07+
+           z*(2.08757232129817482790e-09+z*-1.13596475577881948265e-11)))));
+      switch( q & 3 )
+    {
+    case 0: *s =  sr; *c =  cr; break;
+    case 1: *s =  cr; *c = -sr; break;
+    case 2: *s = -sr; *c = -cr; break;
+    default: *s = -cr; *c =  sr; break;
+    }
+      return;
+    }
+#endif
+  *s = sin(x);
+  *c = cos(x);
+} /* Procedure SinCos */
+
+/*------------------------------------------------------------------*/
+
+/* Returns the arctangent of x */
+double
+ArcTan(double x)
+{
+#ifndef SGP4_LIBM
+  static const double atanhi[] = {
+    4.63647609000806093515e-01, 7.85398163397448278999e-01,
+    9.82793723247329054082e-01, 1.57079632679489655800e+00 };
+  static const double atanlo[] = {
+    2.26987774529616870924e-17, 3.06161699786838301793e-17,
+    1.39033110312309984516e-17, 6.12323399573676603587e-17 };
+  double t,z,w,s1,s2;
+  int id;
+
+  t = fabs(x);
+  if( t < 0.4375 )
+    id = -1;
+  else if( t < 0.6875 )
+    {
+      id = 0;
+      t = (2*t-1)/(2+t);
+    }
+  else if( t < 1.1875 )
+    {
+      id = 1;
+      t = (t-1)/(t+1);
+    }
+  else if( t < 2.4375 )
+    {
+      id = 2;
+      t = (t-1.5)/(1+1.5*t);
+    }
+  else
+    {
+      id = 3;
+      t = -1/t;
+    }
+  z = t*t;
+  w = z*z;
+  s1 = z*(3.33333333333329318027e-01+w*(1.42857142725034663711e-01+
+       w*(9.09088713343650656196e-02+w*(6.66107313738753120669e-02+
+       w*(4.97687799461593236017e-02+w*1.62858201153657823623e-02)))));
+  s2 = w*(-1.99999999998764832476e-01+w*(-1.11111104054623557880e-01+
+       w*(-7.69187620504482999495e-02+w*(-5.83357013379057348645e-02+
+       w*-3.65315727442169155270e-02))));
+  if( id < 0 )
+    return( x - x*(s1+s2) );
+  z = atanhi[id] - ((t*(s1+s2) - atanlo[id]) - t);
+  return( x < 0 ? -z : z );
+#else
+  return( atan(x) );
+#endif
+} /* Function ArcTan */
+
+/*------------------------------------------------------------------*/
+
+/* Solves Kepler's equation in the form used by SGP4 and SDP4,    */
+/*   capu = epw - axn*sin(epw) + ayn*cos(epw)                     */
+/* by Newton's method with a second order (Halley) correction,    */
+/* starting from capu. It stops as soon as a step is within e6a,  */
+/* usually after two passes for near circular orbits, and has a   */
+/* limit of ten. Returns epw and sets sinepw and cosepw to its    */
+/* sine and cosine.                                               */
+double
+Kepler(double capu, double axn, double ayn,
+       double *sinepw, double *cosepw)
+{
+  double epw,s,c,f,fdot,fddot,delta;
+  int i;
+
+  epw = capu;
+  i = 0;
+  do
+    {
+      SinCos(epw, &s, &c);
+      f = epw - axn*s + ayn*c - capu;
+      fdot = 1 - axn*c - ayn*s;
+      fddot = axn*s - ayn*c;
+      delta = f*fdot/(fdot*fdot - 0.5*f*fddot);
+      if( fabs(delta) > 0.95 )
+        delta = delta > 0 ? 0.95 : -0.95;
+      epw -= delta;
+    }
+  while( fabs(delta) > e6a && ++i < 10 );
+
+  /* Carry the sine and cosine over the last, small, step */
+  *sinepw = s - delta*c;
+  *cosepw = c + delta*s;
+
+  return( epw );
+} /* Function Kepler */
+
+/*------------------------------------------------------------------*/
+
+/* Single precision versions of the above for the float */
+/* and hybrid numeric modes, see sgp4sdp4.h             */
+void
+SinCos_f(float x, float *s, float *c)
+{
+#ifndef SGP4_LIBM
+  float r,z,sr,cr;
+  int q;
+
+  if( fabsf(x) < (float)KERN_MAX_ARG_F )
+    {
+      q = (int)(x*(float)(1/(PIO2_HI+PIO2_LO)) + (x < 0 ? -0.5f : 0.5f));
+      r = ((x - q*1.5703125f) - q*4.837512969970703125e-4f) - q*7.54978995489188216e-8f;
+      z = r*r;
+      sr = ((-1.9515295891e-4f*z + 8.3321608736e-3f)*z - 1.6666654611e-1f)*z*r + r;
+      cr = ((2.443315711809948e-5f*z - 1.388731625493765e-3f)*z + 4.166664568298827e-2f)*z*z - 0.5f*z + 1;
+      switch( q & 3 )
+    {
+    case 0: *s =  sr; *c =  cr; break;
+    case 1: *s =  cr; *c = -sr; break;
+    case 2: *s = -sr; *c = -cr; break;
+    default: *s = -cr; *c =  sr; break;
+    }
+      return;
+    }
+#endif
+  *s = sinf(x);
+  *c = cosf(x);
+} /* Procedure SinCos_f */
+
+/*------------------------------------------------------------------*/
+
+float
+ArcTan_f(float x)
+{
+#ifndef SGP4_LIBM
+  float t,y,z;
+
+  t = fabsf(x);
+  if( t > 2.414213562373095f )
+    {
+      y = (float)pio2;
+      t = -1/t;
+    }
+  else if( t > 0.4142135623730950f )
+    {
+      y = (float)(pio2/2);
+      t = (t-1)/(t+1);
+    }
+  else
+    y = 0;
+  z = t*t;
+  y += (((8.05374449538e-2f*z - 1.38776856032e-1f)*z + 1.99777106478e-1f)*z
+         - 3.33329491539e-1f)*z*t + t;
+  return( x < 0 ? -y : y );
+#else
+  return( atanf(x) );
+#endif
+} /* Function ArcTan_f */
+
+/*------------------------------------------------------------------*/
+
+float
+Kepler_f(float capu, float axn, float ayn,
+         float *sinepw, float *cosepw)
+{
+  float epw,s,c,f,fdot,fddot,delta;
+  int i;
+
+  epw = capu;
+  i = 0;
+  do
+    {
+      SinCos_f(epw, &s, &c);
+      f = epw - axn*s + ayn*c - capu;
+      fdot = 1 - axn*c - ayn*s;
+      fddot = axn*s - ayn*c;
+      delta = f*fdot/(fdot*fdot - 0.5f*f*fddot);
+      if( fabsf(delta) > 0.95f )
+        delta = delta > 0 ? 0.95f : -0.95f;
+      epw -= delta;
+    }
+  while( fabsf(delta) > (float)e6a && ++i < 10 );
+
+  *sinepw = s - delta*c;
+  *cosepw = c + delta*s;
+
+  return( epw );
+} /* Function Kepler_f */
+
+/*------------------------------------------------------------------*/
+
+float
+AcTan_f(float sinx, float cosx)
+{
+  if(cosx == 0)
+    return( sinx > 0 ? (float)pio2 : (float)x3pio2 );
+  else if(cosx > 0)
+    {
+      if(sinx > 0)
+        return( ArcTan_f(sinx/cosx) );
+      else
+        return( (float)twopi + ArcTan_f(sinx/cosx) );
+    }
+  else
+    return( (float)pi + ArcTan_f(sinx/cosx) );
+} /* AcTan_f */
+
+/*------------------------------------------------------------------*/
+
+float
+ArcSin_f(float arg)
+{
+  if( fabsf(arg) >= 1 )
+    return( Sign(arg)*(float)pio2 );
+  else
+    return( ArcTan_f(arg/sqrtf(1-arg*arg)) );
+} /* ArcSin_f */
+
+/*------------------------------------------------------------------*/
+
 /* Returns arg1 mod arg2 */
 double
 Modulus(double arg1, double arg2)
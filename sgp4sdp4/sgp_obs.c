@@ -11,6 +11,61 @@
 
 #include "sgp4sdp4.h"
 
+/* Procedure Observer_Frame sets up everything about the observer */
+/* at time _time that the observations need: the sidereal time,    */
+/* the observer's ECI position and velocity and the rotation into  */
+/* the topocentric frame. Build it once per instant and pass it to */
+/* Calculate_Obs_Frame and Calculate_LatLonAlt_Frame for each      */
+/* object. The observer's theta is set to the local sidereal time. */
+/* Apart from the sidereal time it is done in SGP4_NUMERIC         */
+/* precision.                                                      */
+void
+Observer_Frame(double _time, geodetic_t *geodetic, obs_frame_t *frame)
+{
+/* Reference:  The 1992 Astronomical Almanac, page K11. */
+
+  sgp4_real_t c,sq,achcp,lat,alt,theta,sin_lat,cos_lat,
+              sin_theta,cos_theta,x,y;
+
+  frame->jd = _time;
+  frame->gmst = ThetaG_JD(_time);
+  geodetic->theta = FMod2p(frame->gmst + geodetic->lon);/*LMST*/
+  frame->geodetic = *geodetic;
+
+  theta = (sgp4_real_t)geodetic->theta;
+  lat = (sgp4_real_t)geodetic->lat;
+  alt = (sgp4_real_t)geodetic->alt;
+  SGP4_SINCOS(lat, &sin_lat, &cos_lat);
+  SGP4_SINCOS(theta, &sin_theta, &cos_theta);
+  c = 1/SGP4_SQRT(1 + SGP4_REAL(__f)*(SGP4_REAL(__f) - 2)*(sin_lat*sin_lat));
+  sq = (1 - SGP4_REAL(__f))*(1 - SGP4_REAL(__f))*c;
+  achcp = (SGP4_REAL(xkmper)*c + alt)*cos_lat;
+  x = achcp*cos_theta;
+  y = achcp*sin_theta;
+  frame->pos.x = x;/*kilometers*/
+  frame->pos.y = y;
+  frame->pos.z = (SGP4_REAL(xkmper)*sq + alt)*sin_lat;
+  frame->vel.x = -SGP4_REAL(mfactor)*y;/*kilometers/second*/
+  frame->vel.y =  SGP4_REAL(mfactor)*x;
+  frame->vel.z =  0;
+  SgpMagnitude(&frame->pos);
+  SgpMagnitude(&frame->vel);
+
+  frame->sin_lat = sin_lat;
+  frame->cos_lat = cos_lat;
+  frame->topo[0][0] =  sin_lat*cos_theta;  /*South*/
+  frame->topo[0][1] =  sin_lat*sin_theta;
+  frame->topo[0][2] = -cos_lat;
+  frame->topo[1][0] = -sin_theta;          /*East*/
+  frame->topo[1][1] =  cos_theta;
+  frame->topo[1][2] =  0;
+  frame->topo[2][0] =  cos_lat*cos_theta;  /*Zenith*/
+  frame->topo[2][1] =  cos_lat*sin_theta;
+  frame->topo[2][2] =  sin_lat;
+} /*Procedure Observer_Frame*/
+
+/*------------------------------------------------------------------*/
+
 /* Procedure Calculate_User_PosVel passes the user's geodetic position */
 /* and the time of interest and returns the ECI position and velocity  */
 /* of the observer. The velocity calculation assumes the geodetic      */
@@ -21,22 +76,11 @@ Calculate_User_PosVel(double _time,
                       vector_t *obs_pos,
                       vector_t *obs_vel)
 {
-/* Reference:  The 1992 Astronomical Almanac, page K11. */
+  obs_frame_t frame;
 
-  double c,sq,achcp;
-
-  geodetic->theta = FMod2p(ThetaG_JD(_time) + geodetic->lon);/*LMST*/
-  c = 1/sqrt(1 + __f*(__f - 2)*Sqr(sin(geodetic->lat)));
-  sq = Sqr(1 - __f)*c;
-  achcp = (xkmper*c + geodetic->alt)*cos(geodetic->lat);
-  obs_pos->x = achcp*cos(geodetic->theta);/*kilometers*/
-  obs_pos->y = achcp*sin(geodetic->theta);
-  obs_pos->z = (xkmper*sq + geodetic->alt)*sin(geodetic->lat);
-  obs_vel->x = -mfactor*obs_pos->y;/*kilometers/second*/
-  obs_vel->y =  mfactor*obs_pos->x;
-  obs_vel->z =  0;
-  SgpMagnitude(obs_pos);
-  SgpMagnitude(obs_vel);
+  Observer_Frame(_time, geodetic, &frame);
+  *obs_pos = frame.pos;
+  *obs_vel = frame.vel;
 } /*Procedure Calculate_User_PosVel*/
 
 /*------------------------------------------------------------------*/
@@ -46,15 +90,17 @@ Calculate_User_PosVel(double _time,
 /* It is intended to be used to determine the ground track of */
 /* a satellite.  The calculations  assume the earth to be an  */
 /* oblate spheroid as defined in WGS '72.                     */
-void
-Calculate_LatLonAlt(double _time, vector_t *pos,  geodetic_t *geodetic)
+/* Calculate_LatLonAlt_Frame takes the sidereal time from an  */
+/* observer frame instead of working it out again.            */
+static void
+LatLonAlt(double gmst, vector_t *pos,  geodetic_t *geodetic)
 {
   /* Reference:  The 1992 Astronomical Almanac, page K12. */
 
   double r,e2,phi,c;
 
   geodetic->theta = AcTan(pos->y,pos->x);/*radians*/
-  geodetic->lon = FMod2p(geodetic->theta - ThetaG_JD(_time));/*radians*/
+  geodetic->lon = FMod2p(geodetic->theta - gmst);/*radians*/
   r = sqrt(Sqr(pos->x) + Sqr(pos->y));
   e2 = __f*(2 - __f);
   geodetic->lat = AcTan(pos->z,r);/*radians*/
@@ -71,8 +117,20 @@ Calculate_LatLonAlt(double _time, vector_t *pos,  geodetic_t *geodetic)
 
   if( geodetic->lat > pio2 ) geodetic->lat -= twopi;
   
+} /*Procedure LatLonAlt*/
+
+void
+Calculate_LatLonAlt(double _time, vector_t *pos,  geodetic_t *geodetic)
+{
+  LatLonAlt(ThetaG_JD(_time), pos, geodetic);
 } /*Procedure Calculate_LatLonAlt*/
 
+void
+Calculate_LatLonAlt_Frame(obs_frame_t *frame, vector_t *pos,  geodetic_t *geodetic)
+{
+  LatLonAlt(frame->gmst, pos, geodetic);
+} /*Procedure Calculate_LatLonAlt_Frame*/
+
 /*------------------------------------------------------------------*/
 
 /* The procedures Calculate_Obs and Calculate_RADec calculate         */
@@ -91,64 +149,61 @@ Calculate_LatLonAlt(double _time, vector_t *pos,  geodetic_t *geodetic)
 /* based on *topocentric* position using the WGS '72 geoid and        */
 /* incorporating atmospheric refraction.                              */
 
+/* Calculate_Obs_Frame is Calculate_Obs for an observer frame built   */
+/* by Observer_Frame, for when many objects are observed at once.     */
+/* Both are done in SGP4_NUMERIC precision.                           */
+
 void
-Calculate_Obs(double _time,
-                vector_t *pos,
-                vector_t *vel,
-                geodetic_t *geodetic,
-                vector_t *obs_set)
+Calculate_Obs_Frame(obs_frame_t *frame,
+                    vector_t *pos,
+                    vector_t *vel,
+                    vector_t *obs_set)
   {
-   double
-     sin_lat,cos_lat,
-     sin_theta,cos_theta,
-     el,azim,
-     top_s,top_e,top_z;
-
-   vector_t
-     obs_pos,obs_vel,range,rgvel;
-
-  Calculate_User_PosVel(_time, geodetic, &obs_pos, &obs_vel);
-
-    range.x = pos->x - obs_pos.x;
-    range.y = pos->y - obs_pos.y;
-    range.z = pos->z - obs_pos.z;
-
-    rgvel.x = vel->x - obs_vel.x;
-    rgvel.y = vel->y - obs_vel.y;
-    rgvel.z = vel->z - obs_vel.z;
-
-  SgpMagnitude(&range);
-
-  sin_lat = sin(geodetic->lat);
-  cos_lat = cos(geodetic->lat);
-  sin_theta = sin(geodetic->theta);
-  cos_theta = cos(geodetic->theta);
-  top_s = sin_lat*cos_theta*range.x
-         + sin_lat*sin_theta*range.y
-         - cos_lat*range.z;
-  top_e = -sin_theta*range.x
-         + cos_theta*range.y;
-  top_z = cos_lat*cos_theta*range.x
-         + cos_lat*sin_theta*range.y
-         + sin_lat*range.z;
-  azim = atan(-top_e/top_s); /*Azimuth*/
+   sgp4_real_t
+     el,azim,deg,refr,sin_refr,cos_refr,
+     top_s,top_e,top_z,
+     range_x,range_y,range_z,range_w,
+     rgvel_x,rgvel_y,rgvel_z;
+
+    range_x = (sgp4_real_t)pos->x - (sgp4_real_t)frame->pos.x;
+    range_y = (sgp4_real_t)pos->y - (sgp4_real_t)frame->pos.y;
+    range_z = (sgp4_real_t)pos->z - (sgp4_real_t)frame->pos.z;
+
+    rgvel_x = (sgp4_real_t)vel->x - (sgp4_real_t)frame->vel.x;
+    rgvel_y = (sgp4_real_t)vel->y - (sgp4_real_t)frame->vel.y;
+    rgvel_z = (sgp4_real_t)vel->z - (sgp4_real_t)frame->vel.z;
+
+  range_w = SGP4_SQRT(range_x*range_x + range_y*range_y + range_z*range_z);
+
+  top_s = frame->topo[0][0]*range_x
+         + frame->topo[0][1]*range_y
+         + frame->topo[0][2]*range_z;
+  top_e = frame->topo[1][0]*range_x
+         + frame->topo[1][1]*range_y;
+  top_z = frame->topo[2][0]*range_x
+         + frame->topo[2][1]*range_y
+         + frame->topo[2][2]*range_z;
+  azim = SGP4_ATAN(-top_e/top_s); /*Azimuth*/
   if( top_s > 0 ) 
-    azim = azim + pi;
+    azim = azim + SGP4_REAL(pi);
   if( azim < 0 )
-    azim = azim + twopi;
-  el = ArcSin(top_z/range.w);
+    azim = azim + SGP4_REAL(twopi);
+  el = SGP4_ARCSIN(top_z/range_w);
   obs_set->x = azim;      /* Azimuth (radians)  */
   obs_set->y = el;        /* Elevation (radians)*/
-  obs_set->z = range.w; /* Range (kilometers) */
+  obs_set->z = range_w; /* Range (kilometers) */
 
  /*Range Rate (kilometers/second)*/
-  obs_set->w = Dot(&range, &rgvel)/range.w;
+  obs_set->w = (range_x*rgvel_x + range_y*rgvel_y + range_z*rgvel_z)/range_w;
 
 /* Corrections for atmospheric refraction */
 /* Reference:  Astronomical Algorithms by Jean Meeus, pp. 101-104    */
 /* Correction is meaningless when apparent elevation is below horizon */
-  obs_set->y = obs_set->y + Radians((1.02/tan(Radians(Degrees(el)+
-               10.3/(Degrees(el)+5.11))))/60);
+  deg = el/SGP4_REAL(de2ra);
+  SGP4_SINCOS((deg+SGP4_REAL(10.3)/(deg+SGP4_REAL(5.11)))*SGP4_REAL(de2ra),
+              &sin_refr, &cos_refr);
+  refr = (SGP4_REAL(1.02)*cos_refr/sin_refr)/60;
+  obs_set->y = el + refr*SGP4_REAL(de2ra);
   if( obs_set->y >= 0 )
     SetFlag(VISIBLE_FLAG);
   else
@@ -156,6 +211,20 @@ Calculate_Obs(double _time,
     obs_set->y = el;  /*Reset to true elevation*/
     ClearFlag(VISIBLE_FLAG);
     } /*else*/
+  } /*Procedure Calculate_Obs_Frame*/
+
+void
+Calculate_Obs(double _time,
+                vector_t *pos,
+                vector_t *vel,
+                geodetic_t *geodetic,
+                vector_t *obs_set)
+  {
+   obs_frame_t
+     frame;
+
+  Observer_Frame(_time, geodetic, &frame);
+  Calculate_Obs_Frame(&frame, pos, vel, obs_set);
   } /*Procedure Calculate_Obs*/
 
 /*------------------------------------------------------------------*/
@@ -182,7 +251,7 @@ double
     az = obs_set->x;
     el = obs_set->y;
     phi   = geodetic->lat;
-    theta = FMod2p(ThetaG_JD(_time) + geodetic->lon);
+    theta = geodetic->theta; /* LMST, set by Calculate_Obs */
     sin_theta = sin(theta);
     cos_theta = cos(theta);
     sin_phi = sin(phi);
@@ -67,3 +67,33 @@ Sat_Eclipsed(vector_t *pos, vector_t *sol, double *depth)
 } /*Function Sat_Eclipsed*/
 
 /*------------------------------------------------------------------*/
+
+/* Calculates solar position vector by interpolating linearly     */
+/* between positions SOLAR_CACHE_STEP days apart, kept in *cache. */
+/* The sun moves about a degree a day, so the chord differs from  */
+/* the arc by far less than the solar radius.                     */
+void
+Solar_Position_Cached(solar_cache_t *cache, double _time, vector_t *solar_vector)
+{
+  double jd,f;
+
+  jd = floor(_time/SOLAR_CACHE_STEP)*SOLAR_CACHE_STEP;
+  if( jd != cache->jd )
+    {
+      /* Stepping on by one interval keeps the later position */
+      if( jd == cache->jd + SOLAR_CACHE_STEP )
+        cache->sol[0] = cache->sol[1];
+      else
+        Calculate_Solar_Position(jd, &cache->sol[0]);
+      Calculate_Solar_Position(jd + SOLAR_CACHE_STEP, &cache->sol[1]);
+      cache->jd = jd;
+    }
+
+  f = (_time - jd)/SOLAR_CACHE_STEP;
+  solar_vector->x = cache->sol[0].x + f*(cache->sol[1].x - cache->sol[0].x);
+  solar_vector->y = cache->sol[0].y + f*(cache->sol[1].y - cache->sol[0].y);
+  solar_vector->z = cache->sol[0].z + f*(cache->sol[1].z - cache->sol[0].z);
+  SgpMagnitude(solar_vector);
+} /*Procedure Solar_Position_Cached*/
+
+/*------------------------------------------------------------------*/
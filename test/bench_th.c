@@ -0,0 +1,425 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#include "sowb.h"
+#include "user.h"
+#include "sgp4sdp4.h"
+#include "satapi.h"
+#include "gps.h"
+#include "debug.h"
+#include "star.h"
+#include "bench_th.h"
+
+#ifdef BENCH_TH_RUN
+
+/* Number of samples and spacing (seconds) used by the benchmarks, 
+   the same as the coarse scan satapi_aos() does. */
+#define BENCH_TH_SAMPLES    90
+#define BENCH_TH_INTERVAL   60
+
+/** bench_th_cycles_start
+ *
+ * Enable and reset the Cortex-M3 DWT cycle counter.
+ */
+static void bench_th_cycles_start(void) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/** bench_th_cycles
+ *
+ * @return uint32_t The core cycles since bench_th_cycles_start().
+ */
+static uint32_t bench_th_cycles(void) {
+    return DWT->CYCCNT;
+}
+
+/** bench_th_setup
+ *
+ * Fill in a fixed TLE, time and place so results do not depend
+ * on the GPS having a fix.
+ *
+ * @param SAT_POS_DATA * A pointer to the data structure to fill.
+ */
+static void bench_th_setup(SAT_POS_DATA *q) {
+    memset(q, 0, sizeof(SAT_POS_DATA));
+    strcpy(q->elements[0], "ISS (ZARYA)");
+    strcpy(q->elements[1], "1 25544U 98067A   10278.19511664  .00012217  00000-0  97221-4 0   147");
+    strcpy(q->elements[2], "2 25544 051.6473 027.7875 0007506 064.6316 006.5147 15.71651651680777");
+    q->time.year = 2010; q->time.month = 10; q->time.day = 5; 
+    q->time.hour = 18; q->time.minute = 0; q->time.second = 0;
+    q->time.is_valid = 1;
+    q->location.north_south = 'N'; q->location.latitude  = 56.1920;
+    q->location.east_west   = 'W'; q->location.longitude = 3.0339;
+    q->location.height = 100.;
+    q->location.is_valid = '1';
+}
+
+/** bench_th_satapi_load
+ *
+ * Time a pass-search sized run of satallite_calculate() calls, 
+ * first re-loading the TLE for every sample (as was done before
+ * satellite handles) and then loading it once only.
+ */
+void bench_th_satapi_load(void) {
+    static SAT_POS_DATA q;
+    char buf[128];
+    uint32_t reload, once;
+    int i;
+    
+    bench_th_setup(&q);
+    
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        q.tsince = i * BENCH_TH_INTERVAL;
+        q.sat.is_valid = 0;
+        satallite_calculate(&q);
+    }
+    reload = bench_th_cycles();
+    
+    q.sat.is_valid = 0;
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        q.tsince = i * BENCH_TH_INTERVAL;
+        satallite_calculate(&q);
+    }
+    once = bench_th_cycles();
+    
+    sprintf(buf, "BENCH satapi reload per sample: %lu cycles/sample\r\n", (unsigned long)(reload / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    sprintf(buf, "BENCH satapi load once        : %lu cycles/sample\r\n", (unsigned long)(once / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    sprintf(buf, "BENCH satapi speed-up x%.2f\r\n", (double)reload / (double)once);
+    debug_printf("%s", buf);
+}
+
+/** bench_th_numeric
+ *
+ * Time sgp4_propagate() and Calculate_Obs() in the SGP4_NUMERIC 
+ * mode the firmware was built with. The accuracy of each mode is
+ * measured against double by host/bench_numeric.c as it needs a 
+ * double build to compare with.
+ */
+void bench_th_numeric(void) {
+    static SAT_POS_DATA q;
+    static const char *mode[] = { "double", "hybrid" };
+    char buf[128];
+    vector_t pos, vel, obs_set;
+    geodetic_t obs_geodetic;
+    double tsince, phase, jd;
+    uint32_t prop = 0, obs = 0, start;
+    int i;
+    
+    bench_th_setup(&q);
+    if (satapi_load(&q.sat, q.elements) != 0) return;
+    
+    obs_geodetic.lat   = Radians(q.location.latitude);
+    obs_geodetic.lon   = -Radians(q.location.longitude);
+    obs_geodetic.alt   = q.location.height / 1000.;
+    obs_geodetic.theta = 0.;
+    
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        tsince = (i * BENCH_TH_INTERVAL) / 60.;
+        jd = q.sat.jd_epoch + tsince / xmnpda;
+        start = bench_th_cycles();
+        sgp4_propagate(&q.sat.ctx, tsince, &pos, &vel, &phase);
+        prop += bench_th_cycles() - start;
+        Convert_Sat_State(&pos, &vel);
+        start = bench_th_cycles();
+        Calculate_Obs(jd, &pos, &vel, &obs_geodetic, &obs_set);
+        obs += bench_th_cycles() - start;
+    }
+    
+    sprintf(buf, "BENCH SGP4_NUMERIC %s\r\n", mode[SGP4_NUMERIC]);
+    debug_printf("%s", buf);
+    sprintf(buf, "BENCH sgp4_propagate : %lu cycles/call\r\n", (unsigned long)(prop / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    sprintf(buf, "BENCH Calculate_Obs  : %lu cycles/call\r\n", (unsigned long)(obs / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+}
+
+/** bench_th_math
+ *
+ * Time the math kernel in sgp_math.c against the C library and 
+ * then a whole satellite sample. For the speed-up per sample run
+ * it again in a build with SGP4_LIBM defined, which makes the 
+ * kernel call the C library.
+ */
+void bench_th_math(void) {
+    static SAT_POS_DATA q;
+    char buf[128];
+    volatile double sink = 0.;
+    double x, s, c;
+    uint32_t libm, kern;
+    int i;
+    
+    bench_th_cycles_start();
+    for (i = 0, x = -10.; i < BENCH_TH_SAMPLES; i++, x += 0.23) sink += sin(x) + cos(x);
+    libm = bench_th_cycles();
+    bench_th_cycles_start();
+    for (i = 0, x = -10.; i < BENCH_TH_SAMPLES; i++, x += 0.23) { SinCos(x, &s, &c); sink += s + c; }
+    kern = bench_th_cycles();
+    sprintf(buf, "BENCH sin+cos %lu, SinCos %lu cycles/call\r\n", 
+        (unsigned long)(libm / BENCH_TH_SAMPLES), (unsigned long)(kern / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    
+    bench_th_cycles_start();
+    for (i = 0, x = -10.; i < BENCH_TH_SAMPLES; i++, x += 0.23) sink += atan(x);
+    libm = bench_th_cycles();
+    bench_th_cycles_start();
+    for (i = 0, x = -10.; i < BENCH_TH_SAMPLES; i++, x += 0.23) sink += ArcTan(x);
+    kern = bench_th_cycles();
+    sprintf(buf, "BENCH atan %lu, ArcTan %lu cycles/call\r\n", 
+        (unsigned long)(libm / BENCH_TH_SAMPLES), (unsigned long)(kern / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    
+    bench_th_setup(&q);
+    satallite_calculate(&q);
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        q.tsince = i * BENCH_TH_INTERVAL;
+        satallite_calculate(&q);
+    }
+    kern = bench_th_cycles();
+#ifdef SGP4_LIBM
+    sprintf(buf, "BENCH SGP4_LIBM sample %lu cycles\r\n", (unsigned long)(kern / BENCH_TH_SAMPLES));
+#else
+    sprintf(buf, "BENCH kernel sample %lu cycles\r\n", (unsigned long)(kern / BENCH_TH_SAMPLES));
+#endif
+    debug_printf("%s", buf);
+}
+
+/** bench_th_frame
+ *
+ * Time a sky full of objects at one instant, first working out
+ * the sidereal time and observer for every object and then once
+ * only in an observer frame. The satellites are the same TLE many
+ * times over, the stars are the start of the bright star catalog.
+ * The stars are also done as one batch (satapi_transform.c) and
+ * turned back to RA/Dec each way.
+ */
+void bench_th_frame(void) {
+    static SAT_POS_DATA q;
+    static RaDec list[BENCH_TH_SAMPLES];
+    static AltAz listaz[BENCH_TH_SAMPLES];
+    char buf[128];
+    obs_frame_t frame;
+    SAT_TRANSFORM t;
+    RaDec radec;
+    AltAz altaz;
+    basicStarData bright, *star;
+    double jd, sidereal;
+    uint32_t each, shared, batch;
+    int i;
+    
+    bench_th_setup(&q);
+    satallite_calculate(&q);
+    
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        satallite_calculate(&q);
+    }
+    each = bench_th_cycles();
+    bench_th_cycles_start();
+    satapi_observer_frame(&q.location, q.jd_utc, &frame);
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        satapi_observe(&q, &frame, SAT_OUT_ALL);
+    }
+    shared = bench_th_cycles();
+    sprintf(buf, "BENCH satellites %lu, in a frame %lu cycles/object\r\n", 
+        (unsigned long)(each / BENCH_TH_SAMPLES), (unsigned long)(shared / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    
+    jd = q.jd_utc;
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        star = get_bright_star(i, &bright);
+        radec.ra = star->ra; radec.dec = star->dec;
+        sidereal = gps_siderealDegrees_by_jd(jd);
+        radec2altaz(sidereal, &q.location, &radec, &altaz);
+    }
+    each = bench_th_cycles();
+    bench_th_cycles_start();
+    satapi_observer_frame(&q.location, jd, &frame);
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        star = get_bright_star(i, &bright);
+        radec.ra = star->ra; radec.dec = star->dec;
+        radec2altaz_frame(&frame, &radec, &altaz);
+    }
+    shared = bench_th_cycles();
+    bench_th_cycles_start();
+    satapi_transform_frame(&frame, &t);
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        star = get_bright_star(i, &bright);
+        list[i].ra = star->ra; list[i].dec = star->dec;
+    }
+    radec2altaz_batch(&t, list, listaz, BENCH_TH_SAMPLES);
+    batch = bench_th_cycles();
+    sprintf(buf, "BENCH stars %lu, in a frame %lu, batch %lu cycles/object\r\n", 
+        (unsigned long)(each / BENCH_TH_SAMPLES), (unsigned long)(shared / BENCH_TH_SAMPLES),
+        (unsigned long)(batch / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+    
+    sidereal = gps_siderealDegrees_by_jd(jd);
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        altaz2radec(sidereal, &q.location, &listaz[i], &radec);
+    }
+    each = bench_th_cycles();
+    bench_th_cycles_start();
+    satapi_transform_site(sidereal, &q.location, &t);
+    altaz2radec_batch(&t, listaz, list, BENCH_TH_SAMPLES);
+    batch = bench_th_cycles();
+    sprintf(buf, "BENCH altaz2radec %lu, batch %lu cycles/object\r\n", 
+        (unsigned long)(each / BENCH_TH_SAMPLES), (unsigned long)(batch / BENCH_TH_SAMPLES));
+    debug_printf("%s", buf);
+}
+
+/** bench_th_outputs
+ *
+ * Time a sample with every output and with only those an AOS 
+ * search asks for, then a whole satapi_next_pass() search. What
+ * the search would cost with every output is estimated from the
+ * number of propagations it took.
+ */
+void bench_th_outputs(void) {
+    static SAT_POS_DATA q;
+    char buf[128];
+    SAT_PASS pass;
+    uint32_t all, azel, search;
+    int i;
+    
+    bench_th_setup(&q);
+    satallite_calculate(&q);
+    
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        q.tsince = i * BENCH_TH_INTERVAL;
+        satapi_calculate(&q, SAT_OUT_ALL);
+    }
+    all = bench_th_cycles() / BENCH_TH_SAMPLES;
+    bench_th_cycles_start();
+    for (i = 0; i < BENCH_TH_SAMPLES; i++) {
+        KICK_WATCHDOG;
+        q.tsince = i * BENCH_TH_INTERVAL;
+        satapi_calculate(&q, SAT_OUT_AZEL | SAT_OUT_RANGE);
+    }
+    azel = bench_th_cycles() / BENCH_TH_SAMPLES;
+    sprintf(buf, "BENCH all outputs %lu, az/el/range %lu cycles/sample\r\n", 
+        (unsigned long)all, (unsigned long)azel);
+    debug_printf("%s", buf);
+    
+    bench_th_cycles_start();
+    satapi_next_pass(&q, 0., 86400., 10., &pass);
+    search = bench_th_cycles();
+    sprintf(buf, "BENCH AOS search %d samples %lu cycles, %lu with all outputs\r\n", 
+        pass.evaluations, (unsigned long)search, (unsigned long)(search + pass.evaluations * (all - azel)));
+    debug_printf("%s", buf);
+}
+
+/** bench_th_appulse
+ *
+ * Time satapi_appulse() on the first pass of the day, looking for
+ * stars to magnitude 5 within half a degree, and list what it finds.
+ * host/bench_appulse.c checks the results against a scan of the 
+ * whole catalog.
+ */
+void bench_th_appulse(void) {
+    static SAT_POS_DATA q;
+    static SAT_APPULSE found[16];
+    basicStarData bright;
+    char buf[128];
+    SAT_PASS pass;
+    uint32_t cycles;
+    int i, n;
+    
+    bench_th_setup(&q);
+    satallite_calculate(&q);
+    if (satapi_next_pass(&q, 0., 86400., 10., &pass) != 0) return;
+    
+    bench_th_cycles_start();
+    n = satapi_appulse(&q, &pass, 30., 5., found, 16);
+    cycles = bench_th_cycles();
+    sprintf(buf, "BENCH appulses %d in %lu cycles\r\n", n, (unsigned long)cycles);
+    debug_printf("%s", buf);
+    for (i = 0; i < n; i++) {
+        sprintf(buf, "BENCH   %.1f s HR%d %.2f' PA %.1f\r\n", found[i].t, 
+            get_bright_star(found[i].star, &bright)->hr, found[i].separation, found[i].position_angle);
+        debug_printf("%s", buf);
+    }
+}
+
+/** bench_th_stars
+ *
+ * Time star_nearest() and star_cone() against a scan of the whole
+ * catalog, as star_closest() did, at a few points including the 
+ * poles and either side of RA 0/360. host/bench_stars.c checks the
+ * results at many more.
+ */
+void bench_th_stars(void) {
+    static const float points[][2] = {
+        { 0., 90. }, { 180., -90. }, { 359.5, -20. }, { 0.5, 45. }, { 101.3, -16.7 }, { 210., 10. }
+    };
+    basicStarData bright, *s;
+    int found[32], i, j, n, best, index;
+    double c, cos_best;
+    uint32_t cycles_scan, cycles_index, cycles_cone;
+    char buf[128];
+    RaDec p;
+    
+    for (i = 0; i < (int)(sizeof(points) / sizeof(points[0])); i++) {
+        p.ra = points[i][0]; p.dec = points[i][1];
+        
+        bench_th_cycles_start();
+        best = -1; cos_best = -2.;
+        for (j = 0; (s = get_bright_star(j, &bright)) != NULL; j++) {
+            if (s->mag > 5.) continue;
+            c = sin(p.dec * de2ra) * sin(s->dec * de2ra) + cos(p.dec * de2ra) * cos(s->dec * de2ra) * cos((p.ra - s->ra) * de2ra);
+            if (c > cos_best) { cos_best = c; best = j; }
+        }
+        cycles_scan = bench_th_cycles();
+        
+        bench_th_cycles_start();
+        index = star_nearest(&p, 5., NULL);
+        cycles_index = bench_th_cycles();
+        
+        bench_th_cycles_start();
+        n = star_cone(&p, 5., 5., found, 32);
+        cycles_cone = bench_th_cycles();
+        
+        sprintf(buf, "BENCH stars %.1f %.1f HR%d scan %lu, HR%d nearest %lu, cone %d in %lu cycles\r\n", p.ra, p.dec,
+            best < 0 ? 0 : get_bright_star(best, &bright)->hr, (unsigned long)cycles_scan,
+            index < 0 ? 0 : get_bright_star(index, &bright)->hr, (unsigned long)cycles_index, n, (unsigned long)cycles_cone);
+        debug_printf("%s", buf);
+    }
+}
+
+#endif
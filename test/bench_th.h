@@ -0,0 +1,40 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+#ifndef BENCH_TH_H
+#define BENCH_TH_H
+
+#define BENCH_TH_RUN
+
+#ifdef BENCH_TH_RUN
+
+void bench_th_satapi_load(void);
+void bench_th_numeric(void);
+void bench_th_math(void);
+void bench_th_frame(void);
+void bench_th_outputs(void);
+void bench_th_appulse(void);
+void bench_th_stars(void);
+
+#endif
+
+#endif
@@ -27,7 +27,12 @@
 
 #define WHILE_WAITING_DO_PROCESS_FUNCTIONS user_call_process();
 
+#ifdef SOWB_HOST
+/* See SOWB_HOST in host/Makefile. */
+#define KICK_WATCHDOG
+#else
 #define KICK_WATCHDOG   { LPC_WDT->WDFEED = 0xAA; LPC_WDT->WDFEED = 0x55; }
+#endif
 
 typedef struct _user_input {
     char            xbox_button;
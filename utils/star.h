@@ -32,8 +32,52 @@ typedef struct _basicStarData {
     float  mag;
 } basicStarData;
 
-const basicStarData * get_bright_star(int index);
+/* The packed catalog in star_packed.c, written by host/gen_star_catalog.c
+   from brightstars[] in star_catalog.c, which the firmware does not 
+   build. Each star is 8 bytes, in fixed point: RA in steps of 0.6 
+   arcsec, Dec of 2.5 arcsec and magnitude of 0.01. Empty and repeated rows are 
+   left out. The stars are in STAR_TIERS tiers of magnitude, brightest
+   first, each in declination zones STAR_ZONE_DEG wide from the south
+   pole, each zone sorted by RA. Zone z of tier t is star_packed[] from 
+   star_zone_start[t * STAR_ZONES + z] up to, but not including, the 
+   next start. The catalog index of a star is its place in star_packed[]. */
+typedef struct _packedStarData {
+    uint32_t  ra  : 21;     /* RA * STAR_RA_STEPS / 360. */
+    uint32_t  mag : 11;     /* (mag - STAR_MAG_MIN) * 100. */
+    uint32_t  dec : 18;     /* (Dec + 90) * STAR_DEC_STEPS / 180. */
+    uint32_t  hr  : 14;
+} packedStarData;
+
+#define STAR_RA_STEPS       (1UL << 21)
+#define STAR_DEC_STEPS      (1UL << 18)
+#define STAR_MAG_MIN        -2.0
+
+#define STAR_RA(p)          ((p)->ra * (360. / STAR_RA_STEPS))
+#define STAR_DEC(p)         ((p)->dec * (180. / STAR_DEC_STEPS) - 90.)
+#define STAR_MAG(p)         ((p)->mag / 100. + STAR_MAG_MIN)
+
+#define STAR_ZONE_DEG       1
+#define STAR_ZONES          (180 / STAR_ZONE_DEG)
+
+/* Tier 0 is the stars brighter than magnitude 2, tier t from 1 up to
+   STAR_TIERS - 2 those from t + 1 to t + 2 and the last the rest. */
+#define STAR_TIERS          6
+#define STAR_TIER_MAG(t)    ((t) + 1.0)
+
+#define STAR_COUNT          (star_zone_start[STAR_TIERS * STAR_ZONES])
+
+extern const packedStarData star_packed[];
+extern const uint16_t star_zone_start[STAR_TIERS * STAR_ZONES + 1];
+extern const basicStarData brightstars[];
+
+/* Most stars star_knearest() will find. */
+#define STAR_KNEAREST_MAX   16
+
+basicStarData * get_bright_star(int index, basicStarData *star);
 basicStarData * star_closest(RaDec *radec, basicStarData *star);
+int star_cone(RaDec *centre, double radius, double mag, int *found, int max);
+int star_nearest(RaDec *point, double mag, double *separation);
+int star_knearest(RaDec *point, double mag, int k, int *found, double *separation);
 
 
 #endif
@@ -0,0 +1,2398 @@
+/****************************************************************************
+ *    Copyright 2010 Andy Kirkham, Stellar Technologies Ltd
+ *    
+ *    This file is part of the Satellite Observers Workbench (SOWB).
+ *
+ *    SOWB is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    SOWB is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with SOWB.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    $Id: main.cpp 5 2010-07-12 20:51:11Z ajk $
+ *    
+ ***************************************************************************/
+
+/* Written by host/gen_star_catalog.c from star_catalog.c, do not edit.
+   9092 stars of 9111 rows, 74898 bytes. See star.h. */
+
+#include "sowb.h"
+#include "satapi.h"
+#include "star.h"
+
+const uint16_t star_zone_start[1081] = {
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    2,    2,
+       2,    2,    2,    2,    4,    4,    4,    7,    9,    9,   11,   12,
+      12,   13,   13,   14,   14,   14,   14,   14,   15,   16,   16,   16,
+      16,   17,   17,   17,   17,   17,   18,   18,   18,   19,   19,   19,
+      19,   19,   20,   21,   21,   23,   23,   23,   23,   23,   23,   23,
+      23,   23,   24,   25,   25,   25,   25,   25,   26,   26,   26,   28,
+      28,   28,   28,   28,   28,   28,   29,   29,   29,   29,   29,   29,
+      30,   31,   32,   33,   33,   33,   34,   34,   34,   34,   34,   36,
+      36,   36,   37,   37,   37,   37,   37,   37,   37,   37,   37,   39,
+      39,   39,   40,   40,   40,   40,   40,   40,   40,   41,   41,   41,
+      41,   41,   41,   42,   44,   44,   44,   44,   46,   46,   46,   46,
+      46,   46,   47,   47,   47,   47,   47,   47,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   49,   49,   49,   49,   49,   49,   49,   49,   50,   51,
+      51,   51,   51,   52,   53,   53,   54,   55,   56,   57,   57,   57,
+      59,   59,   60,   60,   60,   62,   64,   65,   67,   68,   68,   68,
+      70,   72,   73,   74,   75,   75,   77,   79,   79,   81,   81,   81,
+      81,   82,   85,   86,   86,   88,   90,   91,   92,   93,   94,   95,
+      96,   96,   99,  102,  103,  103,  104,  104,  104,  105,  107,  107,
+     107,  107,  110,  110,  111,  111,  112,  114,  114,  114,  114,  116,
+     116,  117,  117,  118,  119,  121,  121,  122,  123,  124,  126,  126,
+     126,  127,  128,  130,  131,  132,  134,  135,  137,  138,  139,  140,
+     141,  142,  145,  145,  147,  147,  148,  148,  149,  150,  150,  153,
+     153,  154,  155,  155,  156,  156,  156,  156,  156,  156,  157,  158,
+     160,  161,  161,  163,  163,  163,  164,  166,  167,  168,  168,  168,
+     168,  168,  168,  168,  168,  168,  168,  168,  168,  169,  169,  169,
+     169,  169,  169,  169,  169,  169,  169,  169,  169,  169,  169,  169,
+     170,  170,  170,  170,  170,  170,  170,  170,  170,  170,  170,  170,
+     171,  172,  173,  173,  173,  174,  174,  177,  178,  180,  180,  181,
+     182,  186,  187,  190,  192,  196,  199,  202,  203,  209,  210,  211,
+     214,  216,  216,  220,  224,  226,  227,  230,  232,  236,  239,  241,
+     247,  254,  255,  261,  262,  265,  268,  270,  273,  274,  278,  279,
+     280,  282,  284,  287,  289,  292,  293,  296,  298,  302,  307,  310,
+     311,  311,  312,  316,  319,  325,  325,  327,  327,  329,  334,  338,
+     339,  341,  342,  344,  347,  351,  355,  358,  362,  366,  370,  371,
+     375,  379,  379,  379,  387,  391,  391,  393,  393,  395,  403,  405,
+     406,  408,  412,  413,  416,  417,  419,  425,  426,  428,  432,  433,
+     436,  440,  440,  442,  446,  449,  450,  452,  453,  458,  459,  460,
+     465,  468,  469,  471,  471,  475,  479,  481,  481,  482,  484,  485,
+     487,  489,  490,  491,  493,  496,  497,  498,  499,  499,  501,  502,
+     503,  504,  505,  505,  507,  509,  510,  512,  512,  512,  512,  512,
+     513,  513,  513,  513,  513,  513,  513,  513,  513,  513,  513,  513,
+     513,  513,  513,  513,  513,  513,  513,  513,  514,  514,  516,  517,
+     518,  521,  524,  525,  526,  527,  528,  529,  531,  534,  534,  538,
+     545,  550,  554,  563,  573,  582,  590,  595,  605,  608,  615,  621,
+     623,  627,  634,  640,  645,  649,  660,  670,  679,  686,  699,  707,
+     711,  721,  731,  739,  746,  752,  766,  771,  781,  791,  799,  811,
+     815,  818,  825,  832,  846,  852,  864,  872,  886,  896,  904,  912,
+     923,  935,  942,  949,  957,  965,  973,  984,  989, 1001, 1008, 1016,
+    1027, 1033, 1041, 1047, 1055, 1065, 1073, 1085, 1095, 1102, 1112, 1120,
+    1129, 1136, 1142, 1156, 1165, 1172, 1176, 1183, 1189, 1197, 1205, 1214,
+    1222, 1227, 1234, 1244, 1256, 1266, 1275, 1283, 1293, 1302, 1314, 1319,
+    1328, 1337, 1344, 1348, 1356, 1364, 1371, 1382, 1394, 1403, 1412, 1419,
+    1423, 1428, 1436, 1442, 1449, 1456, 1464, 1469, 1481, 1490, 1499, 1502,
+    1503, 1509, 1515, 1519, 1524, 1535, 1542, 1543, 1546, 1550, 1553, 1557,
+    1564, 1565, 1569, 1573, 1577, 1579, 1583, 1585, 1586, 1587, 1591, 1592,
+    1596, 1596, 1596, 1596, 1597, 1599, 1600, 1601, 1601, 1603, 1603, 1603,
+    1603, 1603, 1603, 1604, 1606, 1606, 1610, 1614, 1616, 1624, 1626, 1639,
+    1645, 1651, 1657, 1664, 1668, 1674, 1685, 1690, 1697, 1710, 1722, 1737,
+    1749, 1765, 1776, 1797, 1810, 1833, 1848, 1876, 1896, 1914, 1934, 1956,
+    1966, 1981, 2010, 2037, 2059, 2085, 2097, 2120, 2148, 2180, 2204, 2232,
+    2255, 2280, 2313, 2339, 2362, 2392, 2424, 2457, 2479, 2503, 2526, 2553,
+    2572, 2597, 2616, 2635, 2657, 2685, 2708, 2740, 2770, 2792, 2814, 2843,
+    2865, 2892, 2910, 2940, 2963, 2995, 3020, 3047, 3072, 3093, 3117, 3148,
+    3177, 3196, 3229, 3257, 3282, 3299, 3325, 3389, 3416, 3443, 3466, 3482,
+    3508, 3535, 3556, 3586, 3612, 3634, 3668, 3691, 3717, 3746, 3774, 3807,
+    3840, 3866, 3897, 3926, 3956, 3979, 4003, 4042, 4070, 4095, 4118, 4143,
+    4166, 4185, 4209, 4237, 4271, 4294, 4306, 4328, 4351, 4373, 4398, 4422,
+    4446, 4462, 4482, 4497, 4515, 4537, 4552, 4574, 4601, 4622, 4630, 4649,
+    4671, 4690, 4714, 4736, 4757, 4769, 4788, 4802, 4822, 4838, 4850, 4864,
+    4878, 4889, 4899, 4912, 4920, 4930, 4935, 4948, 4955, 4962, 4968, 4974,
+    4981, 4987, 4992, 4998, 5003, 5007, 5012, 5014, 5015, 5018, 5020, 5020,
+    5020, 5020, 5020, 5022, 5024, 5026, 5029, 5032, 5036, 5039, 5046, 5049,
+    5057, 5066, 5075, 5083, 5093, 5100, 5108, 5121, 5132, 5146, 5158, 5168,
+    5178, 5196, 5222, 5243, 5266, 5283, 5303, 5325, 5345, 5370, 5394, 5410,
+    5431, 5453, 5470, 5500, 5524, 5547, 5573, 5597, 5612, 5629, 5657, 5677,
+    5704, 5732, 5762, 5798, 5847, 5885, 5926, 5960, 6005, 6033, 6068, 6091,
+    6128, 6166, 6199, 6229, 6256, 6298, 6331, 6368, 6401, 6437, 6460, 6490,
+    6526, 6557, 6575, 6601, 6627, 6660, 6679, 6704, 6728, 6762, 6794, 6820,
+    6847, 6880, 6913, 6947, 6979, 7015, 7053, 7105, 7147, 7179, 7211, 7239,
+    7265, 7294, 7314, 7347, 7368, 7406, 7441, 7462, 7497, 7527, 7557, 7591,
+    7623, 7654, 7691, 7728, 7756, 7789, 7820, 7860, 7894, 7916, 7947, 7975,
+    7998, 8019, 8050, 8086, 8117, 8142, 8170, 8208, 8242, 8287, 8311, 8341,
+    8370, 8397, 8418, 8441, 8476, 8505, 8530, 8557, 8582, 8608, 8636, 8667,
+    8689, 8707, 8731, 8750, 8785, 8806, 8833, 8850, 8870, 8888, 8903, 8924,
+    8936, 8947, 8953, 8967, 8976, 8986, 8993, 8999, 9009, 9018, 9031, 9038,
+    9046, 9051, 9058, 9067, 9072, 9076, 9081, 9083, 9087, 9088, 9090, 9090,
+    9092
+};
+
+const packedStarData star_packed[9092] = {
+ {  805656,  368,  31628, 3685 }, { 1468975,  392,  30624, 6217 }, { 1087313,  333,  39466, 4730 }, { 1087327,  373,  39466, 4731 },
+ { 1228907,  261,  44234, 5267 }, { 1281008,  199,  44907, 5459 }, { 1281013,  333,  44908, 5460 }, {  731838,  386,  45889, 3307 },
+ { 1118073,  325,  46150, 4853 }, {  142308,  246,  48404,  472 }, { 1093963,  363,  48225, 4763 }, { 1784980,  394,  50587, 7790 },
+ {  764154,  396,  53460, 3485 }, {  559170,  128,  56355, 2326 }, {  712934,  378,  63114, 3207 }, { 1934380,  374,  65479, 8425 },
+ { 1539834,  387,  71358, 6553 }, { 1534428,  363,  77338, 6527 }, { 1608066,  385,  82116, 6879 }, { 2006351,  316,  89744, 8728 },
+ {  609667,  350,  91710, 2618 }, {  623890,  384,  93780, 2693 }, { 1440928,  296,  93836, 6134 }, {  557347,  398, 107706, 2294 },
+ {  590040,   54, 108813, 2491 }, { 1172648,  298, 115287, 5056 }, {  458080,  212, 119715, 1713 }, {  826608,  398, 120380, 3748 },
+ {  489646,  370, 129910, 1903 }, {  668906,  238, 138681, 2943 }, {  473507,  364, 140319, 1790 }, {  517256,  250, 141859, 2061 },
+ { 1734204,  277, 143987, 7557 }, {  886005,  335, 148500, 3982 }, {  401838,  285, 155115, 1457 }, {  579210,  393, 154955, 2421 },
+ { 1246148,  196, 159009, 5340 }, {  475197,  365, 172735, 1791 }, {  677664,  314, 171888, 2990 }, {  662059,  398, 177513, 2891 },
+ { 1626659,  203, 187555, 7001 }, {  523601,  390, 196532, 2088 }, {  461213,  208, 198062, 1708 }, { 1807966,  325, 197016, 7924 },
+ {  297567,  379, 203687, 1017 }, { 1205192,  386, 202890, 5191 }, { 1127261,  377, 212569, 4905 }, {  966625,  379, 221003, 4301 },
+ {   37503,  480,  19303,   98 }, { 1102728,  469,  30781, 4798 }, { 1338260,  489,  33029, 5671 }, {  936374,  476,  38440, 4199 },
+ { 1391026,  485,  39949, 5897 }, {  172971,  486,  43064,  591 }, { 1949334,  486,  44069, 8502 }, {  811321,  425,  45548, 3699 },
+ { 1070633,  480,  47694, 4656 }, {  818637,  450,  50988, 3734 }, { 1522329,  485,  51744, 6461 }, { 1194047,  430,  54564, 5132 },
+ {  597014,  493,  59149, 2553 }, { 1060749,  460,  59306, 4621 }, {  941927,  469,  60322, 4216 }, { 1531855,  495,  60986, 6510 },
+ { 1109039,  417,  62565, 4819 }, { 1216843,  455,  63043, 5231 }, { 1284404,  430,  63189, 5469 }, { 1984530,  410,  65368, 8636 },
+ {  798078,  421,  69079, 3634 }, { 1308582,  468,  68644, 5571 }, {   38278,  439,  70351,   99 }, { 1275049,  431,  70135, 5440 },
+ { 1361899,  478,  71604, 5776 }, {  704271,  425,  72823, 3165 }, { 1547361,  441,  74318, 6580 }, {  636636,  470,  77329, 2773 },
+ { 1530285,  469,  77618, 6508 }, { 1165954,  475,  79680, 5028 }, { 1233072,  406,  79182, 5288 }, {  494649,  464,  81664, 1956 },
+ { 1471157,  429,  81983, 6241 }, { 1581323,  499,  87999, 6746 }, {  646761,  445,  89279, 2827 }, { 1603440,  470,  90044, 6859 },
+ { 1664049,  460,  90120, 7194 }, { 1450360,  482,  90609, 6165 }, { 1396429,  489,  93373, 5944 }, { 1653350,  402,  93639, 7121 },
+ { 1428959,  489,  95526, 6084 }, { 1613598,  481,  95277, 6913 }, {  710036,  481,  96562, 3185 }, { 1098655,  465,  98154, 4786 },
+ { 1398587,  432,  99938, 5953 }, { 1674464,  489, 100523, 7264 }, {  478042,  484, 103051, 1829 }, { 1406019,  462, 104574, 5984 },
+ {   63483,  404, 107751,  188 }, {  484573,  458, 107511, 1865 }, { 1071596,  459, 107103, 4662 }, { 1092070,  495, 108521, 4757 },
+ { 1297436,  475, 107831, 5531 }, { 1903515,  487, 107956, 8322 }, { 1500597,  443, 110282, 6378 }, {  346656,  495, 112880, 1231 },
+ { 1452217,  456, 117334, 6175 }, {  506458,  406, 118940, 2004 }, { 1335488,  461, 118523, 5685 }, {  448339,  479, 123916, 1666 },
+ {  488510,  477, 125116, 1899 }, { 1880968,  491, 124622, 8232 }, { 1418993,  474, 127714, 6056 }, {  496265,  405, 130989, 1948 },
+ {  483520,  423, 131508, 1852 }, { 1930812,  496, 131538, 8414 }, {  265464,  453, 137028,  911 }, { 1548795,  477, 137723, 6603 },
+ { 1375190,  465, 140430, 5854 }, {  651209,  490, 143144, 2845 }, { 1899360,  439, 145454, 8308 }, { 1139128,  483, 147032, 4932 },
+ { 1727616,  472, 146529, 7525 }, { 1536360,  408, 149364, 6556 }, { 1668124,  499, 151262, 7235 }, { 1032643,  414, 152294, 4534 },
+ {   19277,  483, 153185,   39 }, { 2016705,  449, 153216, 8781 }, { 1215598,  468, 157866, 5235 }, {  902899,  461, 159969, 4057 },
+ {  166957,  464, 161376,  553 }, {  981742,  456, 160962, 4357 }, { 1442112,  477, 162369, 6148 }, {  557726,  488, 163860, 2286 },
+ {  185209,  400, 165242,  617 }, {  853208,  498, 165696, 3873 }, {  331299,  487, 166177, 1165 }, {  588268,  498, 167672, 2473 },
+ { 1397378,  400, 168821, 5958 }, { 1361239,  423, 169978, 5793 }, { 1288855,  470, 170502, 5506 }, { 2015269,  442, 171971, 8775 },
+ {   12216,  406, 173438,   15 }, { 1985015,  494, 175085, 8650 }, {  340979,  485, 177506, 1203 }, {  662059,  488, 177513, 2890 },
+ { 1458230,  481, 177097, 6212 }, {  432528,  469, 179374, 1577 }, { 1814927,  446, 180545, 7949 }, {  101554,  406, 182948,  337 },
+ {  523883,  462, 185267, 2095 }, { 1130173,  490, 186877, 4915 }, {  274040,  412, 190718,  936 }, {  346399,  489, 189341, 1220 },
+ { 1779999,  420, 189700, 7796 }, {  180442,  426, 192719,  603 }, {  439773,  499, 194894, 1605 }, { 1725745,  487, 196798, 7528 },
+ { 1567922,  423, 206058, 6705 }, { 1529804,  479, 207241, 6536 }, {  269130,  493, 208996,  915 }, { 1039590,  444, 209271, 4554 },
+ { 1170800,  427, 211063, 5054 }, {   58995,  423, 213410,  168 }, {  963877,  437, 213185, 4295 }, {   13367,  427, 217215,   21 },
+ {   82588,  447, 219497,  264 }, {  124980,  468, 218796,  403 }, { 1433042,  474, 220659, 6132 }, { 1862067,  444, 222219, 8162 },
+ { 1297183,  408, 239069, 5563 }, {  221092,  402, 261072,  424 }, { 1293040,  583,  16085, 5470 }, { 1446816,  589,  18783, 6102 },
+ { 1895410,  576,  19501, 8254 }, {  330940,  524,  23650, 1208 }, {  672574,  595,  27097, 3024 }, { 1095859,  587,  26408, 4773 },
+ { 1748488,  596,  27541, 7590 }, { 1139263,  562,  28470, 4923 }, {  624410,  578,  29854, 2736 }, {  893819,  532,  29183, 4037 },
+ { 1115978,  505,  32197, 4844 }, {  636180,  598,  34890, 2803 }, {  736533,  577,  35152, 3347 }, { 1027614,  564,  36014, 4520 },
+ { 1760336,  556,  35217, 7665 }, { 1813102,  542,  35248, 7913 }, {  855029,  501,  36514, 3890 }, {  326515,  585,  39040, 1175 },
+ { 1285244,  519,  39286, 5463 }, { 1552086,  562,  38920, 6582 }, { 1013303,  513,  39350, 4467 }, { 1420585,  585,  40320, 6030 },
+ {  370534,  535,  41468, 1336 }, {  485877,  576,  41491, 1922 }, {  802855,  597,  41240, 3663 }, {  852327,  569,  41517, 3884 },
+ {  594470,  527,  43605, 2550 }, {  898693,  540,  42718, 4050 }, {  920450,  532,  43232, 4140 }, {  779218,  584,  44630, 3571 },
+ { 1079684,  559,  44275, 4700 }, { 1530773,  562,  44687, 6500 }, { 1470606,  576,  45207, 6229 }, {  802404,  544,  48012, 3659 },
+ {  914414,  582,  47680, 4114 }, {  951718,  578,  47846, 4257 }, {  973705,  591,  48023, 4337 }, { 1827450,  565,  47265, 7986 },
+ { 2035155,  599,  46947, 8848 }, {  831902,  513,  48110, 3803 }, { 1522464,  534,  50066, 6462 }, {   99593,  592,  51330,  338 },
+ {  399037,  527,  51038, 1465 }, { 1483473,  513,  52415, 6285 }, {  869245,  554,  53256, 3940 }, {  991788,  589,  53144, 4390 },
+ {  694359,  547,  56772, 3117 }, {  757732,  562,  56684, 3447 }, { 1065545,  596,  55878, 4638 }, { 1328611,  541,  55486, 5649 },
+ {  168877,  570,  57685,  566 }, {  198807,  556,  57544,  674 }, {  505771,  585,  56895, 2020 }, { 1993103,  549,  57259, 8675 },
+ { 1089412,  591,  58590, 4743 }, { 1582522,  566,  58388, 6743 }, {  132895,  595,  59817,  440 }, {  928138,  584,  61496, 4167 },
+ { 1103485,  586,  61955, 4802 }, { 1328101,  587,  62241, 5646 }, {  792483,  575,  62766, 3614 }, { 1802337,  511,  63048, 7869 },
+ {   96241,  531,  65126,  322 }, {  758218,  584,  65025, 3445 }, {  766084,  591,  64140, 3487 }, { 1251597,  555,  64164, 5354 },
+ {   13707,  588,  66625,   25 }, { 1612146,  551,  66946, 6897 }, { 2024858,  590,  65895, 8820 }, { 1221416,  587,  68163, 5249 },
+ { 1343752,  537,  67996, 5708 }, {   38161,  594,  69439,  100 }, {  128691,  541,  68912,  429 }, {  579282,  517,  68734, 2451 },
+ {  654239,  525,  68888, 2878 }, { 1503182,  533,  68797, 6380 }, { 1965017,  597,  69170, 8556 }, {  369917,  586,  70334, 1326 },
+ {  523045,  596,  71092, 2120 }, {  895275,  585,  70083, 4023 }, { 1208217,  504,  70595, 5193 }, { 1220822,  583,  70052, 5248 },
+ { 1309499,  513,  70057, 5576 }, { 1477594,  562,  70431, 6271 }, { 1208054,  541,  72363, 5190 }, {  259612,  524,  73262,  897 },
+ {  687716,  573,  73656, 3080 }, {  831142,  560,  73497, 3786 }, { 1341845,  522,  73761, 5695 }, { 1554784,  503,  73003, 6615 },
+ { 1695033,  597,  73715, 7348 }, { 1181170,  588,  74868, 5089 }, { 1398278,  541,  76309, 5948 }, { 1473642,  508,  75800, 6247 },
+ { 1474320,  557,  75756, 6252 }, {  677577,  561,  78597, 3017 }, { 1558094,  521,  77250, 6630 }, { 1913547,  501,  77718, 8353 },
+ { 1342478,  556,  79024, 5705 }, { 1598535,  511,  79753, 6832 }, {  482362,  587,  80785, 1862 }, {  511123,  512,  81218, 2040 },
+ {  757455,  597,  80549, 3438 }, {  384531,  596,  81581, 1393 }, {  375587,  556,  84175, 1347 }, {  556493,  585,  83648, 2296 },
+ {  762536,  568,  83284, 3468 }, { 1384934,  595,  83926, 5883 }, {  596875,  596,  85209, 2538 }, { 1009257,  554,  87174, 4450 },
+ {  401299,  582,  88200, 1464 }, {  553871,  502,  87474, 2282 }, { 1367018,  566,  89970, 5812 }, { 1393565,  588,  89150, 5928 },
+ {  279725,  587,  91731,  963 }, {  675470,  596,  91684, 2996 }, { 1364641,  558,  90491, 5794 }, {  614172,  547,  93112, 2646 },
+ { 1670352,  532,  92727, 7234 }, {  633240,  585,  94332, 2749 }, { 1232618,  527,  94201, 5287 }, { 1639357,  517,  94650, 7039 },
+ { 1316647,  529,  95074, 5603 }, {  603123,  587,  96387, 2580 }, {  683461,  534,  97371, 3045 }, { 1517537,  527,  97575, 6453 },
+ {  616075,  502,  98789, 2653 }, { 1163514,  500,  97826, 5020 }, {  444861,  519,  99573, 1654 }, {  501661,  560,  99685, 1983 },
+ { 1063322,  500,  99935, 4630 }, { 1873844,  574,  99631, 8204 }, {  290567,  569, 101592, 1003 }, { 1592908,  586, 100574, 6812 },
+ { 1656939,  551, 100644, 7150 }, { 1667066,  577, 101569, 7217 }, { 2023529,  566, 100740, 8812 }, {  511649,  581, 103225, 2035 },
+ { 1408014,  596, 102919, 5993 }, { 2043223,  597, 102091, 8892 }, {  577712,  595, 103774, 2429 }, { 1691809,  593, 107548, 7340 },
+ {  455740,  531, 108070, 1702 }, {  911810,  581, 108988, 4094 }, {  946085,  511, 108052, 4232 }, { 1893396,  568, 108735, 8278 },
+ {  151561,  550, 110592,  509 }, { 1540222,  554, 109807, 6561 }, { 2001979,  527, 110422, 8709 }, {  405129,  587, 111126, 1481 },
+ {  505290,  555, 111880, 1998 }, {  519052,  571, 110927, 2085 }, {  989363,  556, 111817, 4382 }, { 1362460,  591, 111833, 5787 },
+ { 1778227,  508, 111821, 7776 }, {  889234,  561, 114112, 3994 }, { 1773921,  557, 114389, 7754 }, {   99891,  545, 116774,  334 },
+ {  162325,  573, 116996,  539 }, {  310102,  573, 118632, 1084 }, {  325129,  554, 119076, 1136 }, {  671739,  593, 118767, 2970 },
+ { 1571447,  534, 119091, 6698 }, { 1817061,  577, 118687, 7950 }, {   28295,  556, 120621,   74 }, {  122368,  560, 119688,  402 },
+ {  256942,  589, 120729,  874 }, { 1624138,  585, 119777, 6973 }, { 1999016,  574, 121722, 8698 }, {  462548,  560, 123564, 1735 },
+ {  545922,  598, 122734, 2227 }, { 1286049,  588, 124749, 5487 }, { 1424784,  524, 126255, 6075 }, { 1669345,  544, 126532, 7236 },
+ {  402418,  593, 127216, 1463 }, {  736421,  590, 128023, 3314 }, { 1382984,  553, 127330, 5881 }, {  202936,  504, 129583,  681 },
+ {  472554,  536, 128737, 1788 }, {  493336,  581, 129033, 1931 }, { 1603899,  526, 129468, 6869 }, {  844478,  591, 129824, 3845 },
+ { 1109248,  565, 130270, 4825 }, { 1109248,  568, 130270, 4826 }, { 1953929,  584, 130180, 8518 }, { 1077567,  589, 132043, 4689 },
+ { 1186483,  537, 131940, 5107 }, { 1764091,  523, 132268, 7710 }, { 1035025,  561, 133642, 4540 }, { 1290693,  572, 133829, 5511 },
+ { 1443122,  582, 133961, 6149 }, { 1736665,  590, 132537, 7570 }, {  428535,  572, 134626, 1567 }, {  807353,  588, 134442, 3665 },
+ { 1555232,  575, 135015, 6629 }, { 1573804,  597, 135342, 6714 }, {  237823,  547, 135784,  804 }, { 1129554,  538, 136020, 4910 },
+ { 1697380,  536, 135608, 7377 }, { 2034769,  569, 135852, 8852 }, { 1384727,  571, 137593, 5892 }, {  354123,  591, 139794, 1251 },
+ {  424101,  569, 139235, 1552 }, {  779723,  511, 139731, 3547 }, { 1858052,  592, 138715, 8131 }, {  422110,  519, 141210, 1543 },
+ {  767174,  538, 140420, 3482 }, { 1740801,  571, 140402, 7602 }, { 1937244,  553, 140098, 8450 }, {  298281,  560, 144221, 1030 },
+ {  301713,  574, 145246, 1038 }, {  488081,  554, 145540, 1879 }, {  723103,  552, 144450, 3249 }, {  846361,  552, 145479, 3852 },
+ {  921599,  585, 144626, 4133 }, { 1482087,  520, 144725, 6299 }, { 1583568,  573, 145000, 6771 }, {  996038,  594, 146406, 4399 },
+ { 1361403,  580, 146418, 5788 }, { 1361403,  580, 146421, 5789 }, { 1982772,  540, 146846, 8634 }, {  350516,  547, 149262, 1239 },
+ {  590246,  536, 149853, 2484 }, { 1506816,  548, 152029, 6406 }, { 1802313,  563, 152328, 7882 }, {  133232,  562, 153421,  437 },
+ {  378351,  565, 153831, 1346 }, {  391140,  584, 154319, 1411 }, {  391267,  540, 154186, 1412 }, {  981933,  534, 153543, 4359 },
+ { 1377987,  567, 153532, 5867 }, { 1392936,  585, 153881, 5933 }, { 1805354,  577, 154245, 7906 }, {  638019,  558, 155161, 2763 },
+ {  884493,  552, 155485, 3975 }, {  382927,  576, 156620, 1373 }, {  764128,  594, 157511, 3461 }, { 1729260,  582, 158064, 7536 },
+ {  391202,  553, 159005, 1409 }, {  902907,  580, 159967, 4058 }, { 1430025,  575, 158966, 6095 }, { 1745816,  547, 159460, 7635 },
+ {  617653,  579, 161030, 2650 }, {  491731,  500, 161863, 1910 }, {  640976,  553, 163086, 2777 }, { 1607377,  584, 162776, 6895 },
+ {  545954,  528, 163850, 2216 }, {  898120,  544, 165176, 4031 }, { 1990156,  595, 165392, 8667 }, {  327498,  570, 166190, 1142 },
+ {  328884,  587, 166560, 1149 }, {  333741,  563, 166102, 1178 }, {  676400,  557, 166604, 2985 }, { 1507374,  514, 167247, 6410 },
+ { 1995212,  548, 166901, 8684 }, { 1932601,  576, 167983, 8430 }, {  863274,  588, 168947, 3905 }, { 1372969,  584, 169368, 5849 },
+ {  247556,  563, 170773,  838 }, {  649137,  579, 171556, 2821 }, { 1553143,  542, 171443, 6623 }, { 1704987,  508, 171791, 7417 },
+ { 1583850,  583, 172960, 6779 }, {  164687,  541, 174149,  544 }, { 1351248,  568, 173460, 5747 }, { 1569609,  570, 173667, 6703 },
+ {   57276,  527, 176016,  165 }, { 1269694,  558, 175304, 5429 }, { 1485905,  592, 176112, 6324 }, { 1853849,  520, 175093, 8115 },
+ {  326687,  583, 178095, 1131 }, { 1658706,  524, 178679, 7178 }, {  601167,  560, 180531, 2540 }, {  988106,  548, 179269, 4377 },
+ { 1333298,  547, 179590, 5681 }, { 1645798,  545, 179660, 7106 }, {  188661,  500, 182026,  622 }, {  817095,  513, 181160, 3705 },
+ {  951454,  583, 180901, 4247 }, { 1742248,  589, 182166, 7615 }, {  813877,  582, 184670, 3690 }, { 1507396,  516, 184679, 6418 },
+ { 1567407,  586, 185322, 6695 }, {   82653,  587, 187141,  269 }, {  269683,  539, 187637,  921 }, { 1270056,  503, 186863, 5435 },
+ { 1460574,  553, 187757, 6220 }, { 1856550,  572, 186480, 8130 }, {  511894,  597, 188086, 2012 }, { 1313555,  550, 189895, 5602 },
+ {  440516,  575, 190893, 1612 }, {  446395,  517, 191124, 1641 }, {  787364,  597, 191923, 3579 }, {  906331,  505, 191510, 4069 },
+ { 1830891,  594, 191026, 8028 }, {  327961,  577, 193082, 1135 }, {  898712,  545, 193571, 4033 }, { 2012569,  562, 192714, 8762 },
+ { 1842190,  572, 195046, 8079 }, {  275975,  580, 196400,  941 }, {  975268,  501, 195878, 4335 }, { 1426850,  589, 198521, 6092 },
+ { 1542958,  580, 198074, 6588 }, { 1767479,  579, 199144, 7735 }, { 2064479,  582, 198732, 8961 }, {  324658,  501, 200668, 1122 },
+ {  791712,  560, 199749, 3594 }, { 1028260,  571, 200656, 4518 }, { 1770159,  598, 200561, 7751 }, {  142713,  557, 201892,  464 },
+ {  785277,  514, 201038, 3569 }, { 1967961,  577, 204301, 8585 }, {  834283,  517, 206332, 3775 }, { 1703506,  579, 206409, 7420 },
+ {  253782,  595, 207913,  854 }, {   53844,  566, 209565,  153 }, { 1685154,  577, 208796, 7328 }, {  523599,  572, 210130, 2077 },
+ { 1170822,  595, 211058, 5055 }, {  248595,  576, 212476,  834 }, { 1563439,  575, 213899, 6688 }, {   71507,  544, 215272,  219 },
+ { 1071043,  531, 214132, 4660 }, { 1347027,  529, 216948, 5744 }, { 1938198,  535, 215833, 8465 }, { 1964874,  575, 216145, 8571 },
+ {  860692,  580, 217053, 3888 }, {  743128,  536, 219499, 3323 }, { 1813585,  543, 221131, 7957 }, {  166600,  538, 223798,  542 },
+ {  832349,  567, 222913, 3757 }, { 1229730,  565, 224826, 5291 }, { 1498279,  517, 226776, 6396 }, { 1994741,  552, 227484, 8694 },
+ { 1678530,  507, 229611, 7310 }, { 1006929,  584, 232043, 4434 }, { 1097339,  587, 232709, 4787 }, { 1730403,  583, 233407, 7582 },
+ { 1876747,  523, 233834, 8238 }, { 1340908,  505, 235688, 5735 }, {  179766,  598, 236543,  580 }, { 1603530,  557, 236997, 6927 },
+ { 2067074,  521, 244133, 8974 }, { 1262536,  632,  11167, 5339 }, { 1249888,  691,  13119, 5303 }, { 1989462,  615,  13663, 8630 },
+ {  940485,  645,  15350, 4234 }, { 1075293,  626,  16475, 4674 }, {  925468,  611,  18361, 4174 }, { 1048025,  691,  17799, 4583 },
+ { 1427734,  668,  18490, 6020 }, {    2323,  678,  19028, 9084 }, {  729112,  635,  19638, 3340 }, { 1460836,  624,  19686, 6163 },
+ {  726032,  607,  21728, 3318 }, {  248272,  675,  21943,  872 }, {  909341,  600,  23348, 4102 }, {  919009,  693,  25081, 4142 },
+ {  793928,  648,  27092, 3643 }, {  917992,  674,  29117, 4138 }, { 1635538,  601,  28294, 6982 }, {  794644,  671,  29912, 3642 },
+ { 1033930,  697,  29456, 4538 }, { 1439561,  691,  29250, 6098 }, {  110346,  686,  33316,  377 }, {  206436,  609,  33000,  705 },
+ {  232420,  611,  32429,  806 }, {  710600,  635,  32939, 3223 }, {  167387,  669,  34439,  570 }, {  241090,  684,  34394,  837 },
+ {  456941,  683,  33766, 1744 }, { 1074162,  611,  34895, 4671 }, { 1158164,  680,  34799, 4993 }, { 1517508,  678,  34618, 6417 },
+ { 1655803,  644,  33836, 7107 }, {  789995,  600,  35529, 3615 }, {  907263,  699,  36266, 4089 }, { 1031447,  672,  36139, 4530 },
+ { 1161031,  687,  36094, 5002 }, { 1364197,  611,  35414, 5771 }, {  502112,  635,  37480, 2015 }, { 1036711,  690,  36709, 4549 },
+ { 1873519,  622,  36942, 8181 }, { 2097031,  650,  37250, 9076 }, {   29231,  623,  39139,   77 }, {  260392,  699,  37969,  909 },
+ {  935320,  682,  38544, 4196 }, {  942048,  685,  38423, 4222 }, { 1058598,  615,  38759, 4616 }, { 1075424,  604,  37870, 4679 },
+ { 1170922,  653,  38646, 5041 }, { 1639053,  679,  39134, 7012 }, { 1962196,  648,  39273, 8540 }, {  515698,  665,  39453, 2102 },
+ {  699536,  682,  40148, 3159 }, {  938061,  682,  40721, 4205 }, { 1033553,  632,  40470, 4537 }, { 1052981,  633,  39777, 4599 },
+ { 1054867,  672,  39563, 4603 }, { 1087192,  686,  39500, 4729 }, { 1219914,  671,  40322, 5241 }, { 1336422,  686,  40211, 5666 },
+ { 1585359,  635,  40295, 6745 }, {   45941,  637,  42173,  126 }, {   45963,  654,  42185,  127 }, {  304929,  672,  42143, 1083 },
+ {  350831,  651,  41010, 1264 }, {  816938,  681,  41367, 3728 }, {  970719,  661,  41396, 4325 }, { 1020750,  694,  40909, 4499 },
+ { 1618554,  664,  41183, 6916 }, { 1648910,  622,  41051, 7074 }, {  347698,  656,  42817, 1247 }, {  351423,  697,  42349, 1266 },
+ {  712175,  676,  42675, 3220 }, {  843740,  652,  42712, 3856 }, { 1028934,  611,  42494, 4522 }, { 1606690,  636,  42954, 6855 },
+ { 1802369,  688,  43006, 7859 }, { 1970451,  681,  43665, 8582 }, {  937215,  657,  44516, 4200 }, {  979545,  660,  44153, 4352 },
+ { 1115032,  669,  45119, 4842 }, { 1168917,  653,  45130, 5035 }, { 1799444,  676,  44538, 7848 }, {  373528,  644,  45587, 1355 },
+ {  758203,  633,  46255, 3457 }, {  782024,  692,  45481, 3582 }, {  836596,  608,  45481, 3825 }, {  930249,  666,  45414, 4177 },
+ { 1109660,  693,  46146, 4823 }, { 1128170,  662,  45361, 4897 }, { 1153856,  660,  46488, 4975 }, { 1156706,  692,  45297, 4989 },
+ { 1344767,  651,  45614, 5704 }, {  750499,  686,  46617, 3414 }, { 1256277,  692,  47272, 5371 }, { 1336225,  607,  47770, 5670 },
+ {   63138,  636,  48734,  191 }, {  444931,  672,  48748, 1674 }, {  810030,  634,  48848, 3696 }, {  913727,  666,  48990, 4110 },
+ {  925643,  645,  48872, 4159 }, { 1128083,  603,  48319, 4898 }, { 1403245,  663,  49189, 5961 }, {  509475,  651,  49759, 2042 },
+ {  767075,  649,  50637, 3498 }, {  904270,  650,  49579, 4074 }, { 1116119,  665,  50228, 4848 }, { 1252939,  633,  50079, 5358 },
+ { 1927283,  669,  50661, 8387 }, {  902377,  657,  51015, 4063 }, {  931058,  628,  51851, 4180 }, {  539286,  681,  53839, 2212 },
+ { 1011820,  662,  52814, 4460 }, { 1417731,  694,  53347, 6024 }, { 1919358,  640,  53874, 8368 }, {  596895,  640,  54791, 2554 },
+ {  760836,  686,  54051, 3467 }, {  919489,  689,  54927, 4134 }, { 1237776,  675,  54525, 5297 }, { 1484879,  606,  54119, 6295 },
+ { 1863941,  639,  54540, 8140 }, { 1988845,  685,  54614, 8655 }, {  575227,  639,  56762, 2435 }, {  663605,  694,  56119, 2934 },
+ {  781077,  669,  56395, 3574 }, { 1658005,  687,  56708, 7134 }, { 1758385,  694,  56624, 7673 }, { 2011052,  612,  56440, 8747 },
+ {  372866,  625,  57507, 1338 }, {  886831,  686,  57979, 3990 }, { 1087208,  682,  57454, 4732 }, { 1203903,  665,  57428, 5172 },
+ { 1811762,  651,  58139, 7920 }, { 1060353,  647,  59217, 4618 }, { 1270838,  642,  58920, 5425 }, { 1422882,  699,  58354, 6058 },
+ { 1426995,  602,  58481, 6072 }, {  253233,  600,  61007,  868 }, {  617342,  693,  60561, 2672 }, {  688946,  663,  60603, 3089 },
+ {  696487,  641,  60067, 3129 }, {  840065,  635,  60228, 3836 }, { 1141132,  685,  60478, 4933 }, { 1146021,  627,  61030, 4942 },
+ { 1278515,  605,  60331, 5453 }, { 1402784,  665,  60045, 5962 }, { 1544310,  677,  60316, 6569 }, { 1614853,  613,  59814, 6905 },
+ {   45754,  677,  62337,  125 }, {  580542,  693,  61488, 2462 }, {  606232,  695,  62217, 2608 }, {  632986,  676,  61563, 2762 },
+ {  689298,  624,  61317, 3090 }, {  731858,  682,  61881, 3294 }, { 1110602,  666,  62351, 4831 }, { 1125931,  633,  62541, 4888 },
+ { 1145101,  671,  61842, 4940 }, { 1711534,  690,  61311, 7424 }, {  170637,  683,  63184,  574 }, {  214063,  625,  63648,  721 },
+ {  682067,  671,  62737, 3046 }, {  712869,  627,  63127, 3206 }, {  759079,  677,  63085, 3452 }, { 1318177,  672,  62698, 5605 },
+ { 1318177,  682,  62698, 5606 }, { 1337711,  627,  63898, 5683 }, { 1437692,  647,  63432, 6115 }, {   60187,  659,  64203,  180 },
+ {  165510,  641,  64520,  555 }, {  629961,  649,  65186, 2740 }, {  683378,  611,  64623, 3055 }, {  861696,  658,  64877, 3912 },
+ { 1537416,  659,  64816, 6537 }, { 1819692,  689,  64410, 7952 }, {  109496,  696,  66310,  370 }, {  630927,  689,  65803, 2746 },
+ {  771570,  693,  65985, 3520 }, { 1035680,  646,  65789, 4546 }, { 1225848,  634,  66415, 5260 }, { 1253497,  677,  65809, 5364 },
+ { 1261403,  656,  65858, 5395 }, { 1261466,  635,  66089, 5396 }, { 1323599,  605,  65943, 5626 }, { 1407553,  672,  65788, 5980 },
+ { 1589219,  653,  66926, 6783 }, { 1619113,  696,  66869, 6934 }, { 2064894,  674,  66253, 8959 }, {  741955,  699,  68048, 3359 },
+ { 1329398,  682,  67721, 5651 }, { 1362984,  654,  68388, 5781 }, { 1370705,  664,  67955, 5825 }, { 1447739,  694,  67058, 6155 },
+ { 1568189,  686,  67491, 6675 }, { 1693215,  601,  67661, 7337 }, { 1694062,  629,  68157, 7343 }, {  291167,  627,  68550, 1008 },
+ { 1298545,  632,  69287, 5528 }, { 1965728,  611,  69540, 8560 }, { 2019790,  628,  69207, 8787 }, {  232726,  675,  71204,  789 },
+ {  715699,  675,  71343, 3226 }, {  753875,  614,  71346, 3426 }, {  763713,  607,  70851, 3477 }, {  961420,  639,  70234, 4293 },
+ { 1366139,  633,  70732, 5797 }, { 1476738,  673,  70433, 6262 }, { 1621657,  664,  70360, 6951 }, { 1664782,  675,  70044, 7188 },
+ { 2060855,  671,  70801, 8949 }, {  365317,  693,  72808, 1302 }, {  408597,  645,  72620, 1502 }, {  786563,  645,  71731, 3591 },
+ {  906329,  683,  72308, 4080 }, { 1232145,  636,  71623, 5285 }, { 1397381,  699,  72446, 5943 }, { 1569653,  688,  72404, 6682 },
+ { 1740726,  613,  72626, 7581 }, { 1945131,  679,  71866, 8486 }, { 1985741,  685,  71965, 8644 }, {  259627,  635,  73261,  898 },
+ {  316168,  658,  73218, 1106 }, {  719510,  644,  73325, 3243 }, { 1028942,  691,  73547, 4523 }, { 1126399,  627,  73078, 4889 },
+ { 1558572,  681,  72950, 6631 }, { 1672404,  659,  73541, 7242 }, { 1865242,  682,  73997, 8151 }, {  233988,  611,  75520,  794 },
+ {  624560,  683,  75229, 2702 }, {  715593,  645,  75175, 3225 }, { 1106648,  664,  75712, 4817 }, { 1256888,  642,  75020, 5378 },
+ { 1674850,  611,  74770, 7259 }, { 1931295,  646,  75065, 8411 }, {  669132,  684,  76179, 2961 }, {  688339,  649,  76987, 3084 },
+ {  809168,  694,  76561, 3682 }, { 1347619,  660,  76799, 5724 }, { 1403058,  689,  76608, 5967 }, { 1538708,  629,  76656, 6546 },
+ {  324527,  659,  77644, 1143 }, {  332921,  673,  78091, 1190 }, {  517732,  697,  77363, 2087 }, {  809372,  662,  77789, 3684 },
+ {  956415,  660,  77388, 4273 }, { 1153511,  685,  78356, 4979 }, { 1253277,  605,  78476, 5367 }, { 1284447,  600,  78343, 5471 },
+ { 1658386,  687,  77343, 7152 }, { 1669593,  693,  77279, 7226 }, { 1669593,  699,  77279, 7227 }, { 1674039,  611,  78504, 7254 },
+ { 1752809,  677,  78557, 7652 }, { 2057789,  637,  78379, 8937 }, {  334168,  617,  78935, 1195 }, {  638331,  666,  79712, 2787 },
+ {  726074,  645,  79604, 3270 }, { 1344445,  654,  79894, 5712 }, { 1407701,  623,  79811, 5987 }, {  443325,  655,  80803, 1652 },
+ {  520701,  636,  80512, 2106 }, {  548393,  637,  80304, 2256 }, {  718702,  678,  81410, 3237 }, {  829023,  651,  81485, 3765 },
+ { 1286918,  605,  80352, 5485 }, { 1288855,  692,  80379, 5489 }, { 1451077,  616,  80472, 6166 }, { 1637414,  687,  81034, 7029 },
+ { 1747243,  637,  80502, 7623 }, {  462371,  683,  82860, 1743 }, {  598377,  699,  82091, 2549 }, {  666091,  653,  82967, 2937 },
+ { 1019759,  670,  82640, 4494 }, { 1207967,  619,  82212, 5192 }, { 1368635,  667,  82156, 5820 }, { 1372882,  675,  82591, 5839 },
+ { 1443804,  623,  82582, 6143 }, { 1492507,  687,  81735, 6334 }, { 1934671,  699,  81620, 8433 }, {   40674,  681,  83023,  105 },
+ {  514261,  687,  84179, 2056 }, {  730192,  683,  83091, 3282 }, { 1038250,  628,  84335, 4552 }, { 1122394,  691,  84468, 4874 },
+ { 1202494,  623,  83076, 5168 }, { 1820398,  690,  84148, 7965 }, { 1900466,  634,  83050, 8305 }, {  246255,  646,  85060,  841 },
+ {  565311,  648,  85313, 2361 }, { 1211436,  656,  85917, 5210 }, { 1753928,  699,  84551, 7659 }, { 1836889,  667,  84844, 8039 },
+ { 1861133,  671,  84720, 8135 }, { 1934598,  650,  85908, 8431 }, { 1937167,  692,  85267, 8447 }, { 1968272,  629,  84973, 8576 },
+ { 1998887,  646,  85744, 8695 }, { 2003870,  621,  85255, 8720 }, { 2037184,  641,  85243, 8863 }, {  913356,  625,  86024, 4104 },
+ { 1213448,  673,  87276, 5221 }, { 1332014,  691,  86681, 5660 }, { 1557099,  683,  86949, 6628 }, {  656392,  665,  88783, 2881 },
+ {  695655,  679,  87869, 3113 }, { 1336689,  634,  87598, 5686 }, {   85352,  631,  89358,  280 }, {  181302,  669,  89270,  612 },
+ {  398328,  651,  89954, 1453 }, {  756880,  689,  89655, 3433 }, { 1264369,  697,  89554, 5407 }, { 1525322,  629,  90100, 6492 },
+ { 1580177,  669,  89682, 6742 }, {  224053,  690,  90633,  749 }, {  663195,  664,  90832, 2922 }, {  675079,  659,  90893, 2993 },
+ {  820227,  669,  91509, 3733 }, { 1424750,  678,  91188, 6070 }, { 1584636,  657,  90960, 6766 }, { 2081025,  657,  90484, 9016 },
+ {  635820,  664,  93034, 2766 }, {  772643,  601,  92784, 3518 }, {  779914,  689,  92743, 3556 }, {  850805,  679,  92871, 3871 },
+ {  928031,  689,  92351, 4162 }, {  968959,  694,  92178, 4314 }, { 1256976,  677,  92848, 5381 }, { 1296576,  641,  93149, 5526 },
+ { 1416019,  659,  93100, 6028 }, { 1554747,  654,  92960, 6616 }, { 1599156,  665,  91812, 6842 }, { 1743180,  652,  91998, 7604 },
+ { 1751498,  658,  92784, 7650 }, { 1981600,  617,  91814, 8628 }, {  632427,  666,  93720, 2745 }, {  668207,  650,  94374, 2948 },
+ {  668220,  662,  94377, 2949 }, { 1741568,  670,  93643, 7597 }, { 1746102,  683,  93492, 7618 }, { 1823097,  611,  94545, 7980 },
+ {  667448,  670,  95194, 2944 }, {  681701,  650,  96028, 3034 }, {  798153,  658,  95913, 3628 }, {  817734,  672,  96069, 3718 },
+ {  865374,  688,  96021, 3919 }, { 1290333,  694,  95308, 5497 }, { 1384963,  664,  95757, 5885 }, { 1388798,  659,  95140, 5904 },
+ { 1442093,  679,  94831, 6141 }, { 1682877,  685,  95037, 7292 }, { 1814758,  614,  95057, 7936 }, { 1845390,  650,  94672, 8080 },
+ {  340365,  665,  97011, 1213 }, {  349416,  666,  96143, 1240 }, {  638862,  698,  96933, 2781 }, {  638913,  640,  97509, 2782 },
+ { 1060829,  602,  97181, 4623 }, { 1428156,  655,  96366, 6081 }, { 1523887,  617,  96375, 6486 }, { 1713703,  660,  97406, 7440 },
+ {  265627,  609,  98485,  919 }, {  330372,  623,  97939, 1173 }, {  570680,  633,  98185, 2387 }, {  635864,  679,  98035, 2764 },
+ {  655151,  685,  97611, 2874 }, {  846555,  677,  98438, 3858 }, {  847948,  694,  98909, 3862 }, { 1149144,  695,  97748, 4958 },
+ { 1179230,  697,  97986, 5080 }, { 1369384,  696,  98767, 5824 }, { 1531237,  681,  98978, 6519 }, { 1572563,  676,  98764, 6700 },
+ { 1589937,  698,  98597, 6801 }, { 2019502,  647,  98658, 8789 }, {  169913,  685,  99800,  565 }, {  288895,  688,  99777,  994 },
+ {  575343,  654, 100437, 2414 }, {  661263,  645,  99463, 2906 }, {  694475,  620, 100314, 3102 }, {  826200,  669,  99533, 3749 },
+ {  978173,  648, 100235, 4343 }, { 1651755,  683, 100117, 7116 }, { 1653136,  699, 100010, 7120 }, { 2024208,  669,  99698, 8817 },
+ {  174770,  600, 100602,  585 }, {  249093,  675, 100495,  850 }, {  311352,  627, 101410, 1088 }, {  466687,  671, 100837, 1762 },
+ { 1444904,  645, 101168, 6153 }, { 1516071,  639, 100653, 6445 }, { 1548732,  687, 101484, 6595 }, { 1876839,  651, 101664, 8213 },
+ {  438985,  691, 102020, 1621 }, {  602274,  683, 102271, 2571 }, {  605295,  668, 102144, 2590 }, { 1408885,  632, 103210, 5997 },
+ { 1433204,  650, 102000, 6104 }, { 1609783,  681, 102734, 6896 }, { 2047704,  639, 102880, 8906 }, { 2058234,  671, 103277, 8939 },
+ {  408423,  632, 104379, 1496 }, {  644037,  696, 103426, 2812 }, {  712197,  640, 103758, 3192 }, {  866342,  694, 103415, 3923 },
+ { 1328519,  654, 104554, 5652 }, { 1371809,  674, 104390, 5838 }, { 1406026,  692, 104569, 5985 }, { 1415571,  601, 104072, 6027 },
+ { 1727764,  686, 104510, 7515 }, { 1841423,  684, 104646, 8060 }, { 1889010,  668, 104080, 8260 }, {   21321,  644, 106216,   48 },
+ {  240449,  647, 105691,  818 }, {  579469,  643, 105203, 2443 }, {  698857,  661, 105439, 3131 }, {  960867,  608, 105293, 4287 },
+ { 1026386,  673, 105368, 4514 }, { 1162761,  674, 105311, 5019 }, { 1208588,  697, 105053, 5196 }, { 1437457,  642, 105522, 6118 },
+ { 1685929,  696, 106246, 7304 }, { 1897134,  673, 106119, 8288 }, { 1985870,  669, 106067, 8649 }, {    5447,  655, 106803, 9098 },
+ {  606043,  637, 106393, 2596 }, {  997431,  608, 107310, 4405 }, { 1458647,  696, 107395, 6196 }, { 1789657,  678, 107499, 7822 },
+ { 1843669,  607, 106653, 8075 }, { 2070593,  682, 107503, 8982 }, {  531548,  693, 108476, 2148 }, {  930004,  691, 109047, 4171 },
+ { 1095281,  631, 108056, 4775 }, { 1239128,  691, 108210, 5301 }, { 1389109,  615, 108833, 5908 }, { 1443450,  628, 108663, 6147 },
+ { 1867407,  628, 108985, 8167 }, {   16406,  689, 109908,   33 }, {  221492,  675, 109583,  740 }, {  617143,  612, 110149, 2657 },
+ {  670487,  694, 109611, 2959 }, {  718469,  699, 110375, 3229 }, {  759812,  688, 110600, 3441 }, { 1175939,  676, 110645, 5068 },
+ { 1691887,  661, 110617, 7342 }, {  124693,  690, 111555,  412 }, {  533252,  667, 112045, 2155 }, {  581491,  682, 110895, 2450 },
+ {  660892,  697, 111446, 2902 }, {  861403,  612, 111916, 3903 }, { 1395465,  688, 111090, 5941 }, { 1615387,  670, 111507, 6930 },
+ { 2071988,  649, 111477, 8988 }, {  239022,  625, 113390,  811 }, {  465415,  629, 112397, 1756 }, {  766589,  632, 112937, 3484 },
+ {  881277,  660, 112234, 3970 }, {  928504,  682, 112699, 4163 }, { 1251170,  652, 112680, 5359 }, { 1931764,  627, 113406, 8418 },
+ { 1994612,  601, 113002, 8679 }, {  212555,  689, 114019,  708 }, {  329343,  642, 113744, 1162 }, {  436805,  679, 114379, 1611 },
+ {  456177,  636, 114967, 1705 }, {  603208,  607, 113652, 2574 }, {  715466,  672, 114946, 3211 }, {  757341,  698, 114288, 3431 },
+ { 1515816,  633, 114829, 6446 }, { 1545797,  626, 114870, 6581 }, { 1773329,  624, 114336, 7747 }, { 1777720,  676, 114701, 7773 },
+ {  232381,  684, 116322,  781 }, {  454818,  645, 116318, 1696 }, {  815229,  679, 116472, 3706 }, { 1404463,  677, 115595, 5978 },
+ { 1848982,  651, 115593, 8093 }, {    6556,  694, 117250, 9103 }, {   64356,  676, 117396,  194 }, {  159594,  667, 117508,  531 },
+ {  370490,  687, 116882, 1318 }, {  526968,  695, 117379, 2128 }, {  997036,  683, 117760, 4402 }, { 1242121,  619, 116907, 5315 },
+ { 1345962,  694, 116978, 5723 }, { 1360496,  662, 116602, 5777 }, { 1415578,  694, 116602, 6031 }, { 1470676,  665, 117649, 6243 },
+ { 1967022,  682, 117496, 8573 }, {  816263,  680, 118774, 3709 }, { 1014616,  670, 119133, 4468 }, { 1127734,  679, 118750, 4902 },
+ { 1634429,  672, 118041, 7020 }, { 2032914,  621, 118093, 8841 }, { 2035844,  639, 118231, 8858 }, { 2037385,  698, 118854, 8865 },
+ {  285203,  680, 120615,  984 }, {  450228,  627, 120520, 1679 }, { 1312137,  692, 120177, 5586 }, { 1438590,  663, 119962, 6129 },
+ { 1540599,  662, 119594, 6567 }, { 1607319,  668, 120782, 6884 }, { 1636247,  690, 119822, 7032 }, { 1824308,  673, 120853, 7990 },
+ {  371766,  643, 121828, 1325 }, {  439001,  681, 121131, 1617 }, {  471782,  614, 122054, 1784 }, {  483408,  662, 121316, 1855 },
+ {  493537,  680, 121188, 1937 }, {  566256,  660, 120925, 2356 }, {  762654,  662, 121218, 3459 }, { 1105733,  666, 122327, 4813 },
+ { 1713973,  695, 120918, 7446 }, { 1889988,  669, 122122, 8264 }, { 1946905,  616, 122018, 8499 }, {    2854,  641, 122355, 9089 },
+ {  366805,  604, 123554, 1298 }, {  487945,  678, 122337, 1887 }, { 1182510,  669, 122706, 5095 }, { 1246662,  608, 122335, 5338 },
+ { 2030630,  622, 122405, 8834 }, {    7770,  661, 124821,    3 }, {  306735,  673, 123900, 1070 }, {  426559,  639, 124450, 1560 },
+ { 1150448,  638, 124575, 4963 }, { 1524268,  654, 123916, 6493 }, { 1655966,  683, 125022, 7149 }, { 1662692,  602, 124866, 7193 },
+ { 1817148,  642, 123831, 7951 }, {  488442,  659, 126467, 1892 }, {  615912,  699, 125595, 2648 }, {  626566,  692, 125592, 2701 },
+ { 1306618,  649, 125751, 5570 }, { 1487026,  682, 125571, 6318 }, { 1641567,  622, 126336, 7063 }, {  149604,  699, 127708,  500 },
+ {  415792,  602, 127074, 1520 }, {  524371,  653, 126811, 2113 }, {  698665,  693, 127693, 3122 }, {  985460,  647, 127652, 4368 },
+ { 1005344,  677, 126708, 4432 }, { 1573568,  662, 127708, 6710 }, { 2095220,  686, 127513, 9067 }, {  341212,  679, 129550, 1212 },
+ {  553405,  690, 129535, 2275 }, {  711565,  634, 129592, 3188 }, {  828882,  660, 129279, 3759 }, {  963858,  674, 128865, 4299 },
+ { 1264410,  681, 128491, 5409 }, { 1297637,  694, 128595, 5535 }, { 1790808,  691, 129449, 7831 }, { 1801114,  689, 128960, 7873 },
+ { 1927217,  669, 128385, 8402 }, {   77199,  677, 129826,  248 }, {  480209,  671, 129750, 1834 }, {  496268,  621, 130989, 1949 },
+ {  496389,  695, 129803, 1952 }, {  700830,  668, 130187, 3141 }, {  833009,  657, 129885, 3787 }, { 1713725,  636, 130033, 7447 },
+ { 1803461,  632, 129769, 7884 }, {  232264,  607, 131551,  779 }, {  315844,  628, 131657, 1101 }, {  395952,  691, 131136, 1437 },
+ {  468599,  673, 131629, 1765 }, {  628949,  615, 131790, 2714 }, {  885374,  649, 131613, 3981 }, { 1015005,  630, 132272, 4471 },
+ { 1509675,  673, 131721, 6415 }, { 1698866,  666, 131565, 7387 }, { 1964374,  659, 131102, 8558 }, { 1964384,  642, 131101, 8559 },
+ { 1973881,  602, 131243, 8597 }, {  434793,  647, 133568, 1601 }, {  472947,  695, 133761, 1789 }, {  498768,  691, 133220, 1963 },
+ {  513278,  678, 133774, 2037 }, { 1225737,  626, 133321, 5264 }, { 1430248,  682, 132571, 6093 }, { 1575417,  645, 132973, 6723 },
+ { 1959201,  666, 133078, 8539 }, { 2048995,  694, 132901, 8911 }, { 2071006,  650, 133664, 8984 }, {  177744,  633, 135097,  596 },
+ {  456264,  646, 135239, 1698 }, {  593989,  647, 134585, 2506 }, {  702350,  639, 134472, 3145 }, { 1001881,  695, 135231, 4418 },
+ { 1314943,  640, 134118, 5601 }, { 1580808,  603, 134712, 6752 }, {  165377,  662, 135714,  549 }, {  290341,  683, 135980,  996 },
+ {  475991,  659, 135580, 1811 }, {  755494,  644, 135938, 3418 }, {  762002,  630, 136022, 3454 }, {  962010,  684, 136340, 4291 },
+ { 1078213,  696, 135896, 4695 }, { 1185665,  694, 136401, 5105 }, { 1603256,  686, 135990, 6866 }, { 2015417,  653, 136635, 8773 },
+ {  493974,  657, 137074, 1934 }, {  558903,  644, 137761, 2298 }, {  842436,  668, 137843, 3834 }, { 1524098,  634, 137102, 6498 },
+ { 1573247,  664, 137434, 6712 }, { 1654740,  662, 137194, 7141 }, { 1654774,  698, 137191, 7142 }, { 1962961,  679, 137910, 8551 },
+ {  147720,  644, 139064,  489 }, {  227010,  686, 139218,  754 }, {  481741,  620, 139735, 1839 }, {  753892,  616, 139378, 3410 },
+ {  769587,  636, 139574, 3492 }, {  795131,  697, 138488, 3613 }, { 1161597,  680, 139038, 5015 }, { 1930662,  684, 138439, 8413 },
+ { 2067952,  613, 139266, 8969 }, {  131342,  684, 140020,  434 }, {  962282,  699, 139958, 4294 }, {  991977,  605, 139853, 4386 },
+ { 1027983,  603, 140581, 4517 }, { 1049848,  666, 140705, 4589 }, { 2050503,  628, 140362, 8916 }, { 2096150,  601, 141067, 9072 },
+ {   70900,  643, 142118,  224 }, {   91668,  628, 142563,  294 }, {  572207,  650, 141752, 2385 }, {  968501,  663, 141756, 4310 },
+ { 1378358,  643, 141781, 5868 }, { 1709892,  645, 141818, 7429 }, {  193695,  637, 143956,  649 }, {  215771,  628, 143393,  718 },
+ {  261729,  670, 144044,  896 }, {  372150,  629, 144022, 1320 }, {  423234,  636, 144034, 1544 }, {  593217,  677, 142777, 2503 },
+ {  652685,  632, 144071, 2854 }, {  874124,  670, 142787, 3950 }, { 1027145,  685, 143099, 4515 }, { 1056161,  612, 143790, 4608 },
+ { 1283991,  686, 142958, 5480 }, { 1583505,  664, 143792, 6770 }, { 1739250,  671, 143395, 7595 }, { 2002822,  690, 143911, 8717 },
+ {  153490,  626, 144409,  510 }, {  369827,  684, 144563, 1311 }, {  487617,  641, 144892, 1876 }, {  490653,  609, 144602, 1907 },
+ {  527759,  612, 145122, 2124 }, {  583967,  666, 145484, 2456 }, {  649023,  699, 144581, 2828 }, {  885326,  637, 145632, 3980 },
+ { 2019973,  652, 144775, 8795 }, {  240214,  627, 145802,  813 }, {  401451,  625, 145870, 1458 }, {  429475,  665, 145855, 1570 },
+ { 1109576,  688, 145979, 4828 }, { 1476757,  638, 145876, 6281 }, { 1850069,  669, 145827, 8097 }, { 1856098,  649, 145646, 8123 },
+ {  784228,  625, 148341, 3572 }, {  832956,  697, 147528, 3782 }, { 1445586,  684, 147803, 6159 }, { 1795997,  603, 147534, 7852 },
+ {  307106,  611, 149912, 1066 }, {  405098,  627, 149292, 1473 }, {  509067,  691, 149497, 2010 }, {  655064,  654, 148558, 2864 },
+ { 1493316,  691, 149627, 6355 }, { 1990391,  619, 148800, 8665 }, { 2052230,  655, 149656, 8923 }, {  431622,  607, 150754, 1580 },
+ {  588351,  649, 150336, 2478 }, {  603871,  665, 150264, 2564 }, { 1177362,  698, 151139, 5072 }, { 1283265,  683, 151065, 5477 },
+ { 1283265,  643, 151065, 5478 }, {  388274,  669, 152500, 1396 }, {  398821,  665, 152691, 1444 }, {  426032,  674, 151826, 1556 },
+ {  535315,  642, 152580, 2159 }, {  541677,  648, 151765, 2199 }, { 1435117,  657, 151509, 6117 }, { 1490041,  698, 151595, 6337 },
+ { 1799048,  668, 152443, 7871 }, {  387896,  649, 153818, 1394 }, {  406723,  669, 154254, 1479 }, {  443560,  668, 153506, 1638 },
+ {  451033,  682, 153787, 1676 }, { 1208013,  607, 154079, 5200 }, { 1659697,  602, 153017, 7176 }, { 1768419,  695, 153205, 7724 },
+ { 1810918,  643, 153026, 7928 }, {  390944,  697, 154898, 1407 }, {  394034,  678, 154656, 1427 }, {  497047,  686, 155151, 1946 },
+ {  541845,  695, 154564, 2198 }, { 1252106,  686, 154821, 5370 }, { 1282651,  694, 154983, 5475 }, { 1289226,  660, 155778, 5502 },
+ { 1572947,  667, 155467, 6713 }, { 1815578,  627, 154555, 7948 }, {  384619,  680, 156477, 1380 }, {  386648,  629, 157182, 1389 },
+ {  472476,  699, 156388, 1780 }, { 1078747,  674, 156985, 4697 }, { 1134389,  678, 156426, 4920 }, { 1204787,  650, 156495, 5185 },
+ { 1720026,  637, 156523, 7488 }, { 1899833,  634, 156340, 8313 }, {  483821,  638, 158152, 1845 }, {  678841,  688, 158029, 3003 },
+ { 1381703,  609, 157493, 5879 }, { 1641344,  636, 157551, 7069 }, { 1718641,  637, 157307, 7479 }, {  165340,  683, 159174,  545 },
+ {  165340,  675, 159170,  546 }, {  279081,  635, 159801,  951 }, {  902555,  679, 159428, 4054 }, { 1298178,  655, 158890, 5544 },
+ { 1371234,  652, 159719, 5842 }, { 1867174,  608, 159914, 8173 }, {   21267,  680, 160500,   45 }, {  374662,  694, 161042, 1329 },
+ {  516106,  641, 160601, 2047 }, {  529997,  663, 160401, 2135 }, {  566469,  615, 160508, 2343 }, {  964588,  642, 160461, 4300 },
+ { 1031078,  653, 160518, 4527 }, { 1385380,  676, 161623, 5899 }, { 1585619,  636, 161385, 6787 }, { 1639364,  619, 160995, 7061 },
+ {  104061,  666, 161706,  351 }, {  260996,  663, 162151,  887 }, {  283846,  689, 161720,  972 }, {  441414,  664, 162515, 1620 },
+ {  477153,  688, 163020, 1810 }, {  762089,  666, 162338, 3449 }, { 1126195,  690, 162012, 4894 }, { 1208357,  691, 162040, 5201 },
+ { 1575058,  696, 162523, 6730 }, { 1602426,  695, 163056, 6868 }, { 1683863,  677, 162224, 7306 }, { 1803728,  682, 161948, 7891 },
+ {  356363,  636, 163231, 1256 }, {  386471,  622, 163540, 1387 }, {  387840,  628, 164297, 1392 }, {  411049,  628, 164505, 1497 },
+ {  464981,  694, 163252, 1739 }, {  832628,  631, 164522, 3773 }, { 1099332,  681, 164028, 4789 }, { 1401443,  683, 164283, 5972 },
+ { 1652597,  659, 164051, 7133 }, { 1734619,  695, 164000, 7565 }, {   83313,  642, 165176,  271 }, {  171746,  679, 165436,  569 },
+ {  329612,  618, 165949, 1156 }, {  530288,  616, 164952, 2134 }, {  983336,  663, 164707, 4362 }, { 1072375,  695, 165945, 4667 },
+ { 1878623,  657, 165499, 8225 }, { 2039825,  660, 165646, 8880 }, { 2046733,  640, 165157, 8905 }, {   68942,  606, 166414,  215 },
+ {  107404,  665, 166874,  360 }, {  327984,  630, 166705, 1145 }, {  508293,  686, 166851, 2002 }, {  954806,  650, 167116, 4259 },
+ { 1321354,  693, 167290, 5634 }, { 1702050,  644, 166993, 7405 }, { 1738104,  658, 166141, 7592 }, {  188484,  698, 168849,  623 },
+ {  521368,  682, 168870, 2084 }, { 1081352,  681, 168713, 4707 }, { 1238482,  683, 167614, 5304 }, { 1313791,  681, 167493, 5600 },
+ { 1769858,  678, 168343, 7739 }, { 1812981,  691, 167875, 7939 }, { 1900027,  613, 168420, 8315 }, { 2020130,  676, 168163, 8796 },
+ { 2093887,  666, 167687, 9064 }, {  663984,  606, 170242, 2905 }, {  689580,  697, 170053, 3067 }, {  822338,  646, 169203, 3731 },
+ { 1286578,  681, 169706, 5490 }, { 1317194,  654, 170317, 5616 }, { 1382948,  663, 169037, 5889 }, { 1394589,  615, 170216, 5947 },
+ { 1530249,  641, 169098, 6526 }, { 1639966,  683, 169902, 7064 }, {  115732,  676, 170778,  383 }, {  238044,  666, 171424,  801 },
+ {  379170,  695, 170904, 1348 }, {  514569,  658, 171285, 2034 }, {  704175,  694, 171550, 3149 }, { 1087026,  695, 170784, 4733 },
+ { 1123867,  694, 171181, 4883 }, { 1146412,  680, 171303, 4954 }, { 1153249,  626, 171672, 4983 }, { 1749231,  664, 171491, 7653 },
+ { 1770591,  652, 171579, 7744 }, { 1823544,  659, 170535, 7995 }, {  674746,  628, 173137, 2973 }, {  767058,  602, 172957, 3475 },
+ { 1087808,  636, 172241, 4737 }, { 1899296,  673, 172932, 8309 }, { 1953441,  681, 172331, 8522 }, {   56149,  637, 173760,  163 },
+ {  244534,  651, 173666,  824 }, {  291766,  647, 173377,  999 }, {  546684,  635, 174032, 2219 }, { 1273845,  646, 174391, 5447 },
+ { 1400203,  699, 174546, 5971 }, { 1695383,  697, 174211, 7372 }, { 1983202,  679, 173754, 8641 }, { 2073838,  693, 173833, 8997 },
+ {  104362,  651, 174893,  352 }, {  192780,  694, 175204,  642 }, {  627893,  641, 175120, 2697 }, { 1136358,  690, 175906, 4924 },
+ { 1430282,  685, 176062, 6103 }, { 1570684,  641, 175039, 6707 }, { 1717592,  669, 174986, 7478 }, { 1790436,  601, 175299, 7834 },
+ { 1814126,  622, 175811, 7942 }, {  654066,  618, 177361, 2852 }, {  930203,  671, 177641, 4166 }, {  987674,  687, 176990, 4374 },
+ {  987676,  641, 176990, 4375 }, { 1358678,  614, 176742, 5778 }, { 1590199,  697, 176809, 6815 }, { 2059219,  698, 176693, 8943 },
+ {  484571,  676, 177955, 1843 }, { 1660268,  693, 177887, 7192 }, { 1733886,  623, 179007, 7564 }, { 1782378,  643, 177952, 7806 },
+ {   53713,  636, 180179,  154 }, {  199979,  601, 180366,  664 }, {  323857,  697, 180537, 1123 }, {  463381,  654, 179673, 1726 },
+ {  911554,  674, 180291, 4090 }, { 1510714,  682, 179277, 6431 }, { 1727859,  699, 180192, 7534 }, { 1936934,  629, 179391, 8454 },
+ {  199598,  687, 180915,  660 }, {  289422,  682, 180913,  991 }, {  379250,  693, 181413, 1343 }, {  668708,  690, 181439, 2930 },
+ { 1211384,  674, 181235, 5219 }, { 1706516,  674, 181248, 7426 }, { 1816338,  692, 181133, 7956 }, { 1861104,  643, 181894, 8146 },
+ {  249784,  653, 182131,  843 }, {  260777,  693, 182311,  882 }, {  348018,  604, 183197, 1228 }, {  884634,  648, 182401, 3974 },
+ { 1249548,  681, 182786, 5361 }, { 1385331,  682, 183002, 5901 }, { 1797002,  661, 182410, 7866 }, {   26693,  652, 184644,   68 },
+ {  426178,  678, 184525, 1551 }, {  836273,  655, 184080, 3800 }, {  914421,  621, 184531, 4100 }, { 1190512,  682, 183930, 5127 },
+ { 1411167,  676, 184216, 6018 }, { 1601790,  633, 183595, 6872 }, { 1652240,  630, 184810, 7139 }, { 1761355,  693, 184724, 7708 },
+ { 1768792,  697, 184675, 7736 }, { 1816670,  653, 184216, 7963 }, {  187125,  682, 186208,  620 }, {  422212,  688, 185668, 1533 },
+ {  435824,  694, 186254, 1592 }, {  472810,  699, 185519, 1773 }, {  511239,  674, 185402, 2011 }, { 1186634,  698, 185223, 5110 },
+ { 1346386,  631, 185506, 5733 }, { 1511219,  665, 185382, 6436 }, { 1519974,  652, 185169, 6485 }, { 1638070,  636, 185838, 7056 },
+ { 1724728,  689, 185473, 7517 }, { 1945647,  613, 186048, 8498 }, {   24891,  661, 187406,   63 }, {  248433,  623, 186878,  840 },
+ {  456463,  686, 187119, 1689 }, {  795942,  656, 187072, 3612 }, {  989057,  678, 186684, 4380 }, { 1684084,  636, 186608, 7314 },
+ { 1741600,  694, 187122, 7613 }, { 1773530,  681, 186462, 7763 }, { 1885655,  690, 187191, 8255 }, {  260340,  670, 188835,  879 },
+ {  278586,  663, 188761,  947 }, {  508523,  652, 188134, 1995 }, {  628643,  690, 188337, 2696 }, {  837496,  681, 188775, 3809 },
+ { 1680282,  639, 188083, 7298 }, { 1860373,  623, 188445, 8143 }, { 1942601,  649, 188911, 8485 }, { 1979568,  688, 187943, 8622 },
+ {  146480,  694, 190166,  477 }, {  236291,  691, 189609,  788 }, {  371208,  671, 190031, 1306 }, {  464784,  671, 189471, 1729 },
+ {  922210,  675, 189946, 4132 }, { 1155934,  692, 189549, 4997 }, { 1161504,  673, 190160, 5017 }, {   72546,  653, 190897,  226 },
+ {  140971,  609, 191373,  458 }, {  402959,  625, 191168, 1454 }, { 1097716,  626, 191303, 4785 }, {  148238,  695, 193133,  483 },
+ {  180459,  684, 192721,  604 }, {  581569,  679, 192951, 2427 }, { 1387433,  662, 192897, 5914 }, { 1447768,  620, 192875, 6168 },
+ {  293371,  695, 194175, 1002 }, {  732306,  625, 193969, 3275 }, {  952425,  671, 193972, 4248 }, {  994439,  699, 194398, 4392 },
+ { 1653452,  604, 195073, 7157 }, { 1966791,  651, 193875, 8579 }, { 1998168,  694, 194150, 8699 }, { 2065311,  629, 194086, 8965 },
+ {  144689,  698, 195714,  469 }, {  194018,  683, 195489,  643 }, { 1410874,  626, 196513, 6023 }, { 1825173,  678, 195716, 8001 },
+ { 1981394,  646, 195554, 8632 }, { 2068620,  614, 195638, 8976 }, {  119916,  688, 197378,  390 }, {  127659,  683, 197200,  417 },
+ {  524194,  626, 197972, 2091 }, {  608201,  690, 196745, 2585 }, { 1114301,  699, 197249, 4846 }, { 1469808,  682, 198040, 6254 },
+ { 1884497,  602, 197470, 8252 }, {  380914,  685, 198791, 1350 }, { 1247198,  618, 198193, 5351 }, { 1402177,  676, 198118, 5982 },
+ { 1766996,  683, 199252, 7730 }, { 1818898,  684, 198231, 7977 }, { 1953012,  657, 198846, 8523 }, { 2076814,  695, 198676, 9003 },
+ {   63305,  694, 199557,  184 }, {  101221,  625, 199873,  335 }, {  306672,  636, 200970, 1052 }, {  362140,  604, 200558, 1273 },
+ { 1316240,  676, 200474, 5618 }, { 1834756,  674, 200280, 8047 }, { 1844622,  655, 200465, 8089 }, { 1965396,  636, 200550, 8572 },
+ {   65136,  654, 201391,  193 }, {  315286,  623, 201258, 1087 }, {  371223,  614, 201573, 1303 }, { 1454533,  690, 202329, 6200 },
+ { 1791402,  695, 202363, 7844 }, {  239134,  612, 202766,  799 }, {  275348,  605, 203327,  937 }, {  302997,  698, 202525, 1034 },
+ {  304915,  667, 203175, 1044 }, {  560549,  691, 202853, 2289 }, {  650573,  664, 202741, 2818 }, { 1186136,  670, 202457, 5112 },
+ { 1903156,  623, 202884, 8335 }, { 1958095,  657, 203127, 8541 }, { 2004576,  695, 203502, 8726 }, { 2028048,  652, 203025, 8830 },
+ { 2035613,  685, 202456, 8860 }, {   61261,  680, 204636,  179 }, {   71121,  689, 205300,  223 }, {  150966,  607, 204893,  496 },
+ {  212079,  671, 204296,  699 }, {  359113,  629, 204402, 1261 }, {  376094,  661, 204320, 1324 }, { 1650381,  692, 204921, 7137 },
+ { 1713317,  648, 204212, 7469 }, { 2015863,  665, 203966, 8780 }, {  711367,  684, 206084, 3173 }, {  799352,  648, 206227, 3619 },
+ { 1083565,  680, 206165, 4716 }, { 1242975,  654, 206497, 5329 }, { 1246880,  675, 205881, 5350 }, { 1260034,  605, 206585, 5404 },
+ { 1896314,  667, 205622, 8301 }, { 1976818,  663, 206140, 8613 }, { 2094841,  680, 205912, 9066 }, {  837150,  650, 206877, 3799 },
+ { 1741262,  692, 207442, 7619 }, { 1956701,  643, 207136, 8538 }, {  432955,  647, 209354, 1568 }, {   46273,  673, 210476,  123 },
+ {  810008,  683, 209747, 3662 }, {  862318,  659, 209809, 3894 }, { 1172694,  601, 211154, 5062 }, { 1195287,  666, 210708, 5154 },
+ { 1394883,  695, 210807, 5960 }, {  103552,  633, 211390,  343 }, {  516783,  699, 212201, 2029 }, {  918417,  684, 212600, 4112 },
+ { 1532343,  688, 211440, 6554 }, { 1532475,  687, 211424, 6555 }, { 2095708,  688, 212271, 9071 }, {  270212,  676, 213656,  918 },
+ { 1137020,  693, 213162, 4931 }, { 1464070,  685, 213767, 6237 }, { 1767140,  630, 213455, 7740 }, { 1620305,  677, 214151, 6978 },
+ { 1680518,  699, 215111, 7309 }, { 1813675,  651, 214929, 7955 }, { 1944283,  619, 214148, 8494 }, { 2088972,  654, 214812, 9045 },
+ {   80102,  683, 216957,  253 }, {  116627,  698, 215878,  382 }, {  305711,  654, 216820, 1040 }, {  607700,  635, 216156, 2560 },
+ {  674303,  699, 216575, 2946 }, { 1400852,  601, 216364, 5986 }, { 1607683,  698, 216707, 6923 }, { 1741689,  696, 216773, 7633 },
+ { 1898369,  608, 216677, 8316 }, { 2053510,  691, 216340, 8926 }, { 2078304,  687, 216490, 9008 }, {   82522,  663, 217261,  265 },
+ {  136798,  671, 217335,  442 }, {  304478,  621, 218366, 1035 }, {  552866,  648, 217013, 2238 }, {  591623,  687, 217640, 2470 },
+ { 1647432,  666, 217562, 7125 }, { 2019405,  685, 217608, 8797 }, {  441885,  603, 219097, 1603 }, {   77286,  682, 220091,  244 },
+ {  550376,  698, 220660, 2215 }, { 1901197,  629, 220086, 8334 }, {   48060,  616, 222723,  130 }, { 1790708,  622, 222814, 7850 },
+ { 1890233,  673, 221485, 8279 }, { 2045944,  698, 221778, 8904 }, {  329192,  680, 223325, 1129 }, {  802333,  667, 223570, 3624 },
+ { 1917513,  691, 223733, 8383 }, {  757615,  660, 224756, 3403 }, { 1210860,  665, 225332, 5226 }, { 1457693,  683, 225137, 6223 },
+ { 1927909,  629, 225193, 8417 }, {  291257,  684, 226685,  985 }, {  334263,  647, 226501, 1155 }, {  908958,  697, 226560, 4072 },
+ { 1307200,  660, 227093, 5589 }, { 1479699,  689, 225931, 6315 }, { 1610707,  682, 226556, 6945 }, { 1690346,  659, 226776, 7371 },
+ {  428241,  629, 227691, 1542 }, {  217094,  652, 229234,  707 }, {  790138,  676, 229565, 3576 }, {  801559,  680, 228844, 3616 },
+ { 1751731,  651, 229920, 7685 }, {  125149,  674, 230294,  399 }, {  168937,  699, 231102,  548 }, { 1539297,  680, 231208, 6596 },
+ { 2036896,  675, 230267, 8872 }, {  551736,  680, 232026, 2209 }, {  836650,  656, 232770, 3771 }, { 1092429,  695, 231853, 4765 },
+ { 1707373,  668, 232523, 7462 }, {  177612,  654, 234338,  575 }, { 1099160,  694, 233049, 4795 }, {  335484,  663, 234957, 1148 },
+ { 1603096,  622, 234965, 6920 }, { 1652087,  682, 234906, 7180 }, { 1896061,  656, 234927, 8317 }, { 1546560,  658, 236146, 6636 },
+ { 1936671,  679, 236426, 8468 }, { 1682892,  645, 237904, 7352 }, {  279531,  687, 239416,  932 }, {  924919,  684, 241337, 4126 },
+ { 1263425,  625, 241312, 5430 }, { 1423595,  695, 241399, 6116 }, { 2021274,  641, 240863, 8819 }, {  611767,  655, 243179, 2527 },
+ { 1236225,  682, 244009, 5321 }, { 1356471,  696, 243720, 5826 }, { 1374885,  632, 244368, 5903 }, { 1760571,  639, 244247, 7750 },
+ {  840444,  629, 249512, 3751 }, {  656923,  696, 251092, 2742 }, { 1465048,  623, 250547, 6322 }, { 1991542,  674, 252174, 8702 },
+ { 2001634,  671, 253910, 8748 }, {  100117,  625, 256693,  285 }, { 1532399,  636, 257173, 6789 }, { 1847780,  747,   4306, 7228 },
+ { 1652646,  728,   5251, 6721 }, { 2050638,  749,   5071, 8862 }, {  781604,  742,   8247, 3678 }, { 1128642,  746,   7461, 4870 },
+ { 1195558,  758,   8427, 5084 }, { 1968444,  777,   8690, 8505 }, {   19403,  777,  10186,   47 }, {  141946,  769,   9859,  525 },
+ { 1326942,  791,   9885, 5557 }, { 1373751,  757,   9416, 5729 }, { 1313410,  765,  10526, 5525 }, { 1317679,  765,  10250, 5545 },
+ {   14615,  728,  11977,   30 }, {  142616,  787,  13071,  512 }, {  435230,  785,  12336, 1716 }, {  874874,  752,  11964, 3983 },
+ { 1216997,  795,  12621, 5188 }, { 1909143,  729,  12698, 8280 }, { 2085657,  711,  11678, 9032 }, { 2093577,  773,  11898, 9061 },
+ {  380058,  779,  13952, 1456 }, { 1803420,  791,  13528, 7812 }, {  375718,  769,  14875, 1426 }, {  491030,  765,  15247, 2022 },
+ {  582608,  764,  15748, 2559 }, {  734484,  769,  15895, 3393 }, {  821605,  736,  15710, 3795 }, {  835783,  711,  15935, 3860 },
+ {  939730,  747,  15248, 4231 }, { 1255930,  706,  14722, 5336 }, { 1531292,  788,  15815, 6429 }, { 1615572,  795,  14903, 6837 },
+ { 1796111,  777,  15969, 7785 }, { 1951553,  710,  15204, 8481 }, { 1995763,  735,  14744, 8663 }, {  220893,  728,  16179,  776 },
+ {  510130,  747,  16546, 2125 }, {  606679,  745,  16632, 2689 }, {  649000,  753,  16157, 2919 }, {  765926,  779,  16755, 3543 },
+ {  934769,  797,  17161, 4206 }, {  273115,  757,  18917,  981 }, {  305806,  770,  17989, 1109 }, {  759235,  747,  18879, 3502 },
+ { 1156764,  785,  18128, 4976 }, { 1427879,  727,  18448, 6021 }, { 2074838,  775,  18629, 8995 }, {   31278,  797,  19554,   87 },
+ {  285387,  752,  19498, 1025 }, { 1311007,  793,  19166, 5547 }, { 1841877,  715,  18967, 8021 }, { 1948373,  751,  19678, 8471 },
+ { 2058304,  781,  19494, 8935 }, {  483338,  719,  20886, 1953 }, {  853924,  745,  21519, 3902 }, { 1055530,  704,  21145, 4605 },
+ { 1231101,  750,  21549, 5261 }, { 1307635,  734,  21354, 5540 }, { 1371756,  795,  20508, 5786 }, { 1926850,  795,  20562, 8380 },
+ { 1015458,  765,  23151, 4479 }, { 1059979,  718,  22380, 4617 }, { 1589265,  786,  23144, 6731 }, { 1607236,  747,  21910, 6829 },
+ {   70764,  707,  24646,  236 }, {  429897,  747,  24666, 1629 }, {  539201,  709,  24398, 2261 }, {  811806,  729,  24604, 3720 },
+ {  811855,  786,  24372, 3721 }, { 1172539,  705,  24595, 5042 }, {  208072,  701,  25699,  715 }, {  487508,  778,  25838, 1964 },
+ {  731197,  729,  25341, 3334 }, {  832460,  747,  24876, 3821 }, { 1095422,  788,  24761, 4769 }, { 1300858,  760,  25035, 5520 },
+ { 1356614,  749,  25325, 5730 }, { 1369489,  765,  25409, 5782 }, { 1591178,  785,  25736, 6751 }, { 1620810,  789,  26164, 6899 },
+ { 1848656,  768,  25010, 8061 }, {  996416,  759,  26588, 4406 }, { 1130896,  793,  26484, 4907 }, { 1406738,  770,  26798, 5955 },
+ { 1732221,  741,  26947, 7498 }, { 1958235,  729,  26587, 8515 }, {    6828,  759,  28307, 9108 }, {  265431,  753,  28985,  939 },
+ {  440863,  731,  28129, 1677 }, {  727911,  737,  28421, 3301 }, {  728195,  765,  28407, 3302 }, {  825909,  747,  28548, 3777 },
+ { 1121027,  755,  29107, 4862 }, {  412243,  754,  30483, 1541 }, {  599218,  740,  30530, 2602 }, {  624344,  769,  29851, 2735 },
+ {  738782,  753,  29263, 3370 }, {  755975,  720,  29691, 3460 }, {  952020,  799,  30176, 4262 }, {  971144,  757,  30406, 4329 },
+ { 1173583,  767,  30041, 5049 }, { 1331573,  781,  29243, 5644 }, { 1448086,  750,  30566, 6135 }, { 1517666,  741,  29307, 6411 },
+ { 1854438,  702,  29311, 8092 }, { 1959053,  778,  29756, 8527 }, {   30074,  751,  31494,   83 }, {   80107,  745,  31351,  270 },
+ {  299431,  796,  31073, 1064 }, {  557255,  756,  32017, 2352 }, {  561391,  738,  31589, 2377 }, { 1052404,  789,  30863, 4597 },
+ { 1153230,  791,  31955, 4966 }, { 1211382,  775,  31168, 5194 }, { 1484846,  779,  30974, 6276 }, { 1745716,  775,  30822, 7579 },
+ { 1876876,  734,  31319, 8196 }, { 1908969,  753,  31500, 8333 }, {  537012,  706,  33268, 2221 }, {  788095,  788,  33036, 3610 },
+ {  811608,  739,  33044, 3712 }, {  887661,  781,  33035, 4002 }, { 1055341,  735,  32519, 4604 }, { 1080905,  774,  32488, 4704 },
+ { 1259901,  761,  32324, 5379 }, { 1348942,  789,  32490, 5713 }, { 1391538,  709,  32918, 5891 }, { 1458378,  791,  32471, 6172 },
+ { 1665335,  788,  33140, 7161 }, { 1674632,  733,  32658, 7221 }, { 1705657,  796,  32672, 7383 }, { 1819427,  741,  33171, 7934 },
+ { 2016863,  752,  33234, 8769 }, {  195509,  755,  34722,  667 }, {  197299,  769,  34583,  678 }, {  611439,  717,  34830, 2662 },
+ { 1016255,  796,  34400, 4485 }, { 1080793,  715,  34256, 4703 }, { 1215788,  771,  34446, 5218 }, { 1268886,  783,  34541, 5408 },
+ { 1324553,  776,  33619, 5621 }, { 1422993,  775,  34867, 6037 }, { 1466065,  713,  33656, 6204 }, { 1504840,  789,  33783, 6368 },
+ { 1964082,  755,  34209, 8547 }, {  307087,  783,  35666, 1092 }, {  509569,  711,  36265, 2064 }, {  533254,  771,  35010, 2194 },
+ {  684026,  779,  35238, 3081 }, {  772713,  735,  36108, 3537 }, {  827953,  791,  35975, 3783 }, {  893489,  716,  35496, 4025 },
+ { 1008281,  790,  36354, 4448 }, { 1154621,  790,  35283, 4977 }, { 1224606,  797,  35344, 5253 }, { 1247577,  775,  35809, 5320 },
+ { 1294321,  791,  35817, 5500 }, { 1685295,  753,  35916, 7278 }, { 1748185,  776,  36335, 7603 }, { 1750355,  731,  36328, 7612 },
+ { 1808723,  715,  36061, 7881 }, {   61856,  739,  37091,  187 }, {  540672,  701,  37267, 2245 }, {  725724,  707,  37302, 3280 },
+ {  886498,  728,  37596, 3995 }, {  932342,  752,  36555, 4185 }, { 1018706,  717,  36988, 4492 }, { 1147778,  751,  36855, 4952 },
+ { 1262833,  785,  37606, 5391 }, { 1396599,  775,  36464, 5920 }, { 1450161,  752,  37130, 6151 }, { 1643687,  773,  36522, 7036 },
+ {  123919,  793,  38403,  420 }, {  484956,  734,  38197, 1917 }, {  736712,  797,  38740, 3346 }, {  901601,  767,  38850, 4065 },
+ {  915868,  729,  38116, 4120 }, {  937679,  777,  38228, 4204 }, {  941206,  734,  38615, 4219 }, {  941527,  723,  38249, 4220 },
+ {  979768,  723,  38112, 4355 }, {  989266,  799,  38714, 4384 }, {  995220,  711,  39256, 4401 }, { 1046821,  761,  38359, 4578 },
+ { 1172704,  731,  38572, 5048 }, { 1194476,  779,  38705, 5130 }, { 1317715,  717,  37911, 5593 }, { 1350845,  771,  38639, 5725 },
+ { 1438814,  727,  37950, 6109 }, { 1636390,  778,  38668, 7004 }, { 1907828,  762,  38903, 8331 }, { 2074142,  772,  38454, 8996 },
+ { 2093638,  700,  38300, 9062 }, {   47667,  709,  39367,  136 }, {  240966,  774,  40347,  833 }, {  375259,  787,  39694, 1372 },
+ {  381403,  724,  39884, 1395 }, {  447927,  720,  39904, 1695 }, {  998652,  717,  40738, 4413 }, { 1041290,  791,  39728, 4563 },
+ { 1095077,  795,  40059, 4771 }, { 1110964,  731,  39407, 4830 }, { 1299918,  787,  40501, 5527 }, { 1595702,  760,  39403, 6805 },
+ { 1847457,  776,  40674, 8073 }, { 2052030,  768,  39483, 8919 }, {   78107,  770,  42047,  257 }, {  246161,  726,  41953,  852 },
+ {  288023,  754,  41616, 1006 }, {  288672,  724,  41515, 1010 }, {  371096,  745,  41057, 1340 }, {  389961,  775,  41536, 1435 },
+ {  398411,  779,  41977, 1475 }, {  403061,  740,  40891, 1492 }, {  534565,  705,  41003, 2196 }, {  721282,  716,  42112, 3260 },
+ {  753392,  747,  42021, 3432 }, {  828351,  792,  41176, 3776 }, {  860602,  757,  41863, 3914 }, { 1024575,  703,  41491, 4511 },
+ { 1034672,  770,  41724, 4541 }, { 1045180,  757,  41432, 4573 }, { 1066586,  792,  42163, 4644 }, { 1289295,  736,  42053, 5482 },
+ { 1305962,  711,  41915, 5551 }, { 1520462,  770,  42037, 6440 }, { 1588061,  749,  40781, 6761 }, { 2034473,  766,  40780, 8843 },
+ { 2093266,  797,  42171, 9060 }, {   98030,  737,  43363,  332 }, {  386063,  794,  42581, 1416 }, {  821523,  799,  43179, 3742 },
+ {  823499,  777,  43618, 3752 }, {  887452,  760,  43034, 3999 }, {  953175,  793,  43438, 4266 }, {  973671,  713,  43614, 4338 },
+ {  999917,  730,  42402, 4415 }, { 1014165,  783,  42310, 4472 }, { 1015094,  715,  42647, 4475 }, { 1016713,  715,  43438, 4487 },
+ { 1190138,  763,  43242, 5113 }, { 1252260,  723,  42632, 5349 }, { 1442991,  720,  43157, 6125 }, { 1915387,  790,  43525, 8352 },
+ {   62182,  798,  44073,  186 }, {  148257,  771,  44840,  505 }, {  211024,  735,  44145,  714 }, {  559573,  780,  44100, 2345 },
+ {  683344,  778,  44104, 3070 }, {  693677,  774,  44457, 3120 }, {  695820,  760,  44132, 3138 }, {  697364,  781,  44891, 3147 },
+ {  698507,  717,  44545, 3153 }, {  777419,  778,  44207, 3560 }, {  787541,  779,  45094, 3604 }, {  876726,  794,  44304, 3960 },
+ {  954331,  792,  44443, 4271 }, { 1055787,  796,  45102, 4607 }, { 1123282,  772,  44171, 4876 }, { 1126292,  776,  44169, 4887 },
+ { 1126955,  790,  44240, 4890 }, { 1304278,  720,  43857, 5546 }, { 1334905,  773,  45007, 5661 }, { 1335398,  709,  45085, 5664 },
+ { 1338122,  746,  44414, 5680 }, { 1344468,  767,  44647, 5700 }, { 1391604,  777,  43950, 5900 }, { 1392422,  776,  44394, 5905 },
+ { 1520889,  777,  44672, 6447 }, { 1560618,  778,  43930, 6624 }, { 1658216,  714,  43983, 7127 }, { 1805944,  712,  44490, 7875 },
+ {   58895,  789,  45809,  176 }, {  267406,  711,  46222,  934 }, {  414117,  727,  46214, 1530 }, {  616417,  750,  45406, 2674 },
+ {  785561,  716,  45269, 3598 }, {  805258,  754,  45751, 3673 }, {  861000,  779,  45767, 3913 }, {  926735,  708,  45969, 4164 },
+ {  935966,  738,  45461, 4198 }, {  945760,  791,  45618, 4239 }, {  980875,  774,  46049, 4361 }, { 1007461,  713,  45791, 4441 },
+ { 1007526,  715,  45898, 4442 }, { 1094701,  748,  45764, 4768 }, { 1146739,  799,  46400, 4944 }, { 1368889,  795,  46470, 5803 },
+ { 1513455,  791,  46158, 6408 }, { 1734151,  742,  45428, 7531 }, { 1750168,  713,  45695, 7625 }, { 1930907,  762,  46073, 8409 },
+ {  475240,  714,  47932, 1836 }, {  563707,  782,  46607, 2369 }, {  570852,  770,  47702, 2412 }, {  750397,  726,  46931, 3415 },
+ {  830691,  788,  47130, 3793 }, {  890962,  772,  46692, 4009 }, {  910208,  795,  47443, 4095 }, {  928349,  745,  47671, 4169 },
+ {  930597,  792,  47793, 4179 }, { 1088594,  750,  48048, 4739 }, { 1156640,  789,  47599, 4988 }, { 1197151,  738,  47750, 5140 },
+ { 1439248,  769,  47477, 6114 }, { 1465608,  774,  47337, 6215 }, { 1467024,  758,  47101, 6219 }, { 1518858,  788,  46618, 6438 },
+ { 1743408,  726,  47916, 7587 }, { 2049456,  763,  47297, 8909 }, {  280426,  774,  48528,  977 }, {  513130,  794,  48287, 2072 },
+ {  691604,  763,  48501, 3105 }, {  729925,  797,  49477, 3293 }, {  774213,  759,  48982, 3536 }, {  845718,  732,  49492, 3863 },
+ {  846196,  780,  48438, 3864 }, {  929215,  791,  48433, 4173 }, {  950294,  725,  48410, 4250 }, { 1030107,  741,  49074, 4526 },
+ { 1081812,  739,  49044, 4706 }, { 1128112,  717,  48305, 4899 }, { 1245111,  707,  48185, 5316 }, { 1411660,  757,  49421, 5994 },
+ { 1421153,  763,  49388, 6040 }, { 1476757,  794,  49384, 6251 }, { 1491908,  773,  49097, 6320 }, { 1616474,  776,  48822, 6908 },
+ { 1958711,  732,  49221, 8531 }, { 1981831,  797,  48675, 8620 }, {   60837,  770,  50247,  183 }, {  145330,  787,  49805,  486 },
+ {  145340,  776,  49800,  487 }, {  557682,  761,  50055, 2320 }, {  567214,  722,  50758, 2389 }, {  617939,  717,  50608, 2683 },
+ {  683193,  759,  50114, 3062 }, {  712973,  766,  49641, 3218 }, {  900941,  781,  49676, 4061 }, {  942201,  723,  50619, 4221 },
+ {  994888,  779,  50651, 4398 }, { 1037170,  757,  50955, 4551 }, { 1046032,  744,  49978, 4576 }, { 1080555,  792,  50062, 4702 },
+ { 1092119,  780,  50280, 4754 }, { 1130059,  732,  50734, 4908 }, { 1228344,  792,  49827, 5266 }, { 1519147,  780,  50281, 6442 },
+ { 1531188,  795,  50857, 6505 }, { 1597804,  733,  49550, 6819 }, { 1730180,  735,  50044, 7510 }, { 2046650,  759,  50753, 8901 },
+ {  203752,  781,  52348,  688 }, {  593191,  761,  51759, 2526 }, {  807258,  727,  51802, 3679 }, {  818229,  763,  51722, 3732 },
+ { 1076240,  700,  51181, 4682 }, { 1327128,  754,  51476, 5637 }, { 1385159,  773,  51054, 5873 }, { 1417583,  781,  51760, 6019 },
+ { 1427840,  777,  51176, 6073 }, { 1527200,  794,  51220, 6487 }, {  233978,  721,  53230,  802 }, {  656110,  796,  53010, 2892 },
+ {  688121,  770,  52964, 3088 }, {  700262,  787,  52649, 3156 }, {  779439,  771,  53835, 3570 }, {  912868,  758,  53707, 4107 },
+ { 1125858,  793,  53816, 4885 }, { 1196753,  701,  53244, 5141 }, { 1272185,  787,  53883, 5426 }, { 1485633,  765,  53298, 6297 },
+ { 1540960,  725,  53157, 6549 }, { 1693525,  705,  53046, 7329 }, { 1700734,  769,  52903, 7370 }, { 1736889,  774,  53843, 7548 },
+ { 1842635,  716,  53488, 8055 }, {  149260,  752,  54964,  506 }, {  154527,  704,  54645,  520 }, {  423683,  761,  54557, 1563 },
+ {  706430,  753,  54043, 3180 }, {  739258,  709,  54014, 3350 }, {  745771,  769,  54194, 3386 }, {  756426,  748,  54526, 3440 },
+ {  757247,  719,  53965, 3442 }, {  757727,  761,  53907, 3448 }, {  760677,  752,  54031, 3466 }, {  824736,  711,  54437, 3753 },
+ {  840616,  745,  54859, 3840 }, {  850079,  756,  55184, 3875 }, {  981081,  776,  54223, 4360 }, { 1000208,  781,  54118, 4417 },
+ { 1020483,  796,  55296, 4497 }, { 1147082,  771,  54555, 4951 }, { 1214190,  789,  54429, 5217 }, { 1242669,  756,  54855, 5308 },
+ { 1383706,  777,  54190, 5869 }, { 1417442,  783,  54863, 6022 }, { 1422449,  744,  55066, 6055 }, { 1463147,  796,  54107, 6207 },
+ { 1490066,  729,  54230, 6314 }, { 1558985,  792,  54777, 6622 }, { 1708155,  775,  54156, 7411 }, { 1857968,  775,  54268, 8114 },
+ { 1948982,  737,  54799, 8501 }, { 2016557,  737,  55291, 8774 }, {   50191,  757,  55885,  140 }, {  229240,  731,  56132,  778 },
+ {  511016,  717,  55500, 2049 }, {  516769,  729,  56267, 2094 }, {  558699,  798,  55605, 2322 }, {  591128,  780,  55939, 2515 },
+ {  634024,  797,  56069, 2767 }, {  641736,  739,  55467, 2815 }, {  655350,  787,  56290, 2884 }, {  732430,  785,  55522, 3300 },
+ {  788971,  723,  55616, 3605 }, { 1122799,  773,  56488, 4872 }, { 1166002,  748,  56431, 5026 }, { 1168390,  783,  55608, 5036 },
+ { 1211804,  725,  56524, 5207 }, { 1216353,  771,  55576, 5230 }, { 1272124,  787,  56332, 5427 }, { 1291819,  721,  55900, 5495 },
+ { 1305315,  738,  56521, 5556 }, { 1367263,  744,  55884, 5798 }, { 1480354,  794,  55755, 6275 }, { 1526202,  775,  55774, 6483 },
+ { 1649556,  717,  55498, 7087 }, { 1669466,  716,  55838, 7213 }, { 1768477,  765,  55990, 7714 }, { 2048524,  752,  56393, 8907 },
+ { 2095594,  713,  56428, 9069 }, {  208128,  792,  56932,  701 }, {  525482,  767,  57113, 2138 }, {  569880,  760,  58001, 2400 },
+ {  592562,  740,  57185, 2523 }, {  612919,  714,  57384, 2652 }, {  622187,  796,  58207, 2698 }, {  650066,  710,  56825, 2862 },
+ {  736212,  717,  57858, 3330 }, {  812787,  726,  56872, 3703 }, {  813670,  787,  57614, 3708 }, {  830249,  745,  57551, 3784 },
+ {  836162,  701,  57170, 3819 }, {  864838,  793,  57012, 3924 }, {  893299,  728,  57138, 4017 }, {  893426,  778,  57899, 4020 },
+ { 1131695,  716,  57087, 4913 }, { 1178803,  706,  57039, 5071 }, { 1549774,  715,  58013, 6585 }, { 1666008,  793,  56825, 7190 },
+ { 1822631,  705,  57684, 7968 }, { 1835530,  776,  57184, 8027 }, { 2045041,  775,  58096, 8898 }, {    1942,  753,  58745, 9082 },
+ {   73818,  722,  59692,  242 }, {  154515,  749,  59443,  519 }, {  161522,  794,  58554,  541 }, {  236743,  741,  59420,  810 },
+ {  309592,  768,  58806, 1090 }, {  411818,  731,  58955, 1516 }, {  465114,  745,  59137, 1767 }, {  567714,  727,  58603, 2384 },
+ {  685067,  791,  58997, 3071 }, {  705905,  795,  59114, 3178 }, {  718811,  751,  58540, 3247 }, {  751288,  780,  59667, 3413 },
+ {  866321,  772,  58609, 3927 }, {  957017,  791,  59368, 4274 }, { 1155460,  789,  59274, 4985 }, { 1205076,  791,  58617, 5175 },
+ { 1205338,  745,  58722, 5176 }, { 1222302,  791,  58793, 5251 }, { 1483007,  755,  59188, 6289 }, { 1523348,  723,  59177, 6468 },
+ { 1525105,  792,  59172, 6478 }, { 1540028,  793,  58342, 6547 }, { 2011409,  768,  59638, 8749 }, { 2020322,  783,  59254, 8793 },
+ { 2078608,  718,  58584, 9006 }, {    9200,  770,  59820,    6 }, {  440999,  738,  59931, 1649 }, {  444140,  703,  60552, 1663 },
+ {  749625,  701,  61086, 3407 }, {  762652,  716,  60909, 3476 }, {  835572,  712,  59718, 3817 }, {  979474,  736,  59858, 4350 },
+ { 1012090,  750,  59910, 4462 }, { 1267537,  737,  60467, 5413 }, { 1321543,  777,  59839, 5617 }, { 1430821,  733,  60544, 6083 },
+ { 1458788,  765,  60660, 6188 }, {    1565,  771,  62347, 9081 }, {   44324,  769,  61480,  120 }, {   51970,  751,  61168,  147 },
+ {  561755,  776,  61425, 2348 }, {  627386,  714,  62525, 2719 }, {  665164,  772,  62376, 2940 }, {  667452,  768,  62042, 2957 },
+ {  712391,  770,  62164, 3203 }, {  715340,  782,  61840, 3227 }, {  758890,  790,  62510, 3453 }, {  760606,  751,  61311, 3462 },
+ {  775718,  791,  61690, 3539 }, {  783417,  787,  62002, 3583 }, { 1060584,  734,  62176, 4620 }, { 1157393,  789,  62560, 4996 },
+ { 1328138,  769,  62250, 5647 }, { 1333871,  795,  61275, 5663 }, { 1342473,  765,  61630, 5699 }, { 1383477,  784,  62495, 5871 },
+ { 1458305,  765,  62278, 6187 }, { 1502447,  784,  62440, 6374 }, { 1612038,  746,  61337, 6894 }, { 1670333,  797,  61603, 7223 },
+ {   66643,  780,  63427,  209 }, {  287548,  785,  63718,  998 }, {  306733,  799,  63170, 1081 }, {  328063,  773,  63147, 1169 },
+ {  480828,  746,  62737, 1856 }, {  713206,  723,  63989, 3213 }, {  741399,  733,  63977, 3358 }, {  777468,  733,  63382, 3551 },
+ {  784789,  718,  62965, 3588 }, {  806202,  792,  63116, 3670 }, {  882826,  708,  63162, 3976 }, {  903346,  765,  63642, 4066 },
+ {  921798,  702,  62628, 4143 }, {  967777,  767,  63612, 4311 }, { 1012487,  771,  63166, 4463 }, { 1013517,  725,  63558, 4466 },
+ { 1015903,  744,  63711, 4476 }, { 1291038,  774,  63266, 5494 }, { 1305671,  764,  63904, 5559 }, { 1342961,  700,  63974, 5698 },
+ { 1420318,  714,  63165, 6045 }, { 1519370,  725,  63305, 6451 }, { 1616453,  770,  62944, 6922 }, { 1630009,  786,  63948, 6986 },
+ { 1733398,  794,  63435, 7537 }, { 1905296,  758,  63065, 8323 }, { 1984452,  798,  62930, 8635 }, { 2005106,  770,  64035, 8722 },
+ {   91488,  736,  64659,  299 }, {  266413,  782,  65500,  929 }, {  340139,  793,  65381, 1216 }, {  504564,  731,  64949, 2008 },
+ {  596975,  714,  64975, 2548 }, {  633173,  772,  65317, 2761 }, {  635347,  766,  65207, 2771 }, {  680882,  723,  64966, 3037 },
+ {  683344,  784,  65329, 3058 }, {  716527,  776,  65018, 3232 }, {  718862,  713,  65524, 3244 }, {  742392,  799,  64563, 3363 },
+ {  767958,  775,  64306, 3496 }, {  772682,  710,  64850, 3527 }, {  803258,  779,  64930, 3658 }, {  819054,  775,  64149, 3730 },
+ {  860269,  773,  65440, 3904 }, {  861187,  762,  64362, 3910 }, { 1108845,  784,  64292, 4818 }, { 1166485,  777,  65362, 5029 },
+ { 1190418,  790,  64703, 5121 }, { 1211377,  777,  65389, 5206 }, { 1217987,  783,  64943, 5239 }, { 1262956,  783,  64275, 5401 },
+ { 1276229,  755,  64437, 5444 }, { 1277712,  741,  64275, 5450 }, { 1353544,  724,  65147, 5742 }, { 1441363,  735,  64434, 6131 },
+ { 1513231,  748,  65003, 6416 }, { 1545589,  779,  65422, 6572 }, { 1649252,  754,  64947, 7092 }, { 1988913,  751,  64877, 8657 },
+ {  482930,  786,  66884, 1870 }, {  531089,  793,  65651, 2158 }, {  674224,  706,  65788, 2998 }, {  695939,  717,  66377, 3121 },
+ {  697638,  799,  65851, 3137 }, {  708769,  705,  65924, 3187 }, {  720020,  783,  66751, 3250 }, {  758162,  771,  65815, 3444 },
+ {  760142,  723,  66134, 3456 }, {  766786,  746,  66865, 3494 }, {  859179,  708,  66603, 3898 }, {  865502,  771,  65949, 3925 },
+ {  920356,  774,  65633, 4135 }, { 1027796,  729,  66541, 4519 }, { 1069028,  731,  66590, 4652 }, { 1267238,  750,  66005, 5412 },
+ { 1524598,  729,  66765, 6477 }, { 1619516,  707,  66639, 6938 }, { 1644891,  781,  66716, 7065 }, { 1681598,  792,  65818, 7281 },
+ { 1684074,  740,  66215, 7289 }, { 1708829,  761,  65932, 7416 }, { 1748799,  781,  65701, 7630 }, { 1956079,  762,  66888, 8524 },
+ {  177248,  714,  68032,  602 }, {  280246,  793,  67604,  968 }, {  377599,  734,  67383, 1364 }, {  394432,  707,  68382, 1443 },
+ {  522288,  781,  67042, 2117 }, {  631388,  710,  67924, 2748 }, {  695128,  709,  67152, 3116 }, {  713029,  721,  67171, 3204 },
+ {  741470,  779,  67226, 3356 }, {  802558,  700,  68257, 3654 }, {  807020,  785,  67205, 3672 }, {  810295,  712,  67379, 3692 },
+ {  854162,  755,  68092, 3886 }, {  921232,  791,  67894, 4139 }, {  980484,  780,  67534, 4354 }, { 1061533,  775,  67467, 4624 },
+ { 1099119,  777,  67973, 4788 }, { 1128639,  789,  67214, 4903 }, { 1189988,  798,  67201, 5118 }, { 1363442,  743,  67570, 5784 },
+ { 1501073,  708,  67804, 6371 }, { 1512862,  776,  67181, 6420 }, { 1520751,  712,  67229, 6460 }, { 1595989,  746,  67293, 6818 },
+ { 1608258,  725,  67153, 6875 }, { 1797024,  711,  67744, 7846 }, { 1883638,  757,  68228, 8236 }, { 2034036,  792,  67705, 8846 },
+ {  188096,  785,  69201,  632 }, {  617430,  754,  69334, 2667 }, {  637986,  785,  69886, 2789 }, {  694630,  735,  69177, 3114 },
+ {  804651,  757,  69342, 3661 }, {  807416,  725,  68780, 3674 }, {  841810,  750,  68727, 3842 }, {  896423,  760,  68613, 4036 },
+ {  961180,  781,  69624, 4292 }, { 1021386,  755,  68588, 4502 }, { 1152541,  725,  68986, 4973 }, { 1161053,  784,  69875, 5008 },
+ { 1252701,  756,  68534, 5362 }, { 1430843,  788,  69777, 6085 }, { 1454079,  783,  69029, 6174 }, { 1476320,  796,  68523, 6257 },
+ { 1582811,  777,  69067, 6749 }, { 1619375,  772,  69188, 6937 }, { 1630511,  737,  68720, 6991 }, { 1643995,  749,  69439, 7062 },
+ { 1645075,  761,  69081, 7068 }, { 1703060,  771,  69098, 7392 }, { 1818241,  711,  69888, 7943 }, {   65466,  794,  70891,  198 },
+ {  166559,  711,  70629,  558 }, {  174248,  757,  69950,  588 }, {  305713,  778,  70829, 1075 }, {  535766,  750,  70129, 2181 },
+ {  617563,  720,  70396, 2666 }, {  735391,  798,  71026, 3322 }, {  736720,  747,  70128, 3326 }, {  818251,  758,  70189, 3726 },
+ {  971792,  715,  70835, 4327 }, { 1002825,  708,  70887, 4423 }, { 1053906,  715,  70537, 4600 }, { 1129146,  747,  71239, 4906 },
+ { 1152191,  779,  70245, 4970 }, { 1199552,  798,  70003, 5157 }, { 1323320,  785,  71169, 5625 }, { 1426201,  745,  70887, 6071 },
+ { 1451077,  747,  71156, 6164 }, { 1477398,  788,  70603, 6266 }, { 1550582,  787,  70967, 6597 }, { 1654830,  736,  70940, 7122 },
+ { 1780334,  759,  69977, 7779 }, { 1782414,  764,  70521, 7787 }, { 1874369,  751,  70703, 8202 }, { 2024268,  781,  71158, 8814 },
+ {   98739,  721,  72071,  331 }, {  123324,  742,  72079,  408 }, {  195928,  791,  71604,  659 }, {  633444,  794,  71982, 2759 },
+ {  703051,  752,  71813, 3162 }, {  788393,  755,  72620, 3600 }, {  889297,  798,  72403, 4001 }, {  900712,  796,  72335, 4056 },
+ { 1061550,  748,  71698, 4625 }, { 1100653,  713,  71393, 4794 }, { 1145548,  759,  72219, 4941 }, { 1175184,  769,  72087, 5060 },
+ { 1198459,  798,  71946, 5155 }, { 1244762,  761,  72581, 5318 }, { 1275075,  787,  72115, 5439 }, { 1318466,  715,  71459, 5607 },
+ { 1334119,  716,  72077, 5667 }, { 1375348,  794,  72555, 5846 }, { 1414551,  786,  71536, 6015 }, { 1444261,  733,  72551, 6142 },
+ { 1473193,  722,  71697, 6245 }, { 1476788,  745,  72536, 6260 }, { 1478162,  777,  71581, 6272 }, { 1533722,  784,  71614, 6523 },
+ { 1589020,  786,  71885, 6786 }, { 1592102,  747,  71851, 6804 }, { 1674755,  788,  72661, 7257 }, { 1844365,  753,  71924, 8069 },
+ { 1870562,  777,  71371, 8180 }, { 1881755,  729,  71622, 8229 }, { 1946337,  710,  72275, 8488 }, { 2015584,  779,  72058, 8771 },
+ { 2031582,  777,  71515, 8835 }, {  341351,  771,  73338, 1219 }, {  476357,  787,  74192, 1827 }, {  493307,  782,  73848, 1947 },
+ {  539101,  758,  73333, 2203 }, {  622036,  779,  74119, 2691 }, {  629529,  731,  73544, 2727 }, {  675310,  717,  74178, 3002 },
+ {  757773,  720,  73203, 3439 }, {  771363,  748,  73285, 3514 }, {  833504,  735,  73764, 3807 }, {  893860,  790,  73321, 4015 },
+ { 1008965,  764,  73453, 4447 }, { 1010160,  739,  73673, 4453 }, { 1193935,  760,  72893, 5136 }, { 1276841,  774,  73126, 5449 },
+ { 1322664,  779,  73668, 5624 }, { 1338303,  759,  73966, 5687 }, { 1360275,  782,  72914, 5767 }, { 1463215,  771,  74041, 6214 },
+ { 1560553,  796,  73943, 6643 }, { 1642395,  724,  73409, 7050 }, { 1709968,  789,  72868, 7422 }, { 1852815,  783,  73210, 8100 },
+ { 1976245,  786,  73679, 8602 }, { 2024572,  783,  73680, 8818 }, { 2036225,  753,  74018, 8859 }, {   41419,  743,  75607,  109 },
+ {  470985,  771,  75262, 1793 }, {  516824,  757,  75669, 2082 }, {  638699,  725,  74580, 2791 }, {  698283,  724,  74707, 3140 },
+ {  811122,  733,  74859, 3694 }, {  925099,  738,  75094, 4153 }, { 1089900,  744,  74334, 4748 }, { 1101034,  780,  75541, 4796 },
+ { 1124229,  798,  75266, 4879 }, { 1174012,  709,  75374, 5058 }, { 1346762,  737,  75309, 5719 }, { 1433085,  740,  74555, 6094 },
+ { 1466254,  748,  74823, 6221 }, { 1503352,  767,  75012, 6381 }, { 1619987,  716,  75299, 6942 }, { 1638332,  743,  75274, 7031 },
+ { 1735747,  733,  75548, 7552 }, { 1815107,  750,  74564, 7933 }, { 1825789,  735,  75454, 7987 }, { 1854016,  726,  74894, 8104 },
+ { 1964119,  747,  74466, 8552 }, { 1996717,  742,  74503, 8685 }, {   64373,  790,  76345,  195 }, {   89282,  759,  77066,  288 },
+ {  252784,  792,  76367,  863 }, {  484756,  748,  76478, 1877 }, {  635743,  780,  76195, 2769 }, {  654042,  743,  76913, 2875 },
+ {  669530,  773,  75934, 2963 }, {  669628,  776,  76110, 2964 }, {  671763,  742,  76508, 2981 }, {  680725,  708,  76475, 3035 },
+ {  748040,  796,  76967, 3389 }, {  775946,  782,  76785, 3535 }, {  908021,  733,  75745, 4086 }, { 1068123,  776,  77084, 4648 },
+ { 1083162,  779,  77057, 4714 }, { 1268748,  797,  76997, 5419 }, { 1291911,  794,  76154, 5508 }, { 1312492,  789,  75815, 5585 },
+ { 1325466,  798,  76885, 5636 }, { 1491085,  791,  75952, 6327 }, { 1508199,  796,  76595, 6398 }, { 1605355,  710,  76687, 6862 },
+ { 1614300,  764,  77180, 6910 }, { 1621485,  765,  76788, 6953 }, { 1636626,  713,  76202, 7021 }, { 1665044,  774,  76099, 7197 },
+ { 1838581,  794,  76503, 8046 }, { 1839329,  730,  76650, 8048 }, { 1921367,  750,  76306, 8379 }, { 2019810,  761,  77030, 8790 },
+ {  105960,  792,  78434,  359 }, {  332908,  740,  78093, 1189 }, {  410777,  705,  77397, 1503 }, {  478056,  757,  77523, 1835 },
+ {  513443,  763,  78106, 2053 }, {  535250,  702,  77555, 2177 }, {  549075,  753,  78261, 2263 }, {  549277,  787,  77555, 2265 },
+ {  571409,  724,  78201, 2399 }, {  593256,  726,  78541, 2518 }, {  676579,  788,  78560, 3011 }, {  678914,  788,  78547, 3022 },
+ {  701415,  795,  77600, 3154 }, {  764390,  776,  77401, 3479 }, {  808209,  786,  78064, 3677 }, {  858476,  797,  77458, 3892 },
+ {  998407,  789,  78276, 4411 }, { 1024478,  798,  77464, 4508 }, { 1251590,  794,  77192, 5357 }, { 1300309,  703,  78357, 5543 },
+ { 1372817,  724,  77806, 5837 }, { 1404817,  790,  78444, 5975 }, { 1433823,  742,  78011, 6100 }, { 1439236,  779,  77448, 6122 },
+ { 1455026,  791,  77504, 6178 }, { 1494714,  798,  77518, 6344 }, { 1518855,  793,  77508, 6456 }, { 1655403,  738,  77687, 7129 },
+ { 1748013,  795,  78210, 7629 }, { 1821918,  752,  78517, 7971 }, { 1873429,  763,  78395, 8200 }, { 1917117,  746,  77556, 8366 },
+ {  135344,  751,  79903,  445 }, {  143388,  794,  79413,  471 }, {  148621,  772,  79856,  498 }, {  559265,  762,  79674, 2316 },
+ {  573549,  742,  78981, 2411 }, {  575845,  759,  79779, 2424 }, {  578508,  771,  80086, 2446 }, {  599589,  796,  78979, 2558 },
+ {  629770,  796,  79436, 2726 }, {  636173,  703,  79507, 2770 }, {  638811,  711,  79725, 2790 }, {  660967,  754,  79136, 2911 },
+ {  668076,  780,  79367, 2954 }, {  674584,  760,  78716, 2994 }, {  675982,  780,  78735, 3007 }, {  688941,  743,  79173, 3085 },
+ {  719401,  708,  79113, 3240 }, {  730144,  720,  79349, 3283 }, {  841004,  798,  78783, 3835 }, {  994999,  700,  78883, 4396 },
+ {  998317,  722,  78735, 4409 }, { 1204319,  715,  79010, 5174 }, { 1283083,  767,  78840, 5466 }, { 1350483,  745,  79761, 5736 },
+ { 1394250,  780,  78913, 5929 }, { 1408694,  773,  79744, 5991 }, { 1547887,  754,  80021, 6583 }, { 1571301,  774,  79893, 6691 },
+ { 1582178,  795,  78672, 6748 }, { 1606193,  734,  79618, 6870 }, { 1607062,  755,  78990, 6874 }, { 1763935,  732,  78790, 7703 },
+ { 1854400,  796,  79261, 8108 }, {   17088,  725,  80293,   35 }, {  247940,  792,  81328,  848 }, {  248561,  747,  81084,  851 },
+ {  302276,  771,  81092, 1054 }, {  394194,  796,  81051, 1439 }, {  457995,  776,  81523, 1721 }, {  485146,  778,  80303, 1881 },
+ {  532227,  780,  80848, 2160 }, {  569751,  784,  80477, 2388 }, {  683388,  793,  80454, 3049 }, {  690579,  749,  81378, 3091 },
+ {  719760,  778,  80814, 3242 }, {  725687,  758,  80757, 3266 }, {  739812,  775,  80265, 3343 }, {  832378,  787,  81141, 3790 },
+ {  872170,  723,  81397, 3947 }, {  968335,  743,  81271, 4313 }, { 1082931,  732,  80701, 4712 }, { 1085514,  773,  80371, 4724 },
+ { 1213941,  754,  81067, 5222 }, { 1486379,  797,  81460, 6311 }, { 1688887,  759,  80713, 7316 }, {  222993,  790,  82503,  744 },
+ {  228614,  779,  82398,  772 }, {  340275,  711,  82622, 1214 }, {  424484,  786,  82876, 1559 }, {  498440,  729,  82528, 1973 },
+ {  534572,  783,  82010, 2170 }, {  552954,  778,  82134, 2279 }, {  554296,  753,  81765, 2288 }, {  609366,  706,  81719, 2619 },
+ {  650562,  790,  81761, 2856 }, {  678055,  737,  81808, 3018 }, {  687781,  701,  82583, 3079 }, {  946558,  761,  81641, 4238 },
+ { 1255857,  756,  82702, 5376 }, { 1378785,  761,  82550, 5860 }, { 1513085,  791,  82997, 6426 }, { 1561543,  790,  82720, 6647 },
+ { 1561691,  784,  82163, 6648 }, { 1563235,  760,  82860, 6658 }, { 1564002,  796,  82652, 6662 }, { 1564786,  796,  82235, 6668 },
+ { 1747416,  730,  82572, 7624 }, { 1936849,  737,  81577, 8444 }, { 2014863,  711,  82647, 8767 }, {   11736,  768,  83783,   13 },
+ {  215582,  714,  84194,  724 }, {  488253,  778,  83129, 1909 }, {  526142,  755,  84340, 2131 }, {  683890,  760,  83433, 3052 },
+ {  868850,  784,  83622, 3932 }, {  960076,  771,  84086, 4282 }, { 1014473,  774,  83842, 4469 }, { 1116685,  786,  83472, 4850 },
+ { 1302904,  782,  83450, 5549 }, { 1304523,  732,  84259, 5558 }, { 1393574,  712,  84420, 5925 }, { 1393591,  762,  84416, 5926 },
+ { 1412485,  754,  83807, 6007 }, { 1419031,  792,  83029, 6044 }, { 1458916,  787,  83225, 6192 }, { 1481383,  748,  83390, 6288 },
+ { 1507796,  753,  83811, 6397 }, { 1622327,  728,  83037, 6960 }, { 1748119,  766,  84037, 7631 }, { 1806361,  747,  83641, 7893 },
+ { 1881966,  797,  84388, 8230 }, { 1978981,  766,  83131, 8616 }, {  126657,  779,  85260,  423 }, {  148757,  725,  84945,  497 },
+ {  494913,  745,  85385, 1958 }, {  503897,  717,  84915, 1996 }, {  530606,  765,  84720, 2149 }, {  566017,  774,  85009, 2364 },
+ {  571838,  769,  84513, 2397 }, {  574661,  762,  85512, 2415 }, {  579328,  727,  84963, 2447 }, {  645940,  739,  84763, 2823 },
+ {  703519,  782,  85144, 3160 }, {  705269,  731,  85452, 3170 }, {  743436,  765,  84701, 3362 }, {  771662,  721,  85605, 3512 },
+ {  840557,  763,  84729, 3833 }, {  936029,  764,  85511, 4194 }, {  975598,  781,  85004, 4339 }, { 1011427,  798,  85679, 4458 },
+ { 1021973,  722,  85196, 4503 }, { 1087696,  755,  85677, 4735 }, { 1315072,  744,  85405, 5595 }, { 1488218,  703,  84678, 6316 },
+ { 1510330,  755,  85434, 6409 }, { 1536030,  770,  85316, 6535 }, { 1618127,  734,  85909, 6936 }, { 1844346,  718,  84966, 8076 },
+ { 2068952,  731,  84575, 8975 }, {   23518,  767,  86575,   57 }, {   90935,  750,  86729,  293 }, {  323673,  700,  87291, 1134 },
+ {  440373,  794,  87048, 1635 }, {  518970,  750,  86482, 2092 }, {  589057,  720,  86028, 2492 }, {  590377,  792,  87081, 2500 },
+ {  597671,  770,  86953, 2545 }, {  645180,  743,  87271, 2819 }, {  647685,  735,  87103, 2834 }, {  654022,  777,  86590, 2873 },
+ {  832361,  793,  87195, 3789 }, {  944063,  788,  86927, 4225 }, { 1009111,  704,  86052, 4449 }, { 1160548,  710,  86662, 5006 },
+ { 1666680,  750,  85993, 7211 }, { 1727267,  752,  87248, 7507 }, { 1807913,  776,  86796, 7909 }, { 1975677,  782,  86892, 8601 },
+ {  121630,  784,  88758,  400 }, {  133579,  782,  87794,  441 }, {  176576,  735,  87384,  594 }, {  193562,  728,  88436,  652 },
+ {  227417,  775,  87446,  767 }, {  230558,  783,  87664,  777 }, {  331952,  754,  87626, 1184 }, {  350513,  793,  88096, 1246 },
+ {  412374,  768,  88496, 1509 }, {  582122,  771,  88066, 2460 }, {  590584,  780,  88763, 2501 }, {  634024,  736,  88381, 2756 },
+ {  800908,  759,  87913, 3644 }, {  916907,  756,  88266, 4118 }, { 1036478,  785,  88597, 4548 }, { 1105459,  789,  87996, 4810 },
+ { 1320266,  796,  88720, 5619 }, { 1426566,  749,  88702, 6077 }, { 1498286,  797,  87969, 6366 }, { 1571534,  716,  87750, 6693 },
+ { 1587566,  753,  88442, 6780 }, { 1609310,  760,  88483, 6888 }, { 1843775,  768,  87563, 8070 }, { 1904530,  701,  88690, 8326 },
+ { 1981185,  787,  88341, 8623 }, {    3396,  701,  89887, 9091 }, {   49058,  755,  89651,  138 }, {  140014,  769,  90159,  462 },
+ {  329802,  790,  89330, 1171 }, {  533160,  781,  89942, 2164 }, {  652428,  754,  89065, 2863 }, {  771922,  787,  89512, 3513 },
+ {  916751,  758,  89804, 4117 }, { 1008189,  781,  89221, 4443 }, { 1008194,  764,  89218, 4444 }, { 1192318,  783,  89654, 5128 },
+ { 1414170,  713,  89444, 6017 }, { 1434017,  784,  89864, 6106 }, { 1613387,  792,  90027, 6907 }, { 1696754,  793,  89288, 7360 },
+ { 1699482,  767,  89920, 7380 }, { 1997171,  797,  89618, 8693 }, { 2009183,  751,  89511, 8740 }, { 2096373,  762,  89544, 9073 },
+ {   31341,  718,  91724,   84 }, {  264516,  789,  90428,  914 }, {  288427,  791,  91455,  993 }, {  491874,  731,  91298, 1935 },
+ {  900212,  734,  91739, 4049 }, {  973911,  744,  90411, 4334 }, { 1042268,  793,  90989, 4565 }, { 1112668,  748,  90766, 4839 },
+ { 1183432,  769,  91303, 5097 }, { 1313788,  785,  90382, 5591 }, { 1361141,  715,  90362, 5775 }, { 1415964,  767,  90902, 6029 },
+ { 1519503,  735,  90502, 6459 }, { 1568056,  780,  90389, 6680 }, { 1784686,  785,  91260, 7801 }, { 1923608,  742,  90955, 8386 },
+ { 2011698,  755,  91537, 8754 }, { 2021931,  760,  91493, 8802 }, { 2023960,  787,  90423, 8813 }, {   13617,  742,  93189,   24 },
+ {   16855,  741,  92915,   34 }, {  247439,  739,  93122,  845 }, {  300556,  793,  92213, 1045 }, {  357715,  759,  92700, 1275 },
+ {  465152,  799,  92288, 1758 }, {  539692,  772,  91975, 2200 }, {  569102,  793,  92871, 2380 }, {  626704,  746,  92466, 2708 },
+ {  633299,  758,  91806, 2750 }, {  645872,  738,  92965, 2822 }, {  662032,  777,  91768, 2916 }, {  969875,  771,  92170, 4317 },
+ { 1103485,  745,  91953, 4803 }, { 1119122,  766,  92621, 4860 }, { 1226805,  748,  92377, 5265 }, { 1241932,  708,  92131, 5312 },
+ { 1308759,  765,  92708, 5577 }, { 1769894,  773,  91798, 7722 }, { 1854361,  742,  92652, 8110 }, { 1943234,  743,  92867, 8478 },
+ { 1965740,  795,  91907, 8563 }, {   19954,  794,  93239,   42 }, {  131628,  793,  93509,  436 }, {  440057,  702,  93607, 1628 },
+ {  444582,  773,  93429, 1655 }, {  459342,  707,  94581, 1723 }, {  529033,  704,  93621, 2140 }, {  639126,  728,  94060, 2786 },
+ {  674004,  764,  93718, 2988 }, {  732302,  790,  93714, 3291 }, {  750722,  796,  94435, 3402 }, {  754203,  727,  93578, 3420 },
+ {  829989,  748,  94066, 3770 }, { 1032194,  711,  94299, 4532 }, { 1189561,  778,  93928, 5120 }, { 1202389,  781,  93376, 5167 },
+ { 1292875,  724,  93334, 5516 }, { 1293183,  777,  94148, 5517 }, { 1325735,  776,  93691, 5641 }, { 1330946,  784,  93489, 5658 },
+ { 1391550,  762,  93594, 5917 }, { 1409937,  738,  93683, 6001 }, { 1507833,  707,  94083, 6402 }, { 1507838,  711,  94085, 6401 },
+ { 1703747,  752,  94642, 7398 }, { 1830331,  770,  93638, 8013 }, { 1887704,  773,  93456, 8253 }, { 1929108,  796,  94405, 8408 },
+ { 2040730,  764,  94644, 8883 }, {   39679,  798,  95460,  102 }, {  153859,  731,  94740,  514 }, {  261564,  771,  95062,  901 },
+ {  559141,  763,  95505, 2311 }, {  609628,  759,  95266, 2616 }, {  613269,  763,  94977, 2640 }, {  625818,  769,  95000, 2704 },
+ {  629442,  792,  96036, 2718 }, {  642357,  787,  95961, 2802 }, {  648692,  778,  94980, 2841 }, {  840322,  770,  95095, 3830 },
+ { 1040870,  730,  95703, 4558 }, { 1223341,  777,  94678, 5257 }, { 1251029,  787,  95851, 5356 }, { 1292334,  763,  95572, 5514 },
+ { 1390322,  787,  95018, 5912 }, { 1402970,  700,  95923, 5969 }, { 1485424,  786,  94797, 6308 }, { 1638148,  783,  94679, 7035 },
+ { 1679511,  780,  95984, 7277 }, { 1819415,  786,  95801, 7961 }, { 1942400,  758,  94926, 8470 }, { 2009912,  765,  94902, 8743 },
+ {   54387,  757,  97237,  159 }, {   71699,  790,  96318,  228 }, {   76716,  746,  96128,  247 }, {  290659,  761,  96299, 1004 },
+ {  383160,  783,  97419, 1384 }, {  407944,  758,  96822, 1495 }, {  442570,  761,  96684, 1645 }, {  468612,  706,  97245, 1771 },
+ {  608123,  746,  97038, 2607 }, {  659964,  785,  97155, 2900 }, {  676574,  762,  97101, 3004 }, {  683072,  733,  97448, 3043 },
+ {  735549,  728,  96187, 3315 }, {  880148,  770,  96535, 3965 }, { 1004366,  776,  96794, 4428 }, { 1082596,  768,  97344, 4711 },
+ { 1221181,  715,  97535, 5250 }, { 1259471,  732,  97294, 5390 }, { 1286292,  773,  97572, 5484 }, { 1295154,  768,  96486, 5521 },
+ { 1302470,  730,  97055, 5548 }, { 1389213,  739,  96896, 5906 }, { 1396033,  743,  97330, 5942 }, { 1485713,  775,  97560, 6310 },
+ { 1511714,  720,  96537, 6424 }, { 1577017,  734,  96530, 6724 }, { 1578505,  797,  96645, 6736 }, { 1622222,  749,  96167, 6961 },
+ { 1663830,  765,  97353, 7195 }, { 1697055,  703,  96860, 7362 }, { 1712716,  765,  97167, 7431 }, { 1956636,  753,  97230, 8529 },
+ {   44242,  719,  98723,  118 }, {  207594,  720,  98765,  695 }, {  258350,  745,  98831,  883 }, {  259370,  784,  98459,  889 },
+ {  293310,  752,  98501, 1016 }, {  331554,  724,  98850, 1181 }, {  533803,  747,  97737, 2163 }, {  622413,  771,  98800, 2690 },
+ {  650976,  761,  97701, 2855 }, {  661637,  783,  98266, 2909 }, {  661649,  787,  98267, 2910 }, {  697733,  711,  98028, 3123 },
+ {  735341,  768,  97800, 3308 }, {  923352,  708,  98661, 4145 }, { 1064691,  746,  98453, 4635 }, { 1092691,  763,  98590, 4759 },
+ { 1290496,  781,  97799, 5499 }, { 1365773,  778,  97782, 5806 }, { 1389261,  742,  99000, 5907 }, { 1406993,  792,  98459, 5988 },
+ { 1410813,  788,  98574, 6003 }, { 1435362,  792,  98226, 6113 }, { 1435365,  702,  98227, 6112 }, { 1480822,  758,  97794, 6291 },
+ { 1628951,  781,  98311, 6990 }, { 1654434,  793,  97829, 7128 }, { 1697375,  743,  98977, 7363 }, { 1718672,  797,  98200, 7473 },
+ { 1896194,  724,  97959, 8285 }, { 1974248,  797,  99019, 8596 }, {   11330,  794,  99773,   12 }, {   65157,  724,  99041,  197 },
+ {   67279,  750,  99792,  210 }, {  252806,  795,  99580,  862 }, {  440909,  775, 100190, 1634 }, {  498411,  787,  99576, 1968 },
+ {  509567,  787, 100447, 2026 }, {  518810,  796, 100256, 2086 }, {  537344,  750,  99655, 2180 }, {  538558,  771, 100160, 2186 },
+ {  605524,  730, 100403, 2595 }, {  652032,  795, 100284, 2860 }, {  680422,  790,  99789, 3023 }, {  756042,  705,  99996, 3430 },
+ {  835128,  791, 100290, 3810 }, { 1077963,  797,  99288, 4691 }, { 1078521,  721,  99346, 4696 }, { 1334580,  750,  99614, 5678 },
+ { 1575641,  777, 100169, 6716 }, { 1640356,  737,  99603, 7046 }, { 1690298,  758,  99618, 7327 }, { 1868516,  760, 100006, 8172 },
+ {   69932,  757, 101541,  220 }, {  130492,  712, 101405,  433 }, {  143980,  758, 100889,  473 }, {  193717,  786, 100489,  651 },
+ {  415163,  772, 100902, 1521 }, {  534424,  778, 101672, 2166 }, {  686984,  763, 100742, 3068 }, {  834795,  701, 100657, 3808 },
+ { 1307031,  774, 101094, 5568 }, { 1366457,  784, 100512, 5810 }, { 1521455,  785, 101132, 6472 }, { 1593639,  744, 101527, 6816 },
+ { 1628070,  794, 101068, 6988 }, { 1629502,  786, 100564, 6998 }, { 1651510,  769, 101012, 7114 }, { 1698577,  759, 101620, 7375 },
+ { 1773875,  787, 101668, 7748 }, { 1814862,  793, 101237, 7937 }, { 1847474,  730, 100770, 8087 }, { 1874689,  778, 100774, 8207 },
+ { 1943215,  732, 100597, 8480 }, { 1953837,  713, 101360, 8516 }, {   31707,  712, 102029,   85 }, {  174425,  741, 103146,  583 },
+ {  213483,  788, 102007,  713 }, {  332918,  781, 103260, 1187 }, {  366424,  779, 102463, 1300 }, {  379599,  738, 102877, 1367 },
+ {  482238,  755, 103203, 1849 }, {  546337,  791, 102341, 2242 }, {  551934,  781, 103294, 2271 }, {  604453,  774, 102534, 2588 },
+ {  628699,  784, 103231, 2716 }, {  709682,  738, 102753, 3183 }, {  730149,  758, 102060, 3279 }, {  828972,  766, 103035, 3763 },
+ {  951716,  724, 102147, 4251 }, { 1070411,  783, 103174, 4655 }, { 1141445,  758, 102794, 4935 }, { 1388395,  703, 102188, 5902 },
+ { 1394713,  785, 103377, 5934 }, { 1475900,  788, 102550, 6269 }, { 1595022,  738, 103006, 6822 }, { 1595022,  795, 102510, 6823 },
+ { 1645199,  724, 102418, 7078 }, { 1656374,  708, 102901, 7145 }, { 1857773,  724, 102894, 8127 }, { 1870194,  741, 103186, 8183 },
+ { 1885762,  769, 102068, 8245 }, { 1972915,  720, 102976, 8592 }, { 2013759,  797, 103213, 8764 }, {  391250,  796, 104069, 1421 },
+ {  474767,  789, 104414, 1812 }, {  535492,  731, 103643, 2168 }, {  550835,  752, 104809, 2266 }, {  601931,  764, 103449, 2565 },
+ {  660203,  766, 104002, 2899 }, {  665093,  774, 104424, 2928 }, {  670254,  793, 104364, 2960 }, {  744948,  742, 104242, 3367 },
+ {  803877,  773, 104490, 3653 }, {  833531,  774, 103984, 3796 }, { 1049819,  726, 104361, 4590 }, { 1156611,  733, 104757, 4995 },
+ { 1159230,  722, 104775, 5001 }, { 1358214,  752, 104378, 5762 }, { 1367384,  738, 103841, 5814 }, { 1390827,  794, 103959, 5915 },
+ { 1459116,  757, 104748, 6202 }, { 1672302,  754, 103824, 7249 }, { 1736267,  792, 103467, 7561 }, { 1775870,  728, 103574, 7761 },
+ { 1991641,  726, 104294, 8670 }, {   69500,  770, 104947,  218 }, {  289359,  771, 105673,  997 }, {  413799,  753, 105829, 1513 },
+ {  464344,  796, 105047, 1747 }, {  500054,  773, 105670, 1975 }, {  546558,  799, 105552, 2243 }, {  577270,  770, 105819, 2423 },
+ {  779451,  775, 105209, 3554 }, {  799643,  773, 105336, 3638 }, {  879709,  786, 105006, 3963 }, {  995223,  709, 105994, 4395 },
+ { 1245769,  743, 105150, 5332 }, { 1250483,  790, 105900, 5355 }, { 1604009,  775, 106110, 6863 }, { 1616844,  766, 105919, 6933 },
+ { 1618649,  714, 105444, 6944 }, { 1692064,  787, 105307, 7344 }, { 1714211,  764, 105194, 7443 }, { 1787414,  725, 105166, 7814 },
+ { 1791169,  794, 105707, 7830 }, { 1805954,  710, 105059, 7900 }, { 1935472,  781, 105614, 8439 }, { 2038026,  793, 104967, 8869 },
+ { 2070319,  734, 104897, 8980 }, { 2074144,  724, 105261, 8998 }, { 2076785,  729, 105845, 9002 }, { 2084562,  718, 106181, 9031 },
+ {   17719,  725, 107680,   37 }, {  206924,  787, 107278,  693 }, {  314995,  723, 106994, 1100 }, {  565971,  777, 106993, 2359 },
+ {  597638,  779, 106436, 2535 }, {  651185,  763, 107573, 2853 }, {  684031,  718, 106646, 3044 }, {  730959,  775, 107168, 3281 },
+ {  884238,  760, 106520, 3977 }, {  942068,  742, 106746, 4214 }, { 1042773,  718, 106534, 4567 }, { 1169480,  737, 107385, 5044 },
+ { 1205022,  743, 107566, 5181 }, { 1497495,  799, 107201, 6365 }, { 1584233,  752, 106539, 6769 }, { 1597903,  775, 106858, 6838 },
+ { 1827433,  778, 107658, 8000 }, { 1861157,  743, 107749, 8137 }, {    6304,  778, 108541, 9101 }, {  164377,  780, 109124,  547 },
+ {  363065,  737, 108332, 1288 }, {  418855,  751, 109131, 1532 }, {  420219,  777, 108250, 1538 }, {  422624,  703, 108087, 1549 },
+ {  429790,  770, 108849, 1579 }, {  430076,  772, 108379, 1581 }, {  435482,  766, 108318, 1604 }, {  472548,  765, 109192, 1792 },
+ {  547777,  792, 108670, 2249 }, {  550058,  714, 108958, 2260 }, {  640022,  770, 108346, 2788 }, {  647595,  733, 108063, 2825 },
+ {  712850,  768, 108133, 3194 }, {  781434,  796, 108803, 3564 }, {  784585,  786, 107964, 3578 }, {  960489,  789, 108286, 4284 },
+ { 1153519,  704, 108060, 4981 }, { 1200761,  760, 108031, 5165 }, { 1320371,  720, 108144, 5622 }, { 1351872,  764, 108814, 5743 },
+ { 1355391,  782, 108658, 5750 }, { 1358663,  750, 109012, 5764 }, { 1398577,  747, 108547, 5954 }, { 1653716,  779, 108319, 7126 },
+ { 1722167,  706, 107951, 7489 }, { 1806670,  780, 107951, 7905 }, { 1831625,  787, 107816, 8018 }, { 2002137,  756, 108166, 8711 },
+ {  137815,  763, 110211,  451 }, {  139786,  742, 109810,  459 }, {  179098,  786, 109672,  608 }, {  212635,  783, 109723,  710 },
+ {  595596,  739, 109437, 2522 }, {  635323,  746, 110080, 2758 }, {  814908,  778, 110442, 3704 }, {  830671,  785, 110067, 3772 },
+ { 1183815,  755, 109755, 5099 }, { 1297157,  715, 110679, 5530 }, { 1374906,  741, 110207, 5848 }, { 1540246,  794, 110058, 6562 },
+ { 1567500,  789, 110410, 6681 }, { 1602205,  739, 110438, 6858 }, { 1652553,  710, 110105, 7119 }, { 1668527,  797, 110188, 7230 },
+ { 1698380,  772, 109304, 7378 }, { 1723682,  749, 109911, 7496 }, { 1744641,  702, 109942, 7614 }, { 1857943,  728, 109476, 8128 },
+ { 2042762,  720, 109284, 8890 }, { 2060486,  796, 109585, 8946 }, { 2071615,  728, 109879, 8987 }, {  235299,  798, 111483,  796 },
+ {  406801,  745, 111206, 1487 }, {  509154,  749, 111387, 2021 }, {  538228,  756, 111534, 2183 }, {  591263,  732, 111842, 2498 },
+ {  592521,  729, 111303, 2504 }, {  606004,  700, 110747, 2593 }, {  642209,  745, 111207, 2796 }, {  664193,  770, 111401, 2921 },
+ {  678587,  704, 111504, 3015 }, {  687859,  769, 111916, 3073 }, {  736809,  798, 112037, 3320 }, {  811372,  784, 111518, 3687 },
+ {  845133,  706, 111167, 3849 }, {  961476,  788, 110804, 4289 }, { 1295164,  731, 110900, 5523 }, { 1425782,  794, 111954, 6078 },
+ { 1441474,  768, 111485, 6140 }, { 1507821,  799, 111533, 6404 }, { 1554824,  794, 111740, 6620 }, { 1616234,  796, 111530, 6932 },
+ { 1620518,  750, 111944, 6959 }, { 1621870,  776, 111926, 6962 }, { 1714965,  747, 111122, 7454 }, { 1804822,  722, 112073, 7889 },
+ { 1895517,  718, 110752, 8283 }, { 1897738,  788, 111265, 8295 }, { 1899112,  799, 111774, 8302 }, { 1991877,  766, 110765, 8673 },
+ { 2067712,  700, 111006, 8968 }, { 2083397,  772, 111268, 9029 }, { 2086229,  787, 111049, 9037 }, {   71983,  759, 112957,  227 },
+ {  126499,  766, 112222,  421 }, {  391927,  760, 112210, 1423 }, {  462640,  750, 112896, 1737 }, {  471136,  725, 113490, 1783 },
+ {  547223,  701, 113185, 2244 }, {  577850,  797, 112607, 2428 }, {  648280,  778, 113234, 2832 }, {  687067,  717, 113447, 3064 },
+ {  714580,  754, 113303, 3202 }, {  834390,  794, 112892, 3802 }, {  918956,  758, 112996, 4123 }, {  952889,  766, 113243, 4255 },
+ { 1017510,  748, 112433, 4488 }, { 1079055,  714, 112963, 4699 }, { 1096053,  774, 113391, 4776 }, { 1108680,  798, 112161, 4822 },
+ { 1186456,  791, 112452, 5106 }, { 1697178,  769, 113446, 7367 }, { 1750506,  771, 113067, 7649 }, { 1912627,  708, 112943, 8351 },
+ { 1950079,  795, 112584, 8508 }, { 1958000,  776, 112910, 8534 }, { 2037604,  708, 112808, 8866 }, { 2064617,  765, 112227, 8958 },
+ {   15602,  785, 114440,   31 }, {  305252,  759, 114578, 1062 }, {  348799,  760, 114432, 1235 }, {  355902,  761, 114750, 1265 },
+ {  406168,  701, 113775, 1483 }, {  447708,  797, 114310, 1665 }, {  466012,  730, 114055, 1757 }, {  569993,  715, 114166, 2379 },
+ {  681495,  748, 113877, 3029 }, {  725845,  798, 114516, 3259 }, {  737933,  754, 114374, 3324 }, {  799818,  777, 114117, 3636 },
+ {  888520,  731, 114784, 3991 }, {  927029,  770, 113931, 4158 }, { 1000747,  794, 114115, 4416 }, { 1097468,  758, 114805, 4779 },
+ { 1174871,  725, 114627, 5064 }, { 1202860,  751, 114217, 5173 }, { 1345483,  772, 114134, 5720 }, { 1409180,  778, 114682, 6002 },
+ { 1606656,  773, 113617, 6881 }, { 1659367,  753, 114820, 7166 }, { 1679554,  751, 114007, 7282 }, { 1765732,  785, 114495, 7715 },
+ { 1821459,  788, 114389, 7976 }, { 1870240,  749, 114875, 8187 }, { 1946858,  734, 114807, 8496 }, {   81593,  731, 115440,  267 },
+ {   85534,  761, 115606,  279 }, {  148177,  775, 115525,  492 }, {  302946,  773, 115470, 1050 }, {  314517,  757, 115334, 1098 },
+ {  453480,  768, 116289, 1693 }, {  516608,  766, 116179, 2065 }, {  555471,  764, 116178, 2284 }, {  559490,  722, 115824, 2305 },
+ {  621395,  739, 115481, 2678 }, {  630777,  778, 115418, 2723 }, {  652246,  779, 115863, 2859 }, {  965926,  750, 115494, 4305 },
+ { 1085269,  795, 115941, 4722 }, { 1302538,  780, 116360, 5554 }, { 1306014,  746, 115649, 5564 }, { 1309108,  787, 115262, 5582 },
+ { 1404463,  707, 115595, 5977 }, { 1418270,  722, 116272, 6048 }, { 1536125,  755, 115404, 6544 }, { 1902780,  758, 115585, 8319 },
+ { 1937863,  746, 115875, 8452 }, { 2000273,  780, 115950, 8704 }, { 2069697,  789, 116043, 8979 }, { 2078606,  773, 116379, 9009 },
+ {   73002,  719, 117447,  235 }, {  206836,  746, 117641,  692 }, {  325588,  760, 117216, 1139 }, {  436674,  738, 116892, 1608 },
+ {  473355,  761, 116988, 1799 }, {  532225,  787, 116862, 2150 }, {  568253,  793, 116627, 2367 }, {  592227,  766, 116665, 2502 },
+ {  634561,  795, 117359, 2752 }, {  654440,  775, 116984, 2867 }, { 1049656,  755, 117158, 4587 }, { 1147458,  719, 117587, 4955 },
+ { 1150164,  794, 116988, 4961 }, { 1183971,  721, 116749, 5100 }, { 1499755,  756, 117271, 6375 }, { 1541055,  775, 117858, 6568 },
+ { 1618635,  772, 117667, 6946 }, { 1623895,  714, 117932, 6970 }, { 1640907,  771, 116690, 7055 }, { 1711395,  712, 117324, 7430 },
+ { 1734199,  739, 117621, 7553 }, {   21712,  775, 118794,   51 }, {   96243,  758, 119187,  317 }, {   98697,  782, 119109,  329 },
+ {  233316,  778, 118625,  784 }, {  264962,  783, 119365,  912 }, {  512822,  797, 118025, 2039 }, {  522936,  703, 118778, 2108 },
+ {  551730,  736, 118533, 2267 }, {  585368,  719, 118208, 2469 }, {  632435,  790, 119345, 2732 }, {  684745,  761, 118232, 3047 },
+ {  946231,  786, 119207, 4233 }, { 1097772,  748, 118623, 4781 }, { 1233115,  746, 118421, 5290 }, { 1360882,  717, 118232, 5780 },
+ { 1647102,  783, 119092, 7094 }, { 1747321,  788, 119360, 7637 }, { 1794806,  765, 119208, 7845 }, { 1830493,  751, 118981, 8015 },
+ { 1868414,  799, 118430, 8175 }, { 1871735,  770, 119055, 8195 }, { 1900552,  709, 118085, 8311 }, { 1946968,  779, 118023, 8500 },
+ { 2082945,  794, 119384, 9027 }, {   12073,  799, 120621,   16 }, {  175416,  751, 120184,  587 }, {  365246,  770, 120615, 1293 },
+ {  399323,  711, 119758, 1451 }, {  399325,  726, 120834, 1452 }, {  413734,  790, 120155, 1508 }, {  449048,  778, 120390, 1671 },
+ {  470852,  790, 120027, 1778 }, {  570651,  743, 119651, 2381 }, {  593637,  707, 120875, 2508 }, {  612245,  796, 120014, 2624 },
+ {  658414,  790, 120704, 2883 }, {  799107,  760, 120280, 3630 }, {  800401,  746, 120568, 3641 }, {  810736,  747, 120506, 3683 },
+ {  862901,  705, 119574, 3909 }, {  888559,  791, 120016, 3989 }, {  889731,  765, 120030, 3996 }, {  899489,  724, 119521, 4042 },
+ {  947070,  779, 120729, 4237 }, { 1148397,  755, 120855, 4957 }, { 1196561,  701, 120445, 5150 }, { 1399257,  755, 120020, 5959 },
+ { 1415755,  743, 120219, 6033 }, { 1420852,  750, 119959, 6060 }, { 1577352,  724, 119684, 6734 }, { 1577354,  794, 119684, 6733 },
+ { 1581782,  785, 119893, 6755 }, { 1739088,  779, 120257, 7584 }, { 1739801,  771, 119752, 7593 }, { 2086727,  775, 120873, 9040 },
+ {   21059,  712, 122014,   46 }, {   81129,  785, 121383,  263 }, {  108353,  713, 122222,  366 }, {  136483,  776, 120914,  448 },
+ {  225315,  775, 122129,  752 }, {  227191,  753, 122089,  759 }, {  263843,  775, 121843,  907 }, {  266084,  732, 121876,  917 },
+ {  268367,  726, 121752,  925 }, {  318194,  785, 121448, 1108 }, {  379691,  785, 121740, 1363 }, {  511715,  735, 121632, 2031 },
+ {  552997,  727, 122076, 2273 }, {  566267,  740, 120928, 2357 }, {  566267,  760, 120928, 2358 }, {  654528,  786, 121680, 2866 },
+ {  715872,  736, 122003, 3212 }, {  732401,  796, 121669, 3288 }, {  750708,  772, 122308, 3398 }, {  774162,  754, 121136, 3523 },
+ {  911298,  757, 120964, 4092 }, { 1008951,  795, 122083, 4446 }, { 1438479,  723, 121749, 6128 }, { 1631130,  784, 122029, 7007 },
+ { 1678710,  734, 122246, 7279 }, { 1951805,  737, 122073, 8512 }, { 1956665,  793, 121161, 8530 }, { 2017290,  743, 121888, 8782 },
+ { 2034308,  706, 121936, 8850 }, {  122834,  791, 123666,  404 }, {  199496,  751, 122949,  666 }, {  271695,  727, 122463,  935 },
+ {  305327,  799, 123506, 1060 }, {  364635,  744, 123679, 1290 }, {  374749,  794, 123021, 1332 }, {  398915,  772, 123410, 1449 },
+ {  455553,  791, 122417, 1697 }, {  487901,  767, 122347, 1886 }, {  490202,  772, 122429, 1911 }, {  493166,  796, 123170, 1933 },
+ {  530441,  721, 123367, 2142 }, {  541565,  705, 123135, 2205 }, {  678715,  749, 123459, 3014 }, {  810746,  724, 122848, 3681 },
+ {  826890,  738, 122437, 3750 }, { 1265129,  742, 123645, 5410 }, { 1477611,  725, 122558, 6280 }, { 1927156,  754, 123095, 8401 },
+ {   15020,  784, 124152,   29 }, {  154357,  734, 124858,  513 }, {  318969,  796, 124702, 1111 }, {  321328,  753, 124097, 1121 },
+ {  338884,  748, 124317, 1202 }, {  347882,  783, 124475, 1232 }, {  420312,  778, 124772, 1536 }, {  431668,  751, 124040, 1582 },
+ {  488279,  713, 124358, 1895 }, {  488435,  708, 124396, 1897 }, {  571452,  760, 125056, 2386 }, {  577574,  752, 124098, 2418 },
+ {  614495,  720, 124842, 2639 }, {  617621,  762, 124261, 2655 }, {  644325,  782, 125222, 2811 }, {  649316,  797, 124919, 2833 },
+ {  688563,  776, 124414, 3072 }, {  823423,  759, 123961, 3738 }, {  836742,  756, 125123, 3814 }, { 1035522,  764, 124276, 4544 },
+ { 1102155,  787, 125002, 4799 }, { 1171716,  775, 124029, 5050 }, { 1187689,  773, 124367, 5111 }, { 1341488,  754, 124991, 5707 },
+ { 1534268,  762, 124875, 6534 }, { 1642016,  720, 124817, 7066 }, { 1645220,  799, 125120, 7083 }, { 1690171,  701, 124396, 7333 },
+ { 1822525,  799, 124702, 7982 }, { 1823569,  755, 124528, 7985 }, { 1840948,  789, 124989, 8059 }, { 1947305,  775, 124354, 8504 },
+ { 2038024,  755, 123971, 8868 }, {   59284,  791, 125759,  174 }, {   91813,  743, 126465,  296 }, {  180114,  762, 125397,  611 },
+ {  440924,  785, 125552, 1625 }, {  446754,  712, 126200, 1657 }, {  449616,  712, 125911, 1673 }, {  488838,  726, 126493, 1901 },
+ {  507659,  797, 125384, 2007 }, {  517741,  787, 126144, 2070 }, {  533965,  738, 125529, 2154 }, {  545568,  783, 126074, 2224 },
+ {  546855,  799, 126580, 2234 }, {  565008,  706, 126357, 2344 }, {  665960,  713, 125408, 2927 }, {  907953,  797, 125355, 4082 },
+ { 1169913,  789, 126593, 5047 }, { 1568197,  747, 125366, 6686 }, { 1572298,  787, 126443, 6706 }, { 1581971,  777, 126341, 6756 },
+ { 1667469,  742, 125292, 7225 }, { 1715279,  746, 126190, 7460 }, { 1861492,  782, 126003, 8141 }, { 1865696,  787, 126062, 8160 },
+ { 1913903,  771, 125649, 8360 }, { 1957510,  778, 126465, 8533 }, { 1977377,  703, 125579, 8610 }, { 2002756,  772, 126685, 8716 },
+ { 2011997,  794, 126283, 8759 }, {    2655,  710, 126743, 9087 }, {   43749,  772, 128097,  117 }, {   51334,  720, 127566,  142 },
+ {  229663,  765, 127280,  771 }, {  257226,  717, 127740,  875 }, {  384012,  717, 127789, 1383 }, {  397036,  781, 127008, 1441 },
+ {  479714,  779, 127353, 1830 }, {  544538,  783, 127783, 2218 }, {  632325,  775, 128016, 2731 }, {  734853,  761, 127797, 3297 },
+ {  737576,  759, 128141, 3321 }, {  770939,  731, 127348, 3500 }, {  948219,  795, 126838, 4240 }, { 1135460,  779, 127885, 4921 },
+ { 1136829,  799, 127240, 4925 }, { 1382004,  753, 127895, 5875 }, { 1385373,  711, 126835, 5895 }, { 1412434,  737, 127383, 6016 },
+ { 1664481,  742, 127721, 7209 }, { 1737886,  765, 126870, 7575 }, { 1871829,  749, 127514, 8199 }, { 1886407,  777, 128135, 8251 },
+ { 2032449,  755, 127426, 8840 }, { 2086851,  793, 126930, 9041 }, {  104457,  794, 128525,  353 }, {  111564,  741, 128888,  373 },
+ {  193392,  754, 128733,  650 }, {  260251,  723, 129299,  892 }, {  261688,  756, 128836,  899 }, {  404287,  723, 128849, 1474 },
+ {  453393,  790, 128874, 1687 }, {  596047,  774, 128555, 2521 }, {  748606,  781, 128380, 3383 }, {  766104,  770, 128231, 3478 },
+ {  916744,  721, 129236, 4116 }, {  952061,  745, 128347, 4253 }, { 1251798,  714, 128546, 5366 }, { 1312657,  752, 129259, 5590 },
+ { 1451052,  775, 128632, 6171 }, { 1704902,  703, 129308, 7414 }, { 2079591,  749, 129269, 9012 }, {  191652,  793, 130818,  639 },
+ {  221594,  735, 129667,  739 }, {  280746,  706, 129901,  962 }, {  326964,  725, 129853, 1146 }, {  351758,  728, 130416, 1244 },
+ {  484513,  735, 130478, 1861 }, {  485728,  734, 129843, 1868 }, {  486520,  793, 130301, 1874 }, {  563114,  787, 130354, 2324 },
+ {  573268,  710, 129936, 2395 }, {  594654,  775, 130081, 2514 }, {  603528,  745, 129800, 2572 }, {  654357,  759, 130934, 2865 },
+ {  767863,  729, 130922, 3486 }, {  944704,  793, 131012, 4224 }, { 1112124,  793, 130456, 4837 }, { 1174099,  797, 129896, 5059 },
+ { 1215622,  715, 130348, 5232 }, { 1358729,  751, 129887, 5772 }, { 1377848,  740, 130787, 5863 }, { 1529751,  731, 129707, 6516 },
+ { 1616093,  739, 131051, 6935 }, { 1619394,  794, 129620, 6957 }, { 1766897,  747, 129629, 7720 }, { 1971976,  789, 130452, 8590 },
+ { 2059505,  787, 129976, 8944 }, {   51769,  793, 131808,  143 }, {  108965,  770, 132490,  368 }, {  116225,  787, 131813,  385 },
+ {  179415,  743, 131259,  607 }, {  180301,  793, 131568,  610 }, {  206720,  728, 131648,  689 }, {  207104,  742, 132361,  691 },
+ {  234811,  771, 132085,  790 }, {  288902,  738, 132427,  992 }, {  315721,  771, 131928, 1099 }, {  327595,  755, 131504, 1150 },
+ {  332993,  791, 131404, 1182 }, {  353329,  738, 131464, 1249 }, {  380766,  786, 131215, 1366 }, {  403743,  731, 132526, 1469 },
+ {  429399,  799, 131753, 1574 }, {  439584,  792, 132124, 1618 }, {  468262,  768, 131678, 1764 }, {  471429,  770, 131305, 1781 },
+ {  472561,  708, 132370, 1787 }, {  496753,  793, 131564, 1955 }, {  522579,  722, 131878, 2103 }, {  546966,  765, 131818, 2233 },
+ {  561095,  787, 132450, 2313 }, {  563945,  720, 131508, 2334 }, {  563988,  755, 131474, 2335 }, {  575644,  780, 132368, 2409 },
+ {  584130,  779, 131793, 2461 }, {  598317,  777, 131860, 2530 }, {  628262,  745, 131512, 2707 }, {  643794,  799, 131330, 2801 },
+ {  789296,  767, 131775, 3596 }, {  917929,  709, 132000, 4119 }, {  954942,  791, 132145, 4265 }, {  966452,  795, 131073, 4306 },
+ {  981234,  742, 131174, 4356 }, { 1075768,  790, 132218, 4681 }, { 1243262,  791, 132303, 5317 }, { 1266799,  794, 132279, 5418 },
+ { 1289607,  769, 132116, 5501 }, { 1307159,  753, 131316, 5573 }, { 1313364,  771, 131277, 5594 }, { 1333757,  763, 131614, 5679 },
+ { 1337571,  789, 131744, 5690 }, { 1341352,  735, 132114, 5710 }, { 1439705,  739, 132040, 6136 }, { 1493549,  764, 132371, 6353 },
+ { 1527467,  744, 131553, 6507 }, { 1567485,  782, 132048, 6684 }, { 1568599,  797, 131169, 6689 }, { 1612489,  721, 131358, 6918 },
+ { 1627623,  775, 131523, 6993 }, { 1640548,  790, 132473, 7059 }, { 1690239,  749, 132371, 7336 }, { 1692807,  783, 131440, 7349 },
+ { 1719550,  767, 131977, 7480 }, { 1739976,  761, 131470, 7596 }, { 1754015,  768, 132105, 7667 }, { 1759321,  799, 132060, 7690 },
+ { 1805029,  716, 131780, 7897 }, { 1923967,  758, 131953, 8390 }, { 1929365,  730, 132392, 8410 }, { 2008980,  743, 132474, 8742 },
+ { 2089545,  761, 131231, 9047 }, {   36996,  777, 133897,   97 }, {  201011,  758, 133632,  672 }, {  391083,  755, 133083, 1415 },
+ {  454026,  789, 132582, 1691 }, {  480471,  778, 133678, 1833 }, {  504748,  795, 132773, 1988 }, {  521968,  790, 133747, 2100 },
+ {  658416,  725, 133860, 2880 }, {  686963,  714, 133645, 3059 }, {  853997,  765, 133672, 3879 }, {  971248,  752, 133920, 4319 },
+ {  988744,  791, 133476, 4381 }, {  996203,  739, 133122, 4400 }, { 1062686,  795, 133836, 4626 }, { 1104461,  771, 133773, 4807 },
+ { 1218191,  791, 132602, 5244 }, { 1338847,  706, 133643, 5694 }, { 1352425,  717, 133755, 5746 }, { 1458844,  774, 132792, 6205 },
+ { 1472980,  751, 132843, 6255 }, { 1509554,  788, 132835, 6414 }, { 1562072,  795, 132973, 6667 }, { 1665396,  783, 133721, 7214 },
+ { 1687249,  710, 132653, 7319 }, { 1702504,  780, 133912, 7400 }, { 1896420,  767, 132944, 8287 }, { 2081800,  777, 132639, 9022 },
+ {  102760,  795, 134634,  347 }, {  177744,  723, 135097,  595 }, {  220640,  725, 134374,  737 }, {  355591,  736, 135189, 1257 },
+ {  427266,  733, 134725, 1562 }, {  464849,  734, 134852, 1746 }, {  510453,  798, 134020, 2024 }, {  537344,  773, 134712, 2174 },
+ {  564105,  755, 135307, 2333 }, {  639884,  789, 135063, 2778 }, {  696638,  729, 134312, 3110 }, {  736321,  773, 134134, 3305 },
+ {  986375,  718, 134000, 4371 }, { 1167550,  769, 134112, 5037 }, { 1241198,  701, 134581, 5313 }, { 1374843,  788, 134735, 5853 },
+ { 1383962,  723, 134271, 5888 }, { 1531147,  759, 135040, 6524 }, { 1638155,  702, 134072, 7040 }, { 1656279,  757, 134764, 7158 },
+ { 1680214,  715, 134412, 7287 }, { 1701528,  785, 135340, 7397 }, { 1892614,  710, 134339, 8277 }, { 1903796,  764, 134984, 8328 },
+ { 2022414,  740, 134171, 8807 }, { 2062765,  768, 134134, 8954 }, { 2085450,  755, 135340, 9033 }, {  113304,  716, 136336,  378 },
+ {  157917,  791, 136440,  527 }, {  174986,  788, 135583,  582 }, {  292892,  769, 136425, 1007 }, {  320182,  757, 135524, 1115 },
+ {  470160,  700, 136234, 1770 }, {  482406,  746, 135867, 1842 }, {  486828,  736, 136558, 1872 }, {  587851,  790, 136799, 2479 },
+ {  610140,  797, 136318, 2610 }, {  632544,  735, 135603, 2729 }, {  660010,  759, 135864, 2887 }, {  661569,  781, 135982, 2901 },
+ {  672234,  794, 136351, 2966 }, { 1011245,  777, 135528, 4455 }, { 1048501,  737, 136395, 4585 }, { 1198670,  736, 136225, 5159 },
+ { 1411182,  791, 136103, 6011 }, { 1586791,  773, 136888, 6795 }, { 1587282,  769, 135615, 6797 }, { 1588406,  751, 135913, 6800 },
+ { 2010812,  783, 135458, 8751 }, { 2077333,  704, 136150, 9004 }, {  265603,  761, 137411,  910 }, {  510043,  797, 137514, 2019 },
+ {  531531,  763, 137128, 2145 }, {  571357,  784, 138144, 2382 }, {  700842,  765, 138179, 3136 }, {  748167,  787, 137999, 3378 },
+ {  892462,  777, 137793, 4004 }, {  936944,  779, 137986, 4193 }, { 1309825,  793, 137724, 5584 }, { 1332842,  733, 138266, 5675 },
+ { 1399342,  783, 137520, 5963 }, { 1457295,  777, 137217, 6195 }, { 1684300,  759, 138113, 7303 }, { 1833658,  723, 137325, 8034 },
+ { 1961162,  775, 137471, 8548 }, { 1966032,  748, 137526, 8566 }, {   70463,  775, 138762,  222 }, {   99571,  752, 139300,  330 },
+ {  354977,  733, 138988, 1253 }, {  366038,  772, 139116, 1292 }, {  399243,  768, 139182, 1448 }, {  458366,  750, 138581, 1709 },
+ {  531526,  767, 138965, 2144 }, {  549437,  771, 138500, 2251 }, {  664940,  791, 139609, 2918 }, {  864660,  795, 139749, 3915 },
+ { 1063222,  772, 139529, 4629 }, { 1168233,  787, 138579, 5040 }, { 1258566,  710, 139548, 5392 }, { 1376826,  758, 139005, 5859 },
+ { 1417408,  748, 138385, 6047 }, { 1445572,  763, 139113, 6158 }, { 1467676,  724, 138713, 6234 }, { 1639089,  783, 139082, 7048 },
+ { 1717325,  717, 138933, 7474 }, { 1781383,  731, 138853, 7794 }, { 1841676,  761, 139086, 8066 }, { 1842938,  794, 139749, 8077 },
+ { 1891124,  767, 139478, 8270 }, { 1896551,  730, 139344, 8289 }, { 1952186,  737, 139503, 8513 }, { 2039398,  705, 138909, 8878 },
+ {   47181,  767, 141202,  132 }, {   69021,  799, 140889,  216 }, {  227310,  782, 141102,  753 }, {  280261,  756, 140772,  958 },
+ {  306937,  794, 140085, 1067 }, {  328660,  735, 139883, 1153 }, {  329367,  791, 140980, 1159 }, {  337879,  767, 140589, 1199 },
+ {  379653,  777, 140001, 1360 }, {  506816,  727, 140472, 1999 }, {  652499,  725, 141182, 2851 }, {  751261,  799, 140713, 3395 },
+ {  840625,  700, 141027, 3827 }, {  853667,  779, 140842, 3876 }, {  924494,  708, 141199, 4146 }, {  955405,  781, 140080, 4267 },
+ { 1109672,  759, 140985, 4829 }, { 1411481,  797, 140362, 6014 }, { 1433316,  785, 141191, 6111 }, { 1545977,  795, 140266, 6590 },
+ { 1563014,  777, 139958, 6670 }, { 1613613,  773, 140093, 6928 }, { 1626242,  745, 140789, 6987 }, { 1653631,  757, 140706, 7135 },
+ { 1673350,  722, 139917, 7266 }, { 1817248,  758, 139822, 7953 }, { 1868349,  716, 140991, 8178 }, {   70327,  793, 141703,  221 },
+ {  107379,  724, 142104,  361 }, {  228044,  781, 142329,  766 }, {  369261,  729, 142309, 1309 }, {  406474,  739, 142535, 1480 },
+ {  429329,  733, 142401, 1571 }, {  492275,  788, 142055, 1920 }, {  561015,  798, 141391, 2310 }, {  623066,  775, 141953, 2682 },
+ {  634471,  782, 142691, 2747 }, {  640495,  791, 141474, 2779 }, {  736790,  713, 142088, 3306 }, {  790432,  785, 141701, 3599 },
+ { 1115013,  722, 142247, 4847 }, { 1471390,  749, 141627, 6250 }, { 1600766,  739, 141645, 6857 }, { 1726750,  791, 142160, 7519 },
+ { 1753654,  752, 141672, 7669 }, { 1835103,  799, 142019, 8038 }, { 1865708,  782, 141783, 8163 }, { 2070857,  789, 141631, 8983 },
+ {    3634,  763, 143430, 9093 }, {   21816,  779, 143918,   50 }, {   29999,  737, 143000,   80 }, {  191295,  763, 143553,  635 },
+ {  256654,  797, 143279,  870 }, {  355268,  746, 143010, 1254 }, {  448385,  734, 143449, 1664 }, {  468549,  780, 143347, 1763 },
+ {  592067,  793, 143578, 2494 }, {  601217,  777, 143277, 2551 }, {  692531,  786, 143979, 3087 }, {  827919,  771, 142997, 3755 },
+ {  868619,  785, 144082, 3926 }, {  910591,  761, 143866, 4088 }, {  924839,  767, 143670, 4148 }, {  981627,  779, 142811, 4358 },
+ { 1017206,  736, 142918, 4483 }, { 1030976,  732, 143081, 4528 }, { 1041369,  758, 143369, 4559 }, { 1225290,  799, 144026, 5262 },
+ { 1257386,  712, 143373, 5386 }, { 1258313,  795, 143078, 5388 }, { 1410432,  773, 143501, 6010 }, { 1464848,  715, 143571, 6228 },
+ { 1520377,  777, 143965, 6476 }, { 1610215,  765, 142769, 6902 }, { 1749056,  791, 143536, 7648 }, { 1924069,  765, 143097, 8393 },
+ { 2023643,  712, 143709, 8815 }, { 2026864,  716, 143771, 8826 }, {  309621,  777, 144723, 1079 }, {  352101,  767, 145632, 1243 },
+ {  384282,  712, 144850, 1381 }, {  450490,  743, 145387, 1672 }, {  488085,  761, 145541, 1880 }, {  505164,  779, 144940, 1987 },
+ {  509787,  780, 145448, 2014 }, {  519142,  799, 144922, 2075 }, {  549206,  739, 145552, 2247 }, {  575687,  788, 145619, 2406 },
+ {  606470,  792, 145572, 2589 }, {  616473,  797, 144381, 2647 }, {  619900,  778, 144450, 2663 }, {  753077,  788, 145134, 3406 },
+ {  827878,  741, 144262, 3754 }, {  832977,  707, 145222, 3779 }, { 1116115,  767, 144966, 4849 }, { 1160387,  722, 144797, 5011 },
+ { 1409206,  763, 145478, 6004 }, { 1535889,  781, 145034, 6548 }, { 1625967,  739, 144358, 6985 }, { 1964818,  758, 144367, 8562 },
+ { 1998705,  716, 145396, 8697 }, { 2024371,  739, 145376, 8821 }, { 2067906,  797, 145165, 8970 }, { 2084559,  779, 144635, 9030 },
+ {  210905,  747, 146525,  702 }, {  263215,  795, 146903,  902 }, {  370795,  722, 145652, 1315 }, {  488204,  760, 145985, 1883 },
+ {  616961,  713, 147022, 2649 }, {  679055,  730, 146754, 3008 }, {  764223,  766, 145755, 3465 }, {  797714,  724, 146609, 3623 },
+ {  945549,  734, 146430, 4227 }, { 1068137,  785, 146017, 4650 }, { 1149366,  778, 145668, 4960 }, { 1178507,  765, 146827, 5081 },
+ { 1193595,  757, 146722, 5138 }, { 1244961,  729, 145782, 5330 }, { 1363867,  726, 145650, 5802 }, { 1503634,  733, 146488, 6393 },
+ { 1512595,  703, 146894, 6433 }, { 1734559,  711, 146241, 7560 }, { 1804614,  705, 145761, 7896 }, { 1832724,  748, 146858, 8030 },
+ { 2072937,  706, 146118, 8991 }, { 2086402,  730, 147015, 9039 }, {   14619,  751, 147304,   26 }, {   68485,  750, 148510,  213 },
+ {  161461,  794, 147155,  534 }, {  277652,  798, 148363,  948 }, {  306429,  714, 147582, 1061 }, {  332445,  707, 147301, 1174 },
+ {  389546,  788, 147401, 1402 }, {  414231,  740, 147305, 1507 }, {  416559,  737, 148120, 1519 }, {  429307,  719, 147712, 1569 },
+ {  460308,  756, 147589, 1718 }, {  490898,  794, 147143, 1908 }, {  519664,  787, 147851, 2076 }, {  570608,  723, 147885, 2375 },
+ {  648035,  730, 148067, 2820 }, {  780500,  741, 148004, 3550 }, {  853990,  763, 148272, 3877 }, {  997577,  780, 147719, 4404 },
+ { 1154232,  777, 147902, 4986 }, { 1157106,  767, 147575, 4998 }, { 1284105,  756, 148054, 5481 }, { 1670406,  709, 147196, 7248 },
+ { 1686193,  728, 147959, 7315 }, { 1696610,  716, 148467, 7373 }, { 1713949,  798, 147490, 7456 }, { 1722238,  727, 148296, 7497 },
+ { 1731172,  772, 148280, 7544 }, { 1742148,  728, 147709, 7610 }, { 1802704,  743, 147642, 7883 }, { 1862485,  796, 147388, 8149 },
+ { 1927220,  780, 147655, 8404 }, { 1937860,  778, 148001, 8458 }, { 2008601,  775, 148153, 8739 }, { 2029346,  782, 147187, 8833 },
+ {  141410,  757, 148755,  463 }, {  228111,  768, 149200,  763 }, {  240240,  718, 149198,  812 }, {  407862,  746, 148836, 1484 },
+ {  522667,  770, 149726, 2099 }, {  547226,  733, 149351, 2229 }, {  548235,  704, 148945, 2241 }, {  582241,  797, 149980, 2449 },
+ {  617291,  798, 149414, 2651 }, {  632849,  762, 148717, 2728 }, {  737981,  750, 149501, 3319 }, {  761973,  764, 149540, 3450 },
+ {  767402,  787, 148708, 3481 }, {  871226,  726, 149196, 3937 }, { 1243854,  754, 149945, 5323 }, { 1371581,  733, 149783, 5843 },
+ { 1605761,  789, 148590, 6883 }, { 1688870,  753, 149094, 7331 }, { 1819906,  798, 149342, 7973 }, { 1828663,  758, 149376, 8012 },
+ { 1917933,  754, 148660, 8373 }, { 1953728,  701, 148847, 8520 }, { 2043379,  708, 149005, 8893 }, {    8301,  751, 150581,    4 },
+ {  178530,  794, 150699,  601 }, {  271458,  762, 150277,  931 }, {  362672,  795, 150585, 1284 }, {  391522,  703, 150074, 1414 },
+ {  394121,  740, 151060, 1430 }, {  506396,  729, 151315, 1993 }, {  546340,  791, 151244, 2222 }, {  597725,  765, 150607, 2525 },
+ {  672637,  777, 150705, 2965 }, {  706442,  712, 150177, 3163 }, {  898103,  741, 151065, 4035 }, {  984300,  732, 150452, 4365 },
+ { 1161094,  733, 150989, 5013 }, { 1251405,  741, 150011, 5365 }, { 1282622,  791, 150783, 5473 }, { 1470303,  791, 150385, 6246 },
+ { 1490805,  793, 150886, 6341 }, { 1658471,  789, 151325, 7167 }, { 1658928,  723, 150911, 7172 }, { 1698695,  774, 150039, 7389 },
+ { 1776758,  795, 150803, 7774 }, { 1797070,  738, 150044, 7858 }, { 1804034,  772, 150463, 7892 }, { 1828617,  717, 151055, 8011 },
+ { 1923977,  760, 150179, 8392 }, {   94794,  768, 152839,  308 }, {  378597,  759, 151512, 1351 }, {  381650,  772, 151573, 1368 },
+ {  390871,  790, 152540, 1408 }, {  486284,  764, 151906, 1864 }, {  505676,  772, 152172, 1989 }, {  510426,  752, 151906, 2016 },
+ {  513178,  759, 151711, 2033 }, {  553517,  769, 152409, 2269 }, {  573224,  753, 151687, 2391 }, {  672914,  756, 151764, 2967 },
+ {  740734,  795, 151768, 3333 }, {  808612,  734, 152832, 3669 }, {  850121,  735, 151493, 3866 }, {  920703,  746, 151661, 4127 },
+ {  941420,  748, 151745, 4209 }, { 1032039,  788, 151875, 4531 }, { 1071882,  710, 152770, 4663 }, { 1119796,  770, 151639, 4865 },
+ { 1305215,  777, 152111, 5567 }, { 1379589,  771, 151629, 5870 }, { 1394086,  754, 152064, 5940 }, { 1506823,  739, 152029, 6407 },
+ { 1684198,  763, 152254, 7307 }, { 1703016,  756, 152329, 7407 }, { 1807730,  799, 152310, 7918 }, { 1899847,  794, 152585, 8314 },
+ { 1981923,  771, 152261, 8631 }, { 1983493,  790, 152213, 8642 }, {   53577,  789, 153255,  155 }, {   67793,  738, 153610,  211 },
+ {  193776,  771, 153325,  648 }, {  239641,  777, 153371,  809 }, {  249755,  749, 153037,  847 }, {  379534,  726, 153056, 1356 },
+ {  393425,  758, 153847, 1422 }, {  394160,  748, 153925, 1428 }, {  406546,  707, 154082, 1478 }, {  430846,  781, 152976, 1576 },
+ {  477335,  750, 154190, 1814 }, {  481231,  794, 153442, 1832 }, {  615004,  774, 153407, 2632 }, {  623854,  744, 154273, 2684 },
+ {  660615,  725, 154121, 2886 }, {  694667,  778, 154068, 3095 }, {  782425,  720, 153387, 3561 }, {  782918,  767, 153764, 3565 },
+ { 1004446,  774, 153519, 4426 }, { 1042277,  753, 153859, 4564 }, { 1248786,  780, 153301, 5352 }, { 1290477,  763, 153109, 5512 },
+ { 1348279,  717, 153541, 5739 }, { 1384550,  720, 153112, 5894 }, { 1464184,  756, 154003, 6227 }, { 1546618,  752, 154304, 6594 },
+ { 1682579,  757, 153039, 7300 }, { 1804546,  797, 154138, 7899 }, {   71330,  707, 155744,  225 }, {  107955,  798, 154568,  364 },
+ {  145170,  797, 154965,  475 }, {  157551,  784, 155765,  522 }, {  383629,  764, 155506, 1376 }, {  405095,  779, 154422, 1472 },
+ {  453936,  718, 154440, 1684 }, {  546743,  730, 154582, 2223 }, {  596858,  785, 154669, 2519 }, {  612053,  768, 154489, 2615 },
+ {  615395,  782, 155356, 2635 }, {  631143,  700, 154605, 2717 }, {  696902,  799, 155129, 3104 }, {  701243,  799, 155037, 3134 },
+ {  840380,  769, 155011, 3826 }, {  998487,  757, 155038, 4408 }, { 1011742,  795, 155534, 4456 }, { 1116508,  712, 155215, 4851 },
+ { 1150225,  791, 155610, 4962 }, { 1282658,  788, 154982, 5476 }, { 1306635,  771, 154939, 5575 }, { 1363860,  793, 154547, 5804 },
+ { 1521200,  771, 154812, 6481 }, { 1523212,  798, 155710, 6495 }, { 1534499,  769, 154836, 6542 }, { 1618118,  777, 155726, 6955 },
+ { 1714553,  766, 155048, 7463 }, { 1741833,  736, 155298, 7609 }, { 1744360,  753, 155523, 7622 }, { 1752724,  767, 154419, 7664 },
+ { 1815559,  714, 154555, 7947 }, { 1939655,  795, 154433, 8461 }, { 1999632,  764, 155599, 8703 }, {   40848,  706, 157131,  103 },
+ {  139684,  780, 156462,  457 }, {  170906,  710, 157021,  563 }, {  246549,  722, 156506,  836 }, {  339574,  797, 156306, 1201 },
+ {  361162,  789, 156325, 1280 }, {  433079,  748, 156054, 1585 }, {  476474,  742, 157231, 1808 }, {  477724,  777, 156178, 1816 },
+ {  483855,  746, 155915, 1847 }, {  490884,  754, 155889, 1905 }, {  505992,  749, 156892, 1990 }, {  545371,  788, 157150, 2214 },
+ {  586044,  721, 156770, 2466 }, {  615201,  794, 156930, 2631 }, {  657991,  742, 155955, 2877 }, {  669162,  705, 156813, 2938 },
+ {  700199,  755, 156279, 3128 }, {  716835,  763, 156773, 3208 }, { 1102420,  768, 155960, 4801 }, { 1137647,  796, 156009, 4929 },
+ { 1150504,  722, 156601, 4968 }, { 1213458,  770, 157189, 5225 }, { 1399905,  712, 157022, 5966 }, { 1409862,  700, 155898, 6008 },
+ { 1554125,  772, 156845, 6627 }, { 1606093,  725, 157034, 6885 }, { 1657689,  738, 156355, 7165 }, { 1747707,  737, 156583, 7645 },
+ { 1753602,  780, 155932, 7672 }, { 1777273,  780, 156985, 7780 }, { 1908037,  729, 156246, 8344 }, { 2025368,  771, 156696, 8824 },
+ {   13165,  753, 157595,   22 }, {  138089,  789, 157957,  450 }, {  245447,  782, 157699,  828 }, {  256040,  791, 157769,  867 },
+ {  256952,  763, 157320,  869 }, {  350710,  789, 157569, 1238 }, {  424346,  710, 158509, 1547 }, {  447757,  700, 158226, 1656 },
+ {  485734,  769, 158073, 1858 }, {  733076,  795, 157770, 3284 }, {  745065,  735, 157424, 3357 }, {  941400,  749, 158585, 4208 },
+ { 1005589,  752, 157883, 4433 }, { 1099738,  702, 157835, 4792 }, { 1246742,  798, 158614, 5343 }, { 1279020,  791, 157721, 5462 },
+ { 1328301,  789, 158708, 5654 }, { 1371758,  781, 157962, 5845 }, { 1420643,  769, 158464, 6065 }, { 1478740,  735, 157917, 6293 },
+ { 1515069,  700, 157370, 6452 }, { 1599265,  799, 157478, 6852 }, { 1624142,  778, 157582, 6977 }, { 1654570,  769, 157440, 7148 },
+ { 1752394,  796, 158015, 7662 }, { 2065035,  753, 157870, 8963 }, {   79498,  774, 159017,  254 }, {  101683,  755, 159702,  339 },
+ {  125618,  738, 158994,  413 }, {  126258,  750, 159093,  414 }, {  190239,  770, 159471,  631 }, {  201159,  762, 160055,  669 },
+ {  323769,  769, 159763, 1126 }, {  362875,  750, 159630, 1283 }, {  385864,  798, 158803, 1385 }, {  516926,  792, 159835, 2052 },
+ {  529319,  714, 159749, 2130 }, {  541796,  775, 159894, 2193 }, {  545913,  720, 158971, 2220 }, {  687320,  799, 159217, 3053 },
+ {  692738,  735, 160030, 3086 }, { 1195194,  775, 160134, 5144 }, { 1261869,  739, 159073, 5405 }, { 1534096,  764, 159117, 6541 },
+ { 1644065,  788, 159221, 7086 }, { 1697349,  716, 159906, 7385 }, { 1698807,  781, 160041, 7391 }, { 1710608,  700, 159869, 7437 },
+ { 1731575,  700, 158950, 7546 }, { 1755139,  710, 160186, 7679 }, { 1835680,  765, 159222, 8044 }, { 1889995,  745, 159207, 8267 },
+ { 1910112,  777, 159947, 8348 }, { 1913102,  768, 159716, 8358 }, { 1933278,  775, 159435, 8435 }, { 1979008,  782, 159503, 8618 },
+ { 2086212,  708, 158918, 9036 }, {   47465,  738, 160628,  131 }, {   98964,  755, 161276,  328 }, {  121482,  797, 160882,  397 },
+ {  149272,  724, 160590,  493 }, {  236464,  769, 160216,  793 }, {  259358,  780, 161173,  878 }, {  295281,  709, 161280, 1015 },
+ {  382119,  791, 161395, 1370 }, {  383808,  799, 161630, 1375 }, {  405250,  792, 161196, 1471 }, {  448276,  730, 160808, 1658 },
+ {  518203,  740, 160454, 2063 }, {  643632,  710, 160845, 2795 }, {  650901,  793, 160574, 2837 }, {  728688,  783, 161288, 3264 },
+ {  746686,  733, 160842, 3366 }, { 1066278,  757, 160988, 4643 }, { 1091859,  769, 161504, 4756 }, { 1337529,  770, 161033, 5692 },
+ { 1390203,  744, 160652, 5924 }, { 1442608,  725, 160897, 6152 }, { 1478084,  741, 161595, 6287 }, { 1524540,  754, 160317, 6502 },
+ { 1555990,  769, 161023, 6638 }, { 1576338,  728, 161413, 6738 }, { 1585799,  710, 160265, 6794 }, { 1698431,  763, 160342, 7390 },
+ { 1891833,  785, 160585, 8276 }, { 2006079,  749, 161319, 8729 }, {   57327,  787, 162020,  166 }, {   58148,  736, 162294,  167 },
+ {   95656,  734, 162345,  310 }, {   95675,  756, 162333,  311 }, {  174173,  787, 161740,  577 }, {  193406,  727, 161962,  646 },
+ {  231294,  743, 163056,  773 }, {  293058,  728, 161869, 1005 }, {  376303,  765, 162499, 1331 }, {  377830,  735, 161863, 1339 },
+ {  378087,  738, 162782, 1341 }, {  390323,  772, 162558, 1403 }, {  448449,  789, 162682, 1660 }, {  599363,  727, 162764, 2529 },
+ {  652069,  722, 162304, 2846 }, {  710357,  730, 162503, 3176 }, {  877913,  766, 163038, 3952 }, { 1020592,  726, 162169, 4495 },
+ { 1054805,  787, 162324, 4602 }, { 1099745,  785, 162939, 4793 }, { 1105551,  746, 161746, 4815 }, { 1145210,  799, 161879, 4946 },
+ { 1221370,  776, 162669, 5255 }, { 1575046,  718, 162522, 6729 }, { 1648992,  748, 162275, 7113 }, { 1678612,  793, 162463, 7286 },
+ { 1682513,  764, 161994, 7301 }, { 1785018,  766, 162252, 7811 }, { 1933805,  778, 162679, 8438 }, { 2020662,  799, 161851, 8799 },
+ {  160405,  786, 163513,  530 }, {  184323,  703, 164056,  613 }, {  344965,  763, 163808, 1218 }, {  357298,  790, 163125, 1262 },
+ {  386541,  728, 163403, 1388 }, {  389272,  753, 164563, 1399 }, {  538182,  793, 163389, 2169 }, {  708236,  799, 164037, 3169 },
+ {  800061,  714, 163178, 3627 }, { 1145244,  760, 164009, 4949 }, { 1195724,  762, 163834, 5149 }, { 1270731,  792, 163490, 5434 },
+ { 1443573,  776, 163396, 6154 }, { 1486893,  765, 164033, 6325 }, { 1494660,  756, 163234, 6364 }, { 1520595,  774, 164510, 6480 },
+ { 1559475,  798, 163573, 6655 }, { 1566815,  758, 163788, 6687 }, { 1581648,  706, 163431, 6765 }, { 1832493,  731, 163586, 8032 },
+ { 1877240,  793, 163373, 8223 }, { 1902107,  729, 164494, 8321 }, { 2058513,  732, 163838, 8940 }, {   80051,  747, 165483,  258 },
+ {  168719,  774, 165409,  559 }, {  332556,  745, 165181, 1172 }, {  433720,  779, 165950, 1586 }, {  538463,  775, 164733, 2173 },
+ {  600018,  765, 165444, 2533 }, {  671344,  789, 164595, 2951 }, {  897899,  797, 165301, 4030 }, {  898926,  782, 164723, 4039 },
+ {  937044,  708, 164842, 4192 }, { 1172529,  778, 165812, 5057 }, { 1296540,  785, 165896, 5534 }, { 1415043,  770, 165289, 6039 },
+ { 1508338,  796, 165650, 6419 }, { 1605115,  741, 164984, 6882 }, { 1615965,  790, 165830, 6943 }, { 1620589,  784, 165467, 6966 },
+ { 1624575,  761, 165450, 6980 }, { 1686062,  743, 164605, 7318 }, { 1746425,  767, 164716, 7641 }, { 1757661,  707, 165463, 7688 },
+ { 1770205,  715, 165309, 7741 }, { 1803820,  791, 165559, 7895 }, { 1865698,  757, 165815, 8165 }, {  193149,  796, 166269,  644 },
+ {  297546,  750, 167079, 1022 }, {  312306,  792, 166701, 1086 }, {  327393,  746, 166446, 1140 }, {  327915,  764, 167247, 1144 },
+ {  329001,  776, 166832, 1151 }, {  333777,  709, 166224, 1180 }, {  355877,  747, 166179, 1252 }, {  448718,  750, 166411, 1659 },
+ {  488537,  738, 166082, 1875 }, {  541092,  780, 166637, 2185 }, {  615184,  718, 166338, 2630 }, {  629786,  785, 166211, 2706 },
+ {  633075,  782, 167313, 2725 }, {  728957,  798, 166057, 3268 }, {  744938,  775, 166143, 3355 }, {  790420,  745, 166684, 3595 },
+ {  861992,  732, 166600, 3900 }, {  974037,  768, 166983, 4332 }, { 1091463,  748, 166183, 4753 }, { 1093738,  746, 166851, 4766 },
+ { 1189821,  774, 166918, 5123 }, { 1473475,  704, 166980, 6270 }, { 1515925,  712, 166752, 6457 }, { 1540123,  777, 166476, 6571 },
+ { 1547339,  752, 166846, 6602 }, { 1548630,  771, 166502, 6608 }, { 1600794,  727, 166674, 6860 }, { 1669916,  777, 166390, 7250 },
+ { 1702407,  781, 167144, 7406 }, { 1736015,  757, 167470, 7573 }, { 1739644,  752, 166490, 7601 }, { 1750168,  788, 167190, 7656 },
+ { 1750573,  722, 167391, 7657 }, { 1772072,  732, 167002, 7753 }, { 1779749,  754, 166674, 7789 }, { 1803742,  704, 166194, 7894 },
+ { 1869931,  771, 166424, 8190 }, { 1940060,  792, 167408, 8466 }, {  102416,  780, 168148,  341 }, {  180086,  763, 168843,  605 },
+ {  197647,  758, 167544,  657 }, {  197725,  779, 168621,  656 }, {  219240,  792, 167823,  728 }, {  245782,  786, 167755,  830 },
+ {  335420,  726, 168325, 1188 }, {  382412,  737, 168397, 1369 }, {  434222,  781, 167554, 1590 }, {  479541,  747, 167700, 1821 },
+ {  494778,  718, 168787, 1928 }, {  604839,  773, 168028, 2569 }, {  645858,  703, 167555, 2808 }, {  675917,  731, 168623, 2983 },
+ {  700407,  783, 168053, 3124 }, {  714274,  773, 168220, 3191 }, {  898132,  784, 168022, 4032 }, { 1065838,  766, 168748, 4640 },
+ { 1090682,  729, 168810, 4752 }, { 1204001,  795, 168504, 5182 }, { 1323232,  781, 167639, 5640 }, { 1488849,  775, 168217, 6333 },
+ { 1514847,  738, 168264, 6455 }, { 1556582,  712, 168388, 6644 }, { 1723910,  749, 168605, 7506 }, { 1729874,  795, 168040, 7540 },
+ { 1912287,  708, 168828, 8356 }, { 2050073,  798, 167724, 8915 }, {  264913,  790, 169610,  905 }, {  365300,  741, 169637, 1287 },
+ {  491006,  783, 170283, 1902 }, {  628250,  778, 170185, 2700 }, {  799231,  798, 169854, 3626 }, {  936480,  751, 169411, 4189 },
+ { 1078181,  754, 169839, 4693 }, { 1083978,  718, 169081, 4717 }, { 1087881,  700, 170140, 4738 }, { 1322949,  767, 169376, 5638 },
+ { 1458703,  792, 170273, 6213 }, { 1566194,  746, 169010, 6685 }, { 1584260,  786, 169085, 6781 }, { 1584260,  790, 169079, 6782 },
+ { 1659894,  727, 169273, 7181 }, { 1662124,  769, 169362, 7202 }, { 1693521,  718, 169320, 7358 }, { 1705921,  787, 169836, 7421 },
+ { 1763003,  752, 170254, 7711 }, { 1764812,  749, 170115, 7718 }, { 1765120,  792, 169635, 7719 }, { 1801626,  759, 169610, 7880 },
+ { 1870786,  768, 169191, 8198 }, { 1929948,  778, 169919, 8415 }, { 1964871,  779, 170049, 8564 }, {    3160,  775, 170513, 9088 },
+ {  171457,  782, 171565,  564 }, {  234015,  730, 170482,  782 }, {  279965,  779, 170768,  954 }, {  291169,  790, 170497,  995 },
+ {  294473,  752, 171278, 1012 }, {  307796,  796, 171226, 1065 }, {  359147,  720, 171267, 1268 }, {  426399,  797, 171701, 1554 },
+ {  511135,  756, 171803, 2013 }, {  634901,  771, 171701, 2738 }, {  647433,  776, 171323, 2816 }, {  655086,  701, 171728, 2861 },
+ {  728273,  714, 170711, 3262 }, {  737588,  757, 171695, 3304 }, {  780114,  722, 171744, 3540 }, { 1014058,  780, 171531, 4465 },
+ { 1120360,  778, 171198, 4869 }, { 1218343,  701, 171110, 5247 }, { 1288855,  712, 170503, 5505 }, { 1651828,  762, 171718, 7132 },
+ { 1705036,  711, 171799, 7418 }, { 1875303,  741, 171280, 8217 }, {   84231,  742, 173295,  274 }, {  118144,  723, 172925,  389 },
+ {  202361,  703, 172786,  675 }, {  399964,  788, 173250, 1445 }, {  409716,  778, 172746, 1490 }, {  575554,  727, 171882, 2398 },
+ {  580188,  779, 173283, 2425 }, {  589472,  744, 173264, 2480 }, {  654399,  705, 172022, 2857 }, {  775650,  795, 172332, 3522 },
+ { 1074074,  770, 173215, 4673 }, { 1213394,  790, 172794, 5229 }, { 1296117,  780, 172747, 5532 }, { 1381460,  785, 172078, 5880 },
+ { 1512874,  765, 173049, 6443 }, { 1531834,  762, 172443, 6533 }, { 1603472,  712, 173117, 6877 }, { 1669899,  755, 172765, 7253 },
+ { 1768367,  718, 172862, 7731 }, { 1822585,  777, 172215, 7988 }, { 1827086,  701, 171934, 8008 }, { 1911464,  753, 173005, 8354 },
+ { 1930513,  770, 173254, 8419 }, { 1942259,  789, 172736, 8482 }, { 2082089,  797, 173077, 9025 }, {   43868,  723, 174401,  114 },
+ {  215784,  729, 174281,  717 }, {  216718,  789, 174663,  720 }, {  276142,  772, 173418,  944 }, {  359732,  723, 173308, 1269 },
+ {  467798,  776, 174136, 1752 }, {  494151,  796, 173620, 1924 }, {  616776,  793, 173797, 2643 }, {  718199,  764, 174263, 3215 },
+ {  798085,  743, 174259, 3621 }, {  849863,  764, 174725, 3861 }, {  873235,  773, 174246, 3942 }, {  897465,  735, 173759, 4024 },
+ { 1331818,  726, 173545, 5676 }, { 1340053,  751, 174204, 5709 }, { 1422491,  778, 173525, 6074 }, { 1471866,  772, 174481, 6258 },
+ { 1558856,  750, 173776, 6654 }, { 1601799,  799, 174276, 6867 }, { 1603377,  763, 174557, 6876 }, { 1610700,  783, 174513, 6917 },
+ { 1710997,  738, 173981, 7441 }, { 1752903,  771, 174612, 7670 }, {   29720,  790, 176126,   78 }, {  148043,  799, 174831,  485 },
+ {  284487,  752, 175573,  971 }, {  476430,  774, 175066, 1804 }, {  493173,  740, 175480, 1914 }, {  565894,  755, 175481, 2332 },
+ {  662853,  733, 176162, 2896 }, {  778051,  739, 175606, 3532 }, {  801935,  795, 176165, 3639 }, {  940609,  724, 175756, 4203 },
+ { 1344515,  758, 175182, 5727 }, { 1583095,  704, 175581, 6775 }, { 1620678,  748, 175570, 6968 }, { 1682692,  785, 175529, 7302 },
+ { 1745636,  749, 176195, 7640 }, { 1804412,  768, 175250, 7904 }, { 1847603,  759, 175062, 8094 }, { 1907600,  704, 175016, 8343 },
+ { 2040102,  759, 175367, 8882 }, {   27144,  787, 176972,   71 }, {   91486,  750, 177391,  291 }, {  103566,  716, 176838,  349 },
+ {  214757,  754, 177386,  712 }, {  258195,  711, 177580,  873 }, {  387544,  728, 176858, 1390 }, {  421197,  758, 176856, 1529 },
+ {  472794,  794, 176427, 1776 }, {  516982,  790, 177241, 2046 }, {  525992,  798, 176270, 2110 }, {  839902,  756, 176455, 3820 },
+ {  846997,  789, 176624, 3850 }, {  875287,  736, 177564, 3951 }, { 1021738,  773, 177306, 4501 }, { 1206802,  762, 176496, 5195 },
+ { 1331257,  799, 177367, 5674 }, { 1475242,  732, 177241, 6279 }, { 1530518,  761, 176450, 6528 }, { 1636740,  770, 177569, 7044 },
+ { 1667476,  756, 177303, 7237 }, { 1677382,  798, 176632, 7283 }, { 1844482,  782, 176488, 8084 }, { 1962832,  798, 177443, 8555 },
+ { 2041686,  732, 177402, 8887 }, {   30232,  779, 179003,   79 }, {  158296,  779, 178681,  523 }, {  421348,  786, 178532, 1528 },
+ {  459344,  702, 178677, 1706 }, {  542252,  778, 178685, 2189 }, {  571551,  787, 178338, 2372 }, {  596652,  771, 178559, 2512 },
+ {  754854,  794, 178843, 3409 }, {  775621,  766, 178366, 3519 }, {  781980,  745, 179001, 3555 }, {  785767,  720, 178285, 3575 },
+ {  788473,  782, 178043, 3587 }, {  920208,  790, 178228, 4124 }, { 1342483,  737, 179035, 5718 }, { 1374783,  756, 178427, 5855 },
+ { 1515571,  739, 178357, 6458 }, { 1581350,  771, 178011, 6768 }, { 1645340,  791, 178859, 7100 }, { 1645509,  725, 178478, 7102 },
+ { 1655915,  722, 178988, 7162 }, { 1671061,  723, 178406, 7261 }, { 1722495,  794, 178297, 7502 }, { 1754328,  764, 177994, 7678 },
+ { 1807400,  751, 178123, 7921 }, { 1865351,  768, 178335, 8166 }, { 1875988,  780, 178003, 8220 }, { 1966124,  765, 178509, 8574 },
+ { 2045956,  757, 178236, 8903 }, {   45769,  787, 179979,  122 }, {   84813,  798, 180516,  275 }, {  179083,  750, 179545,  599 },
+ {  197972,  728, 179654,  655 }, {  297818,  761, 179912, 1019 }, {  303427,  761, 180308, 1041 }, {  334297,  711, 179265, 1177 },
+ {  365521,  772, 179986, 1286 }, {  385385,  776, 180529, 1379 }, {  464577,  741, 180222, 1732 }, {  466055,  703, 180527, 1740 },
+ {  513611,  798, 180468, 2028 }, {  607312,  789, 180124, 2586 }, {  680854,  714, 179737, 3013 }, {  799323,  793, 180417, 3625 },
+ {  831171,  785, 180087, 3764 }, {  907463,  790, 180454, 4075 }, {  908974,  750, 180178, 4081 }, {  954991,  703, 179870, 4258 },
+ { 1047547,  796, 179376, 4581 }, { 1072608,  700, 179221, 4668 }, { 1097580,  742, 179492, 4783 }, { 1399623,  741, 179574, 5968 },
+ { 1419481,  764, 180382, 6063 }, { 1430661,  720, 180296, 6107 }, { 1430850,  739, 180156, 6108 }, { 1487823,  725, 179959, 6332 },
+ { 1573748,  799, 179443, 6726 }, { 1589978,  788, 179783, 6814 }, { 1626196,  742, 179815, 6997 }, { 1770047,  766, 180194, 7743 },
+ { 1826122,  747, 179769, 8005 }, { 1935827,  758, 179383, 8449 }, { 2060214,  763, 179856, 8948 }, {  222641,  783, 181378,  738 },
+ {  226871,  735, 181589,  750 }, {  228708,  730, 180972,  758 }, {  337722,  777, 181111, 1191 }, {  385187,  773, 180778, 1377 },
+ {  460650,  796, 181042, 1712 }, {  475959,  794, 181159, 1795 }, {  477173,  707, 181281, 1805 }, {  620689,  755, 181278, 2660 },
+ {  622405,  791, 180602, 2665 }, {  808625,  797, 181511, 3664 }, {  922623,  758, 182028, 4137 }, {  953869,  772, 180639, 4256 },
+ { 1020978,  733, 180882, 4496 }, { 1033569,  770, 181945, 4536 }, { 1162846,  782, 180731, 5022 }, { 1198178,  798, 182028, 5161 },
+ { 1210455,  787, 181556, 5215 }, { 1349008,  746, 181077, 5741 }, { 1461979,  799, 180645, 6222 }, { 1524469,  794, 181601, 6506 },
+ { 1774790,  717, 182019, 7770 }, { 1941026,  733, 181469, 8475 }, {   54397,  748, 182626,  157 }, {  148633,  764, 182402,  490 },
+ {  309718,  790, 182717, 1074 }, {  344397,  749, 182163, 1215 }, {  667807,  756, 182115, 2924 }, {  813277,  775, 182575, 3686 },
+ {  832365,  737, 182195, 3769 }, {  838366,  741, 183225, 3815 }, { 1144319,  725, 183208, 4943 }, { 1315237,  751, 182344, 5609 },
+ { 1497182,  739, 183407, 6377 }, { 1756894,  736, 183461, 7689 }, {  221516,  715, 183715,  736 }, {  326986,  759, 184171, 1133 },
+ {  643772,  713, 184609, 2793 }, {  749630,  778, 184112, 3377 }, {  974766,  774, 183951, 4333 }, { 1050991,  759, 183562, 4593 },
+ { 1368069,  707, 184427, 5834 }, { 1396589,  762, 184439, 5957 }, { 1402941,  783, 184421, 5983 }, { 1415286,  763, 184120, 6046 },
+ { 1584568,  748, 184085, 6793 }, { 1587403,  758, 184180, 6807 }, { 1651109,  758, 184916, 7131 }, { 1670879,  728, 183647, 7262 },
+ { 1698331,  715, 183964, 7395 }, { 1740061,  776, 184951, 7606 }, { 1774535,  758, 184957, 7769 }, { 1790356,  788, 184163, 7835 },
+ { 1836777,  797, 183539, 8051 }, { 1872558,  794, 184473, 8209 }, { 2003569,  774, 184013, 8723 }, { 2082127,  790, 184120, 9024 },
+ {   30761,  718, 186368,   82 }, {  103651,  781, 186012,  348 }, {  121863,  758, 185998,  395 }, {  137301,  788, 185303,  446 },
+ {  158231,  794, 186345,  521 }, {  168802,  789, 185362,  556 }, {  169163,  767, 185324,  557 }, {  226677,  771, 185412,  748 },
+ {  322046,  757, 185802, 1113 }, {  679615,  718, 185711, 2999 }, {  890144,  785, 185542, 3993 }, {  930796,  785, 186282, 4168 },
+ { 1121654,  789, 185710, 4875 }, { 1296875,  748, 185353, 5541 }, { 1391975,  745, 186336, 5936 }, { 1435097,  754, 185531, 6123 },
+ { 1519967,  747, 185171, 6484 }, { 1638113,  773, 185823, 7057 }, { 1747510,  719, 185019, 7647 }, { 1782201,  790, 185651, 7807 },
+ { 1874849,  731, 185127, 8215 }, { 1992559,  790, 185564, 8678 }, { 2002552,  791, 185069, 8718 }, {  228580,  790, 187481,  756 },
+ {  252984,  733, 186905,  855 }, {  362065,  751, 186471, 1278 }, {  410457,  799, 186822, 1489 }, {  533878,  736, 187117, 2143 },
+ {  577515,  729, 187062, 2405 }, {  670278,  773, 186915, 2935 }, {  746989,  790, 186437, 3360 }, {  917660,  777, 187761, 4113 },
+ { 1130142,  760, 186872, 4914 }, { 1150598,  791, 187140, 4971 }, { 1203411,  794, 187147, 5180 }, { 1204401,  750, 187204, 5186 },
+ { 1512263,  794, 187595, 6444 }, { 1657379,  789, 186801, 7174 }, { 1729369,  777, 187007, 7543 }, { 1733889,  712, 187466, 7566 },
+ { 1787781,  762, 187055, 7826 }, { 1845071,  721, 187500, 8085 }, { 1863218,  783, 186759, 8157 }, { 1898255,  765, 186827, 8307 },
+ { 2040192,  777, 186679, 8885 }, {   59885,  733, 188538,  175 }, {  190608,  763, 187927,  628 }, {  288014,  796, 188282,  986 },
+ {  311056,  781, 189180, 1078 }, {  437351,  795, 188445, 1599 }, {  580588,  769, 188439, 2419 }, {  580824,  720, 189184, 2420 },
+ {  847606,  762, 188973, 3851 }, {  962418,  708, 188179, 4288 }, { 1003531,  731, 188361, 4422 }, { 1086220,  702, 187897, 4728 },
+ { 1114100,  795, 188276, 4845 }, { 1310160,  764, 188256, 5588 }, { 1343667,  750, 188717, 5726 }, { 1362057,  711, 187884, 5800 },
+ { 1427110,  746, 188902, 6091 }, { 1517125,  751, 189289, 6469 }, { 1608151,  712, 188609, 6903 }, { 1637439,  706, 188846, 7051 },
+ { 1637499,  714, 188763, 7053 }, { 1637499,  737, 188762, 7054 }, { 1969633,  788, 189005, 8588 }, { 1974631,  773, 188793, 8603 },
+ { 1986595,  795, 188548, 8654 }, { 2055340,  722, 188214, 8930 }, {  164988,  740, 190389,  543 }, {  417595,  797, 189782, 1514 },
+ {  637937,  778, 190613, 2753 }, {  646828,  719, 190305, 2805 }, {  781347,  789, 189620, 3546 }, {  842300,  725, 189675, 3829 },
+ {  960418,  705, 189953, 4277 }, { 1072062,  766, 190288, 4666 }, { 1158579,  779, 190572, 5004 }, { 1165546,  760, 189546, 5032 },
+ { 1287040,  773, 189995, 5493 }, { 1355765,  702, 190540, 5763 }, { 1357008,  702, 190636, 5774 }, { 1365809,  724, 189841, 5823 },
+ { 1499398,  708, 190458, 6388 }, { 1563109,  716, 189338, 6677 }, { 1733968,  769, 190200, 7567 }, { 1743595,  745, 189862, 7628 },
+ { 1772271,  724, 189858, 7759 }, { 1774011,  784, 190393, 7767 }, { 1888820,  701, 189929, 8266 }, { 1982794,  725, 189655, 8640 },
+ { 2001203,  781, 189875, 8712 }, { 2060197,  759, 189671, 8947 }, {   19680,  772, 190834,   41 }, {   91612,  798, 191285,  290 },
+ {  208023,  782, 191360,  687 }, {  261656,  789, 190831,  886 }, {  379002,  792, 191959, 1337 }, {  466393,  752, 190908, 1738 },
+ {  468665,  723, 191954, 1749 }, {  470168,  754, 190825, 1760 }, {  598220,  702, 191921, 2516 }, {  870442,  714, 190864, 3928 },
+ {  906108,  776, 191117, 4067 }, { 1203278,  787, 190912, 5179 }, { 1439814,  704, 192067, 6146 }, { 1533719,  774, 191137, 6550 },
+ { 1652774,  744, 191660, 7146 }, { 1723961,  784, 191908, 7514 }, { 1780766,  793, 190821, 7800 }, { 1808709,  767, 191827, 7926 },
+ { 1896731,  769, 190895, 8300 }, { 1897787,  749, 191008, 8306 }, { 1982976,  794, 191583, 8643 }, { 1986602,  708, 191976, 8656 },
+ { 1995736,  792, 192171, 8690 }, { 2004518,  759, 191662, 8725 }, {  102401,  765, 192357,  340 }, {  426416,  771, 193093, 1550 },
+ {  463507,  748, 193393, 1722 }, {  531652,  787, 193669, 2132 }, {  775024,  799, 192243, 3511 }, { 1391562,  775, 193063, 5938 },
+ { 1415276,  787, 192784, 6050 }, { 1467031,  787, 192587, 6242 }, { 1595651,  759, 192471, 6845 }, { 1710762,  735, 192840, 7444 },
+ { 1717686,  740, 193431, 7483 }, { 1943856,  771, 193628, 8489 }, { 2013565,  710, 193343, 8766 }, { 2038713,  779, 192353, 8876 },
+ { 2049272,  775, 193567, 8913 }, { 2092870,  797, 193198, 9057 }, {   99054,  703, 195067,  324 }, {  125698,  796, 194362,  409 },
+ {  146601,  761, 194129,  476 }, {  412010,  729, 194227, 1494 }, {  592356,  725, 194536, 2483 }, {  774704,  715, 194754, 3508 },
+ {  806534,  732, 194012, 3652 }, {  975236,  789, 193997, 4336 }, { 1005640,  794, 193948, 4431 }, { 1017036,  759, 194606, 4477 },
+ { 1051654,  721, 193762, 4594 }, { 1234888,  727, 194940, 5299 }, { 1278984,  770, 194630, 5464 }, { 1390283,  737, 193897, 5932 },
+ { 1583758,  700, 194368, 6791 }, { 1695113,  784, 194261, 7382 }, { 1805956,  795, 194363, 7919 }, { 1861882,  700, 195073, 8154 },
+ { 1893531,  711, 194094, 8284 }, { 2024994,  794, 194488, 8825 }, {   41111,  717, 195726,  104 }, {   53560,  713, 195863,  152 },
+ {  238969,  743, 195584,  800 }, {  288053,  747, 195188,  982 }, {  335071,  766, 196561, 1176 }, {  587032,  702, 195915, 2459 },
+ { 1279899,  739, 195741, 5468 }, { 1713594,  717, 196164, 7468 }, { 1820563,  704, 195238, 7984 }, { 1830025,  796, 196499, 8023 },
+ { 1832569,  755, 195839, 8035 }, { 1926678,  760, 196098, 8407 }, { 1989629,  776, 195947, 8666 }, { 2000550,  781, 196243, 8708 },
+ { 2064432,  780, 195777, 8962 }, {  329119,  766, 197601, 1141 }, {  642677,  777, 196940, 2776 }, {  758788,  737, 197822, 3422 },
+ {  775062,  799, 197063, 3509 }, {  781820,  774, 197528, 3545 }, {  828181,  741, 197484, 3743 }, {  961552,  747, 197374, 4280 },
+ { 1144508,  763, 196999, 4945 }, { 1444397,  765, 197479, 6162 }, { 1572772,  767, 197338, 6728 }, { 1719718,  706, 197373, 7495 },
+ { 1746668,  792, 197733, 7646 }, { 1770943,  791, 197452, 7756 }, { 1779798,  758, 197766, 7798 }, { 1825265,  745, 196873, 8003 },
+ { 1887495,  753, 197154, 8262 }, { 1931176,  714, 196629, 8424 }, { 1942519,  753, 197250, 8487 }, {   15032,  703, 198170,   27 },
+ {  250049,  788, 199290,  842 }, {  309386,  731, 198147, 1069 }, {  452511,  768, 199466, 1668 }, {  568051,  790, 199063, 2338 },
+ {  606628,  787, 198464, 2568 }, {  607203,  786, 199091, 2573 }, {  664865,  765, 198327, 2903 }, {  811947,  797, 199254, 3676 },
+ {  857196,  709, 198095, 3881 }, {  937235,  718, 198361, 4191 }, { 1174226,  788, 198105, 5067 }, { 1295154,  774, 198233, 5533 },
+ { 1366455,  775, 199226, 5830 }, { 1450802,  779, 198958, 6183 }, { 1515122,  759, 198415, 6464 }, { 1662342,  701, 199426, 7215 },
+ { 1797019,  778, 199075, 7870 }, { 1836729,  737, 198291, 8053 }, { 1871893,  760, 199105, 8208 }, { 1877898,  724, 198852, 8228 },
+ { 2020919,  733, 198628, 8804 }, {   24979,  789, 200901,   62 }, {   64720,  767, 200779,  189 }, {  131222,  727, 199531,  430 },
+ {  159124,  782, 200827,  526 }, {  202841,  730, 200074,  670 }, {  261899,  747, 199842,  885 }, {  343656,  737, 200790, 1207 },
+ {  525711,  773, 200834, 2101 }, {  634730,  758, 199870, 2721 }, {  691349,  745, 200343, 3066 }, { 1128590,  784, 199807, 4909 },
+ { 1735954,  762, 199561, 7589 }, { 1736151,  791, 200878, 7591 }, { 1817272,  757, 200732, 7969 }, { 1828935,  767, 200129, 8020 },
+ {  140470,  792, 202030,  454 }, {  281659,  790, 201235,  956 }, {  306733,  782, 201128, 1051 }, {  308956,  747, 201011, 1063 },
+ {  340270,  776, 201925, 1198 }, {  409821,  767, 201415, 1482 }, {  424025,  766, 202056, 1535 }, {  526791,  796, 202374, 2105 },
+ {  593698,  722, 202127, 2487 }, {  653700,  772, 201245, 2844 }, {  666863,  792, 202104, 2914 }, {  671681,  756, 201169, 2939 },
+ {  794299,  795, 201749, 3603 }, { 1077429,  729, 202410, 4690 }, { 1295703,  769, 202027, 5538 }, { 1318628,  757, 201197, 5627 },
+ { 1524421,  785, 201356, 6509 }, { 1538824,  737, 201830, 6574 }, { 1652651,  777, 202229, 7154 }, { 1874126,  731, 202193, 8216 },
+ { 2005511,  743, 201974, 8731 }, { 2038165,  744, 201888, 8874 }, {   57038,  743, 202950,  164 }, {  172666,  769, 202731,  568 },
+ {  294004,  793, 202537, 1001 }, {  295961,  729, 202744, 1011 }, {  304194,  758, 203669, 1037 }, {  412673,  787, 203852, 1493 },
+ {  503753,  747, 203637, 1971 }, {  523361,  789, 203780, 2081 }, {  638658,  705, 203111, 2751 }, {  655263,  736, 203413, 2849 },
+ {  867575,  727, 203628, 3917 }, {  985514,  788, 203127, 4367 }, { 1162524,  715, 203427, 5023 }, { 1235410,  725, 203101, 5300 },
+ { 1265034,  759, 203664, 5420 }, { 1273816,  774, 202970, 5452 }, { 1305453,  763, 203349, 5581 }, { 1426044,  791, 202489, 6090 },
+ { 1604241,  705, 202611, 6891 }, { 1709315,  796, 202816, 7442 }, { 1787004,  769, 202992, 7828 }, { 1793230,  744, 202754, 7851 },
+ { 1829811,  790, 202719, 8026 }, { 1863378,  776, 203177, 8161 }, { 1867058,  769, 203000, 8185 }, { 1882985,  775, 203857, 8246 },
+ { 2021067,  770, 202864, 8805 }, {  163340,  779, 205044,  536 }, {  205302,  759, 204110,  682 }, {  210319,  719, 203900,  694 },
+ {  285742,  703, 205256,  969 }, {  289276,  715, 204213,  987 }, {  289999,  703, 204028,  989 }, {  344586,  728, 204902, 1210 },
+ {  377519,  745, 203961, 1330 }, {  378931,  755, 205231, 1333 }, {  675851,  727, 204522, 2969 }, { 1366894,  784, 204506, 5835 },
+ { 1556948,  702, 205027, 6656 }, { 1660578,  738, 204667, 7210 }, { 1705861,  753, 204336, 7427 }, { 1721143,  796, 204655, 7503 },
+ { 1749607,  705, 204042, 7660 }, { 1809099,  739, 204385, 7929 }, { 1829801,  781, 204951, 8025 }, { 1832826,  761, 204563, 8040 },
+ { 1938649,  740, 205089, 8463 }, { 2066770,  730, 204577, 8967 }, {  161585,  790, 206705,  529 }, {  194576,  731, 205442,  645 },
+ {  446630,  700, 206217, 1637 }, {  631170,  747, 205971, 2703 }, {  648010,  780, 206638, 2804 }, { 1339974,  766, 206742, 5715 },
+ { 1545722,  799, 206538, 6607 }, { 1710242,  773, 205691, 7451 }, {   35331,  757, 206832,   91 }, {   46147,  760, 208025,  124 },
+ {   93265,  799, 207534,  298 }, {  263411,  728, 207315,  890 }, {  431254,  775, 208069, 1561 }, {  637245,  792, 206993, 2737 },
+ {  756276,  791, 207839, 3408 }, { 1193493,  746, 208144, 5142 }, { 1373118,  751, 207328, 5857 }, { 1401147,  793, 208136, 5981 },
+ { 1450809,  753, 208114, 6184 }, { 1450863,  708, 208149, 6185 }, { 1622300,  736, 207317, 6983 }, { 1640903,  788, 208242, 7084 },
+ { 1647988,  751, 208222, 7123 }, { 1672522,  781, 207422, 7275 }, { 1700196,  775, 207269, 7408 }, { 1733978,  703, 208242, 7576 },
+ { 1925074,  778, 208087, 8403 }, {   36564,  774, 208327,   96 }, {  237379,  784, 209025,  787 }, {  373873,  719, 209150, 1314 },
+ {  396172,  777, 209585, 1417 }, {  407651,  705, 208375, 1467 }, {  407734,  735, 208948, 1466 }, {  555991,  736, 208917, 2264 },
+ {  733724,  751, 208579, 3277 }, {  754931,  766, 208843, 3400 }, {  880520,  774, 209557, 3954 }, {  930750,  752, 209232, 4165 },
+ { 1074050,  781, 208537, 4672 }, { 1214382,  770, 209320, 5238 }, { 1362088,  797, 209601, 5811 }, { 1517168,  767, 208871, 6479 },
+ { 1549545,  775, 209426, 6618 }, { 1667411,  738, 208837, 7251 }, { 1756700,  785, 208500, 7697 }, { 1840532,  790, 208676, 8078 },
+ { 1849950,  773, 209079, 8106 }, { 1981090,  793, 209491, 8633 }, { 2034099,  754, 208570, 8853 }, {   48312,  793, 211019,  135 },
+ {   52630,  708, 209961,  144 }, {   99430,  717, 211055,  321 }, {  178115,  704, 210425,  590 }, {  311150,  798, 211135, 1073 },
+ {  490190,  773, 210340, 1866 }, {  792267,  775, 210129, 3592 }, {  951838,  710, 210567, 4246 }, { 1012286,  763, 210859, 4457 },
+ { 1130559,  782, 209860, 4917 }, { 1203817,  770, 210346, 5187 }, { 1279049,  785, 209749, 5467 }, { 1319864,  725, 210526, 5635 },
+ { 1363078,  774, 210634, 5818 }, { 1365382,  787, 210456, 5828 }, { 1493243,  780, 210400, 6370 }, { 1493245,  783, 210400, 6369 },
+ { 1588195,  795, 210133, 6817 }, { 1716587,  782, 211134, 7484 }, {   65954,  742, 211494,  196 }, {  163095,  752, 211386,  533 },
+ {  207322,  717, 212403,  685 }, {  237454,  777, 211326,  785 }, {  305839,  709, 211830, 1046 }, {  429700,  752, 211549, 1555 },
+ {  644974,  745, 211581, 2784 }, {  665239,  792, 212272, 2894 }, {  998989,  775, 212410, 4407 }, { 1029537,  727, 212087, 4521 },
+ { 1088750,  770, 212210, 4745 }, { 1185650,  760, 211679, 5109 }, { 1270692,  776, 211751, 5442 }, { 1378557,  792, 211863, 5878 },
+ { 1380091,  786, 211720, 5887 }, { 1386854,  781, 212376, 5922 }, { 1433668,  774, 211470, 6127 }, { 1634951,  704, 211957, 7049 },
+ { 1661298,  748, 212130, 7218 }, { 1774443,  776, 211750, 7781 }, { 1860113,  798, 212334, 8150 }, { 1910763,  771, 212332, 8357 },
+ { 1994872,  743, 212486, 8688 }, { 2092989,  755, 212199, 9059 }, {  381366,  788, 213366, 1342 }, {  419437,  730, 213731, 1511 },
+ {  504637,  794, 212796, 1969 }, {  562779,  764, 213043, 2291 }, {  579108,  785, 213877, 2402 }, {  719202,  785, 213286, 3200 },
+ {  809488,  727, 213708, 3660 }, {  818066,  747, 213646, 3698 }, {  873612,  748, 213810, 3939 }, {  948357,  767, 213476, 4235 },
+ { 1042712,  784, 213500, 4566 }, { 1085062,  781, 213760, 4726 }, { 1453453,  729, 212651, 6199 }, { 1677248,  712, 213879, 7295 },
+ { 1790519,  791, 212727, 7843 }, { 1812241,  778, 213339, 7944 }, { 1838142,  783, 213603, 8065 }, { 1914943,  780, 213518, 8371 },
+ { 1939594,  724, 213850, 8472 }, { 1971435,  771, 213538, 8594 }, { 1978651,  721, 213787, 8621 }, { 2009895,  700, 214005, 8752 },
+ {  142908,  756, 215508,  461 }, {  200975,  775, 215395,  661 }, {  201086,  798, 214837,  662 }, {  285154,  779, 214289,  964 },
+ {  340382,  780, 215504, 1192 }, {  374483,  771, 215338, 1313 }, {  471077,  728, 214877, 1751 }, {  592482,  735, 214331, 2477 },
+ {  728812,  789, 215167, 3254 }, {  854194,  720, 214271, 3870 }, {  869775,  793, 214693, 3922 }, {  925021,  716, 214205, 4141 },
+ {  937488,  780, 214374, 4187 }, { 1078936,  755, 215342, 4701 }, { 1655512,  766, 215271, 7175 }, { 1689763,  791, 215024, 7356 },
+ { 1737855,  714, 214847, 7608 }, { 1891748,  762, 214797, 8281 }, { 1946334,  788, 214405, 8506 }, { 2029116,  756, 214329, 8832 },
+ { 2078265,  751, 214742, 9010 }, {    9127,  796, 216177,    5 }, {   99841,  779, 215925,  326 }, {  136067,  770, 216018,  439 },
+ {  187397,  767, 216158,  618 }, {  445851,  708, 216957, 1622 }, {  538830,  736, 216903, 2152 }, {  563340,  721, 216148, 2293 },
+ {  569125,  788, 215778, 2331 }, {  713706,  793, 215902, 3175 }, { 1092201,  735, 216132, 4760 }, { 1863062,  766, 216449, 8164 },
+ { 1925414,  756, 215541, 8406 }, {   44174,  794, 218420,  113 }, {  324347,  776, 218409, 1112 }, {  356011,  706, 217224, 1242 },
+ {  516953,  720, 218291, 2027 }, {  547119,  735, 218452, 2201 }, {  556415,  794, 217539, 2257 }, {  601598,  733, 217650, 2520 },
+ {  634848,  720, 217925, 2715 }, {  701010,  777, 217066, 3106 }, {  725032,  764, 217829, 3235 }, {  948663,  758, 217463, 4236 },
+ { 1101570,  750, 217706, 4800 }, { 1177393,  740, 218374, 5085 }, { 1298254,  746, 217425, 5552 }, { 1423231,  740, 218097, 6086 },
+ { 1834168,  751, 217636, 8049 }, { 1852198,  764, 218434, 8119 }, { 1939154,  704, 217600, 8469 }, { 2023948,  770, 217482, 8822 },
+ {   53091,  779, 218928,  146 }, {   82699,  755, 218982,  266 }, {  150483,  778, 219256,  491 }, {  381264,  739, 219525, 1335 },
+ { 1119438,  785, 218919, 4867 }, { 1312834,  793, 218751, 5608 }, { 1351289,  790, 219430, 5755 }, { 1445329,  794, 219652, 6170 },
+ { 1522894,  765, 218524, 6511 }, { 1767231,  779, 219386, 7742 }, { 1880138,  753, 219122, 8243 }, { 1904071,  752, 219462, 8339 },
+ { 1939912,  735, 219559, 8479 }, { 2042599,  756, 218648, 8894 }, {    2352,  755, 220235, 9085 }, {    7432,  780, 220367, 9110 },
+ {   24688,  774, 220686,   60 }, {   36105,  740, 221120,   93 }, {   92649,  792, 220019,  292 }, {   93683,  784, 220755,  297 },
+ {  256243,  759, 220669,  860 }, {  345358,  700, 220068, 1205 }, {  374128,  770, 221148, 1305 }, {  579178,  794, 220610, 2394 },
+ {  776786,  773, 221311, 3505 }, {  807321,  713, 220526, 3648 }, { 1003541,  783, 221043, 4421 }, { 1008303,  748, 220030, 4439 },
+ { 1208423,  796, 220622, 5213 }, { 1432738,  767, 220924, 6130 }, { 1536443,  723, 221184, 6573 }, { 1637385,  799, 219980, 7075 },
+ { 1755705,  739, 221360, 7701 }, { 1997217,  760, 220925, 8696 }, {    6156,  788, 221785, 9100 }, {  466583,  761, 222318, 1720 },
+ {  727141,  771, 222105, 3245 }, { 1117484,  789, 222503, 4859 }, { 1343665,  798, 221435, 5731 }, { 1378683,  719, 222239, 5886 },
+ { 1503750,  756, 222639, 6421 }, { 1627562,  774, 222133, 7018 }, { 1764494,  775, 221481, 7727 }, { 1776188,  772, 221741, 7792 },
+ { 1900382,  795, 222037, 8327 }, { 1920773,  793, 222383, 8388 }, { 1929683,  727, 222510, 8426 }, { 1929887,  711, 221774, 8428 },
+ { 1948912,  775, 222538, 8511 }, { 2080894,  743, 221678, 9018 }, {  156918,  763, 224064,  511 }, {  323537,  710, 223138, 1105 },
+ {  334396,  785, 223255, 1158 }, {  345776,  703, 222928, 1204 }, {  425382,  744, 223558, 1527 }, {  480845,  742, 222920, 1802 },
+ { 1343692,  779, 223320, 5737 }, { 1745411,  796, 223600, 7654 }, { 1778487,  769, 224250, 7805 }, { 1928042,  729, 222997, 8416 },
+ { 1940407,  779, 223247, 8483 }, { 1978678,  719, 223673, 8627 }, {    9381,  759, 224564,    7 }, {   73876,  739, 224639,  233 },
+ {  104023,  755, 224574,  342 }, {  174228,  726, 225184,  567 }, {  179139,  758, 224847,  589 }, {  272800,  789, 224363,  922 },
+ {  298080,  723, 225132, 1009 }, {  402541,  794, 224660, 1440 }, {  781517,  758, 225158, 3531 }, { 1196394,  785, 225477, 5162 },
+ { 1355763,  779, 224583, 5785 }, { 1593103,  703, 224857, 6850 }, { 1749775,  727, 225475, 7676 }, { 1863218,  718, 225549, 8171 },
+ {  104406,  757, 225763,  345 }, {  229524,  778, 226821,  747 }, {  379631,  727, 225940, 1327 }, {  498714,  760, 226751, 1916 },
+ {  543004,  732, 226781, 2165 }, {  679635,  792, 226399, 2975 }, {  749445,  747, 225946, 3354 }, {  756133,  764, 225765, 3391 },
+ {  900076,  782, 225893, 4026 }, {  934898,  712, 226778, 4178 }, { 1129368,  724, 226374, 4916 }, { 1655041,  763, 226111, 7187 },
+ { 1915863,  786, 226202, 8375 }, { 1961840,  746, 225928, 8561 }, {    3789,  786, 227336, 9094 }, {   61250,  783, 227406,  177 },
+ {   85224,  797, 227704,  273 }, {  798655,  714, 228463, 3609 }, { 1023051,  730, 228276, 4504 }, { 1117859,  743, 228342, 4863 },
+ { 1135838,  732, 228061, 4928 }, { 1773144,  793, 228435, 7783 }, { 1810517,  758, 228149, 7945 }, { 1875449,  744, 228370, 8227 },
+ { 2077654,  795, 228331, 9005 }, {    6845,  767, 228891, 9104 }, {  240049,  795, 229849,  791 }, {  329158,  780, 228942, 1124 },
+ {  598492,  714, 229481, 2490 }, {  742406,  788, 229081, 3303 }, {  843907,  794, 229044, 3824 }, { 1332039,  713, 229153, 5691 },
+ { 1407318,  744, 229828, 6025 }, { 2014938,  724, 228952, 8779 }, { 2079549,  704, 229823, 9013 }, {  102899,  729, 231238,  336 },
+ {  149046,  759, 230167,  478 }, {  250462,  780, 231398,  829 }, {  358339,  787, 231095, 1241 }, {  602499,  712, 231398, 2511 },
+ {  656639,  764, 230782, 2830 }, {  717711,  732, 230795, 3182 }, {  904480,  796, 231193, 4047 }, {  934696,  775, 230750, 4176 },
+ { 1438855,  700, 231223, 6161 }, { 1532035,  705, 230301, 6566 }, { 1595122,  795, 231205, 6865 }, { 1776899,  755, 231386, 7804 },
+ {  847958,  769, 231906, 3838 }, {  936536,  700, 231671, 4181 }, {  951745,  793, 232804, 4243 }, { 1013692,  720, 232031, 4461 },
+ { 1240912,  724, 232190, 5334 }, { 1365554,  762, 231973, 5844 }, { 1429867,  725, 231720, 6126 }, { 1724774,  792, 232051, 7545 },
+ {  132863,  781, 233402,  427 }, {  149905,  718, 233923,  480 }, {  333840,  744, 234286, 1138 }, {  565420,  797, 233797, 2285 },
+ {  613648,  768, 234194, 2581 }, { 1070628,  771, 233308, 4659 }, { 1937897,  750, 233210, 8474 }, { 1960274,  747, 234139, 8557 },
+ { 2032534,  756, 234310, 8851 }, { 2049495,  760, 233541, 8918 }, {  583324,  792, 235564, 2396 }, { 1190109,  750, 234826, 5139 },
+ { 1335621,  702, 235673, 5714 }, { 1844312,  787, 235102, 8099 }, { 2060719,  784, 235409, 8952 }, {   70126,  787, 236913,  212 },
+ {  230153,  716, 237121,  743 }, {  398330,  794, 236699, 1401 }, {  729156,  798, 236523, 3236 }, {  809554,  796, 237307, 3645 },
+ {  837249,  772, 236229, 3768 }, {  848987,  717, 236297, 3839 }, {  871454,  783, 237210, 3918 }, { 1174019,  779, 236500, 5073 },
+ { 1539582,  786, 236593, 6606 }, { 1546601,  779, 236158, 6637 }, { 1565854,  745, 235937, 6725 }, { 1897729,  717, 236396, 8324 },
+ {  143473,  728, 237444,  456 }, {  454926,  743, 238765, 1643 }, {  463444,  774, 237776, 1683 }, {  699335,  741, 238723, 3075 },
+ { 1419304,  798, 237961, 6088 }, { 1921297,  703, 237648, 8400 }, { 1974481,  708, 238323, 8615 }, {   66483,  766, 240281,  192 },
+ {   69568,  741, 240077,  208 }, {  443698,  796, 238940, 1589 }, { 1639534,  727, 238967, 7117 }, { 1793512,  720, 240233, 7879 },
+ { 2031065,  784, 239179, 8844 }, { 2067081,  798, 238846, 8972 }, {  727503,  754, 241401, 3216 }, { 1076002,  738, 240533, 4687 },
+ { 1413867,  748, 241577, 6079 }, { 1640395,  735, 240931, 7124 }, { 1976590,  779, 240840, 8625 }, { 2066821,  795, 240725, 8971 },
+ {  182802,  722, 241923,  592 }, { 1056224,  780, 243074, 4609 }, { 1403230,  756, 242911, 6034 }, { 1557499,  704, 243157, 6701 },
+ { 1673590,  713, 242571, 7312 }, { 1969386,  768, 242085, 8599 }, {  182224,  738, 243621,  581 }, {  291749,  745, 244281,  961 },
+ {  583241,  773, 244662, 2363 }, { 1066341,  714, 244109, 4646 }, { 1460870,  798, 243960, 6267 }, { 1616188,  764, 244008, 7006 },
+ { 1857878,  795, 243229, 8168 }, { 1175199,  777, 245605, 5091 }, { 1198078,  791, 244762, 5184 }, { 1435556,  756, 246072, 6173 },
+ { 1843001,  791, 244852, 8112 }, { 1961286,  783, 245812, 8578 }, { 1965908,  750, 245868, 8591 }, {  105263,  764, 247106,  333 },
+ {  271071,  749, 246734,  881 }, {  469760,  705, 246461, 1686 }, {  591623,  745, 246946, 2401 }, {  706020,  742, 246823, 3082 },
+ {  364157,  710, 248598, 1230 }, {  388915,  743, 248781, 1317 }, { 1514052,  772, 247779, 6529 }, { 1573087,  768, 247587, 6810 },
+ { 1816886,  739, 248385, 8016 }, { 1871167,  797, 248345, 8239 }, {  244367,  778, 249690,  774 }, {  279203,  795, 249722,  906 },
+ {  437409,  707, 249319, 1523 }, { 1788759,  746, 249653, 7901 }, { 1790529,  796, 249170, 7908 }, {  919072,  726, 251307, 4084 },
+ { 1197685,  798, 251589, 5203 }, { 1296652,  764, 251239, 5596 }, { 1809648,  775, 251267, 8002 }, {   79932,  762, 252979,  240 },
+ {  390619,  757, 253126, 1289 }, {  393218,  746, 252446, 1304 }, { 1120098,  785, 252558, 4892 }, { 1120268,  728, 252551, 4893 },
+ {  309236,  761, 254733,  965 }, {  917055,  750, 253773, 4062 }, { 1996717,  790, 255406, 8736 }, {  364126,  786, 257230, 1107 },
+ { 1530338,  779, 257728, 6811 }, { 1941579,  727, 256476, 8546 }, {  670664,  707, 257804, 2609 }, { 2049111,  758, 258223, 8938 },
+ { 1351962,  848,   3107, 5491 }, { 1988620,  857,   4104, 8294 }, {  592705,  847,   4405, 2848 }, { 1508767,  857,   5194, 6133 },
+ { 1085895,  833,   6045, 4709 }, { 1486903,  804,   6356, 6139 }, {  324090,  841,   7664, 1271 }, { 1051977,  805,   8202, 4595 },
+ { 1575148,  845,   7594, 6552 }, {  480935,  820,   9881, 2059 }, {  960073,  819,   9603, 4312 }, { 1881713,  845,   9918, 8129 },
+ { 1020934,  833,  10340, 4507 }, { 1464938,  857,  10542, 6138 }, { 1648543,  916,  10655, 6964 }, { 1783900,  817,  10647, 7698 },
+ {  382801,  876,  12960, 1485 }, { 1258857,  842,  12887, 5327 }, { 1884388,  838,  12646, 8176 }, {  455007,  851,  13896, 1815 },
+ {  879823,  860,  13931, 3997 }, {  920198,  907,  14449, 4161 }, {  960052,  871,  13917, 4304 }, { 1580794,  835,  13816, 6646 },
+ { 1634373,  827,  14284, 6912 }, { 1741838,  839,  13616, 7494 }, {  156959,  806,  14821,  550 }, { 1883567,  847,  14621, 8201 },
+ { 2027538,  841,  15893, 8810 }, {  147609,  833,  16236,  516 }, {  761975,  805,  16121, 3524 }, {  950211,  833,  16835, 4268 },
+ {  988242,  835,  16994, 4385 }, { 1023706,  839,  16466, 4509 }, { 1891714,  818,  16664, 8234 }, { 2021997,  812,  16720, 8786 },
+ { 2037638,  833,  16708, 8849 }, {   24491,  877,  18613,   64 }, {  136392,  811,  18211,  467 }, {  168707,  816,  17984,  593 },
+ {  315301,  829,  17947, 1154 }, {  437227,  829,  17914, 1682 }, {  488760,  805,  18672, 1991 }, { 1068861,  835,  18312, 4649 },
+ { 1224135,  809,  18336, 5240 }, { 1974002,  815,  18600, 8577 }, {  405393,  805,  19888, 1531 }, {  664200,  818,  19856, 3000 },
+ {  993164,  843,  19819, 4397 }, { 1184377,  848,  19760, 5082 }, { 1247973,  847,  19900, 5306 }, { 1367962,  818,  20270, 5757 },
+ { 1642512,  839,  20196, 6994 }, { 1925110,  841,  19897, 8370 }, { 1994743,  873,  19006, 8664 }, {  804207,  814,  21355, 3695 },
+ {  925388,  830,  20839, 4170 }, { 1266466,  807,  21451, 5389 }, { 1569510,  807,  20647, 6635 }, { 1808864,  800,  20652, 7863 },
+ { 1847822,  858,  20698, 8052 }, { 1939751,  815,  20558, 8432 }, { 2065697,  800,  21656, 8957 }, {   23185,  849,  23173,   58 },
+ {  957207,  813,  21991, 4279 }, {  989747,  827,  22053, 4387 }, { 1105726,  849,  22383, 4804 }, { 1193044,  834,  22841, 5115 },
+ { 1310623,  820,  21893, 5555 }, { 1808398,  855,  22356, 7864 }, { 1861613,  863,  22350, 8111 }, { 1937985,  855,  23128, 8420 },
+ { 1960036,  804,  21868, 8526 }, {  663168,  916,  23703, 2979 }, {  663171,  926,  23703, 2980 }, {  931014,  807,  24021, 4186 },
+ { 1054020,  844,  23613, 4601 }, { 1175723,  863,  24309, 5051 }, { 1235647,  802,  24540, 5279 }, { 1509648,  825,  24078, 6373 },
+ {   15500,  864,  25085,   32 }, {   56332,  885,  24958,  169 }, {  445870,  827,  24813, 1700 }, {  587804,  837,  24930, 2531 },
+ {  697985,  834,  25114, 3171 }, {  746678,  812,  25278, 3417 }, {  909841,  819,  26173, 4105 }, { 2022288,  815,  25612, 8794 },
+ {    6570,  931,  27522, 9106 }, {  426846,  828,  26808, 1606 }, {  506523,  853,  27237, 2062 }, {  771633,  811,  27017, 3544 },
+ {  938536,  827,  26861, 4213 }, { 1002414,  809,  26905, 4425 }, { 1072448,  822,  27110, 4664 }, { 1164087,  804,  26266, 5012 },
+ { 1169274,  805,  26428, 5030 }, { 1329016,  801,  27336, 5628 }, { 1550041,  849,  26536, 6565 }, { 1645281,  806,  27663, 7027 },
+ { 1851531,  820,  27007, 8081 }, {   48625,  813,  28058,  139 }, {  546277,  864,  28694, 2283 }, {  583945,  851,  28800, 2505 },
+ {  868223,  835,  28238, 3944 }, {  977930,  835,  28306, 4349 }, {  990417,  841,  29119, 4389 }, { 1052183,  842,  28383, 4596 },
+ { 1140453,  803,  28364, 4930 }, { 1321126,  852,  28989, 5598 }, { 1871856,  809,  28835, 8159 }, { 1901243,  801,  27684, 8286 },
+ {  589730,  811,  29759, 2536 }, {  938364,  826,  30380, 4211 }, {  938672,  846,  30372, 4212 }, { 1067188,  817,  29348, 4645 },
+ { 1192408,  810,  29775, 5119 }, { 1194226,  859,  30275, 5125 }, { 1238653,  805,  29572, 5293 }, { 1369253,  844,  29459, 5792 },
+ { 1503439,  822,  30177, 6357 }, { 1514920,  853,  29194, 6400 }, { 1593838,  873,  30221, 6774 }, { 1994173,  834,  29634, 8672 },
+ { 2001989,  805,  29234, 8701 }, { 2074467,  807,  29841, 8994 }, {   76321,  822,  31318,  252 }, {  273533,  815,  30970,  959 },
+ {  297157,  815,  31493, 1053 }, {  676065,  818,  31780, 3038 }, {  869437,  820,  30732, 3949 }, { 1109867,  833,  31177, 4820 },
+ { 1158427,  837,  31573, 4994 }, { 1177861,  820,  31498, 5066 }, { 1239405,  806,  31632, 5295 }, { 1684239,  827,  30861, 7274 },
+ { 1799854,  811,  31473, 7838 }, { 1870366,  841,  31653, 8156 }, {  476228,  803,  32947, 1859 }, {  620750,  847,  33259, 2712 },
+ {  762992,  832,  32348, 3491 }, { 1057795,  823,  32988, 4614 }, { 1114153,  816,  33250, 4841 }, { 1599101,  833,  32374, 6808 },
+ { 1695329,  834,  32580, 7320 }, { 1746000,  839,  33150, 7588 }, { 1837146,  837,  32345, 8019 }, { 2078785,  889,  32614, 9007 },
+ {  812445,  811,  33570, 3713 }, {  986414,  806,  34696, 4379 }, { 1082407,  836,  34416, 4710 }, { 1105192,  825,  33777, 4806 },
+ { 1278348,  804,  34854, 5443 }, { 1340835,  828,  34197, 5684 }, { 1461261,  803,  34126, 6182 }, { 1474254,  832,  34489, 6231 },
+ { 1755705,  807,  33963, 7644 }, { 2036470,  813,  34182, 8855 }, {  112227,  824,  35532,  380 }, {  174304,  810,  35049,  600 },
+ {  211810,  841,  35673,  722 }, {  238031,  826,  35993,  823 }, {  288334,  805,  36302, 1014 }, {  427453,  841,  35936, 1598 },
+ {  490663,  831,  35769, 1960 }, {  676814,  838,  35057, 3036 }, {  832378,  827,  36000, 3813 }, {  917715,  819,  36387, 4129 },
+ { 1106724,  826,  35698, 4814 }, { 1260706,  836,  35205, 5382 }, { 1660330,  801,  35904, 7130 }, { 1718308,  839,  35951, 7435 },
+ { 1732901,  845,  36136, 7513 }, { 1759775,  845,  35469, 7663 }, { 2024618,  847,  36201, 8809 }, { 2049267,  845,  35799, 8908 },
+ {   53336,  842,  36591,  160 }, {   91336,  821,  37073,  304 }, {  171694,  837,  37027,  584 }, {  312260,  875,  37522, 1104 },
+ {  568051,  829,  37237, 2408 }, {  763858,  805,  37611, 3495 }, {  855043,  826,  36514, 3891 }, {  913749,  801,  37435, 4115 },
+ { 1057149,  833,  37206, 4611 }, { 1057875,  806,  37442, 4615 }, { 1073480,  806,  37418, 4669 }, { 1078383,  821,  37636, 4692 },
+ { 1085405,  830,  37531, 4720 }, { 1160347,  807,  36610, 5000 }, { 1184884,  837,  37330, 5093 }, { 1221183,  820,  37575, 5242 },
+ { 1303011,  809,  37853, 5539 }, { 1322293,  817,  36810, 5611 }, { 1363571,  851,  37302, 5766 }, { 1380470,  818,  37053, 5851 },
+ { 1380472,  839,  37053, 5852 }, { 1387827,  854,  36631, 5876 }, { 1473684,  813,  36956, 6233 }, { 1563116,  849,  37121, 6634 },
+ { 1720866,  809,  37653, 7455 }, { 1734551,  805,  37290, 7524 }, {  215647,  837,  38302,  734 }, {  232330,  855,  38276,  798 },
+ {  253913,  856,  38500,  880 }, {  360244,  838,  38189, 1294 }, {  511739,  836,  37914, 2073 }, {  515839,  863,  38568, 2104 },
+ {  653693,  839,  38608, 2888 }, {  729821,  812,  38020, 3298 }, {  795355,  837,  38593, 3632 }, {  825370,  805,  39219, 3761 },
+ {  838985,  856,  39250, 3841 }, {  869813,  858,  38578, 3948 }, {  970520,  841,  39088, 4326 }, { 1069373,  822,  38460, 4653 },
+ { 1089813,  804,  38362, 4744 }, { 1178376,  811,  38849, 5069 }, { 1584231,  841,  38666, 6740 }, { 1634577,  837,  38802, 6996 },
+ { 1861230,  831,  38858, 8125 }, { 1890420,  820,  39066, 8249 }, { 2061051,  940,  38869, 8945 }, {  343797,  814,  39997, 1236 },
+ {  415010,  846,  39656, 1540 }, {  480983,  819,  40673, 1882 }, {  557816,  827,  40316, 2337 }, {  559879,  846,  39946, 2354 },
+ {  560590,  827,  40527, 2360 }, {  629194,  802,  39598, 2754 }, {  694985,  814,  39754, 3139 }, {  711296,  828,  40488, 3217 },
+ { 1088495,  800,  40471, 4736 }, { 1153266,  833,  39763, 4972 }, { 1235337,  840,  39625, 5289 }, { 1324446,  828,  40258, 5623 },
+ { 1399818,  841,  40453, 5939 }, { 1435044,  815,  39503, 6089 }, { 1478800,  802,  39714, 6253 }, { 1526448,  824,  39375, 6471 },
+ { 1593646,  847,  40326, 6796 }, { 1601511,  818,  40613, 6828 }, { 1610038,  814,  39353, 6871 }, { 1768669,  809,  39927, 7707 },
+ { 1775370,  827,  39658, 7732 }, { 1998360,  812,  39596, 8689 }, {   64864,  807,  41503,  199 }, {  223638,  877,  41633,  762 },
+ {  250959,  803,  42103,  866 }, {  479563,  859,  41236, 1867 }, {  705917,  830,  41996, 3186 }, {  833390,  810,  41927, 3816 },
+ {  877925,  842,  41006, 3967 }, { 1025102,  810,  42057, 4513 }, { 1204666,  851,  41637, 5171 }, { 1388460,  819,  41662, 5884 },
+ { 1402286,  825,  41567, 5951 }, { 1655748,  848,  41945, 7111 }, { 1805672,  822,  42100, 7872 }, { 1822831,  828,  41403, 7959 },
+ { 1822843,  859,  41403, 7960 }, { 2030320,  812,  41797, 8829 }, { 2082217,  859,  42000, 9023 }, {  310000,  841,  42259, 1096 },
+ {  487821,  832,  42490, 1936 }, {  569692,  815,  43515, 2410 }, {  579644,  818,  43011, 2468 }, {  879015,  814,  43522, 3971 },
+ {  893260,  841,  43194, 4022 }, {  918455,  843,  42753, 4128 }, {  960078,  816,  42701, 4290 }, { 1006706,  838,  42640, 4438 },
+ { 1064715,  808,  42638, 4634 }, { 1089973,  822,  43393, 4747 }, { 1100252,  822,  43460, 4790 }, { 1223759,  849,  42935, 5252 },
+ { 1326366,  830,  42850, 5632 }, { 1329677,  832,  43318, 5645 }, { 1500199,  839,  43218, 6356 }, { 1638679,  804,  42373, 7015 },
+ { 1733590,  821,  42324, 7527 }, { 1739869,  824,  42483, 7558 }, { 1992814,  837,  43231, 8669 }, {   85012,  823,  44705,  281 },
+ {  168607,  806,  44945,  571 }, {  373339,  837,  45072, 1357 }, {  527424,  845,  43832, 2151 }, {  597133,  811,  44054, 2562 },
+ {  684361,  872,  43765, 3076 }, {  698570,  833,  43993, 3152 }, {  756169,  836,  44153, 3443 }, {  820593,  830,  44131, 3740 },
+ {  878180,  819,  43951, 3966 }, {  923643,  823,  45129, 4151 }, {  941214,  825,  44569, 4217 }, { 1060824,  822,  44924, 4622 },
+ { 1121685,  875,  44274, 4868 }, { 1168864,  818,  45107, 5034 }, { 1274729,  840,  43714, 5432 }, { 1374681,  848,  44109, 5836 },
+ { 1390640,  815,  44773, 5898 }, { 1454722,  818,  45133, 6167 }, { 1457581,  818,  44340, 6177 }, { 1986870,  830,  44418, 8646 },
+ { 2043192,  809,  43772, 8889 }, {  548039,  843,  45458, 2274 }, {  601121,  841,  45644, 2592 }, {  694456,  825,  45331, 3126 },
+ {  725163,  842,  45390, 3274 }, {  892777,  810,  46484, 4018 }, {  897190,  822,  46463, 4043 }, {  933951,  842,  46133, 4188 },
+ {  939437,  821,  46143, 4210 }, {  943850,  800,  46486, 4228 }, {  958001,  811,  46213, 4276 }, { 1154793,  816,  46336, 4980 },
+ { 1165931,  818,  46273, 5024 }, { 1232686,  842,  46189, 5281 }, { 1236356,  834,  45550, 5292 }, { 1247470,  839,  46478, 5326 },
+ { 1265173,  845,  45435, 5403 }, { 1537302,  828,  46379, 6525 }, { 1587369,  838,  45205, 6760 }, { 1920207,  812,  45165, 8369 },
+ { 1997753,  846,  46431, 8686 }, {  138723,  801,  46806,  460 }, {  140898,  818,  46998,  468 }, {  408224,  853,  47978, 1504 },
+ {  429455,  812,  47400, 1597 }, {  487937,  875,  47872, 1930 }, {  558922,  848,  47395, 2336 }, {  613249,  802,  47972, 2661 },
+ {  673084,  843,  47522, 3006 }, {  674130,  821,  46938, 3012 }, {  764715,  821,  47659, 3489 }, {  779005,  838,  46953, 3568 },
+ {  808702,  802,  47169, 3691 }, {  853313,  822,  47760, 3887 }, {  890688,  840,  47809, 4007 }, {  921572,  800,  47575, 4144 },
+ {  922487,  814,  46881, 4147 }, {  970644,  802,  47587, 4323 }, {  977086,  888,  47266, 4342 }, { 1111884,  840,  47919, 4835 },
+ { 1127753,  858,  47230, 4895 }, { 1191483,  842,  47208, 5122 }, { 1284401,  822,  47501, 5465 }, { 1288765,  811,  47299, 5486 },
+ { 1488090,  811,  47999, 6304 }, { 1621640,  844,  47636, 6939 }, {   90338,  811,  48063,  295 }, {  102124,  841,  49071,  350 },
+ {  347654,  805,  48209, 1245 }, {  384774,  829,  48164, 1405 }, {  758363,  834,  48854, 3455 }, {  793422,  844,  49301, 3622 },
+ {  809127,  832,  48902, 3693 }, {  852951,  846,  48330, 3883 }, {  876678,  820,  48569, 3957 }, {  908545,  835,  49449, 4091 },
+ {  943202,  836,  48741, 4226 }, { 1040117,  806,  48657, 4556 }, { 1050736,  816,  48793, 4592 }, { 1094128,  842,  48178, 4764 },
+ { 1192491,  801,  48967, 5124 }, { 1425576,  849,  49370, 6062 }, { 1441428,  806,  49160, 6120 }, { 1550917,  801,  48854, 6586 },
+ { 1716215,  818,  49492, 7434 }, { 1743202,  853,  49408, 7586 }, { 1763821,  837,  48823, 7691 }, { 1916903,  819,  49370, 8362 },
+ { 1952395,  834,  48802, 8509 }, { 1974646,  823,  49347, 8593 }, {  469483,  811,  49712, 1801 }, {  609635,  845,  50091, 2638 },
+ {  678069,  812,  50568, 3031 }, {  682040,  833,  50202, 3056 }, {  776330,  803,  50462, 3549 }, {  857308,  806,  50116, 3895 },
+ {  874648,  852,  50895, 3953 }, { 1090165,  815,  50110, 4749 }, { 1111420,  800,  49773, 4834 }, { 1198486,  800,  50635, 5151 },
+ { 1270741,  893,  50809, 5421 }, { 1282389,  830,  50158, 5461 }, { 1294868,  823,  50489, 5515 }, { 1408878,  816,  49795, 5979 },
+ { 1506192,  809,  50810, 6384 }, { 1638975,  822,  50800, 7022 }, {  609718,  827,  52035, 2634 }, {  664140,  839,  52265, 2941 },
+ {  701271,  828,  51635, 3161 }, {  739038,  853,  50989, 3349 }, {  742166,  836,  51251, 3368 }, {  760725,  829,  52100, 3471 },
+ {  795996,  811,  52142, 3629 }, {  814894,  828,  51244, 3717 }, {  847303,  800,  51284, 3868 }, {  863619,  848,  51516, 3920 },
+ { 1110947,  808,  52352, 4832 }, { 1166257,  802,  52138, 5027 }, { 1289139,  810,  51849, 5488 }, { 1556313,  811,  51557, 6614 },
+ { 1673161,  849,  52021, 7233 }, { 1703757,  813,  51615, 7388 }, { 1704774,  830,  51133, 7393 }, { 1758673,  826,  50996, 7674 },
+ { 1777538,  827,  51046, 7758 }, { 1894078,  833,  52047, 8271 }, { 1922974,  801,  52258, 8381 }, {   13165,  833,  52432,   23 },
+ {   51783,  806,  53626,  148 }, {   54324,  841,  53003,  162 }, {  327044,  830,  52828, 1168 }, {  444203,  827,  53022, 1667 },
+ {  486044,  843,  53743, 1912 }, {  505671,  818,  52954, 2023 }, {  592288,  846,  53441, 2524 }, {  601157,  857,  52560, 2587 },
+ {  701063,  810,  53179, 3157 }, {  744916,  834,  53003, 3382 }, {  812217,  833,  53150, 3700 }, {  896062,  816,  53848, 4038 },
+ { 1217994,  814,  52621, 5234 }, { 1218314,  800,  53455, 5236 }, { 1231749,  817,  53404, 5278 }, { 1243239,  811,  53340, 5311 },
+ { 1397956,  810,  52460, 5937 }, { 1399713,  813,  53270, 5946 }, { 1718944,  826,  53037, 7459 }, { 1736922,  850,  53851, 7549 },
+ { 1873247,  812,  53391, 8188 }, {   65536,  815,  54926,  202 }, {  143893,  884,  54524,  479 }, {  423710,  842,  54555, 1564 },
+ {  520268,  845,  54506, 2114 }, {  668477,  806,  54283, 2971 }, {  755482,  847,  54017, 3435 }, {  790927,  840,  54686, 3611 },
+ {  876252,  820,  54416, 3955 }, { 1124904,  824,  55093, 4882 }, { 1245698,  839,  54627, 5319 }, { 1258010,  800,  54142, 5380 },
+ { 1423367,  833,  54011, 6059 }, { 1536940,  810,  54399, 6530 }, { 1560024,  809,  54075, 6632 }, { 1686688,  838,  54448, 7297 },
+ { 1877250,  839,  54913, 8211 }, { 2044585,  815,  55062, 8895 }, {  239102,  815,  56173,  821 }, {  341613,  846,  56347, 1227 },
+ {  376711,  809,  56594, 1365 }, {  457133,  805,  55387, 1727 }, {  459696,  849,  55606, 1742 }, {  472981,  827,  55802, 1818 },
+ {  510419,  835,  56460, 2044 }, {  550301,  841,  56409, 2278 }, {  560410,  851,  56516, 2341 }, {  572982,  819,  55821, 2416 },
+ {  590458,  857,  55634, 2513 }, {  641316,  805,  55795, 2813 }, {  641323,  860,  55793, 2814 }, {  691781,  838,  56191, 3100 },
+ {  737528,  805,  56518, 3341 }, {  768960,  830,  56580, 3503 }, {  775771,  839,  55530, 3542 }, {  839985,  819,  56717, 3837 },
+ {  869709,  812,  56272, 3941 }, {  882724,  852,  55615, 3978 }, {  891848,  816,  55579, 4010 }, { 1143986,  843,  55509, 4939 },
+ { 1151938,  806,  56167, 4965 }, { 1292086,  807,  55641, 5498 }, { 1381846,  807,  55980, 5865 }, { 1623137,  822,  56640, 6954 },
+ { 1731488,  825,  56635, 7521 }, { 1883498,  841,  56416, 8233 }, { 1893255,  821,  55865, 8269 }, { 1979391,  865,  56350, 8611 },
+ {  170396,  810,  57914,  573 }, {  224148,  824,  56934,  755 }, {  349906,  851,  57620, 1250 }, {  406427,  844,  57778, 1498 },
+ {  662144,  828,  57489, 2925 }, {  696658,  844,  57451, 3133 }, {  796984,  873,  57106, 3631 }, {  821372,  808,  57871, 3739 },
+ {  849723,  815,  57130, 3872 }, {  868520,  837,  57287, 3935 }, {  898091,  830,  57096, 4045 }, {  961403,  815,  57989, 4296 },
+ {  970074,  830,  57107, 4318 }, { 1047384,  805,  57813, 4582 }, { 1065358,  823,  57321, 4637 }, { 1163012,  819,  57215, 5016 },
+ { 1200423,  847,  56817, 5158 }, { 1237295,  800,  57533, 5296 }, { 1306385,  864,  57449, 5560 }, { 1352158,  810,  57668, 5738 },
+ { 1488058,  845,  56988, 6312 }, { 1524714,  819,  58180, 6475 }, { 1597644,  806,  56897, 6821 }, { 1650345,  831,  58154, 7093 },
+ {   41824,  826,  59030,  111 }, {  148090,  864,  58311,  501 }, {  189948,  812,  59455,  637 }, {  253564,  821,  59523,  871 },
+ {  515810,  852,  58781, 2083 }, {  551638,  904,  58777, 2281 }, {  602987,  826,  59145, 2594 }, {  619351,  846,  58779, 2687 },
+ {  721462,  844,  58909, 3256 }, {  970598,  832,  59648, 4321 }, { 1060343,  837,  59366, 4619 }, { 1198450,  841,  59406, 5152 },
+ { 1257328,  802,  59379, 5377 }, { 1387701,  860,  59150, 5890 }, { 1471791,  847,  58321, 6236 }, { 1479873,  833,  59237, 6274 },
+ { 1513889,  827,  58346, 6423 }, { 1546745,  824,  58998, 6576 }, { 1641290,  854,  58392, 7037 }, { 1678841,  813,  58963, 7271 },
+ { 1827119,  824,  59314, 7992 }, { 2040111,  805,  58701, 8877 }, { 2049313,  820,  58483, 8910 }, {  134866,  828,  60771,  447 },
+ {  516548,  810,  60624, 2089 }, {  537961,  849,  60530, 2204 }, {  674460,  857,  61156, 3005 }, {  697893,  832,  61133, 3142 },
+ {  697919,  834,  61128, 3143 }, {  800634,  848,  60329, 3647 }, {  914637,  810,  60301, 4111 }, {  968578,  813,  60282, 4316 },
+ {  980052,  811,  60783, 4353 }, { 1027037,  826,  59812, 4516 }, { 1098073,  838,  61035, 4782 }, { 1170723,  848,  60909, 5046 },
+ { 1175432,  831,  59920, 5061 }, { 1175784,  828,  60265, 5063 }, { 1194205,  800,  61095, 5134 }, { 1280736,  839,  59792, 5458 },
+ { 1372790,  804,  60423, 5832 }, { 1652291,  860,  60990, 7108 }, { 1748241,  817,  60222, 7621 }, { 1779205,  827,  61166, 7766 },
+ { 1865989,  838,  61076, 8152 }, { 1901005,  845,  60437, 8303 }, { 1990068,  848,  60709, 8659 }, { 2020196,  833,  60594, 8791 },
+ { 2029067,  880,  60612, 8828 }, {  277373,  812,  62236,  960 }, {  327452,  849,  61256, 1167 }, {  531252,  858,  61835, 2162 },
+ {  553563,  860,  62246, 2290 }, {  599358,  842,  61593, 2563 }, {  699412,  802,  62596, 3148 }, {  699752,  812,  62436, 3151 },
+ {  839475,  817,  62261, 3831 }, {  870476,  805,  61770, 3943 }, { 1087611,  826,  62497, 4734 }, { 1121870,  824,  61836, 4871 },
+ { 1124435,  833,  61304, 4880 }, { 1169516,  838,  61987, 5039 }, { 1186175,  833,  61563, 5103 }, { 1256318,  809,  61633, 5375 },
+ { 1308021,  835,  62424, 5566 }, { 1328956,  833,  61485, 5650 }, { 1393824,  831,  61403, 5921 }, { 1486140,  800,  62110, 6300 },
+ { 1633317,  849,  61305, 7005 }, { 1650111,  819,  61691, 7095 }, { 1936905,  843,  61323, 8440 }, { 1989576,  862,  62593, 8658 },
+ { 2000496,  804,  62038, 8700 }, {  160690,  814,  63812,  537 }, {  293536,  839,  63755, 1021 }, {  489401,  811,  63080, 1927 },
+ {  583739,  865,  63606, 2476 }, {  695167,  822,  63920, 3118 }, {  744460,  839,  63886, 3375 }, { 1043816,  826,  62729, 4570 },
+ { 1169276,  816,  63997, 5038 }, { 1214525,  810,  62810, 5223 }, { 1370389,  823,  63695, 5821 }, { 1385758,  801,  62712, 5882 },
+ { 1490864,  806,  62856, 6323 }, { 1588993,  807,  63371, 6778 }, { 1775200,  831,  63658, 7745 }, { 1775732,  813,  63468, 7749 },
+ {   71282,  827,  65096,  229 }, {  130354,  831,  65181,  435 }, {  236136,  810,  64843,  807 }, {  240699,  885,  64498,  822 },
+ {  388993,  810,  65460, 1418 }, {  392245,  816,  64830, 1433 }, {  706828,  819,  65505, 3179 }, {  717277,  803,  64464, 3234 },
+ {  747848,  824,  65494, 3390 }, {  878680,  812,  65006, 3964 }, { 1280403,  807,  64930, 5457 }, { 1460807,  823,  64182, 6197 },
+ { 1531822,  803,  64133, 6513 }, { 1650041,  819,  64933, 7097 }, { 1870466,  831,  64975, 8177 }, { 1990442,  856,  65448, 8662 },
+ { 2067248,  809,  65009, 8966 }, {  133477,  817,  66374,  443 }, {  361999,  859,  66795, 1291 }, {  500528,  839,  66749, 1984 },
+ {  530803,  835,  65589, 2157 }, {  534528,  851,  65669, 2178 }, {  539820,  831,  65947, 2211 }, {  597052,  855,  66191, 2546 },
+ {  609771,  822,  66655, 2626 }, {  699527,  861,  66201, 3146 }, {  779619,  826,  65597, 3562 }, {  808632,  825,  66345, 3680 },
+ {  920334,  809,  65637, 4136 }, {  985169,  831,  66818, 4370 }, { 1064666,  861,  66152, 4636 }, { 1246126,  831,  65537, 5325 },
+ { 1327514,  939,  65943, 5643 }, { 1327587,  844,  65940, 5642 }, { 1383933,  812,  66121, 5872 }, { 1434369,  833,  66045, 6099 },
+ { 1449265,  846,  65892, 6160 }, { 1486267,  865,  66194, 6303 }, { 1492893,  828,  66267, 6331 }, { 1560837,  811,  66411, 6640 },
+ { 1585245,  815,  66653, 6759 }, { 1718063,  825,  65941, 7461 }, { 1864366,  800,  65568, 8145 }, { 1955495,  862,  66916, 8521 },
+ { 2073884,  809,  65657, 8993 }, {     466,  829,  67416, 9077 }, {   58060,  801,  68153,  171 }, {  123351,  826,  67762,  411 },
+ {  367769,  871,  67529, 1316 }, {  386398,  839,  67227, 1404 }, {  473209,  808,  67321, 1813 }, {  509096,  838,  68267, 2032 },
+ {  536779,  827,  67511, 2187 }, {  671909,  841,  67913, 2984 }, {  683715,  832,  68087, 3057 }, {  685516,  845,  67837, 3069 },
+ {  743693,  830,  68066, 3371 }, {  809836,  804,  68301, 3688 }, {  993795,  812,  67933, 4393 }, { 1493944,  819,  67145, 6338 },
+ { 1513748,  865,  67317, 6427 }, { 1945087,  810,  67650, 8484 }, { 1984602,  807,  67353, 8639 }, { 2052024,  843,  67717, 8920 },
+ { 2055573,  802,  68221, 8929 }, {   27248,  833,  68791,   73 }, {   72907,  848,  69024,  239 }, {   75539,  890,  69482,  245 },
+ {  189445,  832,  69637,  636 }, {  207089,  831,  68740,  698 }, {  420251,  872,  69876, 1548 }, {  601162,  846,  69870, 2579 },
+ {  614961,  843,  69037, 2658 }, {  617466,  879,  69340, 2668 }, {  660052,  852,  68575, 2908 }, {  677645,  803,  69544, 3020 },
+ {  686441,  832,  68588, 3074 }, {  692897,  802,  69679, 3101 }, {  786971,  807,  68701, 3593 }, {  925040,  808,  69417, 4154 },
+ {  982894,  821,  69518, 4364 }, { 1156286,  816,  68651, 4991 }, { 1232341,  820,  68583, 5286 }, { 1236250,  817,  69135, 5294 },
+ { 1292566,  830,  69261, 5509 }, { 1309921,  810,  68682, 5580 }, { 1334276,  804,  69155, 5668 }, { 1615411,  836,  69680, 6915 },
+ { 1695718,  817,  69502, 7350 }, { 1748270,  814,  68512, 7627 }, { 1838226,  864,  68451, 8042 }, { 2044369,  810,  68630, 8896 },
+ {  360329,  859,  71240, 1285 }, {  514649,  855,  71247, 2069 }, {  534021,  812,  70340, 2171 }, {  600982,  852,  70640, 2575 },
+ {  603580,  832,  70438, 2591 }, {  686922,  804,  71199, 3078 }, {  694630,  809,  70496, 3111 }, {  704136,  829,  71287, 3166 },
+ {  713316,  826,  70838, 3205 }, {  769170,  843,  70581, 3501 }, {  772378,  800,  70036, 3525 }, {  774002,  855,  70640, 3530 },
+ {  805816,  829,  70304, 3668 }, {  910640,  818,  70587, 4093 }, {  911909,  813,  70981, 4099 }, {  930376,  811,  71003, 4175 },
+ {  953937,  811,  70271, 4263 }, {  996684,  812,  70880, 4403 }, { 1085191,  811,  70654, 4721 }, { 1154669,  822,  70924, 4982 },
+ { 1261529,  832,  70370, 5398 }, { 1273049,  860,  70050, 5431 }, { 1420529,  814,  71215, 6049 }, { 1541030,  810,  71188, 6558 },
+ { 1600049,  830,  70325, 6839 }, { 1692518,  834,  69929, 7334 }, { 1765683,  822,  71042, 7706 }, { 1884937,  832,  71252, 8241 },
+ {  156238,  818,  72468,  524 }, {  203033,  837,  72597,  686 }, {  300293,  832,  72289, 1049 }, {  306165,  812,  71900, 1076 },
+ {  390532,  844,  72760, 1429 }, {  413222,  825,  71456, 1518 }, {  422736,  807,  71829, 1557 }, {  442586,  831,  72446, 1651 },
+ {  566092,  832,  71470, 2368 }, {  577962,  834,  72172, 2445 }, {  766621,  821,  71544, 3488 }, {  768482,  836,  72435, 3497 },
+ {  908290,  827,  72750, 4087 }, { 1071162,  826,  72691, 4658 }, { 1084614,  825,  71921, 4718 }, { 1092216,  802,  72433, 4755 },
+ { 1142950,  826,  71648, 4938 }, { 1228375,  811,  71978, 5269 }, { 1337163,  828,  71450, 5682 }, { 1461829,  820,  71535, 6206 },
+ { 1462033,  812,  71526, 6209 }, { 1474296,  849,  72606, 6249 }, { 1476715,  832,  72810, 6261 }, { 1477031,  845,  72600, 6263 },
+ { 1477220,  859,  72556, 6265 }, { 1562492,  820,  72813, 6649 }, { 1618084,  804,  72692, 6931 }, { 1663369,  823,  72687, 7177 },
+ { 1943715,  823,  71917, 8477 }, { 2034281,  847,  71645, 8847 }, {   44365,  819,  74186,  119 }, {  210535,  818,  74042,  706 },
+ {  237879,  836,  73586,  814 }, {  326374,  845,  73779, 1157 }, {  369325,  837,  73339, 1323 }, {  506766,  861,  73768, 2017 },
+ {  560321,  831,  73232, 2323 }, {  569430,  820,  74152, 2390 }, {  584341,  812,  73327, 2475 }, {  660057,  826,  72904, 2907 },
+ {  679473,  857,  72905, 3025 }, {  681781,  814,  73768, 3041 }, {  693815,  878,  73890, 3107 }, {  753419,  855,  73033, 3421 },
+ {  777468,  847,  73469, 3548 }, {  824989,  820,  73549, 3746 }, {  868119,  841,  74019, 3930 }, {  894120,  835,  73270, 4019 },
+ { 1046156,  879,  74197, 4577 }, { 1111838,  844,  73077, 4836 }, { 1175636,  840,  73055, 5065 }, { 1225256,  813,  73141, 5259 },
+ { 1268401,  839,  74048, 5417 }, { 1317587,  841,  74072, 5604 }, { 1342160,  820,  73910, 5696 }, { 1379785,  842,  73101, 5862 },
+ { 1398053,  849,  73768, 5945 }, { 1399405,  821,  73452, 5952 }, { 1480531,  815,  74017, 6283 }, { 1568393,  843,  73263, 6678 },
+ { 1749724,  829,  74004, 7639 }, { 1785198,  809,  73978, 7799 }, { 1857210,  821,  73555, 8117 }, { 1975529,  828,  73667, 8600 },
+ { 2076792,  831,  73084, 9001 }, { 2089351,  803,  73255, 9046 }, {  248743,  836,  75631,  853 }, {  416406,  805,  74794, 1526 },
+ {  429498,  810,  75190, 1584 }, {  439200,  803,  75320, 1631 }, {  500263,  825,  74867, 1981 }, {  548454,  800,  74659, 2262 },
+ {  587477,  830,  74556, 2488 }, {  591361,  862,  75061, 2507 }, {  661149,  876,  75593, 2917 }, {  667598,  859,  75718, 2952 },
+ {  680259,  831,  74757, 3032 }, {  730221,  816,  75178, 3286 }, {  737343,  853,  74361, 3327 }, {  737357,  925,  74362, 3328 },
+ {  744795,  831,  74368, 3373 }, {  750329,  847,  75687, 3404 }, {  771684,  839,  74481, 3517 }, {  789500,  827,  74860, 3602 },
+ {  803447,  800,  74651, 3656 }, {  819362,  854,  75402, 3729 }, {  821780,  806,  74894, 3737 }, {  834681,  843,  74462, 3812 },
+ {  842762,  870,  75169, 3844 }, {  850895,  882,  75106, 3874 }, {  880207,  843,  75695, 3968 }, { 1042622,  813,  75278, 4568 },
+ { 1082968,  840,  74716, 4713 }, { 1193746,  827,  75364, 5135 }, { 1209246,  844,  75586, 5198 }, { 1262415,  835,  75547, 5400 },
+ { 1276355,  813,  75144, 5446 }, { 1305764,  836,  74880, 5561 }, { 1308700,  815,  75595, 5572 }, { 1360743,  836,  74783, 5773 },
+ { 1366855,  857,  74508, 5805 }, { 1367089,  804,  74461, 5807 }, { 1392434,  803,  75533, 5918 }, { 1410582,  905,  74427, 5999 },
+ { 1410587,  865,  74410, 6000 }, { 1428020,  812,  74902, 6080 }, { 1506544,  860,  75391, 6392 }, { 1569898,  829,  74474, 6683 },
+ { 1620946,  822,  75573, 6948 }, { 1656719,  831,  75473, 7136 }, { 1659058,  849,  75053, 7156 }, { 1674316,  846,  75480, 7255 },
+ { 1676309,  836,  74281, 7268 }, { 1718395,  861,  74905, 7464 }, { 1810080,  829,  75088, 7915 }, {   62209,  806,  76405,  185 },
+ {  147755,  817,  75924,  494 }, {  159927,  837,  76319,  535 }, {  165132,  810,  76597,  554 }, {  236090,  801,  76290,  805 },
+ {  258568,  841,  76009,  893 }, {  513795,  870,  76496, 2055 }, {  572598,  844,  76641, 2407 }, {  578219,  804,  75944, 2444 },
+ {  582467,  858,  75962, 2465 }, {  585853,  829,  76311, 2482 }, {  620463,  811,  76288, 2685 }, {  666651,  838,  75746, 2945 },
+ {  667802,  819,  76868, 2955 }, {  672788,  854,  76501, 2986 }, {  674463,  889,  76989, 2995 }, {  675334,  840,  76025, 3001 },
+ {  732965,  832,  76147, 3296 }, {  747593,  849,  76271, 3388 }, {  805993,  831,  76628, 3667 }, {  829062,  819,  76319, 3766 },
+ {  986239,  827,  75751, 4372 }, { 1182689,  816,  76312, 5092 }, { 1279156,  802,  76887, 5456 }, { 1342034,  848,  76050, 5697 },
+ { 1347289,  903,  75977, 5722 }, { 1357430,  825,  76638, 5751 }, { 1461880,  805,  75959, 6210 }, { 1503360,  830,  76928, 6382 },
+ { 1528341,  839,  76483, 6503 }, { 1540018,  826,  75826, 6557 }, { 1554108,  843,  75893, 6613 }, { 1615506,  863,  76970, 6921 },
+ { 1621489,  832,  76780, 6952 }, { 1744260,  855,  75815, 7605 }, { 1798490,  844,  75861, 7853 }, { 1899804,  830,  76535, 8299 },
+ { 1991982,  871,  76054, 8671 }, {  156990,  832,  77419,  528 }, {  208417,  853,  78026,  700 }, {  230706,  849,  78630,  780 },
+ {  453798,  857,  77763, 1699 }, {  471349,  882,  77677, 1797 }, {  563792,  848,  78491, 2353 }, {  591574,  821,  78316, 2510 },
+ {  647768,  897,  77609, 2842 }, {  647770,  884,  77610, 2843 }, {  653001,  858,  78367, 2869 }, {  656389,  865,  77682, 2882 },
+ {  669875,  800,  78031, 2968 }, {  677317,  854,  78480, 3016 }, {  702114,  834,  77261, 3155 }, {  711614,  837,  78179, 3195 },
+ {  715110,  844,  77612, 3219 }, {  717777,  843,  78533, 3233 }, {  725571,  870,  77732, 3267 }, {  749278,  830,  78077, 3399 },
+ {  816277,  805,  78034, 3716 }, {  821016,  848,  78290, 3735 }, {  885506,  836,  77673, 3984 }, { 1014614,  831,  77533, 4470 },
+ { 1040464,  846,  78278, 4557 }, { 1063960,  806,  78454, 4631 }, { 1309601,  847,  78470, 5579 }, { 1339158,  820,  77328, 5689 },
+ { 1379872,  801,  78521, 5864 }, { 1395934,  831,  77920, 5935 }, { 1472371,  811,  77936, 6244 }, { 1483842,  809,  78091, 6298 },
+ { 1518479,  841,  78359, 6450 }, { 1537499,  848,  77828, 6539 }, { 1603333,  845,  77897, 6856 }, { 1661779,  869,  77275, 7169 },
+ { 1661806,  840,  77277, 7170 }, { 1670258,  816,  78367, 7232 }, { 1677959,  857,  78036, 7273 }, { 1723782,  816,  77972, 7491 },
+ { 1786778,  825,  77774, 7808 }, { 1918074,  818,  78275, 8367 }, {  221725,  830,  79266,  742 }, {  331797,  821,  78797, 1186 },
+ {  335875,  886,  79263, 1200 }, {  570284,  834,  80012, 2393 }, {  576571,  835,  78773, 2431 }, {  657443,  868,  78866, 2885 },
+ {  719411,  811,  79140, 3241 }, {  743460,  869,  79693, 3364 }, {  756385,  813,  79527, 3434 }, {  775718,  842,  79438, 3534 },
+ {  859039,  837,  79034, 3897 }, {  881464,  827,  79202, 3972 }, {  896166,  819,  79398, 4029 }, {  900945,  830,  79815, 4053 },
+ {  986997,  868,  79421, 4376 }, { 1074482,  815,  78780, 4675 }, { 1112624,  839,  79152, 4838 }, { 1158038,  819,  79184, 4999 },
+ { 1211120,  835,  79274, 5208 }, { 1294169,  804,  79568, 5519 }, { 1319795,  827,  79028, 5615 }, { 1329832,  810,  78776, 5653 },
+ { 1527622,  802,  79777, 6501 }, { 1565774,  806,  79336, 6671 }, { 1575493,  830,  79193, 6708 }, { 1586515,  858,  79623, 6772 },
+ { 1637131,  832,  79690, 7026 }, { 1674236,  856,  78883, 7256 }, { 1771504,  839,  79305, 7728 }, { 1815071,  849,  78818, 7935 },
+ { 1835000,  811,  78832, 8031 }, { 1857989,  812,  78950, 8124 }, { 2002851,  840,  79209, 8713 }, { 2013509,  847,  79256, 8760 },
+ {   96763,  861,  81062,  323 }, {  244029,  851,  80902,  835 }, {  281113,  827,  81474,  970 }, {  299907,  839,  81441, 1042 },
+ {  303201,  850,  81342, 1058 }, {  365200,  844,  80498, 1299 }, {  383208,  839,  80893, 1386 }, {  443366,  834,  81127, 1653 },
+ {  448917,  852,  81146, 1680 }, {  456968,  898,  81302, 1715 }, {  505807,  832,  81082, 2009 }, {  561423,  825,  80193, 2329 },
+ {  606953,  829,  80597, 2604 }, {  607727,  823,  80839, 2612 }, {  646580,  831,  81320, 2829 }, {  657855,  861,  81393, 2889 },
+ {  658814,  830,  81500, 2895 }, {  666642,  860,  80503, 2942 }, {  712405,  820,  80762, 3199 }, {  722326,  816,  81414, 3253 },
+ {  761601,  842,  81473, 3463 }, {  826686,  865,  80111, 3756 }, {  837691,  849,  81299, 3823 }, {  848604,  841,  80830, 3867 },
+ {  887692,  813,  81347, 3992 }, {  933320,  837,  81180, 4183 }, { 1001937,  845,  80578, 4420 }, { 1029814,  817,  81420, 4524 },
+ { 1039032,  817,  80197, 4553 }, { 1057234,  823,  81110, 4612 }, { 1146013,  854,  81355, 4947 }, { 1207200,  853,  81125, 5189 },
+ { 1214411,  819,  80557, 5224 }, { 1494910,  813,  80757, 6347 }, { 1509306,  812,  81191, 6405 }, { 1518445,  847,  81425, 6454 },
+ { 1562570,  845,  80127, 6652 }, { 1562618,  803,  81009, 6653 }, { 1579913,  800,  81412, 6739 }, { 1609799,  815,  81544, 6889 },
+ { 1771572,  853,  80388, 7729 }, { 1778014,  846,  81081, 7765 }, { 1789538,  810,  80967, 7817 }, { 2007707,  813,  80861, 8732 },
+ { 2050566,  832,  80892, 8914 }, {   21802,  817,  82873,   54 }, {  385847,  855,  82660, 1398 }, {  416265,  886,  81563, 1524 },
+ {  459893,  866,  82906, 1730 }, {  466534,  834,  82574, 1766 }, {  467900,  809,  82059, 1772 }, {  619728,  814,  82689, 2677 },
+ {  691281,  815,  82789, 3092 }, {  727435,  843,  82416, 3273 }, {  747077,  836,  82479, 3385 }, {  767237,  837,  82463, 3490 },
+ {  815266,  839,  81706, 3710 }, {  986904,  845,  82630, 4373 }, { 1063200,  817,  82583, 4628 }, { 1067824,  850,  81739, 4647 },
+ { 1189612,  850,  82237, 5117 }, { 1313587,  822,  82079, 5587 }, { 1521957,  816,  82570, 6470 }, { 1532681,  817,  81963, 6522 },
+ { 1562407,  806,  81722, 6651 }, { 1563145,  817,  82620, 6657 }, { 1563774,  838,  82700, 6660 }, { 1564080,  842,  82767, 6663 },
+ { 1598498,  816,  81712, 6833 }, { 1644643,  862,  82646, 7070 }, { 1691555,  848,  82989, 7330 }, { 1755688,  853,  83012, 7668 },
+ { 1991302,  828,  81791, 8668 }, {   58204,  869,  84413,  170 }, {  129210,  858,  84124,  431 }, {  172498,  835,  83109,  576 },
+ {  377269,  837,  84330, 1359 }, {  497273,  834,  83596, 1966 }, {  612878,  840,  83690, 2641 }, {  639673,  830,  84071, 2794 },
+ {  661496,  811,  83687, 2913 }, {  707422,  814,  83841, 3177 }, {  718981,  837,  83841, 3238 }, {  753657,  848,  84098, 3419 },
+ {  893348,  838,  83059, 4013 }, { 1044297,  821,  83471, 4571 }, { 1068399,  833,  84167, 4651 }, { 1136748,  802,  83748, 4922 },
+ { 1169665,  822,  83289, 5043 }, { 1186532,  844,  83465, 5104 }, { 1196777,  805,  83882, 5147 }, { 1247084,  855,  83364, 5337 },
+ { 1250131,  854,  83334, 5348 }, { 1363426,  824,  83147, 5790 }, { 1404359,  810,  83325, 5974 }, { 1432974,  847,  83303, 6097 },
+ { 1479604,  837,  83751, 6282 }, { 1531780,  844,  84036, 6517 }, { 1548274,  840,  83087, 6587 }, { 1588767,  816,  84177, 6788 },
+ { 1610598,  830,  84389, 6893 }, { 1684343,  825,  83772, 7296 }, { 1740469,  846,  83080, 7585 }, { 1823328,  804,  83270, 7979 },
+ { 1888624,  811,  83082, 8256 }, { 1891954,  828,  84001, 8268 }, { 1935076,  837,  83195, 8437 }, { 2038490,  837,  84044, 8871 },
+ {   43422,  857,  84639,  116 }, {  239340,  822,  85233,  817 }, {  261617,  831,  85207,  903 }, {  296723,  850,  85499, 1031 },
+ {  719706,  806,  84674, 3239 }, {  749336,  843,  85340, 3397 }, {  775414,  850,  85210, 3533 }, {  971593,  859,  85324, 4324 },
+ {  979030,  838,  85101, 4346 }, { 1015109,  829,  85908, 4473 }, { 1095289,  846,  85246, 4774 }, { 1211448,  806,  85917, 5211 },
+ { 1305645,  806,  85396, 5562 }, { 1357088,  846,  85752, 5753 }, { 1403303,  801,  84469, 5970 }, { 1411978,  819,  85415, 6006 },
+ { 1461664,  846,  84623, 6211 }, { 1504384,  801,  85107, 6389 }, { 1512192,  836,  85274, 6422 }, { 1587425,  843,  85517, 6777 },
+ { 1704292,  860,  84603, 7399 }, { 1821588,  836,  84548, 7970 }, { 1995185,  833,  85641, 8680 }, {   33802,  855,  85978,   89 },
+ {  138128,  812,  87224,  453 }, {  159216,  834,  86031,  532 }, {  216400,  811,  86074,  727 }, {  311583,  820,  86042, 1093 },
+ {  312473,  840,  87199, 1095 }, {  519652,  844,  87347, 2098 }, {  558134,  834,  87076, 2307 }, {  605718,  836,  87076, 2598 },
+ {  631745,  860,  86047, 2741 }, {  649122,  831,  87001, 2847 }, {  653693,  838,  87160, 2870 }, {  653697,  913,  87158, 2871 },
+ {  671203,  856,  86887, 2974 }, {  738770,  833,  86905, 3336 }, {  746904,  838,  86654, 3384 }, {  816632,  882,  87033, 3715 },
+ {  831225,  900,  87223, 3780 }, {  831242,  818,  87220, 3781 }, {  962185,  807,  87147, 4298 }, {  965955,  846,  87324, 4307 },
+ { 1211710,  812,  86827, 5212 }, { 1217137,  851,  86340, 5237 }, { 1227749,  818,  86921, 5268 }, { 1337937,  818,  86230, 5688 },
+ { 1369348,  834,  86236, 5822 }, { 1391558,  821,  86047, 5916 }, { 1392613,  829,  87069, 5923 }, { 1400031,  833,  87220, 5956 },
+ { 1657850,  812,  85978, 7151 }, { 1690009,  858,  87116, 7323 }, { 1877334,  850,  86272, 8214 }, { 2003737,  810,  86847, 8719 },
+ { 2004528,  848,  86749, 8721 }, { 2063787,  852,  87193, 8956 }, { 2090273,  810,  87267, 9049 }, { 2090273,  883,  87213, 9050 },
+ {  105426,  852,  88550,  358 }, {  233077,  852,  88305,  786 }, {  250379,  840,  88567,  858 }, {  285720,  865,  88586,  990 },
+ {  403190,  830,  88425, 1476 }, {  419178,  837,  87411, 1539 }, {  479304,  875,  87551, 1838 }, {  498355,  819,  88161, 1972 },
+ {  589882,  854,  88235, 2497 }, {  609820,  842,  88834, 2621 }, {  620422,  834,  88336, 2680 }, {  629245,  810,  88578, 2720 },
+ {  631990,  833,  87876, 2743 }, {  636359,  832,  88687, 2768 }, {  646483,  860,  87697, 2824 }, {  692102,  844,  88718, 3096 },
+ {  693779,  833,  87797, 3099 }, {  712320,  865,  87851, 3196 }, {  722171,  821,  88730, 3251 }, {  725224,  845,  87386, 3261 },
+ {  852497,  845,  87677, 3878 }, {  877923,  854,  88222, 3956 }, {  907628,  827,  87618, 4083 }, {  972710,  854,  87636, 4328 },
+ { 1030024,  848,  87799, 4525 }, { 1271631,  809,  88421, 5428 }, { 1284290,  837,  88741, 5474 }, { 1299872,  829,  88222, 5542 },
+ { 1477618,  835,  88237, 6273 }, { 1508578,  821,  87688, 6403 }, { 1560060,  866,  88193, 6645 }, { 1571541,  904,  87750, 6694 },
+ { 1649606,  863,  88451, 7105 }, { 1746083,  828,  88165, 7617 }, { 1770700,  830,  87389, 7725 }, { 1798293,  840,  88071, 7856 },
+ { 1825420,  835,  88428, 7991 }, { 1916457,  841,  88264, 8365 }, {    6318,  840,  89229, 9102 }, {   92177,  829,  89603,  300 },
+ {  178358,  842,  89806,  606 }, {  258093,  829,  90083,  884 }, {  281999,  816,  90009,  974 }, {  331081,  855,  90151, 1179 },
+ {  486231,  853,  90074, 1888 }, {  512625,  845,  89491, 2043 }, {  515892,  836,  89053, 2068 }, {  544029,  854,  89415, 2226 },
+ {  547522,  867,  89986, 2252 }, {  717644,  852,  90164, 3230 }, {  738149,  873,  89151, 3331 }, {  973229,  849,  90254, 4331 },
+ { 1021109,  844,  89124, 4498 }, { 1183398,  845,  89661, 5098 }, { 1208933,  818,  88956, 5197 }, { 1245215,  808,  89248, 5324 },
+ { 1306681,  829,  89068, 5565 }, { 1386761,  840,  90129, 5893 }, { 1401971,  803,  89035, 5965 }, { 1434015,  863,  89862, 6105 },
+ { 1525715,  800,  89893, 6494 }, { 1625285,  837,  89856, 6972 }, { 1649493,  813,  89390, 7104 }, { 1676724,  830,  89569, 7270 },
+ { 1777436,  830,  89125, 7764 }, { 1792696,  839,  89002, 7832 }, { 1885810,  841,  89851, 8244 }, { 1927176,  910,  90155, 8398 },
+ { 1928795,  847,  90173, 8405 }, { 1984093,  817,  89363, 8637 }, { 2025466,  851,  89602, 8823 }, {  260848,  814,  91615,  900 },
+ {  417144,  819,  90421, 1525 }, {  489585,  826,  91325, 1915 }, {  505470,  822,  91225, 2005 }, {  560306,  839,  91430, 2318 },
+ {  602298,  804,  91080, 2576 }, {  612703,  827,  91007, 2637 }, {  772393,  817,  91194, 3516 }, {  785357,  825,  91468, 3585 },
+ {  825385,  810,  91441, 3745 }, {  833485,  846,  91209, 3798 }, {  891360,  828,  91177, 4003 }, {  920140,  805,  90640, 4130 },
+ {  970872,  877,  91354, 4320 }, { 1181912,  847,  90458, 5090 }, { 1215004,  804,  91124, 5228 }, { 1366442,  832,  90595, 5809 },
+ { 1378023,  851,  90384, 5856 }, { 1463642,  802,  91036, 6218 }, { 1570900,  801,  91400, 6692 }, { 1590297,  851,  91607, 6802 },
+ { 1598198,  840,  90715, 6836 }, { 1598205,  819,  91244, 6835 }, { 1604908,  816,  90920, 6864 }, { 1671190,  804,  91222, 7240 },
+ { 1731888,  805,  91443, 7538 }, { 1862543,  840,  91409, 8142 }, { 1936955,  844,  90720, 8446 }, { 1978815,  847,  91383, 8614 },
+ { 1980255,  831,  90768, 8619 }, {   81446,  810,  92880,  268 }, {  154398,  839,  92259,  517 }, {  273574,  819,  92961,  943 },
+ {  318643,  801,  93124, 1114 }, {  491192,  816,  93019, 1926 }, {  589628,  845,  92248, 2493 }, {  597251,  904,  92237, 2537 },
+ {  608330,  823,  92533, 2611 }, {  608941,  837,  91990, 2614 }, {  629730,  859,  92441, 2724 }, {  631483,  812,  92269, 2734 },
+ {  670977,  876,  93128, 2972 }, {  741955,  870,  92235, 3353 }, {  863570,  830,  92234, 3916 }, {  869299,  832,  92442, 3933 },
+ {  893217,  825,  91792, 4011 }, { 1034913,  848,  92155, 4542 }, { 1085432,  809,  92842, 4723 }, { 1390091,  814,  92244, 5910 },
+ { 1462601,  858,  92415, 6216 }, { 1503566,  814,  92860, 6387 }, { 1548538,  836,  93038, 6593 }, { 1695928,  804,  93011, 7355 },
+ { 1813483,  850,  92110, 7931 }, { 1826435,  841,  93098, 7997 }, { 1839625,  825,  92816, 8050 }, { 2088934,  835,  91812, 9044 },
+ {   20006,  831,  93621,   43 }, {  283994,  825,  93353,  980 }, {  292368,  839,  94090, 1013 }, {  470694,  849,  94235, 1785 },
+ {  538541,  827,  94227, 2192 }, {  540636,  809,  93909, 2206 }, {  601477,  840,  94601, 2567 }, {  621866,  862,  94165, 2688 },
+ {  637590,  846,  94368, 2774 }, {  642132,  801,  94610, 2800 }, {  661884,  865,  93377, 2912 }, {  669120,  850,  94464, 2956 },
+ {  739671,  862,  93400, 3339 }, {  788165,  820,  94174, 3597 }, {  799139,  815,  94325, 3637 }, {  869116,  828,  94008, 3931 },
+ {  918752,  851,  93911, 4125 }, {  926354,  829,  94190, 4157 }, {  964700,  823,  94418, 4302 }, { 1008364,  816,  94294, 4445 },
+ { 1124256,  815,  94282, 4881 }, { 1130862,  862,  93877, 4912 }, { 1152929,  850,  94010, 4978 }, { 1242592,  824,  94098, 5314 },
+ { 1260905,  848,  94448, 5399 }, { 1365297,  819,  93615, 5801 }, { 1443802,  810,  93990, 6145 }, { 1495512,  829,  93954, 6354 },
+ { 1531707,  805,  93600, 6520 }, { 1556062,  835,  94627, 6621 }, { 1613249,  831,  94131, 6909 }, { 1613792,  827,  94310, 6914 },
+ { 1615035,  850,  94054, 6926 }, { 1649286,  829,  94154, 7103 }, { 1806755,  851,  94146, 7902 }, { 1807922,  828,  93207, 7910 },
+ { 1837564,  805,  94490, 8045 }, { 1863790,  856,  93721, 8148 }, { 1941261,  817,  93684, 8464 }, { 1967384,  843,  93314, 8570 },
+ { 2074552,  817,  93566, 8999 }, { 2092985,  826,  94115, 9058 }, {  143936,  870,  94695,  474 }, {  202397,  834,  96040,  683 },
+ {  210203,  844,  95897,  703 }, {  218788,  851,  94935,  733 }, {  294579,  835,  95519, 1018 }, {  308599,  838,  95558, 1082 },
+ {  380868,  801,  95724, 1374 }, {  430358,  872,  95723, 1583 }, {  452550,  841,  95988, 1694 }, {  526062,  805,  95272, 2129 },
+ {  563882,  807,  95911, 2349 }, {  598002,  833,  95796, 2544 }, {  675242,  855,  95397, 2992 }, {  765783,  810,  95227, 3483 },
+ {  791015,  874,  95398, 3607 }, {  879187,  870,  95124, 3962 }, { 1046984,  843,  95987, 4579 }, { 1201146,  821,  95392, 5166 },
+ { 1319159,  867,  95813, 5614 }, { 1330349,  845,  95113, 5657 }, { 1419791,  805,  95358, 6054 }, { 1466339,  871,  95433, 6225 },
+ { 1503289,  854,  95034, 6386 }, { 1524688,  844,  96037, 6490 }, { 1585828,  861,  95351, 6773 }, { 1600090,  851,  95544, 6846 },
+ { 1615633,  859,  95037, 6929 }, { 1802777,  836,  94822, 7877 }, { 1895838,  849,  94812, 8282 }, { 1946599,  815,  95971, 8492 },
+ { 1992202,  830,  95991, 8674 }, { 2010368,  829,  95576, 8746 }, { 2082336,  842,  95146, 9026 }, {    4556,  844,  96331, 9096 },
+ {   77488,  846,  97251,  251 }, {  188715,  848,  96623,  630 }, {  247362,  814,  96935,  844 }, {  388774,  811,  96238, 1410 },
+ {  532679,  895,  96404, 2156 }, {  596717,  833,  96230, 2528 }, {  602817,  821,  96905, 2578 }, {  621677,  808,  97518, 2686 },
+ {  624517,  865,  96184, 2695 }, {  685943,  845,  96889, 3060 }, {  747227,  819,  97003, 3381 }, {  839679,  853,  97143, 3828 },
+ { 1018002,  842,  97170, 4489 }, { 1118328,  844,  97360, 4857 }, { 1210727,  845,  96689, 5209 }, { 1241410,  834,  96650, 5309 },
+ { 1330077,  847,  96132, 5655 }, { 1359001,  900,  96832, 5765 }, { 1403798,  821,  97177, 5973 }, { 1409556,  833,  96792, 5998 },
+ { 1418143,  841,  96734, 6042 }, { 1458690,  809,  96801, 6193 }, { 1511709,  880,  96533, 6425 }, { 1522042,  819,  96474, 6474 },
+ { 1565437,  820,  97412, 6672 }, { 1604209,  825,  97452, 6861 }, { 1623176,  851,  96444, 6965 }, { 1657830,  862,  97396, 7155 },
+ { 1660847,  836,  97492, 7168 }, { 1672250,  830,  97076, 7246 }, { 1682896,  825,  96380, 7291 }, { 1795502,  836,  97494, 7842 },
+ { 1882420,  843,  96980, 8235 }, { 2069651,  860,  96353, 8978 }, { 2087463,  824,  96453, 9043 }, { 2092052,  831,  97193, 9054 },
+ {    9954,  818,  97732,    9 }, {   59053,  814,  98747,  173 }, {   72172,  828,  98103,  232 }, {   96306,  814,  99021,  320 },
+ {   97894,  837,  99027,  325 }, {  277567,  838,  98651,  953 }, {  519300,  836,  97890, 2090 }, {  544315,  839,  98831, 2225 },
+ {  581967,  805,  98589, 2455 }, {  590390,  805,  98249, 2495 }, {  603247,  891,  98928, 2583 }, {  634668,  832,  98654, 2755 },
+ {  650523,  856,  98613, 2850 }, {  665962,  837,  98704, 2933 }, {  740700,  851,  97680, 3344 }, {  780507,  839,  98768, 3559 },
+ {  801554,  853,  97833, 3646 }, {  829877,  824,  98079, 3767 }, {  872505,  821,  98960, 3946 }, {  905094,  850,  98611, 4071 },
+ {  924730,  810,  97832, 4149 }, { 1071562,  854,  98091, 4661 }, { 1196418,  859,  98231, 5146 }, { 1219642,  814,  97609, 5246 },
+ { 1368035,  834,  97795, 5819 }, { 1633827,  823,  98789, 7011 }, { 1718242,  834,  98199, 7470 }, { 1739318,  818,  98946, 7578 },
+ { 1806165,  837,  98703, 7898 }, { 1824843,  833,  98716, 7989 }, { 1886367,  840,  98237, 8247 }, { 1947143,  817,  97780, 8497 },
+ { 1960514,  829,  98570, 8542 }, {   52597,  806, 100259,  151 }, {  218341,  877, 100027,  730 }, {  219250,  810,  99827,  735 },
+ {  243483,  847,  99739,  827 }, {  376647,  807, 100445, 1353 }, {  501629,  815,  99646, 1982 }, {  511875,  817, 100381, 2036 },
+ {  549131,  807, 100073, 2254 }, {  577709,  835,  99928, 2433 }, {  586566,  813,  99686, 2481 }, {  607660,  861,  99328, 2603 },
+ {  612138,  853,  99206, 2628 }, {  618638,  809,  99079, 2664 }, {  631182,  801, 100013, 2730 }, {  631775,  836, 100352, 2733 },
+ {  642088,  861, 100273, 2799 }, {  647040,  819, 100362, 2826 }, {  664287,  834,  99266, 2923 }, {  671953,  818,  99523, 2976 },
+ {  728843,  813, 100379, 3276 }, {  865845,  824,  99743, 3921 }, {  905271,  851,  99802, 4073 }, { 1132394,  831, 100130, 4918 },
+ { 1228997,  830,  99646, 5272 }, { 1320116,  817,  99079, 5620 }, { 1536904,  857,  99096, 6545 }, { 1555038,  818,  99728, 6617 },
+ { 1577274,  874, 100078, 6727 }, { 1646907,  861,  99268, 7088 }, { 1657930,  814,  99803, 7159 }, { 1662619,  824, 100045, 7182 },
+ { 1749663,  801, 100106, 7643 }, { 1753071,  845,  99900, 7658 }, { 1790621,  816,  99603, 7825 }, { 1870152,  838, 100120, 8184 },
+ { 2011785,  828, 100184, 8756 }, {  242852,  849, 101420,  826 }, {  477114,  807, 101036, 1823 }, {  592773,  808, 100511, 2509 },
+ {  611167,  826, 101367, 2623 }, {  648561,  805, 101920, 2839 }, {  723668,  860, 100955, 3255 }, {  735923,  801, 100555, 3316 },
+ {  764470,  811, 100733, 3473 }, {  771502,  847, 100559, 3507 }, {  979511,  840, 101580, 4348 }, { 1049608,  828, 101708, 4588 },
+ { 1290595,  840, 100745, 5504 }, { 1292120,  806, 100961, 5513 }, { 1419189,  841, 100645, 6051 }, { 1422830,  861, 100931, 6066 },
+ { 1494507,  830, 101311, 6350 }, { 1583335,  828, 101135, 6762 }, { 1638854,  836, 100491, 7038 }, { 1678401,  841, 101447, 7276 },
+ { 1705247,  813, 100943, 7410 }, { 1920540,  812, 100755, 8378 }, { 1938468,  809, 100827, 8457 }, { 2055940,  829, 101027, 8932 },
+ {    4311,  825, 102012, 9095 }, {   24333,  847, 102252,   61 }, {   41290,  843, 102433,  108 }, {  223798,  821, 101948,  745 },
+ {  354494,  846, 102155, 1258 }, {  354787,  901, 102175, 1259 }, {  356346,  813, 102501, 1267 }, {  357941,  834, 102691, 1274 },
+ {  376125,  800, 102987, 1345 }, {  501675,  834, 102129, 1980 }, {  572993,  840, 103290, 2403 }, {  611866,  831, 102176, 2625 },
+ {  684128,  856, 102246, 3048 }, {  711758,  836, 102474, 3190 }, {  739181,  856, 103174, 3335 }, {  741122,  867, 103329, 3345 },
+ {  898222,  857, 102922, 4040 }, {  954194,  844, 102913, 4261 }, { 1007497,  824, 103076, 4440 }, { 1022447,  822, 102373, 4506 },
+ { 1100971,  820, 102713, 4797 }, { 1274086,  850, 102585, 5438 }, { 1355292,  822, 103006, 5749 }, { 1356920,  822, 102185, 5756 },
+ { 1425959,  829, 102262, 6076 }, { 1457193,  826, 102540, 6190 }, { 1492408,  830, 102665, 6340 }, { 1572866,  821, 102439, 6704 },
+ { 1624354,  848, 103169, 6969 }, { 1848916,  825, 102755, 8091 }, {   25549,  845, 103476,   66 }, {  120162,  835, 103520,  394 },
+ {  322398,  859, 104253, 1128 }, {  400510,  813, 104742, 1461 }, {  515487,  869, 104331, 2060 }, {  558939,  860, 104545, 2306 },
+ {  639388,  809, 103809, 2785 }, {  647853,  824, 103419, 2831 }, {  684626,  812, 104164, 3051 }, {  705883,  813, 104462, 3168 },
+ {  755370,  833, 104474, 3425 }, {  785944,  818, 103704, 3584 }, {  838222,  831, 104251, 3822 }, {  892207,  844, 103625, 4005 },
+ {  906167,  813, 104664, 4076 }, { 1097179,  826, 104555, 4778 }, { 1109481,  803, 104506, 4827 }, { 1167267,  821, 104113, 5033 },
+ { 1209613,  853, 104708, 5202 }, { 1260471,  861, 104813, 5397 }, { 1330119,  808, 104344, 5656 }, { 1415544,  830, 104056, 6026 },
+ { 1481211,  827, 104188, 6294 }, { 1515440,  852, 103886, 6441 }, { 1589243,  836, 104628, 6798 }, { 1619305,  868, 103583, 6947 },
+ { 1635371,  835, 103815, 7023 }, { 1639886,  842, 104284, 7045 }, { 1645087,  875, 103608, 7077 }, { 1664706,  805, 103758, 7203 },
+ { 1664785,  837, 103552, 7205 }, { 1674520,  813, 104572, 7265 }, { 1691729,  826, 103742, 7339 }, { 1834428,  825, 103453, 8033 },
+ { 1878689,  857, 103616, 8222 }, { 1897959,  822, 104305, 8293 }, {  208205,  822, 105374,  697 }, {  339647,  822, 105490, 1206 },
+ {  465002,  836, 105615, 1753 }, {  465022,  854, 105600, 1754 }, {  537888,  835, 105041, 2182 }, {  602001,  814, 106217, 2566 },
+ {  626458,  823, 105856, 2705 }, {  668640,  872, 105847, 2947 }, {  925730,  849, 105687, 4152 }, {  979409,  813, 105586, 4347 },
+ { 1105000,  800, 105222, 4809 }, { 1155541,  828, 106062, 4990 }, { 1182629,  801, 105919, 5094 }, { 1248189,  822, 105710, 5344 },
+ { 1341151,  817, 105089, 5701 }, { 1412548,  847, 105354, 6012 }, { 1419439,  832, 105637, 6053 }, { 1488182,  826, 106147, 6321 },
+ { 1521336,  821, 105507, 6473 }, { 1566917,  852, 106026, 6679 }, { 1595457,  807, 105821, 6825 }, { 1598314,  854, 105532, 6841 },
+ { 1600129,  884, 105760, 6848 }, { 1643869,  847, 105733, 7072 }, { 1659440,  837, 105683, 7164 }, { 1670646,  829, 105932, 7241 },
+ { 1713307,  811, 106100, 7439 }, { 1791136,  874, 105712, 7829 }, { 1819486,  821, 104910, 7964 }, { 1910297,  816, 105765, 8346 },
+ { 2044913,  819, 105859, 8900 }, {   10636,  819, 106877,   10 }, {   12462,  806, 107155,   18 }, {  187523,  810, 107449,  625 },
+ {  461376,  856, 106520, 1731 }, {  494100,  838, 107551, 1944 }, {  498421,  815, 107086, 1965 }, {  542888,  852, 107425, 2213 },
+ {  736416,  844, 106954, 3317 }, {  904586,  851, 107748, 4068 }, { 1331927,  817, 107433, 5662 }, { 1514447,  802, 107416, 6435 },
+ { 1574881,  828, 106542, 6715 }, { 1613557,  820, 107479, 6919 }, { 1846285,  817, 106977, 8083 }, { 1857014,  804, 106816, 8122 },
+ { 1861603,  905, 106987, 8139 }, { 1925591,  828, 107630, 8394 }, { 2017363,  814, 106429, 8783 }, {   58949,  849, 108523,  172 },
+ {   66548,  847, 108388,  206 }, {  278572,  826, 107807,  957 }, {  355562,  839, 108628, 1263 }, {  497624,  821, 108827, 1962 },
+ {  505540,  817, 108117, 2000 }, {  580489,  803, 109043, 2448 }, {  625582,  803, 108112, 2699 }, {  681215,  843, 107791, 3027 },
+ {  724370,  816, 108185, 3257 }, {  862153,  808, 108549, 3908 }, {  926648,  803, 108272, 4156 }, { 1009609,  805, 108179, 4451 },
+ { 1019216,  819, 108674, 4491 }, { 1073414,  805, 108780, 4670 }, { 1089096,  835, 108691, 4742 }, { 1230960,  856, 108259, 5284 },
+ { 1479701,  837, 108944, 6284 }, { 1512163,  843, 108225, 6428 }, { 1670253,  803, 108104, 7239 }, { 1719553,  820, 108197, 7476 },
+ { 1799381,  819, 108536, 7865 }, { 1908144,  838, 109000, 8340 }, { 1925948,  837, 109175, 8396 }, { 1961085,  857, 108850, 8544 },
+ { 1961089,  835, 108852, 8545 }, {  123300,  814, 110188,  405 }, {  320675,  833, 109557, 1120 }, {  551687,  806, 109263, 2268 },
+ {  558901,  824, 109331, 2303 }, {  681052,  834, 110670, 3026 }, {  746462,  838, 109269, 3374 }, {  808881,  835, 109263, 3675 },
+ {  816906,  833, 110126, 3714 }, {  886326,  827, 110118, 3986 }, {  943184,  867, 109608, 4218 }, {  951799,  838, 109876, 4252 },
+ {  962583,  834, 110381, 4297 }, { 1034486,  813, 110485, 4539 }, { 1129969,  817, 109703, 4911 }, { 1202346,  819, 110344, 5170 },
+ { 1290277,  833, 109896, 5503 }, { 1341337,  830, 110025, 5703 }, { 1373947,  831, 109290, 5847 }, { 1470137,  810, 110199, 6240 },
+ { 1662515,  832, 109638, 7186 }, { 1687918,  806, 110008, 7317 }, { 1789463,  841, 110307, 7819 }, { 1792878,  812, 109309, 7837 },
+ { 2073596,  836, 109641, 8992 }, { 2081899,  824, 110481, 9021 }, { 2094754,  826, 110461, 9065 }, {    3090,  910, 111668, 9090 },
+ {   43494,  814, 111942,  115 }, {   52502,  845, 112101,  150 }, {  433625,  815, 111020, 1595 }, {  436336,  971, 111857, 1607 },
+ {  442538,  841, 111221, 1640 }, {  457293,  821, 111567, 1710 }, {  528021,  820, 111407, 2136 }, {  654436,  805, 112138, 2868 },
+ {  660266,  821, 111176, 2897 }, {  666499,  853, 111325, 2932 }, {  677902,  889, 111682, 3009 }, {  677912,  807, 111689, 3010 },
+ { 1019233,  821, 111365, 4490 }, { 1229819,  828, 112098, 5277 }, { 1385926,  819, 110878, 5896 }, { 1392625,  837, 111265, 5927 },
+ { 1393087,  813, 111891, 5930 }, { 1408379,  832, 110786, 5996 }, { 1421197,  809, 111920, 6061 }, { 1468662,  803, 112007, 6235 },
+ { 1483579,  859, 111950, 6302 }, { 1619972,  837, 111621, 6956 }, { 1628317,  847, 110690, 6989 }, { 1633606,  842, 111505, 7014 },
+ { 1698708,  870, 111486, 7379 }, { 1737588,  848, 111561, 7571 }, { 1777885,  810, 111826, 7775 }, { 1833112,  801, 111386, 8024 },
+ { 1852030,  848, 111371, 8102 }, { 1940492,  803, 110965, 8462 }, { 1966502,  837, 111536, 8567 }, { 2024082,  842, 111427, 8816 },
+ {  393451,  824, 113002, 1431 }, {  395301,  821, 113079, 1438 }, {  421911,  826, 113260, 1545 }, {  446536,  805, 112317, 1661 },
+ {  468728,  856, 113241, 1769 }, {  568821,  816, 112355, 2373 }, {  683725,  823, 112654, 3042 }, {  732226,  811, 112219, 3289 },
+ {  775526,  813, 112480, 3529 }, {  935740,  824, 113559, 4190 }, {  966450,  834, 112772, 4308 }, { 1092383,  835, 112712, 4758 },
+ { 1108675,  808, 112159, 4821 }, { 1549286,  839, 112880, 6600 }, { 1587024,  839, 113500, 6785 }, { 1730223,  811, 113164, 7532 },
+ { 1797426,  813, 113190, 7855 }, { 1860094,  840, 112546, 8134 }, { 2009181,  807, 112242, 8741 }, {   33297,  839, 113901,   88 },
+ {   63842,  802, 113613,  190 }, {   66233,  815, 114878,  203 }, {  244570,  890, 114267,  832 }, {  251272,  804, 114716,  857 },
+ {  342639,  800, 113740, 1217 }, {  524718,  822, 114906, 2118 }, {  559738,  812, 114997, 2309 }, {  579166,  812, 115030, 2437 },
+ {  621279,  848, 114169, 2679 }, {  679752,  839, 114579, 3019 }, {  686936,  836, 114789, 3063 }, {  888292,  824, 113735, 3988 },
+ {  901892,  800, 114365, 4055 }, {  930378,  804, 114242, 4172 }, { 1036001,  835, 113869, 4547 }, { 1277219,  820, 114040, 5455 },
+ { 1293120,  835, 114819, 5518 }, { 1524855,  821, 114342, 6496 }, { 1712033,  827, 113964, 7433 }, { 1755549,  855, 114565, 7675 },
+ { 1765052,  834, 114167, 7712 }, { 1771482,  832, 114086, 7738 }, { 1907367,  831, 114649, 8337 }, { 1966117,  840, 114928, 8565 },
+ {  117183,  815, 115400,  388 }, {  322190,  849, 116222, 1125 }, {  476345,  835, 116364, 1817 }, {  491006,  811, 116182, 1919 },
+ {  534286,  866, 115305, 2161 }, {  572030,  824, 115294, 2392 }, {  685827,  816, 115239, 3054 }, {  712083,  832, 115547, 3189 },
+ {  760455,  845, 116459, 3446 }, {  766211,  825, 115061, 3480 }, {  814921,  862, 115510, 3702 }, {  897336,  808, 115348, 4034 },
+ {  927980,  852, 116142, 4160 }, {  969302,  809, 115182, 4315 }, { 1127673,  800, 115997, 4901 }, { 1257456,  821, 116092, 5383 },
+ { 1259284,  849, 116027, 5393 }, { 1308132,  860, 115278, 5578 }, { 1477723,  857, 116206, 6278 }, { 1755039,  834, 115925, 7671 },
+ { 1824949,  838, 115887, 7994 }, { 1876123,  861, 115880, 8212 }, { 2035500,  834, 116091, 8856 }, { 2050675,  837, 115707, 8917 },
+ {  127834,  813, 117822,  425 }, {  191321,  801, 116584,  638 }, {  319558,  819, 117145, 1117 }, {  398119,  806, 117653, 1447 },
+ {  496278,  852, 117105, 1957 }, {  506003,  803, 117285, 2001 }, {  549901,  875, 117565, 2255 }, {  617430,  845, 116689, 2656 },
+ {  620158,  849, 117471, 2670 }, {  625269,  821, 117014, 2694 }, {  632743,  803, 116970, 2739 }, {  727088,  832, 116750, 3265 },
+ {  832523,  814, 117313, 3785 }, {  832933,  813, 117048, 3788 }, {  844380,  831, 117339, 3846 }, {  845174,  837, 117629, 3848 },
+ {  886573,  853, 117797, 3985 }, {  926664,  857, 117358, 4155 }, { 1031670,  826, 116965, 4529 }, { 1070679,  811, 116964, 4657 },
+ { 1123406,  841, 117001, 4877 }, { 1236460,  847, 116995, 5298 }, { 1481747,  819, 117911, 6296 }, { 1515889,  846, 117522, 6449 },
+ { 1562757,  818, 117819, 6666 }, { 1606414,  833, 116827, 6878 }, { 1731660,  804, 117777, 7541 }, { 1760037,  818, 116600, 7694 },
+ { 1855802,  877, 117390, 8118 }, { 1892488,  808, 117349, 8273 }, { 1913069,  859, 116962, 8355 }, { 1968539,  838, 117827, 8583 },
+ { 1993027,  819, 117318, 8676 }, { 2031135,  812, 117511, 8836 }, {   95556,  812, 119391,  315 }, {  135526,  859, 117986,  444 },
+ {  142182,  824, 118553,  466 }, {  197295,  855, 118643,  658 }, {  251719,  832, 118607,  859 }, {  260382,  814, 119096,  895 },
+ {  286313,  814, 118190,  988 }, {  312568,  825, 119230, 1091 }, {  344620,  819, 119058, 1225 }, {  400837,  837, 119038, 1460 },
+ {  494452,  850, 118994, 1942 }, {  522856,  812, 118521, 2107 }, {  546764,  810, 118016, 2237 }, {  558658,  819, 119238, 2301 },
+ {  612623,  849, 118261, 2627 }, {  708456,  823, 118322, 3174 }, {  741064,  800, 119055, 3342 }, {  758800,  863, 118040, 3437 },
+ {  819707,  853, 119187, 3724 }, {  826108,  854, 118290, 3744 }, {  841567,  840, 118583, 3832 }, {  879177,  812, 118801, 3959 },
+ {  902926,  832, 118051, 4060 }, { 1149414,  832, 118749, 4959 }, { 1204734,  805, 118998, 5178 }, { 1455848,  835, 118772, 6189 },
+ { 1598209,  831, 119070, 6843 }, { 1650097,  834, 118804, 7110 }, { 1781142,  830, 118918, 7788 }, { 1850710,  827, 118480, 8096 },
+ { 1902396,  800, 118366, 8318 }, { 2052020,  818, 118352, 8921 }, {   27229,  846, 119498,   72 }, {   79070,  816, 120500,  255 },
+ {  102236,  840, 120741,  346 }, {  122394,  821, 119432,  401 }, {  358178,  826, 120668, 1272 }, {  412989,  882, 120577, 1505 },
+ {  413000,  870, 120581, 1506 }, {  456648,  837, 119636, 1704 }, {  552150,  822, 120275, 2270 }, {  598133,  829, 119481, 2534 },
+ {  607303,  834, 119682, 2599 }, {  642663,  855, 120700, 2798 }, {  643758,  843, 120847, 2806 }, {  664501,  827, 119875, 2920 },
+ {  670785,  801, 119692, 2958 }, {  740307,  843, 120610, 3338 }, {  834542,  812, 120157, 3801 }, { 1216013,  819, 119507, 5233 },
+ { 1367033,  850, 120578, 5815 }, { 1367035,  848, 120573, 5816 }, { 1440066,  848, 119609, 6137 }, { 1526317,  837, 119725, 6504 },
+ { 1692788,  831, 119714, 7347 }, { 1739814,  849, 119767, 7594 }, { 1763892,  849, 120648, 7709 }, { 1985098,  845, 119875, 8645 },
+ {  296072,  820, 122034, 1024 }, {  481100,  833, 121511, 1840 }, {  562124,  840, 122180, 2321 }, {  563243,  827, 121622, 2328 },
+ {  779866,  891, 122291, 3552 }, {  779869,  867, 122292, 3553 }, {  804539,  811, 121037, 3655 }, {  834980,  824, 121154, 3805 },
+ {  890266,  825, 121339, 4000 }, {  918929,  820, 121806, 4122 }, {  985909,  814, 121074, 4369 }, { 1052741,  822, 121873, 4598 },
+ { 1184034,  868, 121162, 5101 }, { 1249568,  847, 121668, 5353 }, { 1442518,  850, 121628, 6144 }, { 1549247,  830, 120993, 6601 },
+ { 1608838,  831, 120987, 6892 }, { 1634907,  815, 120984, 7024 }, { 1646167,  880, 122199, 7089 }, { 1693853,  832, 121460, 7353 },
+ { 1703002,  861, 120941, 7402 }, { 1711941,  834, 121548, 7432 }, { 1753481,  872, 121562, 7661 }, { 1978270,  823, 122185, 8612 },
+ { 2001860,  819, 121176, 8710 }, { 2011800,  821, 120966, 8757 }, { 2061522,  839, 121554, 8951 }, {  265283,  819, 123054,  913 },
+ {  379592,  827, 122692, 1362 }, {  399386,  809, 123554, 1450 }, {  482561,  822, 123365, 1848 }, {  499380,  802, 123493, 1967 },
+ {  540339,  815, 123432, 2195 }, {  637197,  829, 123324, 2765 }, {  702594,  833, 122825, 3150 }, {  731823,  815, 122595, 3285 },
+ {  738790,  859, 122931, 3325 }, {  754885,  851, 123299, 3416 }, {  769075,  809, 123147, 3493 }, {  861230,  842, 122598, 3901 },
+ { 1025155,  807, 123320, 4510 }, { 1117836,  826, 122774, 4856 }, { 1180272,  809, 123019, 5088 }, { 1247162,  844, 123240, 5341 },
+ { 1263253,  817, 122509, 5406 }, { 1378814,  824, 122509, 5866 }, { 1406463,  853, 122759, 5989 }, { 1406835,  841, 122537, 5990 },
+ { 1453482,  809, 123118, 6179 }, { 1509823,  809, 122691, 6413 }, { 1562155,  821, 122543, 6661 }, { 1636735,  831, 123526, 7034 },
+ { 1740821,  851, 123403, 7599 }, { 1777387,  863, 122861, 7772 }, { 1826231,  844, 123630, 7998 }, { 1967983,  814, 123142, 8581 },
+ { 1985360,  841, 123736, 8647 }, { 2013474,  815, 123170, 8763 }, { 2054945,  839, 122754, 8928 }, { 2080465,  807, 122888, 9014 },
+ {  285467,  817, 125128,  983 }, {  438096,  822, 124887, 1614 }, {  466675,  839, 124324, 1759 }, {  474830,  823, 124545, 1806 },
+ {  488265,  873, 124354, 1893 }, {  488270,  996, 124351, 1894 }, {  488299,  870, 124355, 1896 }, {  489700,  854, 124734, 1906 },
+ {  491457,  805, 125157, 1918 }, {  538274,  817, 124826, 2179 }, {  600574,  830, 124251, 2552 }, {  603137,  841, 125032, 2570 },
+ {  612106,  830, 124325, 2622 }, {  656600,  824, 124120, 2876 }, {  728593,  813, 124270, 3272 }, {  778128,  800, 124423, 3538 },
+ {  902266,  837, 123944, 4059 }, { 1094663,  819, 123867, 4772 }, { 1199898,  851, 124517, 5163 }, { 1229518,  839, 124346, 5276 },
+ { 1244245,  836, 125170, 5322 }, { 1332340,  828, 124522, 5669 }, { 1360741,  851, 124802, 5779 }, { 1514598,  832, 125126, 6439 },
+ { 1528868,  837, 125130, 6512 }, { 1576900,  876, 124312, 6732 }, { 1616902,  828, 124845, 6940 }, { 1621479,  836, 125118, 6963 },
+ { 1666658,  890, 124788, 7220 }, { 1840945,  931, 124989, 8058 }, { 1904382,  817, 125126, 8332 }, { 1919799,  833, 124409, 8376 },
+ { 2039890,  817, 125113, 8879 }, {   66121,  815, 126163,  201 }, {  151335,  819, 126362,  507 }, {  203424,  850, 125750,  684 },
+ {  488408,  856, 125965, 1890 }, {  488426,  824, 125866, 1891 }, {  488634,  838, 125778, 1898 }, {  492088,  819, 126431, 1923 },
+ {  503967,  834, 125637, 1986 }, {  516392,  857, 125340, 2058 }, {  517865,  828, 126395, 2071 }, {  541369,  818, 126216, 2202 },
+ {  558335,  867, 126247, 2295 }, {  562990,  815, 126116, 2325 }, {  649620,  876, 126029, 2838 }, {  734887,  801, 126291, 3295 },
+ {  753594,  819, 126606, 3411 }, {  829453,  826, 125607, 3762 }, {  861046,  801, 125601, 3899 }, {  945595,  861, 125282, 4229 },
+ { 1089150,  822, 126143, 4746 }, { 1126688,  844, 125573, 4896 }, { 1309089,  809, 126687, 5583 }, { 1416949,  825, 125568, 6041 },
+ { 1592039,  859, 125264, 6813 }, { 1696693,  852, 126534, 7366 }, { 1756661,  847, 125361, 7681 }, { 1835828,  821, 126310, 8041 },
+ { 1920812,  822, 125790, 8382 }, { 1937773,  801, 125636, 8453 }, { 1940929,  839, 126296, 8467 }, { 2005819,  831, 126426, 8727 },
+ { 2015530,  868, 126405, 8772 }, { 2052784,  825, 126023, 8924 }, { 2055682,  849, 125374, 8931 }, {  117346,  823, 127063,  387 },
+ {  235646,  805, 127014,  795 }, {  278620,  805, 127885,  955 }, {  319872,  823, 127275, 1116 }, {  401993,  833, 127594, 1462 },
+ {  444055,  805, 126761, 1646 }, {  479061,  839, 127151, 1826 }, {  488748,  840, 127071, 1900 }, {  494462,  800, 127525, 1940 },
+ {  561840,  835, 127998, 2317 }, {  915659,  805, 127784, 4109 }, { 1057310,  837, 126895, 4613 }, { 1075011,  899, 128093, 4677 },
+ { 1075023,  854, 128084, 4678 }, { 1126035,  811, 127508, 4891 }, { 1141647,  859, 127669, 4937 }, { 1223079,  840, 127503, 5258 },
+ { 1247371,  815, 126989, 5342 }, { 1314723,  861, 126749, 5599 }, { 1422745,  818, 128091, 6067 }, { 1498457,  836, 127989, 6372 },
+ { 1596117,  836, 127602, 6830 }, { 1597455,  800, 126713, 6840 }, { 1607902,  838, 127552, 6890 }, { 1628781,  849, 126985, 6999 },
+ { 1647675,  810, 127166, 7101 }, { 1789009,  813, 127224, 7821 }, { 1829627,  857, 127521, 8014 }, { 1871215,  836, 127283, 8192 },
+ { 1914523,  820, 127141, 8363 }, { 1937465,  827, 128005, 8451 }, { 1981809,  831, 127510, 8629 }, {   11265,  843, 128959,   11 },
+ {   11944,  807, 128811,   14 }, {   35674,  807, 128479,   94 }, {  123516,  815, 129395,  406 }, {  211133,  833, 129295,  704 },
+ {  263382,  811, 129439,  904 }, {  341210,  814, 129547, 1211 }, {  417103,  833, 129549, 1522 }, {  434256,  835, 128469, 1596 },
+ {  437873,  832, 128255, 1613 }, {  452878,  825, 128529, 1685 }, {  493392,  865, 129025, 1932 }, {  496066,  822, 129361, 1950 },
+ {  497595,  842, 129464, 1959 }, {  542842,  862, 128894, 2210 }, {  580127,  814, 128951, 2440 }, {  604358,  804, 129330, 2582 },
+ {  644158,  823, 129585, 2807 }, {  700121,  851, 129443, 3135 }, {  740538,  839, 128913, 3337 }, {  765092,  841, 129034, 3472 },
+ {  829261,  814, 128458, 3760 }, {  951604,  812, 128531, 4249 }, { 1017121,  822, 128794, 4484 }, { 1340990,  835, 128761, 5706 },
+ { 1431085,  823, 128275, 6096 }, { 1471460,  832, 129112, 6248 }, { 1518768,  829, 128725, 6465 }, { 1544023,  819, 128381, 6578 },
+ { 1727048,  848, 129446, 7516 }, { 1734789,  813, 128830, 7559 }, { 1785067,  811, 129325, 7809 }, { 1804745,  822, 128760, 7890 },
+ { 1816163,  827, 128868, 7946 }, { 1967983,  816, 129486, 8580 }, { 2007234,  816, 128735, 8734 }, {  320386,  812, 129791, 1119 },
+ {  369385,  844, 129834, 1312 }, {  407469,  810, 129693, 1488 }, {  432955,  823, 129714, 1591 }, {  459199,  815, 130212, 1717 },
+ {  465432,  834, 130216, 1748 }, {  485141,  846, 130662, 1863 }, {  486517,  822, 129667, 1873 }, {  499755,  831, 130509, 1970 },
+ {  523747,  863, 130263, 2109 }, {  603953,  821, 130717, 2577 }, {  614410,  817, 130119, 2636 }, {  730125,  850, 130493, 3278 },
+ {  824838,  801, 130291, 3741 }, {  828720,  827, 129990, 3758 }, {  934111,  826, 130696, 4182 }, { 1001820,  825, 130635, 4419 },
+ { 1050076,  831, 130734, 4591 }, { 1159878,  868, 130184, 5005 }, { 1178553,  843, 130146, 5078 }, { 1289159,  807, 130224, 5496 },
+ { 1345277,  812, 129648, 5721 }, { 1458091,  824, 129617, 6201 }, { 1477002,  825, 130507, 6277 }, { 1495505,  838, 130572, 6361 },
+ { 1497464,  806, 129731, 6367 }, { 1523297,  844, 130565, 6489 }, { 1561201,  835, 129960, 6659 }, { 1609200,  815, 130459, 6898 },
+ { 1628669,  866, 129781, 7000 }, { 1654971,  822, 130781, 7143 }, { 1667979,  853, 130362, 7231 }, { 1776348,  806, 129730, 7768 },
+ { 1827923,  855, 130159, 8006 }, { 1859271,  848, 130501, 8132 }, { 1946507,  815, 130484, 8495 }, { 2007433,  837, 130213, 8735 },
+ { 2056316,  838, 129741, 8934 }, {    7374,  829, 131805,    2 }, {   38773,  819, 131144,  101 }, {  120266,  849, 131727,  393 },
+ {  125910,  841, 131653,  416 }, {  184212,  828, 131123,  616 }, {  219550,  800, 131444,  732 }, {  451548,  810, 131895, 1681 },
+ {  453931,  867, 131822, 1690 }, {  456985,  832, 131888, 1703 }, {  471651,  811, 132335, 1782 }, {  474073,  857, 131865, 1800 },
+ {  474456,  816, 131830, 1803 }, {  483522,  885, 131486, 1851 }, {  516621,  800, 132482, 2057 }, {  521659,  822, 132520, 2097 },
+ {  563578,  871, 132297, 2327 }, {  633983,  841, 131307, 2744 }, {  674424,  819, 131348, 2982 }, {  707537,  841, 131907, 3172 },
+ {  728496,  818, 132396, 3271 }, {  862454,  835, 131182, 3907 }, {  950420,  831, 131365, 4245 }, {  965918,  814, 132168, 4303 },
+ {  995128,  805, 131264, 4394 }, { 1032585,  815, 131536, 4533 }, { 1039602,  830, 131876, 4555 }, { 1047202,  817, 131845, 4580 },
+ { 1161441,  837, 132058, 5014 }, { 1252002,  819, 131632, 5368 }, { 1294557,  814, 132307, 5522 }, { 1297615,  818, 131447, 5536 },
+ { 1363967,  851, 131890, 5799 }, { 1377220,  833, 132370, 5861 }, { 1493175,  801, 132095, 6349 }, { 1504280,  865, 131584, 6394 },
+ { 1573240,  837, 131989, 6709 }, { 1581782,  834, 131723, 6757 }, { 1645126,  825, 132289, 7085 }, { 1670661,  856, 132007, 7245 },
+ { 1674605,  834, 131695, 7269 }, { 1687695,  841, 131566, 7321 }, { 1702917,  825, 131430, 7404 }, { 1765958,  827, 132335, 7717 },
+ { 1801956,  822, 131213, 7878 }, { 1830896,  805, 131747, 8017 }, { 1839367,  850, 132419, 8054 }, { 1856295,  838, 131206, 8121 },
+ { 1872667,  846, 131850, 8203 }, { 1889713,  825, 131640, 8263 }, { 1948708,  839, 131418, 8507 }, { 2010690,  821, 131343, 8750 },
+ { 2044041,  831, 131496, 8897 }, {   25916,  817, 133532,   67 }, {   92940,  804, 133062,  301 }, {  120319,  820, 133586,  392 },
+ {  168787,  801, 133766,  560 }, {  215541,  845, 133928,  719 }, {  268894,  805, 133786,  926 }, {  390391,  815, 133779, 1413 },
+ {  428067,  861, 133358, 1565 }, {  439819,  824, 133415, 1619 }, {  444763,  817, 132787, 1648 }, {  456606,  809, 133938, 1701 },
+ {  461206,  842, 133908, 1724 }, {  477724,  841, 132963, 1820 }, {  486364,  859, 133122, 1871 }, {  521234,  822, 132855, 2093 },
+ {  527616,  859, 133540, 2127 }, {  547444,  837, 132775, 2236 }, {  548104,  863, 132645, 2246 }, {  561144,  866, 133258, 2312 },
+ {  565474,  848, 133857, 2347 }, {  580554,  821, 133422, 2442 }, {  595739,  815, 132531, 2517 }, {  617985,  857, 133239, 2654 },
+ {  695075,  835, 132713, 3098 }, {  783718,  859, 133317, 3573 }, {  796624,  817, 133202, 3618 }, {  834040,  811, 133787, 3794 },
+ {  949876,  838, 132565, 4244 }, { 1240116,  843, 133056, 5307 }, { 1257206,  827, 132880, 5384 }, { 1361804,  856, 133503, 5791 },
+ { 1464358,  803, 132558, 6224 }, { 1557303,  847, 133928, 6639 }, { 1579595,  814, 133867, 6747 }, { 1597738,  863, 132537, 6844 },
+ { 1746721,  817, 133079, 7636 }, { 1783490,  815, 132628, 7803 }, { 1839450,  825, 133303, 8056 }, { 1873555,  813, 132679, 8205 },
+ { 2002477,  811, 132623, 8715 }, { 2017479,  839, 132975, 8785 }, { 2049452,  825, 132707, 8912 }, {  388864,  823, 134100, 1400 },
+ {  472738,  832, 134499, 1786 }, {  555498,  831, 134376, 2280 }, {  561828,  851, 134381, 2315 }, {  566884,  816, 134926, 2355 },
+ {  579151,  817, 135010, 2430 }, {  662302,  855, 135041, 2904 }, {  675928,  847, 134575, 2989 }, {  750627,  833, 135068, 3392 },
+ {  862458,  802, 134646, 3906 }, {  904445,  866, 134407, 4064 }, {  909084,  832, 134521, 4085 }, {  939578,  828, 134696, 4201 },
+ { 1166094,  826, 135356, 5031 }, { 1230075,  828, 134418, 5283 }, { 1437183,  807, 134491, 6124 }, { 1466788,  810, 134079, 6232 },
+ { 1509129,  817, 134256, 6412 }, { 1542487,  826, 134026, 6575 }, { 1550388,  817, 134829, 6609 }, { 1550422,  856, 134828, 6610 },
+ { 1596301,  801, 134535, 6834 }, { 1655041,  815, 134671, 7144 }, { 1686173,  819, 134031, 7313 }, { 1704191,  809, 135302, 7412 },
+ { 1711830,  838, 135315, 7438 }, { 1788812,  821, 135349, 7824 }, { 1841845,  842, 135356, 8067 }, { 1841936,  833, 134377, 8068 },
+ { 1849530,  845, 135358, 8095 }, { 2080872,  846, 134297, 9015 }, { 2087074,  828, 134117, 9042 }, {   54626,  839, 135638,  161 },
+ {   74719,  837, 136002,  243 }, {  126545,  858, 136221,  419 }, {  231000,  821, 136086,  775 }, {  420513,  803, 136298, 1534 },
+ {  437698,  903, 136337, 1609 }, {  437729,  866, 136338, 1610 }, {  515931,  831, 135769, 2051 }, {  558233,  840, 136554, 2292 },
+ {  587069,  819, 135490, 2474 }, {  599516,  838, 135502, 2543 }, {  685638,  818, 135845, 3050 }, {  687575,  831, 135845, 3061 },
+ {  727933,  805, 136821, 3269 }, {  804222,  814, 136704, 3651 }, {  873403,  870, 136001, 3945 }, {  879843,  845, 135734, 3961 },
+ {  998817,  837, 136694, 4410 }, { 1000160,  850, 135460, 4414 }, { 1104024,  833, 135852, 4805 }, { 1118273,  841, 136275, 4858 },
+ { 1123746,  802, 135524, 4878 }, { 1163412,  862, 136443, 5021 }, { 1245014,  845, 135931, 5331 }, { 1555878,  822, 136612, 6633 },
+ { 1613407,  807, 136531, 6925 }, { 1619638,  843, 136402, 6958 }, { 1666330,  873, 135923, 7219 }, { 1704739,  805, 136088, 7415 },
+ { 1716776,  835, 135997, 7471 }, { 1817236,  840, 135888, 7954 }, { 2006198,  828, 136621, 8730 }, {   95857,  835, 138220,  313 },
+ {   95911,  925, 138222,  314 }, {  240806,  803, 137934,  816 }, {  257887,  811, 137627,  877 }, {  296589,  838, 138182, 1023 },
+ {  467958,  857, 136915, 1761 }, {  481078,  821, 137195, 1837 }, {  502489,  809, 136909, 1978 }, {  547274,  864, 137310, 2232 },
+ {  558913,  872, 137765, 2299 }, {  576717,  855, 137622, 2413 }, {  579452,  815, 138291, 2432 }, {  580831,  857, 137918, 2441 },
+ {  614131,  863, 138089, 2629 }, {  622019,  811, 138223, 2676 }, {  683004,  853, 137382, 3033 }, {  693805,  817, 137605, 3093 },
+ {  763123,  837, 137385, 3458 }, {  781502,  814, 137242, 3557 }, {  859980,  824, 137398, 3893 }, { 1229062,  824, 138209, 5275 },
+ { 1268131,  802, 138022, 5424 }, { 1403580,  808, 138334, 5976 }, { 1457208,  893, 137199, 6194 }, { 1616679,  869, 136993, 6941 },
+ { 1642835,  821, 137249, 7076 }, { 1737981,  853, 137481, 7580 }, { 1828714,  805, 137673, 8010 }, {   94484,  800, 139310,  307 },
+ {  264870,  825, 138843,  908 }, {  396245,  839, 138951, 1436 }, {  431042,  850, 138935, 1578 }, {  471158,  835, 138823, 1777 },
+ {  614461,  859, 139166, 2633 }, {  628935,  809, 139307, 2710 }, {  629325,  816, 139045, 2713 }, {  670094,  802, 138690, 2950 },
+ {  764618,  813, 139345, 3469 }, {  775368,  833, 138849, 3526 }, {  788650,  807, 139287, 3590 }, {  803802,  835, 139036, 3649 },
+ {  883702,  821, 139244, 3973 }, {  907664,  854, 139365, 4079 }, { 1081392,  840, 138799, 4708 }, { 1117081,  834, 139738, 4854 },
+ { 1209375,  801, 139078, 5205 }, { 1316701,  850, 139071, 5610 }, { 1321893,  816, 139079, 5631 }, { 1418818,  831, 139667, 6057 },
+ { 1604139,  813, 138988, 6873 }, { 1609487,  874, 138477, 6900 }, { 1630558,  838, 138739, 7008 }, { 1680248,  849, 139105, 7288 },
+ { 1820422,  821, 139147, 7975 }, {   87131,  811, 140514,  284 }, {  108800,  803, 141260,  367 }, {  233398,  825, 139973,  783 },
+ {  312854,  849, 140419, 1089 }, {  345198,  809, 139868, 1224 }, {  371997,  893, 140101, 1321 }, {  372080,  831, 140082, 1322 },
+ {  475714,  842, 141076, 1807 }, {  547107,  807, 139906, 2231 }, {  578758,  806, 140007, 2422 }, {  583314,  851, 140351, 2454 },
+ {  585438,  837, 140313, 2467 }, {  636860,  865, 140801, 2760 }, {  751269,  925, 140717, 3396 }, {  907319,  807, 140600, 4077 },
+ {  940944,  837, 140353, 4207 }, { 1104646,  908, 141249, 4808 }, { 1179590,  851, 139830, 5087 }, { 1204336,  833, 140321, 5183 },
+ { 1486196,  859, 140660, 6317 }, { 1512979,  851, 139934, 6434 }, { 1568398,  829, 140521, 6690 }, { 1574148,  834, 140201, 6719 },
+ { 1657911,  821, 140160, 7163 }, { 1847343,  815, 141251, 8090 }, { 1889954,  818, 140711, 8265 }, { 1913598,  815, 141069, 8359 },
+ { 1922581,  800, 140855, 8385 }, { 2015621,  841, 140708, 8776 }, {  107413,  830, 142109,  362 }, {  128715,  820, 142667,  426 },
+ {  225835,  818, 141953,  751 }, {  230123,  839, 142279,  770 }, {  549007,  857, 141344, 2248 }, {  574930,  845, 142100, 2404 },
+ {  609703,  827, 142172, 2606 }, {  610701,  835, 141728, 2613 }, {  696279,  841, 141578, 3103 }, { 1094243,  805, 142146, 4770 },
+ { 1179650,  817, 141527, 5086 }, { 1228601,  826, 142062, 5274 }, { 1502599,  833, 142569, 6390 }, { 1523809,  806, 142134, 6497 },
+ { 1630914,  828, 141788, 7010 }, { 1733488,  851, 142581, 7554 }, { 1739867,  815, 141471, 7598 }, { 1820161,  833, 142525, 7974 },
+ { 2007892,  833, 141761, 8738 }, { 2090060,  821, 141370, 9048 }, {    3500,  832, 144116, 9092 }, {   24129,  811, 143072,   59 },
+ {  183800,  831, 143083,  614 }, {  274734,  828, 143408,  942 }, {  369218,  851, 144020, 1308 }, {  387903,  806, 143583, 1397 },
+ {  491260,  812, 144109, 1913 }, {  537085,  855, 143699, 2167 }, {  559296,  826, 144011, 2300 }, {  605228,  829, 143196, 2584 },
+ {  695068,  805, 143657, 3097 }, {  701738,  822, 144054, 3144 }, {  724578,  829, 143984, 3252 }, {  748890,  803, 143381, 3380 },
+ {  756446,  845, 142748, 3424 }, {  871085,  804, 143180, 3938 }, { 1016774,  817, 144011, 4478 }, { 1088919,  837, 143612, 4741 },
+ { 1197432,  816, 143288, 5156 }, { 1257384,  886, 143371, 5385 }, { 1258735,  819, 142847, 5394 }, { 1355755,  857, 143566, 5758 },
+ { 1390341,  829, 143568, 5919 }, { 1406301,  829, 142863, 5992 }, { 1488374,  833, 143379, 6329 }, { 1621489,  842, 143114, 6967 },
+ { 1628715,  840, 143937, 7002 }, { 1663682,  830, 143268, 7208 }, { 1669522,  809, 143058, 7243 }, { 1788587,  825, 143360, 7820 },
+ { 1876388,  840, 143008, 8219 }, { 1945686,  821, 143523, 8491 }, { 1952871,  817, 142995, 8514 }, {  217854,  807, 145003,  725 },
+ {  376334,  854, 144888, 1334 }, {  379842,  853, 144508, 1361 }, {  398752,  801, 144781, 1446 }, {  424853,  811, 145599, 1553 },
+ {  448031,  817, 144866, 1662 }, {  551486,  824, 144248, 2259 }, {  568112,  857, 144222, 2362 }, {  715474,  807, 145375, 3201 },
+ {  745523,  883, 145365, 3361 }, {  754519,  853, 145016, 3412 }, {  783082,  819, 144744, 3567 }, {  914082,  804, 145290, 4101 },
+ { 1227023,  820, 145179, 5270 }, { 1414842,  853, 145217, 6032 }, { 1494456,  837, 145247, 6358 }, { 1687739,  832, 145079, 7325 },
+ { 1693460,  835, 145509, 7354 }, { 1734949,  825, 145097, 7562 }, { 1759042,  843, 144761, 7693 }, { 2007710,  843, 144699, 8737 },
+ {   30450,  856, 147058,   81 }, {   41266,  804, 145912,  107 }, {  236631,  830, 146716,  797 }, {  349057,  837, 146117, 1233 },
+ {  369303,  823, 145945, 1307 }, {  378107,  831, 145812, 1349 }, {  392801,  879, 146395, 1420 }, {  393274,  848, 146018, 1425 },
+ {  515875,  812, 146490, 2048 }, {  543526,  845, 146549, 2208 }, {  565522,  815, 146078, 2342 }, {  579069,  838, 146878, 2426 },
+ {  602021,  824, 147087, 2555 }, {  650212,  837, 146521, 2836 }, {  661309,  828, 146463, 2893 }, {  733887,  808, 146556, 3290 },
+ {  746622,  846, 145732, 3372 }, { 1013220,  856, 146962, 4464 }, { 1096706,  826, 146066, 4777 }, { 1109121,  819, 146257, 4824 },
+ { 1187738,  849, 145934, 5114 }, { 1228492,  830, 146781, 5273 }, { 1494539,  837, 146297, 6359 }, { 1623533,  840, 146934, 6976 },
+ { 1646789,  855, 147058, 7099 }, { 1659214,  875, 145841, 7173 }, { 1730889,  844, 146647, 7542 }, { 1736354,  854, 146147, 7572 },
+ { 1760207,  831, 146693, 7700 }, { 1785103,  833, 145718, 7810 }, { 1791754,  808, 146940, 7836 }, { 1796987,  856, 145723, 7857 },
+ { 1850329,  807, 145707, 8098 }, { 1870558,  835, 145889, 8191 }, { 1896976,  809, 146837, 8292 }, { 1925336,  837, 147054, 8397 },
+ { 1986049,  851, 147003, 8653 }, { 1994535,  854, 146333, 8681 }, {   26632,  805, 147392,   69 }, {  516332,  859, 148202, 2050 },
+ {  529256,  808, 148083, 2133 }, {  554684,  854, 148193, 2276 }, {  566522,  859, 147120, 2351 }, {  569666,  814, 147457, 2370 },
+ {  570386,  865, 148246, 2374 }, {  571457,  803, 148073, 2378 }, {  584416,  811, 147097, 2458 }, {  607924,  827, 148414, 2597 },
+ {  650537,  841, 147105, 2840 }, {  723175,  913, 148150, 3248 }, {  800665,  848, 147914, 3635 }, {  812438,  841, 147822, 3689 },
+ {  855509,  845, 147920, 3880 }, {  855694,  802, 147717, 3882 }, {  960736,  855, 148120, 4281 }, {  987919,  866, 148526, 4378 },
+ { 1010954,  855, 147126, 4454 }, { 1117355,  807, 148487, 4855 }, { 1362989,  807, 147479, 5796 }, { 1436246,  811, 147685, 6121 },
+ { 1529717,  839, 148439, 6521 }, { 1532450,  842, 148447, 6532 }, { 1559356,  817, 148471, 6650 }, { 1564471,  838, 147282, 6676 },
+ { 1569148,  836, 147156, 6696 }, { 1627055,  842, 147706, 6992 }, { 1689202,  802, 147871, 7332 }, { 1712868,  868, 147310, 7445 },
+ { 1736061,  813, 148008, 7569 }, { 1793089,  911, 147471, 7840 }, { 1805682,  842, 147456, 7907 }, { 1975702,  840, 148107, 8605 },
+ { 2005195,  851, 148327, 8724 }, {   96935,  812, 149941,  319 }, {  173935,  809, 148977,  578 }, {  297342,  804, 149465, 1028 },
+ {  301919,  828, 149619, 1039 }, {  369669,  825, 149645, 1310 }, {  557214,  800, 149378, 2287 }, {  591139,  846, 149558, 2489 },
+ {  676089,  843, 149800, 2987 }, {  984443,  867, 149778, 4366 }, { 1035355,  835, 148954, 4543 }, { 1126969,  825, 149158, 4900 },
+ { 1171650,  844, 149177, 5053 }, { 1212135,  804, 148789, 5220 }, { 1343323,  828, 149375, 5717 }, { 1369226,  825, 148626, 5831 },
+ { 1457603,  808, 149124, 6203 }, { 1501158,  857, 149229, 6385 }, { 1581197,  904, 148554, 6758 }, { 1721723,  834, 148830, 7493 },
+ { 1880388,  808, 148749, 8231 }, { 1976389,  830, 149389, 8608 }, {   32659,  823, 150707,   86 }, {   50858,  840, 150545,  141 },
+ {   52300,  841, 150306,  145 }, {   84335,  832, 151018,  276 }, {  278696,  812, 150074,  952 }, {  336801,  830, 150071, 1194 },
+ {  379934,  817, 151263, 1358 }, {  478529,  835, 150993, 1819 }, {  518548,  860, 151352, 2067 }, {  540985,  804, 150935, 2191 },
+ {  671072,  824, 151127, 2953 }, {  683079,  804, 150545, 3030 }, {  698446,  802, 150357, 3115 }, {  711731,  827, 150938, 3184 },
+ {  719949,  838, 150075, 3231 }, {  748205,  828, 150379, 3376 }, {  860754,  846, 150101, 3896 }, {  890761,  844, 150522, 3998 },
+ { 1118828,  856, 150810, 4861 }, { 1323667,  810, 150347, 5639 }, { 1373601,  848, 150977, 5850 }, { 1380948,  800, 151153, 5874 },
+ { 1388200,  810, 150291, 5911 }, { 1453152,  831, 151005, 6181 }, { 1468222,  835, 150865, 6239 }, { 1478589,  834, 150907, 6290 },
+ { 1481890,  837, 151292, 6301 }, { 1491260,  808, 150831, 6342 }, { 1542227,  812, 150484, 6577 }, { 1584233,  863, 150108, 6776 },
+ { 1599149,  830, 151136, 6851 }, { 1648641,  814, 151411, 7109 }, { 1720089,  801, 151192, 7486 }, { 1725153,  826, 150446, 7511 },
+ { 1776006,  821, 150321, 7771 }, {  139480,  822, 152424,  455 }, {  435436,  809, 152251, 1600 }, {  549855,  859, 151546, 2250 },
+ {  550638,  816, 152018, 2253 }, {  561379,  824, 152512, 2308 }, {  715041,  823, 152378, 3198 }, {  717063,  854, 151467, 3214 },
+ {  804335,  851, 152912, 3650 }, {  838688,  836, 152014, 3818 }, {  905618,  812, 152882, 4070 }, {  978275,  830, 152044, 4341 },
+ { 1007432,  820, 151992, 4437 }, { 1191490,  852, 151900, 5129 }, { 1217270,  816, 151543, 5243 }, { 1221394,  800, 152407, 5254 },
+ { 1473951,  852, 152880, 6268 }, { 1487740,  831, 152844, 6326 }, { 1490104,  852, 152205, 6339 }, { 1534581,  848, 152687, 6543 },
+ { 1548640,  824, 151891, 6604 }, { 1549982,  819, 152059, 6611 }, { 1585333,  837, 151876, 6784 }, { 1610617,  837, 152869, 6906 },
+ { 1693941,  864, 152802, 7357 }, { 1700390,  832, 151872, 7396 }, { 1713057,  838, 152031, 7449 }, { 1777251,  813, 152290, 7778 },
+ { 1780936,  817, 152264, 7793 }, { 1839421,  831, 152524, 8057 }, { 1937492,  833, 152378, 8456 }, {  102224,  806, 153899,  344 },
+ {  222679,  804, 152968,  741 }, {  268957,  849, 154164,  924 }, {  317190,  839, 153545, 1102 }, {  360739,  801, 153154, 1279 },
+ {  372494,  832, 153501, 1319 }, {  386840,  846, 154287, 1391 }, {  395929,  802, 154158, 1432 }, {  421957,  808, 154234, 1537 },
+ {  476563,  816, 153293, 1809 }, {  505004,  800, 154115, 1985 }, {  570343,  840, 154233, 2371 }, {  640964,  845, 153125, 2780 },
+ {  647294,  841, 153671, 2817 }, {  653595,  822, 153077, 2858 }, {  751666,  832, 153374, 3394 }, {  773361,  838, 153428, 3510 },
+ {  817389,  853, 153458, 3711 }, {  882088,  837, 154021, 3969 }, { 1074409,  834, 153127, 4676 }, { 1301091,  840, 153943, 5550 },
+ { 1451574,  830, 153643, 6176 }, { 1521255,  835, 153800, 6482 }, { 1545460,  834, 153177, 6589 }, { 1561177,  846, 153392, 6665 },
+ { 1574252,  826, 153053, 6722 }, { 1755552,  834, 153646, 7680 }, { 1846018,  834, 153876, 8088 }, { 1854640,  827, 154348, 8116 },
+ { 1970131,  832, 154175, 8587 }, {   41086,  806, 155022,  106 }, {  252233,  831, 155078,  856 }, {  319566,  816, 155155, 1110 },
+ {  471318,  808, 155392, 1774 }, {  474911,  825, 155394, 1798 }, {  560524,  833, 154457, 2302 }, {  565746,  823, 154721, 2340 },
+ {  569680,  820, 155741, 2366 }, {  584528,  828, 154953, 2457 }, {  717979,  801, 155123, 3222 }, {  823630,  829, 155227, 3736 },
+ { 1032918,  804, 154727, 4535 }, { 1063907,  839, 155552, 4632 }, { 1124976,  830, 154552, 4886 }, { 1357559,  822, 154455, 5770 },
+ { 1370411,  801, 154410, 5840 }, { 1388754,  809, 154483, 5913 }, { 1414818,  808, 155343, 6035 }, { 1516877,  835, 155438, 6463 },
+ { 1535659,  840, 155108, 6551 }, { 1587639,  809, 155068, 6803 }, { 1606431,  822, 155376, 6887 }, { 1625128,  821, 155795, 6981 },
+ { 1626968,  829, 154662, 6995 }, { 1671830,  807, 155616, 7260 }, { 1672872,  848, 155614, 7267 }, { 1678556,  873, 155606, 7285 },
+ { 1695734,  825, 155739, 7369 }, { 1717660,  838, 155206, 7475 }, { 1759435,  842, 155341, 7696 }, { 1834785,  866, 155574, 8037 },
+ { 2001899,  812, 155745, 8714 }, { 2017206,  844, 155194, 8784 }, { 2064622,  826, 155576, 8960 }, {  155231,  855, 156432,  515 },
+ {  188430,  843, 156157,  624 }, {  219774,  823, 156855,  731 }, {  239306,  846, 156943,  808 }, {  272962,  811, 157112,  938 },
+ {  311862,  817, 157043, 1085 }, {  350421,  832, 156262, 1237 }, {  367764,  809, 156234, 1295 }, {  548168,  839, 156094, 2235 },
+ {  552002,  832, 156303, 2258 }, {  555500,  835, 156942, 2277 }, {  716835,  802, 156773, 3209 }, {  716850,  820, 156773, 3210 },
+ {  719709,  847, 156814, 3228 }, {  736671,  814, 155897, 3299 }, {  779706,  864, 156167, 3541 }, {  782262,  817, 156040, 3558 },
+ {  897506,  855, 156908, 4028 }, { 1124605,  832, 155938, 4884 }, { 1360061,  845, 156031, 5783 }, { 1362498,  812, 156785, 5795 },
+ { 1375821,  814, 156215, 5858 }, { 1387815,  836, 156418, 5909 }, { 1409871,  825, 155909, 6009 }, { 1410883,  814, 156130, 6013 },
+ { 1449712,  841, 155913, 6169 }, { 1511818,  800, 156293, 6432 }, { 1654515,  863, 157279, 7147 }, { 1786055,  822, 156290, 7816 },
+ { 1808750,  822, 156589, 7923 }, { 1877240,  844, 157149, 8221 }, { 1903571,  821, 156113, 8330 }, {  130900,  802, 157804,  432 },
+ {  180166,  821, 157655,  609 }, {  274309,  827, 158444,  940 }, {  301543,  857, 158388, 1036 }, {  379262,  812, 158368, 1354 },
+ {  398384,  825, 157311, 1442 }, {  416925,  801, 158357, 1517 }, {  540352,  833, 157475, 2184 }, {  544032,  858, 158277, 2207 },
+ {  593307,  820, 157568, 2499 }, {  705973,  815, 158513, 3158 }, {  772963,  816, 158498, 3504 }, {  785238,  838, 157483, 3577 },
+ {  851240,  850, 158544, 3869 }, { 1099702,  856, 157836, 4791 }, { 1136899,  820, 157830, 4926 }, { 1154305,  853, 158381, 4987 },
+ { 1155191,  811, 158345, 4992 }, { 1192811,  848, 157673, 5137 }, { 1289377,  813, 158575, 5507 }, { 1321410,  802, 157930, 5633 },
+ { 1391785,  826, 158190, 5931 }, { 1435668,  870, 158586, 6119 }, { 1640861,  817, 158314, 7067 }, { 1736505,  823, 158265, 7574 },
+ { 1802837,  825, 157678, 7886 }, { 1813847,  838, 157418, 7941 }, { 1821343,  852, 157361, 7981 }, { 1933312,  835, 157287, 8436 },
+ { 1959786,  826, 157934, 8543 }, { 2018950,  813, 158040, 8788 }, {   68779,  813, 159586,  214 }, {  219385,  815, 159988,  729 },
+ {  325913,  814, 159711, 1132 }, {  401534,  836, 160027, 1455 }, {  429584,  837, 159450, 1566 }, {  444968,  844, 159917, 1642 },
+ {  467407,  818, 159929, 1755 }, {  513205,  806, 160007, 2030 }, {  700216,  825, 159931, 3125 }, {  750494,  858, 159602, 3387 },
+ {  757841,  844, 159719, 3428 }, {  757960,  830, 159536, 3429 }, {  913147,  815, 159273, 4097 }, {  938245,  827, 159848, 4197 },
+ { 1159606,  845, 158818, 5007 }, { 1160043,  845, 159886, 5010 }, { 1301101,  801, 158965, 5553 }, { 1329252,  868, 159159, 5659 },
+ { 1348423,  827, 159443, 5740 }, { 1491131,  835, 159749, 6343 }, { 1492311,  817, 159615, 6352 }, { 1556550,  812, 159115, 6642 },
+ { 1573536,  850, 159479, 6720 }, { 1577590,  850, 159636, 6744 }, { 1658427,  850, 159899, 7171 }, { 1661835,  839, 159194, 7198 },
+ { 1664435,  809, 159706, 7216 }, { 1687637,  858, 159632, 7326 }, { 1785521,  841, 160003, 7813 }, { 1806978,  845, 160105, 7914 },
+ { 1873521,  807, 159290, 8210 }, { 1914074,  839, 159789, 8364 }, { 1937414,  818, 159641, 8455 }, { 1980328,  821, 159735, 8624 },
+ { 1988610,  825, 159277, 8660 }, { 1996156,  840, 158948, 8691 }, { 2019283,  830, 160069, 8792 }, {   69779,  854, 161547,  217 },
+ {  152815,  827, 160320,  508 }, {  297730,  808, 161369, 1027 }, {  318944,  850, 161533, 1103 }, {  326906,  810, 161551, 1137 },
+ {  464935,  808, 160395, 1741 }, {  485908,  818, 160890, 1860 }, {  503399,  895, 161211, 1977 }, {  507355,  807, 161465, 1997 },
+ {  514557,  871, 160635, 2038 }, {  564983,  822, 160922, 2330 }, {  677431,  833, 160660, 2991 }, {  757460,  839, 160210, 3427 },
+ { 1012259,  845, 160842, 4459 }, { 1247437,  825, 160376, 5346 }, { 1537902,  810, 161650, 6559 }, { 1617564,  850, 161386, 6950 },
+ { 1622856,  857, 160878, 6975 }, { 1662250,  869, 161413, 7200 }, { 1682154,  800, 160495, 7299 }, { 1694880,  840, 160584, 7364 },
+ { 1697198,  831, 160594, 7384 }, { 1702987,  833, 160606, 7409 }, { 1713589,  914, 160684, 7458 }, { 1716012,  848, 161339, 7472 },
+ { 1719186,  850, 160893, 7482 }, { 1743262,  848, 161653, 7616 }, { 1762108,  848, 161532, 7705 }, { 1790373,  855, 160327, 7833 },
+ { 1792728,  818, 161081, 7839 }, { 1797386,  848, 161634, 7862 }, { 1907022,  829, 160873, 8341 }, { 1937686,  846, 161624, 8459 },
+ { 1956847,  804, 161435, 8532 }, { 1969854,  842, 160534, 8586 }, { 2042793,  829, 161406, 8891 }, { 2059177,  806, 161424, 8942 },
+ {   84927,  837, 162244,  277 }, {  443256,  819, 162060, 1633 }, {  494360,  834, 162766, 1929 }, {  541556,  856, 162920, 2190 },
+ {  626395,  843, 162015, 2692 }, {  650753,  854, 162436, 2835 }, {  801503,  801, 163107, 3640 }, {  806270,  848, 162068, 3657 },
+ {  859010,  809, 161917, 3889 }, {  894923,  802, 161900, 4012 }, { 1244723,  839, 162927, 5333 }, { 1282125,  810, 163076, 5472 },
+ { 1284365,  838, 161835, 5483 }, { 1306438,  849, 162464, 5574 }, { 1408835,  814, 162853, 6005 }, { 1427333,  805, 161848, 6087 },
+ { 1580879,  815, 162598, 6763 }, { 1592197,  812, 162937, 6820 }, { 1639267,  851, 163090, 7058 }, { 1665646,  852, 162045, 7222 },
+ { 1671984,  823, 162673, 7263 }, { 1763732,  822, 161852, 7713 }, { 1764159,  826, 162931, 7716 }, { 1771407,  813, 162527, 7746 },
+ { 1804682,  808, 162846, 7903 }, { 1911180,  889, 162053, 8350 }, { 1917146,  840, 162005, 8372 }, { 2086069,  811, 162632, 9035 },
+ {   21751,  824, 163526,   49 }, {  303567,  803, 164283, 1048 }, {  334841,  807, 163468, 1185 }, {  337307,  883, 163158, 1193 },
+ {  368244,  812, 163714, 1297 }, {  459424,  827, 163526, 1711 }, {  481651,  829, 163785, 1831 }, {  498168,  836, 164073, 1954 },
+ {  526754,  837, 163696, 2116 }, {  542228,  839, 164435, 2197 }, {  581215,  804, 163157, 2436 }, {  619398,  802, 164040, 2659 },
+ {  622383,  968, 164137, 2671 }, {  645850,  802, 164489, 2810 }, {  659501,  854, 164405, 2879 }, {  674831,  821, 163693, 2978 },
+ {  797280,  840, 164541, 3617 }, {  955779,  814, 163624, 4269 }, { 1022488,  859, 163419, 4505 }, { 1105425,  838, 164072, 4812 },
+ { 1121816,  843, 164369, 4873 }, { 1199678,  813, 164132, 5164 }, { 1311992,  838, 163178, 5592 }, { 1330427,  830, 164544, 5665 },
+ { 1576507,  821, 164456, 6741 }, { 1660199,  829, 164298, 7183 }, { 1662903,  840, 163496, 7207 }, { 1712876,  832, 163965, 7452 },
+ { 1720318,  836, 163771, 7490 }, { 1850348,  868, 163774, 8101 }, { 1864475,  829, 163150, 8158 }, { 1885350,  847, 164211, 8250 },
+ { 2092334,  815, 164056, 9055 }, {  124657,  818, 165313,  407 }, {  199773,  855, 165686,  665 }, {  202385,  846, 164813,  676 },
+ {  217327,  819, 165251,  723 }, {  334561,  817, 165605, 1183 }, {  345248,  806, 164824, 1221 }, {  402663,  802, 165065, 1459 },
+ {  416093,  835, 165483, 1512 }, {  497943,  859, 165044, 1951 }, {  500003,  821, 164866, 1961 }, {  548051,  808, 165981, 2230 },
+ {  549015,  825, 165647, 2240 }, {  561496,  806, 165044, 2304 }, {  682390,  818, 164774, 3021 }, {  700524,  834, 165417, 3127 },
+ {  718996,  856, 164769, 3224 }, {  835927,  825, 165229, 3804 }, {  972353,  846, 165039, 4322 }, { 1076710,  827, 164619, 4685 },
+ { 1085351,  803, 165917, 4725 }, { 1275935,  838, 164933, 5454 }, { 1511112,  845, 164700, 6430 }, { 1568842,  830, 166018, 6697 },
+ { 1579665,  834, 165941, 6754 }, { 1599265,  863, 165000, 6854 }, { 1637919,  831, 165427, 7047 }, { 1643167,  815, 165317, 7079 },
+ { 1719463,  864, 165613, 7485 }, { 1754875,  845, 164874, 7677 }, { 1882269,  870, 165143, 8240 }, { 2052141,  835, 164638, 8922 },
+ {   54060,  847, 166045,  156 }, {   60584,  804, 166941,  178 }, {   80456,  820, 166836,  259 }, {  228592,  909, 166969,  764 },
+ {  228660,  850, 166968,  765 }, {  329207,  843, 166794, 1152 }, {  345797,  816, 166697, 1222 }, {  384473,  836, 166463, 1378 },
+ {  412484,  813, 166154, 1499 }, {  431460,  837, 166887, 1575 }, {  519825,  802, 166388, 2074 }, {  578833,  844, 166885, 2417 },
+ {  581848,  838, 166898, 2439 }, {  632704,  889, 167060, 2722 }, {  667363,  827, 166549, 2926 }, {  668756,  817, 166349, 2931 },
+ {  737882,  902, 166803, 3312 }, {  737889,  981, 166804, 3313 }, {  740722,  810, 166235, 3329 }, {  747113,  836, 166148, 3369 },
+ {  901501,  840, 167061, 4048 }, {  954818,  830, 167115, 4260 }, { 1080878,  819, 167152, 4705 }, { 1097466,  829, 166437, 4780 },
+ { 1119622,  831, 167248, 4864 }, { 1153638,  833, 166400, 4984 }, { 1183728,  811, 166529, 5102 }, { 1293809,  814, 166559, 5524 },
+ { 1341471,  839, 167419, 5711 }, { 1457826,  806, 167275, 6208 }, { 1482141,  832, 166580, 6307 }, { 1501580,  819, 166371, 6391 },
+ { 1545327,  836, 166772, 6592 }, { 1697281,  819, 167354, 7386 }, { 1767545,  856, 166372, 7723 }, { 1870522,  832, 166795, 8197 },
+ { 1886636,  811, 166683, 8258 }, { 2031046,  836, 166175, 8839 }, { 2033021,  860, 167148, 8845 }, { 2062100,  845, 166842, 8953 },
+ {   12918,  823, 168155,   19 }, {  147539,  817, 168567,  484 }, {  184695,  815, 168507,  615 }, {  191074,  802, 168845,  633 },
+ {  238629,  835, 168410,  803 }, {  270074,  880, 167853,  927 }, {  270074,  900, 167853,  928 }, {  291893,  812, 168446, 1000 },
+ {  321522,  811, 167961, 1118 }, {  406884,  822, 167799, 1477 }, {  490068,  849, 168849, 1889 }, {  610890,  840, 168812, 2605 },
+ {  701570,  831, 167612, 3132 }, {  820700,  841, 167748, 3723 }, {  847077,  824, 168810, 3853 }, {  953481,  820, 168196, 4254 },
+ {  956204,  835, 168209, 4270 }, { 1025595,  802, 167799, 4512 }, { 1084177,  842, 168330, 4719 }, { 1090436,  865, 168790, 4751 },
+ { 1257000,  822, 167973, 5387 }, { 1350986,  802, 167629, 5745 }, { 1478252,  808, 168545, 6292 }, { 1481866,  828, 167995, 6305 },
+ { 1644575,  859, 167548, 7091 }, { 1662549,  872, 167518, 7206 }, { 1728197,  862, 167676, 7533 }, { 1794186,  834, 168652, 7849 },
+ { 1800257,  841, 168766, 7874 }, { 1870140,  815, 167936, 8194 }, { 1891442,  816, 168207, 8274 }, { 1902583,  828, 168301, 8325 },
+ { 1934458,  811, 168273, 8441 }, { 2090428,  854, 168872, 9051 }, {     580,  846, 170275, 9078 }, {    7184,  825, 169882, 9109 },
+ {   19515,  830, 170375,   40 }, {  277363,  802, 170243,  946 }, {  405585,  847, 170306, 1470 }, {  493642,  837, 169837, 1921 },
+ {  566440,  847, 170347, 2339 }, {  609907,  810, 169055, 2601 }, {  738052,  832, 170298, 3310 }, {  738057,  830, 170299, 3311 },
+ { 1076297,  848, 168949, 4684 }, { 1078132,  815, 168940, 4694 }, { 1090279,  854, 169267, 4750 }, { 1270433,  801, 169923, 5433 },
+ { 1416677,  850, 169914, 6052 }, { 1523370,  841, 170217, 6499 }, { 1611722,  853, 169592, 6924 }, { 1677016,  836, 170009, 7280 },
+ { 1844316,  812, 170284, 8082 }, { 1952975,  847, 170299, 8517 }, { 2026985,  817, 170171, 8827 }, { 2041767,  862, 169824, 8888 },
+ {   22103,  835, 170806,   53 }, {   47441,  867, 171239,  133 }, {   52914,  850, 170765,  149 }, {   72643,  900, 171429,  230 },
+ {   72653,  910, 171428,  231 }, {   81520,  809, 170699,  262 }, {  214254,  818, 170413,  711 }, {  276921,  842, 171588,  945 },
+ {  443652,  860, 171407, 1632 }, {  467473,  833, 171788, 1750 }, {  489227,  827, 171358, 1878 }, {  525754,  805, 171227, 2111 },
+ {  630335,  843, 170721, 2711 }, {  707231,  821, 171165, 3164 }, {  789076,  807, 171708, 3589 }, {  792497,  838, 171702, 3601 },
+ {  871534,  830, 171499, 3936 }, {  893955,  804, 170591, 4006 }, {  900278,  852, 170998, 4041 }, {  946478,  804, 171812, 4230 },
+ { 1064259,  801, 170803, 4633 }, { 1078706,  913, 170473, 4698 }, { 1147453,  819, 171203, 4956 }, { 1225050,  823, 170957, 5263 },
+ { 1421097,  814, 171008, 6068 }, { 1487172,  855, 170680, 6328 }, { 1609236,  827, 170969, 6904 }, { 1683474,  854, 171057, 7305 },
+ { 1683532,  816, 171743, 7308 }, { 1724225,  828, 170591, 7508 }, { 1946412,  837, 171565, 8503 }, {   47795,  830, 172258,  134 },
+ {  107891,  843, 172621,  363 }, {  267248,  836, 172243,  916 }, {  451108,  801, 171895, 1670 }, {  470959,  846, 173214, 1768 },
+ {  519283,  832, 173222, 2066 }, {  581889,  803, 172233, 2438 }, {  584508,  842, 172136, 2453 }, {  622471,  848, 172108, 2669 },
+ {  767014,  857, 172965, 3474 }, {  775476,  823, 172227, 3521 }, {  834936,  853, 172386, 3792 }, {  897797,  849, 172844, 4027 },
+ { 1066081,  849, 172631, 4642 }, { 1076965,  833, 172078, 4688 }, { 1195161,  823, 171945, 5145 }, { 1264881,  962, 172271, 5414 },
+ { 1264925,  912, 172273, 5415 }, { 1516823,  835, 172954, 6466 }, { 1538103,  838, 172119, 6564 }, { 1648010,  818, 172991, 7112 },
+ { 1695741,  853, 171978, 7374 }, { 1732932,  838, 172492, 7556 }, { 1826813,  856, 172610, 8007 }, { 1886442,  831, 172137, 8257 },
+ { 1899289,  808, 172932, 8310 }, { 2032740,  849, 172211, 8842 }, { 2055964,  841, 172438, 8933 }, {    9631,  813, 173337,    8 },
+ {   93877,  819, 174265,  303 }, {  480127,  824, 173578, 1822 }, {  497127,  843, 174016, 1945 }, {  533573,  808, 174053, 2146 },
+ {  555165,  843, 174094, 2272 }, {  560517,  871, 174336, 2297 }, {  908324,  839, 174203, 4078 }, {  945107,  815, 173912, 4223 },
+ { 1144943,  854, 173349, 4948 }, { 1364445,  852, 174750, 5813 }, { 1594321,  856, 173608, 6831 }, { 1668671,  831, 174649, 7244 },
+ { 1714359,  843, 173792, 7466 }, { 1722604,  849, 173789, 7501 }, { 1725507,  882, 173692, 7518 }, { 1773150,  822, 173522, 7760 },
+ { 1806759,  808, 174479, 7917 }, { 1824993,  834, 174252, 7999 }, { 1855647,  817, 174619, 8126 }, { 1968366,  835, 174097, 8584 },
+ { 2028801,  835, 173950, 8831 }, { 2030686,  841, 174430, 8838 }, {  106302,  819, 174856,  356 }, {  203996,  847, 175037,  680 },
+ {  391563,  840, 175289, 1406 }, {  443084,  814, 175483, 1626 }, {  637983,  824, 176155, 2757 }, {  765106,  813, 175779, 3464 },
+ {  783488,  829, 175103, 3563 }, { 1075558,  823, 175126, 4680 }, { 1252677,  844, 175388, 5374 }, { 1344515,  808, 175182, 5728 },
+ { 1538802,  802, 175906, 6570 }, { 1586219,  838, 175446, 6799 }, { 1621485,  859, 176062, 6971 }, { 1631167,  836, 176000, 7016 },
+ { 1667486,  806, 175831, 7238 }, { 1723099,  805, 175751, 7505 }, { 1740503,  857, 175047, 7607 }, { 1868065,  805, 175214, 8182 },
+ { 1887774,  836, 174844, 8261 }, { 1938205,  832, 175568, 8460 }, { 1982862,  834, 176169, 8638 }, {   22015,  845, 176999,   52 },
+ {  112724,  873, 177304,  374 }, {  191390,  823, 176986,  634 }, {  228233,  810, 177104,  757 }, {  337979,  825, 176464, 1197 },
+ {  342802,  810, 176286, 1209 }, {  378895,  816, 177607, 1344 }, {  472789,  828, 176545, 1775 }, {  496032,  804, 176741, 1938 },
+ {  496183,  811, 177560, 1939 }, {  757749,  810, 177591, 3423 }, {  885850,  824, 177099, 3979 }, {  895812,  846, 176901, 4014 },
+ {  935255,  802, 177234, 4184 }, { 1194590,  821, 176236, 5143 }, { 1266779,  806, 177371, 5422 }, { 1354962,  846, 176636, 5760 },
+ { 1380673,  844, 177291, 5877 }, { 1488813,  836, 177507, 6336 }, { 1543676,  803, 176514, 6584 }, { 1544737,  828, 176638, 6591 },
+ { 1551997,  823, 176954, 6619 }, { 1633577,  841, 177119, 7030 }, { 1642708,  806, 177321, 7081 }, { 1645293,  864, 177135, 7098 },
+ { 1686479,  868, 176251, 7324 }, { 1780574,  809, 176605, 7797 }, { 1802284,  832, 177053, 7885 }, { 1802303,  849, 176979, 7887 },
+ { 2010802,  860, 176340, 8753 }, { 2013487,  857, 177356, 8765 }, {   99064,  825, 177693,  327 }, {  151218,  834, 177955,  503 },
+ {  228803,  825, 178974,  761 }, {  285130,  831, 178923,  975 }, {  286298,  806, 177943,  978 }, {  331779,  825, 177959, 1164 },
+ {  394146,  821, 178343, 1419 }, {  413321,  845, 178936, 1501 }, {  443628,  862, 178142, 1627 }, {  485634,  848, 178842, 1850 },
+ {  511805,  825, 177857, 2018 }, {  528538,  824, 178601, 2122 }, {  564471,  843, 178495, 2319 }, {  613543,  859, 178279, 2620 },
+ {  669780,  817, 177690, 2936 }, {  793597,  846, 178224, 3606 }, {  798182,  850, 178463, 3620 }, {  817675,  816, 178989, 3707 },
+ { 1045838,  842, 178074, 4574 }, { 1217768,  832, 177723, 5245 }, { 1239725,  811, 178106, 5310 }, { 1273139,  833, 178454, 5445 },
+ { 1289207,  828, 178823, 5510 }, { 1304863,  812, 178113, 5569 }, { 1339124,  832, 178426, 5702 }, { 1431512,  840, 178160, 6110 },
+ { 1471965,  813, 178482, 6259 }, { 1542031,  837, 178752, 6579 }, { 1728087,  818, 178969, 7535 }, { 1823365,  844, 178912, 7996 },
+ { 1866126,  804, 178568, 8169 }, { 1929050,  838, 179047, 8412 }, { 2020637,  802, 178878, 8798 }, { 2044420,  869, 178449, 8899 },
+ { 2062940,  835, 178992, 8955 }, { 2095433,  852, 178231, 9068 }, {   20445,  825, 179432,   44 }, {  111139,  802, 179299,  371 },
+ {  218856,  825, 180346,  726 }, {  331870,  857, 180006, 1163 }, {  463580,  814, 180249, 1728 }, {  465150,  849, 180567, 1734 },
+ {  476017,  815, 179514, 1796 }, {  491901,  833, 179946, 1904 }, {  532395,  823, 180004, 2139 }, {  573384,  842, 179167, 2383 },
+ {  623643,  828, 180344, 2673 }, {  685999,  803, 179472, 3040 }, {  772650,  825, 179547, 3499 }, {  999679,  832, 179788, 4412 },
+ { 1017318,  827, 180043, 4482 }, { 1035697,  827, 179678, 4545 }, { 1097786,  824, 179692, 4784 }, { 1127537,  826, 179910, 4904 },
+ { 1415085,  829, 179631, 6043 }, { 1419481,  866, 180382, 6064 }, { 1575192,  815, 179585, 6737 }, { 1652782,  802, 180542, 7140 },
+ { 1661585,  801, 180300, 7204 }, { 1662874,  839, 180037, 7212 }, { 1688008,  860, 179698, 7335 }, { 1693096,  806, 179886, 7359 },
+ { 1694567,  837, 179455, 7368 }, { 1718135,  810, 180558, 7481 }, { 1731378,  844, 179768, 7551 }, { 1923040,  846, 179141, 8391 },
+ { 2096405,  858, 180187, 9074 }, {    7131,  812, 181549, 9107 }, {  121788,  829, 180946,  396 }, {  125457,  831, 181432,  410 },
+ {  126853,  827, 181138,  415 }, {  134169,  839, 181753,  438 }, {  285492,  825, 181591,  976 }, {  346688,  853, 181774, 1223 },
+ {  473631,  855, 181834, 1779 }, {  485889,  827, 181645, 1854 }, {  673892,  802, 180589, 2962 }, { 1048508,  850, 180639, 4584 },
+ { 1210341,  865, 181713, 5214 }, { 1315975,  859, 181413, 5613 }, { 1367249,  811, 181571, 5827 }, { 1491150,  804, 181739, 6351 },
+ { 1532113,  856, 180982, 6538 }, { 1624164,  810, 181255, 6984 }, { 1634228,  847, 181676, 7033 }, { 1673459,  874, 181463, 7272 },
+ { 1724116,  805, 180825, 7512 }, { 1725252,  857, 181191, 7520 }, { 1758826,  811, 181204, 7699 }, { 1787135,  839, 181067, 7823 },
+ { 2038107,  832, 181743, 8873 }, { 2056971,  865, 181975, 8936 }, {  243170,  825, 183477,  819 }, {  243296,  830, 182853,  820 },
+ {  445666,  852, 183408, 1639 }, {  476090,  815, 182710, 1794 }, {  533232,  812, 182609, 2141 }, {  584914,  846, 183402, 2452 },
+ {  601558,  801, 183193, 2542 }, {  692759,  823, 182646, 3083 }, {  701845,  834, 182646, 3130 }, {  735578,  806, 182061, 3292 },
+ {  777590,  814, 182828, 3528 }, {  784187,  851, 183213, 3566 }, {  848635,  814, 182180, 3857 }, {  979453,  841, 183229, 4345 },
+ { 1105784,  845, 183431, 4816 }, { 1163730,  802, 182231, 5025 }, { 1443317,  825, 182372, 6157 }, { 1490585,  869, 182648, 6346 },
+ { 1690176,  831, 182315, 7346 }, { 1727029,  809, 182063, 7530 }, { 1731216,  853, 182498, 7550 }, { 1809332,  866, 182709, 7927 },
+ { 1810837,  847, 182900, 7932 }, { 1896202,  807, 182788, 8297 }, { 1901624,  840, 183293, 8320 }, { 1965689,  856, 183101, 8569 },
+ { 1975010,  810, 182885, 8604 }, { 1976000,  830, 182995, 8609 }, {   12646,  819, 184414,   17 }, {   42152,  826, 184812,  110 },
+ {  351339,  841, 184943, 1234 }, {  431564,  807, 183747, 1573 }, {  547080,  892, 183717, 2217 }, {  588673,  831, 183661, 2471 },
+ {  747639,  824, 184136, 3365 }, {  763376,  833, 184838, 3451 }, {  821931,  867, 184356, 3727 }, {  835227,  818, 184210, 3791 },
+ {  926762,  828, 183977, 4150 }, {  960535,  800, 183636, 4278 }, { 1010621,  840, 184689, 4452 }, { 1041637,  849, 184602, 4562 },
+ { 1208411,  838, 184422, 5204 }, { 1264514,  810, 183788, 5416 }, { 1271891,  843, 184898, 5441 }, { 1273789,  803, 184412, 5448 },
+ { 1320310,  835, 184164, 5630 }, { 1355088,  837, 184672, 5761 }, { 1356411,  838, 184399, 5769 }, { 1368057,  800, 184428, 5833 },
+ { 1521093,  828, 184887, 6491 }, { 1570978,  800, 183920, 6711 }, { 1636363,  801, 184312, 7043 }, { 1648024,  809, 184285, 7115 },
+ { 1695346,  836, 184159, 7376 }, { 1705074,  825, 183834, 7419 }, { 1712390,  805, 184876, 7457 }, { 1726743,  843, 183633, 7529 },
+ { 1736371,  810, 184130, 7583 }, { 1742874,  802, 183866, 7620 }, { 1768137,  845, 184382, 7734 }, { 1792754,  819, 184864, 7847 },
+ { 1851123,  854, 183937, 8105 }, { 1854579,  805, 184424, 8120 }, { 1905115,  847, 184346, 8336 }, { 2069010,  823, 184551, 8977 },
+ {   18700,  873, 185967,   38 }, {   77871,  806, 185566,  249 }, {  114736,  846, 185519,  379 }, {  167420,  826, 185144,  552 },
+ {  230536,  818, 186015,  768 }, {  246782,  845, 185432,  831 }, {  361547,  809, 186017, 1277 }, {  369904,  845, 186365, 1301 },
+ {  451929,  802, 185397, 1669 }, {  531633,  834, 186361, 2137 }, {  587246,  819, 185171, 2464 }, {  624202,  816, 185605, 2675 },
+ {  744681,  818, 185344, 3348 }, {  787179,  844, 185837, 3580 }, { 1038352,  845, 186004, 4550 }, { 1150004,  802, 185573, 4964 },
+ { 1170764,  807, 185007, 5052 }, { 1294863,  816, 186138, 5529 }, { 1346423,  850, 185464, 5734 }, { 1537484,  810, 185397, 6563 },
+ { 1687945,  822, 185606, 7338 }, { 1688860,  831, 185439, 7345 }, { 1700453,  834, 186328, 7403 }, { 1734204,  806, 186161, 7568 },
+ { 1749455,  820, 185101, 7655 }, { 1771613,  848, 185039, 7757 }, { 1776470,  857, 185150, 7782 }, { 1869062,  858, 185549, 8189 },
+ { 1869677,  847, 185469, 8193 }, { 1949968,  817, 186078, 8510 }, { 1961364,  846, 185604, 8549 }, { 1980020,  803, 185820, 8626 },
+ { 1984903,  843, 186126, 8651 }, { 2068093,  853, 185907, 8973 }, {   35001,  939, 187254,   90 }, {   77027,  869, 187212,  246 },
+ {  230779,  830, 186544,  769 }, {  259287,  804, 187309,  876 }, {  262431,  811, 186605,  894 }, {  347319,  830, 187637, 1226 },
+ {  349040,  838, 187609, 1229 }, {  601511,  812, 187679, 2539 }, {  601800,  830, 187052, 2541 }, {  602858,  848, 187149, 2547 },
+ {  610281,  800, 186490, 2600 }, {  644034,  840, 187864, 2792 }, {  658168,  854, 187719, 2872 }, {  715595,  858, 187479, 3193 },
+ {  816999,  812, 186688, 3701 }, {  967777,  800, 186765, 4309 }, { 1150084,  828, 187191, 4967 }, { 1186002,  837, 187563, 5108 },
+ { 1250905,  886, 187531, 5369 }, { 1252167,  833, 187570, 5373 }, { 1260457,  827, 186986, 5402 }, { 1330517,  820, 186799, 5673 },
+ { 1362889,  842, 186958, 5808 }, { 1520489,  849, 187262, 6488 }, { 1530151,  843, 187698, 6531 }, { 1552322,  852, 187697, 6625 },
+ { 1586882,  840, 187080, 6806 }, { 1591913,  804, 187540, 6826 }, { 1607754,  836, 187490, 6901 }, { 1631414,  845, 186948, 7019 },
+ { 1709189,  861, 187524, 7436 }, { 1714048,  850, 186973, 7467 }, { 1732274,  811, 187448, 7555 }, { 1745549,  832, 186567, 7642 },
+ { 1755146,  819, 187110, 7683 }, { 1771011,  827, 187721, 7752 }, { 1802084,  820, 186892, 7888 }, { 1839494,  807, 187371, 8063 },
+ { 1845088,  803, 187496, 8086 }, { 1868186,  863, 187337, 8186 }, { 1905627,  812, 187358, 8338 }, { 1957201,  822, 187249, 8536 },
+ { 2011098,  854, 187445, 8758 }, { 2054425,  805, 187377, 8927 }, { 2060420,  818, 186448, 8950 }, {   94090,  872, 189313,  305 },
+ {  190630,  810, 187933,  629 }, {  203339,  863, 189086,  677 }, {  226413,  836, 188837,  746 }, {  229153,  854, 189174,  760 },
+ {  437470,  858, 188824, 1602 }, {  481692,  837, 189073, 1825 }, {  513596,  845, 188706, 2025 }, {  788874,  836, 188909, 3586 },
+ {  837948,  876, 189273, 3811 }, { 1207251,  940, 188660, 5199 }, { 1247228,  838, 188954, 5347 }, { 1394458,  831, 188882, 5950 },
+ { 1552438,  868, 188340, 6626 }, { 1561327,  804, 189300, 6673 }, { 1628363,  804, 188843, 7009 }, { 1635893,  845, 188307, 7041 },
+ { 1637436,  802, 188847, 7052 }, { 1659087,  841, 188187, 7185 }, { 1777122,  823, 188457, 7784 }, { 1807347,  851, 187990, 7922 },
+ { 1909401,  817, 188651, 8349 }, { 1962354,  814, 189049, 8553 }, { 2006390,  818, 188320, 8733 }, {   28680,  833, 190389,   75 },
+ {  127844,  860, 189815,  422 }, {  167331,  824, 190348,  551 }, {  269931,  805, 190175,  923 }, {  287179,  845, 190030,  979 },
+ {  395255,  826, 189341, 1424 }, {  413918,  808, 190472, 1500 }, {  464101,  818, 190003, 1725 }, {  490607,  809, 189592, 1884 },
+ {  503644,  858, 190065, 1974 }, {  665987,  838, 189363, 2915 }, {  889806,  832, 190289, 3987 }, { 1044561,  862, 189827, 4572 },
+ { 1105041,  837, 190600, 4811 }, { 1177371,  847, 190389, 5077 }, { 1496811,  834, 190078, 6376 }, { 1560096,  846, 189432, 6669 },
+ { 1579738,  852, 189449, 6764 }, { 1597787,  811, 190690, 6853 }, { 1630465,  825, 190688, 7017 }, { 1658464,  822, 190315, 7179 },
+ { 1660707,  865, 190323, 7201 }, { 1676826,  818, 189951, 7284 }, { 1721352,  823, 189696, 7499 }, { 1725514,  834, 190370, 7523 },
+ { 1805233,  806, 190170, 7911 }, { 1826811,  870, 190350, 8009 }, { 1865625,  840, 189830, 8170 }, { 1895551,  811, 190499, 8291 },
+ { 1999850,  834, 189570, 8706 }, {  127348,  846, 190929,  418 }, {  139628,  838, 190894,  452 }, {  171763,  878, 191794,  562 },
+ {  298781,  851, 191157, 1026 }, {  441727,  814, 191426, 1615 }, {  481777,  800, 191455, 1824 }, {  535136,  812, 192027, 2147 },
+ {  536497,  836, 190864, 2153 }, {  913815,  802, 191658, 4096 }, {  981103,  833, 190912, 4351 }, { 1197823,  830, 191764, 5160 },
+ { 1244298,  824, 191538, 5335 }, { 1263323,  863, 190819, 5411 }, { 1266466,  835, 191942, 5423 }, { 1471795,  829, 192088, 6264 },
+ { 1580165,  834, 192161, 6767 }, { 1591374,  836, 190997, 6824 }, { 1640172,  807, 191426, 7073 }, { 1648767,  828, 191341, 7118 },
+ { 1651854,  930, 191111, 7138 }, { 1669396,  849, 191385, 7258 }, { 1779739,  839, 190974, 7795 }, { 1796861,  849, 191907, 7867 },
+ { 1832843,  816, 192152, 8036 }, { 1840642,  833, 191697, 8071 }, { 1862565,  815, 190842, 8155 }, { 1907343,  848, 190999, 8345 },
+ { 2036553,  802, 191909, 8864 }, { 2045573,  872, 190947, 8902 }, {    2519,  825, 192774, 9086 }, {    6716,  801, 192373, 9105 },
+ {  279853,  815, 192787,  950 }, {  283909,  807, 192973,  966 }, {  317490,  842, 193088, 1097 }, {  375939,  822, 192444, 1328 },
+ {  383893,  823, 192862, 1371 }, {  485663,  855, 192398, 1846 }, {  505712,  829, 193006, 1979 }, {  529094,  810, 193567, 2119 },
+ {  642328,  835, 193194, 2775 }, {  712719,  827, 192866, 3181 }, {  735042,  802, 192246, 3287 }, {  955721,  803, 192251, 4264 },
+ {  961694,  802, 193566, 4285 }, { 1083213,  806, 193029, 4715 }, { 1181488,  808, 192393, 5096 }, { 1331359,  813, 192489, 5677 },
+ { 1482332,  834, 192985, 6313 }, { 1744622,  843, 192619, 7638 }, { 1768540,  871, 192390, 7737 }, { 1773091,  829, 193290, 7762 },
+ { 1781013,  820, 193671, 7802 }, { 1825454,  866, 192836, 8004 }, { 1859028,  843, 192605, 8138 }, { 1860329,  819, 193234, 8144 },
+ { 1954208,  841, 192353, 8528 }, {   23826,  815, 194561,   56 }, {   27236,  811, 194847,   70 }, {   47254,  870, 194416,  128 },
+ {  333705,  802, 195098, 1170 }, {  398190,  809, 193788, 1434 }, {  446849,  820, 193950, 1644 }, {  528502,  842, 194247, 2115 },
+ {  604745,  813, 195021, 2557 }, {  664001,  830, 193741, 2898 }, {  696541,  834, 195119, 3094 }, {  709486,  826, 194074, 3167 },
+ { 1168089,  835, 195011, 5045 }, { 1463922,  805, 194012, 6230 }, { 1470446,  813, 194322, 6256 }, { 1492886,  843, 194878, 6362 },
+ { 1544650,  859, 194381, 6599 }, { 1626400,  820, 194018, 7003 }, { 1719500,  816, 193809, 7492 }, { 1767598,  814, 194248, 7733 },
+ { 1795499,  860, 193974, 7861 }, { 1902404,  854, 193784, 8329 }, {   67257,  805, 196406,  205 }, {   87464,  884, 196187,  282 },
+ {   87469,  804, 196190,  283 }, {  112263,  834, 196465,  372 }, {  187229,  842, 195821,  619 }, {  200332,  870, 195599,  663 },
+ {  309696,  841, 196398, 1072 }, {  429414,  808, 195240, 1558 }, {  466090,  862, 195771, 1733 }, {  524749,  822, 196014, 2096 },
+ {  582494,  841, 195172, 2434 }, {  601660,  826, 196374, 2532 }, { 1113313,  833, 195302, 4843 }, { 1187272,  884, 195438, 5116 },
+ { 1315249,  865, 196090, 5612 }, { 1340857,  819, 195784, 5716 }, { 1548242,  834, 195275, 6612 }, { 1838506,  819, 196304, 8062 },
+ { 1889570,  820, 196166, 8272 }, { 2013780,  839, 195237, 8768 }, { 2021720,  856, 195970, 8806 }, { 2039966,  813, 195321, 8884 },
+ { 2071297,  857, 196596, 8986 }, {    1061,  838, 196977, 9080 }, {    7522,  870, 196942,    1 }, {   73262,  815, 196611,  234 },
+ {   83976,  812, 197831,  272 }, {  105683,  811, 197100,  355 }, {  143492,  836, 197191,  465 }, {  150405,  834, 197077,  495 },
+ {  285560,  816, 197112,  973 }, {  604756,  834, 197812, 2556 }, {  739265,  832, 197559, 3309 }, {  870826,  830, 197212, 3929 },
+ {  915477,  835, 196917, 4103 }, { 1017626,  844, 196766, 4486 }, { 1226547,  827, 197706, 5271 }, { 1345797,  801, 197003, 5732 },
+ { 1568214,  802, 197119, 6702 }, { 1571221,  848, 197301, 6718 }, { 1595500,  829, 196913, 6847 }, { 1717878,  820, 198003, 7487 },
+ { 1791315,  841, 197960, 7841 }, { 1804986,  858, 197579, 7912 }, { 1816580,  840, 197452, 7966 }, { 1839098,  848, 197844, 8064 },
+ { 1849538,  863, 197340, 8103 }, { 1883502,  825, 197852, 8248 }, { 1896379,  817, 197723, 8298 }, { 1930899,  844, 196771, 8422 },
+ { 1931429,  819, 196970, 8429 }, { 1935035,  811, 197688, 8448 }, { 1978156,  840, 196875, 8617 }, { 2010606,  850, 197154, 8755 },
+ { 2034932,  843, 196847, 8857 }, { 2035890,  848, 197320, 8861 }, { 2037500,  850, 196808, 8870 }, { 2058867,  824, 196693, 8941 },
+ {  152104,  835, 198268,  504 }, {  156995,  832, 198399,  518 }, {  202698,  821, 198752,  671 }, {  305014,  824, 199430, 1047 },
+ {  327216,  811, 198210, 1130 }, {  466987,  854, 199468, 1736 }, {  549888,  852, 198682, 2228 }, {  550912,  838, 198590, 2239 },
+ {  761679,  822, 199377, 3436 }, {  836424,  852, 199378, 3797 }, {  901460,  843, 199172, 4044 }, { 1005492,  835, 199022, 4430 },
+ { 1017349,  810, 199279, 4480 }, { 1041433,  854, 198759, 4560 }, { 1041566,  903, 198748, 4561 }, { 1131775,  812, 198322, 4919 },
+ { 1561238,  838, 199001, 6674 }, { 1641288,  852, 198523, 7080 }, { 1684795,  800, 199520, 7322 }, { 1775045,  845, 198534, 7777 },
+ { 1776659,  850, 199284, 7786 }, { 1815553,  830, 198839, 7958 }, { 1820316,  833, 199027, 7983 }, { 1840428,  832, 199320, 8074 },
+ { 1930069,  813, 199149, 8421 }, { 2020404,  866, 198164, 8800 }, { 2065078,  858, 198355, 8964 }, { 2079025,  807, 199277, 9011 },
+ { 2095368,  854, 198666, 9070 }, {   91787,  845, 200068,  289 }, {  113843,  825, 200132,  376 }, {  195215,  806, 200226,  647 },
+ {  198014,  833, 200702,  653 }, {  204895,  811, 199973,  679 }, {  257129,  802, 199759,  865 }, {  273489,  841, 199970,  933 },
+ {  280261,  833, 200578,  949 }, {  489721,  811, 200562, 1869 }, {  564850,  856, 200111, 2314 }, {  619170,  838, 200649, 2645 },
+ {  691024,  825, 200083, 3065 }, { 1006169,  842, 200874, 4435 }, { 1311660,  837, 199925, 5597 }, { 1352578,  815, 199814, 5752 },
+ { 1475715,  800, 200128, 6286 }, { 1554128,  843, 200412, 6641 }, { 1729345,  812, 200843, 7547 }, { 1734990,  820, 200070, 7577 },
+ { 1737461,  829, 200697, 7600 }, { 1765195,  892, 200594, 7721 }, { 1850324,  846, 200528, 8107 }, { 1857746,  846, 200939, 8136 },
+ { 1985122,  839, 199766, 8652 }, { 2090686,  800, 200039, 9053 }, {   17454,  816, 201199,   36 }, {   29254,  852, 202237,   76 },
+ {   80226,  827, 201965,  256 }, {  111278,  861, 201097,  369 }, {  202985,  837, 202368,  673 }, {  237432,  848, 201364,  792 },
+ {  252464,  826, 201806,  849 }, {  326379,  806, 201740, 1127 }, {  541194,  882, 202016, 2175 }, {  541196,  809, 202013, 2176 },
+ {  848645,  839, 201605, 3854 }, {  902135,  800, 201555, 4046 }, {  914683,  844, 202120, 4098 }, { 1006589,  856, 202126, 4436 },
+ { 1119496,  827, 201657, 4866 }, { 1249291,  832, 200980, 5363 }, { 1441938,  845, 202376, 6156 }, { 1492517,  809, 202148, 6363 },
+ { 1515425,  843, 201251, 6467 }, { 1558381,  868, 201551, 6664 }, { 1577452,  821, 201653, 6753 }, { 1643160,  812, 202095, 7096 },
+ { 1710730,  867, 201217, 7453 }, { 1754151,  816, 201312, 7684 }, { 1918074,  842, 201951, 8377 }, { 1930914,  827, 201315, 8427 },
+ { 2038451,  832, 201532, 8875 }, {    1925,  822, 203863, 9083 }, {  299946,  809, 202609, 1029 }, {  308005,  829, 202739, 1056 },
+ {  308483,  839, 203017, 1059 }, {  520038,  847, 202476, 2054 }, {  528383,  805, 203752, 2112 }, {  834666,  876, 203072, 3778 },
+ { 1189352,  849, 203142, 5126 }, { 1396752,  805, 203717, 5964 }, { 1502478,  804, 203521, 6399 }, { 1509964,  948, 203440, 6437 },
+ { 1583212,  832, 203468, 6792 }, { 1603620,  840, 203490, 6886 }, { 1642284,  840, 202543, 7090 }, { 1667767,  843, 203778, 7252 },
+ { 1677833,  875, 203677, 7293 }, { 1677843,  857, 203680, 7294 }, { 1687375,  831, 203263, 7341 }, { 1715506,  847, 202848, 7477 },
+ { 1871307,  858, 202904, 8206 }, { 1897119,  809, 203308, 8304 }, { 1934441,  842, 203593, 8445 }, { 1966238,  840, 202952, 8575 },
+ { 2053641,  817, 202627, 8925 }, { 2070134,  826, 203179, 8981 }, {  215341,  812, 204719,  709 }, {  332494,  814, 204963, 1160 },
+ { 1016366,  814, 204790, 4474 }, { 1177020,  880, 204745, 5079 }, { 1177844,  843, 204936, 5083 }, { 1190886,  848, 204931, 5133 },
+ { 1194775,  832, 204646, 5148 }, { 1227701,  815, 205305, 5280 }, { 1322844,  839, 203970, 5648 }, { 1479813,  856, 203946, 6306 },
+ { 1497549,  846, 205116, 6383 }, { 1582901,  829, 205088, 6790 }, { 1658779,  830, 205069, 7196 }, { 1682559,  827, 203993, 7311 },
+ { 1694319,  851, 204285, 7381 }, { 1712575,  852, 204237, 7465 }, { 1721218,  820, 204643, 7504 }, { 1742896,  843, 205204, 7632 },
+ { 1758100,  854, 204224, 7702 }, { 1770525,  831, 204229, 7755 }, { 1840008,  837, 204402, 8072 }, { 1952478,  842, 205318, 8519 },
+ { 1974658,  829, 203993, 8606 }, { 1995455,  821, 204876, 8692 }, { 1999389,  846, 204490, 8705 }, { 2030507,  831, 204790, 8837 },
+ {   25802,  814, 205977,   65 }, {   74211,  839, 206086,  238 }, {   75092,  821, 206178,  241 }, {   90741,  847, 205397,  287 },
+ {   94343,  854, 205361,  302 }, {  164345,  826, 206037,  538 }, {  257547,  822, 205726,  864 }, {  511093,  829, 206096, 2003 },
+ {  518812,  849, 206517, 2045 }, {  530820,  845, 206181, 2123 }, {  544320,  804, 205597, 2188 }, {  816622,  813, 205734, 3697 },
+ {  822737,  831, 206182, 3725 }, {  960173,  817, 206631, 4275 }, {  961816,  843, 206077, 4283 }, { 1092337,  821, 206126, 4761 },
+ { 1242944,  869, 206493, 5328 }, { 1248609,  820, 205794, 5360 }, { 1295484,  851, 205892, 5537 }, { 1439933,  829, 205940, 6150 },
+ { 1601896,  830, 205853, 6880 }, { 1755071,  814, 206569, 7687 }, { 1765875,  801, 206021, 7726 }, { 1798366,  811, 206590, 7876 },
+ { 1818568,  829, 206672, 7978 }, { 1829495,  863, 205455, 8022 }, { 1885192,  815, 206363, 8259 }, { 2083130,  844, 206252, 9028 },
+ {   78342,  827, 207806,  250 }, {  251756,  836, 208256,  846 }, {  263440,  874, 207315,  891 }, {  273889,  831, 207113,  930 },
+ {  426950,  841, 208027, 1546 }, {  541425,  830, 207745, 2172 }, {  619917,  812, 207907, 2644 }, {  755849,  842, 208150, 3405 },
+ {  881350,  814, 207343, 3958 }, {  950291,  865, 207626, 4241 }, {  950318,  844, 207536, 4242 }, {  984594,  850, 207928, 4363 },
+ { 1176723,  834, 207889, 5076 }, { 1199908,  802, 206896, 5169 }, { 1245594,  858, 207583, 5345 }, { 1363248,  874, 206904, 5817 },
+ { 1450873,  853, 208148, 6186 }, { 1500789,  829, 207398, 6395 }, { 1619744,  856, 206971, 6974 }, { 1630943,  800, 207088, 7028 },
+ { 1663328,  831, 207183, 7229 }, { 1746544,  815, 206884, 7651 }, { 1793286,  818, 207254, 7854 }, { 1815133,  833, 208252, 7962 },
+ { 1817357,  827, 207396, 7972 }, { 1873966,  803, 208111, 8218 }, { 1879194,  802, 208198, 8237 }, { 1880823,  816, 207705, 8242 },
+ { 1987663,  855, 207556, 8661 }, { 2008564,  829, 207756, 8744 }, { 2020210,  811, 207991, 8801 }, {   97807,  838, 208985,  318 },
+ {  145954,  839, 209523,  470 }, {  189516,  831, 209487,  621 }, {  299728,  851, 209601, 1020 }, {  436574,  808, 208485, 1588 },
+ {  458371,  820, 208570, 1692 }, {  462097,  850, 209112, 1707 }, {  497110,  823, 208959, 1925 }, {  588649,  827, 208691, 2463 },
+ {  728884,  849, 209095, 3258 }, {  746467,  824, 208426, 3351 }, {  903300,  845, 209394, 4051 }, {  922932,  845, 208983, 4131 },
+ { 1070018,  816, 208892, 4654 }, { 1093483,  821, 208371, 4767 }, { 1607521,  832, 208697, 6911 }, { 1636191,  811, 209529, 7060 },
+ { 1777492,  818, 209127, 7791 }, { 1783366,  851, 209063, 7815 }, { 1859814,  813, 209712, 8147 }, { 1933202,  814, 208706, 8443 },
+ { 1984061,  812, 209583, 8648 }, {  359152,  831, 209728, 1255 }, {  363176,  818, 210922, 1276 }, {  446179,  924, 210306, 1630 },
+ {  523999,  814, 210512, 2080 }, {  686082,  802, 209903, 3028 }, {  725648,  827, 209924, 3246 }, {  849225,  847, 210245, 3855 },
+ {  903698,  800, 210031, 4052 }, {  979751,  863, 211017, 4344 }, { 1005199,  841, 210242, 4427 }, { 1250907,  853, 210974, 5372 },
+ { 1349374,  845, 209744, 5748 }, { 1638288,  823, 211021, 7071 }, { 1688802,  826, 210263, 7351 }, { 1889833,  815, 209777, 8275 },
+ { 1894313,  820, 210985, 8290 }, { 1969449,  835, 209770, 8589 }, { 1993455,  812, 210320, 8682 }, {   67359,  852, 211616,  204 },
+ {  165746,  845, 212043,  540 }, {  209516,  828, 211702,  690 }, {  217604,  851, 211953,  716 }, {  331374,  810, 212515, 1147 },
+ {  419600,  826, 212049, 1515 }, {  523941,  844, 211639, 2079 }, {  574600,  845, 211686, 2376 }, {  594492,  828, 212197, 2486 },
+ {  594506,  833, 212197, 2485 }, {  644945,  853, 211586, 2783 }, {  688288,  838, 211477, 3039 }, {  829822,  845, 212257, 3747 },
+ { 1021964,  827, 211423, 4500 }, { 1201814,  850, 212452, 5177 }, { 1352877,  843, 211456, 5759 }, { 1411839,  849, 212379, 6038 },
+ { 1460686,  816, 212177, 6226 }, { 1566158,  810, 212586, 6699 }, { 1705723,  837, 212237, 7428 }, { 1721512,  848, 211846, 7509 },
+ { 1877065,  812, 211781, 8226 }, { 2013746,  850, 211516, 8770 }, { 2075023,  851, 212336, 9000 }, {   97580,  843, 213990,  316 },
+ {  211560,  825, 213516,  696 }, {  270394,  811, 212728,  920 }, {  317964,  830, 213986, 1094 }, {  499569,  805, 213475, 1941 },
+ {  510550,  854, 213966, 1992 }, {  693876,  872, 213362, 3077 }, { 1004485,  828, 213702, 4424 }, { 1484548,  803, 213631, 6330 },
+ { 1594250,  837, 213485, 6849 }, { 1742263,  812, 213628, 7634 }, { 1755430,  821, 213125, 7692 }, { 1786062,  836, 213558, 7827 },
+ { 1793903,  814, 213764, 7860 }, { 1804429,  848, 212635, 7916 }, { 1829595,  823, 213920, 8029 }, { 1931455,  839, 213128, 8434 },
+ { 1961692,  857, 213259, 8554 }, { 1974619,  838, 212730, 8607 }, {   15284,  874, 214325,   28 }, {   81869,  821, 215536,  260 },
+ {  151896,  821, 214865,  499 }, {  152580,  825, 214214,  502 }, {  191486,  836, 215025,  627 }, {  199319,  848, 214165,  654 },
+ {  246871,  825, 214207,  825 }, {  311204,  837, 215350, 1071 }, {  333981,  846, 214256, 1161 }, {  371414,  808, 214755, 1296 },
+ {  388868,  832, 214937, 1382 }, {  484330,  848, 214406, 1828 }, {  607621,  805, 214905, 2561 }, {  671125,  806, 214205, 2929 },
+ {  702833,  849, 214483, 3119 }, {  941352,  834, 214617, 4202 }, {  992975,  843, 214193, 4388 }, { 1020114,  837, 215498, 4493 },
+ { 1065686,  843, 214163, 4641 }, { 1194729,  829, 214386, 5153 }, { 1273241,  848, 214179, 5451 }, { 1367749,  845, 215431, 5841 },
+ { 1411279,  833, 215450, 6036 }, { 1530236,  840, 215361, 6540 }, { 1534312,  817, 214898, 6560 }, { 1544615,  877, 214536, 6605 },
+ { 1651175,  822, 214793, 7153 }, { 1691445,  843, 215201, 7365 }, { 1723830,  827, 214146, 7526 }, { 1810577,  832, 214251, 7940 },
+ { 1921491,  859, 215043, 8389 }, { 1955890,  816, 214498, 8535 }, { 2011972,  820, 214238, 8761 }, { 2070804,  824, 214463, 8985 },
+ { 2090688,  800, 214685, 9052 }, {   61922,  817, 216638,  181 }, {  121402,  845, 215749,  391 }, {  148981,  837, 216455,  482 },
+ {  194703,  844, 216358,  641 }, {  250141,  845, 215999,  839 }, {  310983,  840, 216655, 1068 }, {  465252,  813, 215711, 1719 },
+ {  513060,  814, 216945, 2006 }, { 1092371,  808, 216658, 4762 }, { 1209447,  846, 216326, 5216 }, { 1392026,  831, 216868, 5949 },
+ { 1523467,  851, 216490, 6514 }, { 1656565,  846, 215869, 7184 }, { 1697788,  860, 215580, 7401 }, { 1723223,  822, 215565, 7522 },
+ { 1740881,  809, 215905, 7626 }, { 1860222,  842, 216431, 8153 }, { 1932817,  832, 216765, 8442 }, { 1991401,  836, 216244, 8677 },
+ { 2014664,  843, 216363, 8778 }, { 2081423,  833, 216943, 9020 }, {     750,  819, 217812, 9079 }, {   68022,  839, 217834,  207 },
+ {  306109,  813, 217530, 1043 }, {  363302,  828, 218319, 1270 }, {  382970,  819, 217895, 1352 }, {  412588,  850, 217755, 1486 },
+ {  445941,  808, 217028, 1623 }, {  459026,  815, 217588, 1688 }, {  531771,  834, 217569, 2121 }, {  620439,  844, 218165, 2642 },
+ {  644127,  835, 218310, 2772 }, {  756096,  848, 218365, 3401 }, {  776381,  825, 217079, 3506 }, {  796216,  845, 217499, 3608 },
+ {  895846,  825, 218432, 4008 }, { 1139850,  853, 218040, 4936 }, { 1236106,  846, 217489, 5302 }, { 1402696,  819, 217595, 5995 },
+ { 1613212,  843, 217797, 6949 }, { 1738291,  806, 218029, 7611 }, { 1784160,  844, 217871, 7818 }, { 1874944,  810, 218089, 8224 },
+ { 1897277,  808, 217392, 8312 }, { 1939790,  830, 217120, 8476 }, { 2008533,  843, 218183, 8745 }, { 2020217,  840, 218056, 8803 },
+ { 2080984,  834, 218423, 9019 }, {  303495,  849, 218826, 1033 }, {  313136,  846, 218513, 1077 }, {  701536,  801, 218926, 3109 },
+ {  722122,  845, 219008, 3221 }, {  732161,  841, 219372, 3263 }, { 1269524,  827, 218782, 5437 }, { 1487344,  813, 219399, 6348 },
+ { 1509498,  832, 219430, 6448 }, { 1589056,  849, 219050, 6827 }, { 1708550,  829, 218684, 7448 }, { 1718815,  851, 219192, 7500 },
+ { 1806315,  801, 219189, 7925 }, { 1809757,  815, 219329, 7938 }, { 1864948,  811, 219556, 8179 }, { 1999668,  801, 218601, 8707 },
+ { 2014715,  874, 219102, 8777 }, { 2093596,  847, 218488, 9063 }, {   74672,  807, 221083,  237 }, {  106555,  841, 220938,  354 },
+ {  148621,  871, 219965,  481 }, {  149966,  834, 220524,  488 }, {  172659,  802, 220926,  561 }, {  439234,  803, 220023, 1593 },
+ {  446366,  804, 220157, 1624 }, {  455917,  817, 221148, 1675 }, {  501195,  815, 220604, 1943 }, {  866614,  827, 220079, 3911 },
+ { 1044042,  822, 220710, 4569 }, { 1046163,  876, 220586, 4575 }, { 1111301,  838, 220136, 4840 }, { 1219748,  837, 220627, 5256 },
+ { 1284583,  825, 220291, 5492 }, { 1906831,  817, 220307, 8347 }, { 1915610,  813, 220699, 8374 }, { 2033723,  853, 221312, 8854 },
+ { 2039245,  845, 221322, 8881 }, { 2071702,  840, 220899, 8990 }, {   96673,  854, 222475,  309 }, {  360960,  899, 221847, 1260 },
+ {  456599,  850, 222373, 1678 }, {  508387,  813, 222543, 1976 }, {  679327,  849, 222576, 2977 }, { 1056821,  813, 222725, 4610 },
+ { 1109110,  807, 222405, 4833 }, { 1145247,  814, 221427, 4953 }, { 1150283,  854, 221700, 4974 }, { 1351032,  850, 221767, 5754 },
+ { 1353469,  838, 221511, 5768 }, { 1632485,  809, 222458, 7042 }, { 1656299,  845, 221944, 7191 }, { 1698754,  838, 222178, 7413 },
+ { 1923343,  866, 222077, 8399 }, { 1955890,  804, 221978, 8537 }, { 1993367,  806, 222733, 8683 }, { 2039738,  839, 221676, 8886 },
+ {    4993,  824, 223757, 9097 }, {  533977,  839, 223483, 2126 }, {  702711,  840, 222954, 3112 }, {  823914,  828, 224193, 3722 },
+ {  853313,  834, 223774, 3865 }, {  962792,  839, 223436, 4286 }, { 1085140,  832, 223992, 4727 }, { 1138550,  800, 223711, 4934 },
+ { 1173820,  850, 223203, 5070 }, { 1268148,  809, 223093, 5436 }, { 1451865,  816, 222928, 6198 }, { 1754534,  826, 224119, 7695 },
+ { 1848817,  854, 223253, 8109 }, { 1942524,  811, 223059, 8490 }, { 2021123,  826, 223745, 8808 }, {  118091,  834, 225237,  384 },
+ {  178955,  800, 225592,  586 }, {  204203,  860, 224770,  668 }, {  256920,  824, 224763,  861 }, {  451094,  841, 225618, 1647 },
+ {  491158,  815, 224504, 1857 }, {  851402,  817, 225712, 3859 }, {  918149,  812, 224654, 4108 }, {  994480,  802, 224760, 4391 },
+ { 1017730,  846, 224784, 4481 }, { 1175391,  866, 225350, 5074 }, { 1175539,  904, 225326, 5075 }, { 1488767,  810, 225153, 6360 },
+ { 1689035,  852, 224848, 7361 }, { 1751032,  857, 225203, 7682 }, { 1819410,  845, 224340, 7993 }, { 1854975,  839, 224867, 8133 },
+ { 1963646,  829, 224403, 8568 }, { 2021353,  821, 224603, 8811 }, { 2071443,  856, 225030, 8989 }, { 2080622,  841, 225555, 9017 },
+ {  181562,  852, 225886,  598 }, {  287669,  836, 226694,  967 }, {  359210,  817, 226494, 1248 }, {  859825,  831, 226599, 3885 },
+ {  917365,  832, 226647, 4106 }, {  944932,  839, 225928, 4215 }, { 1316492,  813, 227075, 5629 }, { 1480269,  841, 225792, 6319 },
+ { 1618370,  859, 226370, 6979 }, { 1625615,  806, 226447, 7013 }, { 1674464,  825, 227160, 7290 }, { 1910187,  837, 226831, 8361 },
+ {    5629,  829, 228229, 9099 }, {   45761,  818, 227948,  121 }, {   50120,  848, 228284,  137 }, {  132341,  814, 227334,  428 },
+ {  195858,  807, 227955,  640 }, {  441043,  819, 228390, 1594 }, {  491185,  826, 228205, 1853 }, {  520768,  825, 227331, 2041 },
+ {  651617,  847, 227675, 2809 }, {  770155,  820, 228223, 3470 }, { 1918289,  843, 227419, 8384 }, {  939447,  800, 229247, 4195 },
+ {  975270,  806, 228954, 4330 }, {  991628,  821, 228794, 4383 }, { 1326354,  817, 229786, 5672 }, { 1416187,  821, 228858, 6069 },
+ { 1521896,  843, 229094, 6518 }, {   82906,  837, 231234,  261 }, {  337433,  832, 230843, 1166 }, {  368254,  832, 230835, 1282 },
+ {  513985,  820, 230791, 1994 }, {  978938,  840, 230500, 4340 }, { 1159953,  820, 230699, 5018 }, { 1210212,  840, 230563, 5227 },
+ { 1226023,  834, 231092, 5282 }, { 1332369,  851, 231481, 5693 }, { 1424544,  841, 230912, 6101 }, { 1728322,  834, 230743, 7563 },
+ { 1754746,  828, 230144, 7704 }, { 1848892,  933, 230818, 8113 }, { 1993768,  819, 230935, 8687 }, {   67939,  833, 232034,  200 },
+ {  246015,  818, 232484,  815 }, {  450905,  841, 232492, 1636 }, {  746950,  831, 232027, 3332 }, { 1484089,  840, 231832, 6345 },
+ { 1538875,  842, 232392, 6598 }, { 1658610,  852, 232334, 7224 }, { 1812510,  841, 232656, 7967 }, { 1970519,  860, 232891, 8595 },
+ {   48528,  842, 234447,  129 }, {   88134,  839, 234449,  278 }, {  124919,  849, 234444,  398 }, {  423227,  837, 234388, 1510 },
+ {  620208,  850, 234083, 2617 }, { 1635735,  844, 234171, 7082 }, { 1705397,  807, 234458, 7450 }, { 1745731,  833, 233551, 7666 },
+ { 1903481,  829, 233237, 8342 }, { 1970862,  834, 233561, 8598 }, {  110977,  983, 235557,  365 }, {  306308,  832, 235731, 1032 },
+ {  344433,  834, 235670, 1196 }, {  632012,  835, 235663, 2681 }, {  806898,  855, 235428, 3633 }, {  899799,  866, 234562, 4021 },
+ { 1087028,  824, 235827, 4740 }, {  369548,  803, 236114, 1281 }, { 1071426,  829, 236732, 4665 }, { 1155666,  859, 237093, 5003 },
+ { 1443930,  830, 236821, 6180 }, { 1791334,  827, 236704, 7868 }, { 1937325,  837, 236091, 8473 }, {  179386,  823, 238625,  579 },
+ {  313418,  857, 237891, 1055 }, {  443048,  866, 238498, 1587 }, {  579506,  824, 238399, 2365 }, {  756883,  815, 238303, 3379 },
+ {  841682,  842, 237503, 3806 }, {  900054,  840, 237493, 4016 }, { 1142989,  831, 237423, 4950 }, { 1480065,  830, 237572, 6335 },
+ { 1941150,  808, 237833, 8493 }, {  141813,  858, 239280,  449 }, {  194210,  829, 238883,  626 }, {  440307,  806, 239234, 1572 },
+ {  752661,  831, 239896, 3352 }, {  815457,  850, 238866, 3666 }, {  839026,  846, 239305, 3774 }, { 1062831,  835, 239806, 4627 },
+ { 1233446,  845, 239707, 5305 }, { 1919258,  835, 240294, 8395 }, {  319544,  827, 241376, 1080 }, {  420651,  806, 241669, 1491 },
+ {  494765,  817, 240363, 1844 }, {  531795,  840, 241152, 2078 }, {  827006,  829, 240442, 3719 }, { 1134193,  801, 240987, 4927 },
+ { 1416359,  839, 240605, 6082 }, { 1487915,  821, 240732, 6379 }, { 1564771,  836, 240547, 6735 }, { 1650857,  822, 241446, 7199 },
+ { 1827345,  805, 241647, 8043 }, { 2034988,  838, 240734, 8867 }, { 2086111,  839, 241092, 9038 }, {   23641,  835, 243140,   55 },
+ {  119400,  838, 242103,  381 }, {  416525,  849, 242645, 1468 }, {  458160,  837, 242444, 1650 }, { 1186512,  857, 242551, 5131 },
+ { 1747059,  820, 242456, 7686 }, { 1949099,  866, 242466, 8525 }, {   45026,  821, 243240,  112 }, {  116982,  831, 244042,  375 },
+ {  179064,  804, 244546,  572 }, {  479765,  856, 244635, 1745 }, {  961117,  820, 244333, 4272 }, { 1442734,  834, 243862, 6191 },
+ { 1657265,  854, 243285, 7247 }, { 2085443,  855, 244084, 9034 }, {  122013,  807, 245725,  386 }, {  852715,  823, 244864, 3843 },
+ { 1453270,  832, 246005, 6238 }, { 1558555,  824, 245114, 6717 }, { 1956888,  876, 245022, 8550 }, {   13598,  801, 247165,   20 },
+ {  111428,  826, 247449,  357 }, {  582950,  854, 246997, 2346 }, {  855318,  817, 246323, 3847 }, { 1272328,  826, 247086, 5479 },
+ { 1639325,  839, 247497, 7160 }, { 1691805,  805, 247002, 7423 }, {  100787,  829, 247597,  312 }, {  662149,  841, 248886, 2797 },
+ {  693645,  856, 247967, 2997 }, {  926283,  852, 248300, 4121 }, { 1049027,  817, 248823, 4586 }, { 1113287,  840, 248485, 4852 },
+ { 1154050,  825, 248267, 5009 }, { 1353221,  858, 248234, 5829 }, { 1572947,  804, 247582, 6809 }, {  188484,  805, 249468,  597 },
+ {  648610,  831, 249412, 2709 }, { 1007565,  815, 249222, 4429 }, { 1064596,  800, 250071, 4639 }, { 1854463,  815, 249373, 8174 },
+ {   57946,  840, 251212,  158 }, {  589100,  865, 250661, 2350 }, {  734802,  832, 251121, 3197 }, { 1919785,  898, 251760, 8423 },
+ {  886297,  837, 253287, 3934 }, { 1608040,  817, 252205, 7025 }, { 1682280,  853, 252624, 7425 }, { 1789936,  819, 252861, 7930 },
+ { 2091999,  859, 252228, 9056 }, {  723658,  849, 253490, 3108 }, {  808792,  833, 253670, 3581 }, {  483219,  851, 256229, 1616 },
+ {  500712,  860, 255835, 1714 }, {  526235,  811, 255128, 1885 }, { 1055084,  827, 255717, 4606 }, { 1073126,  833, 256954, 4683 },
+ {  111010,  825, 257987,  306 }, { 1070914,  828, 258794, 4686 }, {  136664,  846, 260710,  286 }, { 1510163,  838, 260743, 7394 }
+};